@@ -9,7 +9,24 @@ Date:   09\22\2024
 
 #include "orca_aliases.h"
 #include "orca_macros.h"
+#include "orca_simd.h"
 #include "orca_intrinsics.h"
 #include "orca_addons.h"
+#include "orca_arena_track.h"
+#include "orca_bit_set.h"
+#include "orca_frame_arena.h"
+#include "orca_pool.h"
+#include "orca_var_array.h"
+#include "orca_hash_map.h"
+#include "orca_str_intern.h"
+#include "orca_unicode.h"
+#include "orca_format.h"
+#include "orca_parse.h"
+#include "orca_slot_map.h"
+#include "orca_radix_sort.h"
+#include "orca_spatial_grid.h"
+#include "orca_aabb_tree.h"
+#include "orca_ring_buffer.h"
+#include "orca_audio.h"
 
 #endif //  _MY_ORCA_H
@@ -0,0 +1,560 @@
+/*
+File:   orca_aabb_tree.h
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Holds AabbTree_t, a dynamic bounding volume hierarchy over rec for overlap,
+	** point and ray queries on things that are mostly still or move slowly and come
+	** in very different sizes (where SpatialGrid_t has no good cell size). Every
+	** item is a leaf whose stored bounds are fattened by a margin, so small moves
+	** don't touch the tree at all, and bigger ones remove and reinsert just that
+	** leaf. Inserts pick a sibling by surface area cost (perimeter in 2D) and then
+	** rotate nodes on the way back up whenever that shrinks the tree. Nodes live in
+	** one VarArray_t and link to each other by index, with freed nodes kept on a
+	** free list, and queries walk the tree with a fixed size stack so they never allocate
+*/
+
+#ifndef _ORCA_AABB_TREE_H
+#define _ORCA_AABB_TREE_H
+
+#define AABB_TREE_NULL_NODE  UINT32_MAX
+#define AABB_TREE_STACK_SIZE 256 //a tree this deep would need far more leaves than fit in memory, rotations keep it close to balanced
+
+struct AabbTreeNode_t
+{
+	rec bounds; //the leaf's item bounds grown by the margin, or the union of both children
+	rec itemBounds; //leaves only, what queries test against
+	u32 parent; //the next free node while the node is free
+	u32 child1; //AABB_TREE_NULL_NODE for leaves
+	u32 child2;
+	u32 value; //leaves only
+	i32 height; //0 for leaves, -1 for free nodes
+};
+
+struct AabbTreePair_t
+{
+	u32 value1;
+	u32 value2;
+};
+
+struct AabbTree_t
+{
+	OC_Arena_t* arena;
+	r32 margin;
+	VarArray_t nodes; //AabbTreeNode_t, leaf indices double as the handles returned by AabbTreeInsert
+	u32 root;
+	u32 freeNodesHead;
+	u32 numLeaves;
+};
+
+// +--------------------------------------------------------------+
+// |                       Create and Free                        |
+// +--------------------------------------------------------------+
+//NOTE: Arena memory can't be given back individually, so this just clears the structure
+void FreeAabbTree(AabbTree_t* tree)
+{
+	NotNull(tree);
+	FreeVarArray(&tree->nodes);
+	ClearPointer(tree);
+}
+//margin is how far an item can move or grow (in any direction) before its leaf has to be reinserted
+void CreateAabbTree(AabbTree_t* treeOut, OC_Arena_t* arena, r32 margin, u32 initialCapacity = 0)
+{
+	NotNull2(treeOut, arena);
+	Assert(margin >= 0.0f);
+	ClearPointer(treeOut);
+	treeOut->arena = arena;
+	treeOut->margin = margin;
+	//A tree with n leaves has n-1 internal nodes
+	CreateVarArrayType(&treeOut->nodes, arena, AabbTreeNode_t, (initialCapacity > 0) ? (initialCapacity * 2) : 0);
+	treeOut->root = AABB_TREE_NULL_NODE;
+	treeOut->freeNodesHead = AABB_TREE_NULL_NODE;
+}
+
+// +--------------------------------------------------------------+
+// |                            Nodes                             |
+// +--------------------------------------------------------------+
+INLINE r32 AabbTreePerimeter(rec bounds) { return 2.0f * (bounds.width + bounds.height); }
+
+//NOTE: Can move the nodes array, so pointers to nodes need to be fetched again afterwards
+u32 AabbTreeAllocNode(AabbTree_t* tree)
+{
+	u32 nodeIndex = tree->freeNodesHead;
+	if (nodeIndex != AABB_TREE_NULL_NODE)
+	{
+		tree->freeNodesHead = ((AabbTreeNode_t*)tree->nodes.items)[nodeIndex].parent;
+	}
+	else
+	{
+		Assert(tree->nodes.length < AABB_TREE_NULL_NODE);
+		nodeIndex = (u32)tree->nodes.length;
+		VarArrayPush(&tree->nodes, AabbTreeNode_t);
+	}
+	AabbTreeNode_t* node = &((AabbTreeNode_t*)tree->nodes.items)[nodeIndex];
+	ClearPointer(node);
+	node->parent = AABB_TREE_NULL_NODE;
+	node->child1 = AABB_TREE_NULL_NODE;
+	node->child2 = AABB_TREE_NULL_NODE;
+	return nodeIndex;
+}
+INLINE void AabbTreeFreeNode(AabbTree_t* tree, u32 nodeIndex)
+{
+	AabbTreeNode_t* node = &((AabbTreeNode_t*)tree->nodes.items)[nodeIndex];
+	node->height = -1;
+	node->parent = tree->freeNodesHead;
+	tree->freeNodesHead = nodeIndex;
+}
+
+//Recalculates an internal node's bounds and height from its children
+INLINE void AabbTreeRefitNode(AabbTreeNode_t* nodes, u32 nodeIndex)
+{
+	AabbTreeNode_t* node = &nodes[nodeIndex];
+	node->bounds = RecUnion(nodes[node->child1].bounds, nodes[node->child2].bounds);
+	node->height = 1 + MaxI32(nodes[node->child1].height, nodes[node->child2].height);
+}
+
+//Puts newChild where oldChild was under parentIndex (or at the root)
+INLINE void AabbTreeReplaceChild(AabbTree_t* tree, AabbTreeNode_t* nodes, u32 parentIndex, u32 oldChild, u32 newChild)
+{
+	nodes[newChild].parent = parentIndex;
+	if (parentIndex == AABB_TREE_NULL_NODE) { tree->root = newChild; }
+	else if (nodes[parentIndex].child1 == oldChild) { nodes[parentIndex].child1 = newChild; }
+	else { DebugAssert(nodes[parentIndex].child2 == oldChild); nodes[parentIndex].child2 = newChild; }
+}
+
+//Trades the places of two nodes in different subtrees (neither can be above the other)
+INLINE void AabbTreeSwapNodes(AabbTree_t* tree, AabbTreeNode_t* nodes, u32 index1, u32 index2)
+{
+	u32 parent1 = nodes[index1].parent;
+	u32 parent2 = nodes[index2].parent;
+	AabbTreeReplaceChild(tree, nodes, parent1, index1, index2);
+	AabbTreeReplaceChild(tree, nodes, parent2, index2, index1);
+}
+
+// +--------------------------------------------------------------+
+// |                          Rotations                           |
+// +--------------------------------------------------------------+
+//Looks at swapping one of nodeIndex's children with a grandchild on the other side, or two grandchildren with each other, and does
+//whichever one shrinks the children's bounds the most (if any do). nodeIndex's own bounds cover the same leaves so they don't change
+void AabbTreeRotate(AabbTree_t* tree, u32 nodeIndex)
+{
+	AabbTreeNode_t* nodes = (AabbTreeNode_t*)tree->nodes.items;
+	AabbTreeNode_t* node = &nodes[nodeIndex];
+	if (node->height < 2) { return; }
+	u32 indexB = node->child1;
+	u32 indexC = node->child2;
+	AabbTreeNode_t* nodeB = &nodes[indexB];
+	AabbTreeNode_t* nodeC = &nodes[indexC];
+
+	//Every swap that's allowed here, with the total perimeter of the nodes it changes
+	u32 swaps1[6];
+	u32 swaps2[6];
+	r32 costs[6];
+	u32 numSwaps = 0;
+	r32 baseCost;
+	if (nodeB->height == 0 || nodeC->height == 0)
+	{
+		//One side is a leaf, it can only trade places with a grandchild on the other side, which changes the other side
+		u32 leafIndex = (nodeB->height == 0) ? indexB : indexC;
+		const AabbTreeNode_t* other = &nodes[(nodeB->height == 0) ? indexC : indexB];
+		rec leafBounds = nodes[leafIndex].bounds;
+		baseCost = AabbTreePerimeter(other->bounds);
+		swaps1[numSwaps] = leafIndex; swaps2[numSwaps] = other->child1; costs[numSwaps] = AabbTreePerimeter(RecUnion(leafBounds, nodes[other->child2].bounds)); numSwaps++;
+		swaps1[numSwaps] = leafIndex; swaps2[numSwaps] = other->child2; costs[numSwaps] = AabbTreePerimeter(RecUnion(leafBounds, nodes[other->child1].bounds)); numSwaps++;
+	}
+	else
+	{
+		u32 indexD = nodeB->child1, indexE = nodeB->child2;
+		u32 indexF = nodeC->child1, indexG = nodeC->child2;
+		rec boundsB = nodeB->bounds, boundsC = nodeC->bounds;
+		rec boundsD = nodes[indexD].bounds, boundsE = nodes[indexE].bounds;
+		rec boundsF = nodes[indexF].bounds, boundsG = nodes[indexG].bounds;
+		r32 areaB = AabbTreePerimeter(boundsB);
+		r32 areaC = AabbTreePerimeter(boundsC);
+		baseCost = areaB + areaC;
+		//B <-> F and B <-> G only change C, C <-> D and C <-> E only change B, D <-> F and D <-> G change both
+		swaps1[numSwaps] = indexB; swaps2[numSwaps] = indexF; costs[numSwaps] = areaB + AabbTreePerimeter(RecUnion(boundsB, boundsG)); numSwaps++;
+		swaps1[numSwaps] = indexB; swaps2[numSwaps] = indexG; costs[numSwaps] = areaB + AabbTreePerimeter(RecUnion(boundsB, boundsF)); numSwaps++;
+		swaps1[numSwaps] = indexC; swaps2[numSwaps] = indexD; costs[numSwaps] = areaC + AabbTreePerimeter(RecUnion(boundsC, boundsE)); numSwaps++;
+		swaps1[numSwaps] = indexC; swaps2[numSwaps] = indexE; costs[numSwaps] = areaC + AabbTreePerimeter(RecUnion(boundsC, boundsD)); numSwaps++;
+		swaps1[numSwaps] = indexD; swaps2[numSwaps] = indexF; costs[numSwaps] = AabbTreePerimeter(RecUnion(boundsF, boundsE)) + AabbTreePerimeter(RecUnion(boundsD, boundsG)); numSwaps++;
+		swaps1[numSwaps] = indexD; swaps2[numSwaps] = indexG; costs[numSwaps] = AabbTreePerimeter(RecUnion(boundsG, boundsE)) + AabbTreePerimeter(RecUnion(boundsF, boundsD)); numSwaps++;
+	}
+
+	u32 bestSwap = numSwaps;
+	r32 bestCost = baseCost;
+	for (u32 sIndex = 0; sIndex < numSwaps; sIndex++)
+	{
+		if (costs[sIndex] < bestCost) { bestCost = costs[sIndex]; bestSwap = sIndex; }
+	}
+	if (bestSwap == numSwaps)
+	{
+		//Nothing shrinks the bounds, but if a swap ties (lots of items with the same bounds) and lifts the tall side of a lopsided
+		//node, take it. Otherwise identical items end up in a chain as deep as the number of items
+		i32 heightB = nodeB->height;
+		i32 heightC = nodeC->height;
+		if (heightB <= heightC + 1 && heightC <= heightB + 1) { return; }
+		u32 shortIndex = (heightB < heightC) ? indexB : indexC;
+		const AabbTreeNode_t* tallNode = (heightB < heightC) ? nodeC : nodeB;
+		u32 tallestGrandchild = (nodes[tallNode->child1].height >= nodes[tallNode->child2].height) ? tallNode->child1 : tallNode->child2;
+		for (u32 sIndex = 0; sIndex < numSwaps; sIndex++)
+		{
+			if (swaps1[sIndex] == shortIndex && swaps2[sIndex] == tallestGrandchild && costs[sIndex] <= baseCost) { bestSwap = sIndex; }
+		}
+		if (bestSwap == numSwaps) { return; }
+	}
+
+	//Subtrees that moved are unchanged inside, only B and C (if they are still children here) have different children now
+	AabbTreeSwapNodes(tree, nodes, swaps1[bestSwap], swaps2[bestSwap]);
+	if (nodes[indexB].height > 0 && nodes[indexB].parent == nodeIndex) { AabbTreeRefitNode(nodes, indexB); }
+	if (nodes[indexC].height > 0 && nodes[indexC].parent == nodeIndex) { AabbTreeRefitNode(nodes, indexC); }
+	AabbTreeRefitNode(nodes, nodeIndex);
+}
+
+// +--------------------------------------------------------------+
+// |                     Insert and Remove                        |
+// +--------------------------------------------------------------+
+//Refits and rotates every node from nodeIndex up to the root
+INLINE void AabbTreeRefitUpwards(AabbTree_t* tree, u32 nodeIndex)
+{
+	while (nodeIndex != AABB_TREE_NULL_NODE)
+	{
+		AabbTreeRefitNode((AabbTreeNode_t*)tree->nodes.items, nodeIndex);
+		AabbTreeRotate(tree, nodeIndex);
+		nodeIndex = ((AabbTreeNode_t*)tree->nodes.items)[nodeIndex].parent;
+	}
+}
+
+//Walks down from the root towards whichever child would grow the least, stopping when pairing the leaf with the current node is cheaper
+u32 AabbTreeFindBestSibling(const AabbTree_t* tree, rec leafBounds)
+{
+	const AabbTreeNode_t* nodes = (const AabbTreeNode_t*)tree->nodes.items;
+	u32 nodeIndex = tree->root;
+	while (nodes[nodeIndex].height > 0)
+	{
+		const AabbTreeNode_t* node = &nodes[nodeIndex];
+		r32 area = AabbTreePerimeter(node->bounds);
+		r32 combinedArea = AabbTreePerimeter(RecUnion(node->bounds, leafBounds));
+		//Cost of a new parent holding this node and the leaf, and the least it costs to go further down (every ancestor grows either way)
+		r32 cost = 2.0f * combinedArea;
+		r32 inheritanceCost = 2.0f * (combinedArea - area);
+		const AabbTreeNode_t* child1 = &nodes[node->child1];
+		const AabbTreeNode_t* child2 = &nodes[node->child2];
+		r32 cost1 = AabbTreePerimeter(RecUnion(child1->bounds, leafBounds)) - ((child1->height > 0) ? AabbTreePerimeter(child1->bounds) : 0.0f) + inheritanceCost;
+		r32 cost2 = AabbTreePerimeter(RecUnion(child2->bounds, leafBounds)) - ((child2->height > 0) ? AabbTreePerimeter(child2->bounds) : 0.0f) + inheritanceCost;
+		if (cost < cost1 && cost < cost2) { break; }
+		//Ties (lots of items with the same bounds) go to the shorter side, otherwise they'd all pile up down one path
+		bool takeChild1 = (cost1 < cost2 || (cost1 == cost2 && child1->height <= child2->height));
+		nodeIndex = takeChild1 ? node->child1 : node->child2;
+	}
+	return nodeIndex;
+}
+
+void AabbTreeInsertLeaf(AabbTree_t* tree, u32 leafIndex)
+{
+	if (tree->root == AABB_TREE_NULL_NODE)
+	{
+		tree->root = leafIndex;
+		((AabbTreeNode_t*)tree->nodes.items)[leafIndex].parent = AABB_TREE_NULL_NODE;
+		return;
+	}
+	u32 siblingIndex = AabbTreeFindBestSibling(tree, ((AabbTreeNode_t*)tree->nodes.items)[leafIndex].bounds);
+	u32 parentIndex = AabbTreeAllocNode(tree);
+	AabbTreeNode_t* nodes = (AabbTreeNode_t*)tree->nodes.items;
+	AabbTreeReplaceChild(tree, nodes, nodes[siblingIndex].parent, siblingIndex, parentIndex);
+	nodes[parentIndex].child1 = siblingIndex;
+	nodes[parentIndex].child2 = leafIndex;
+	nodes[siblingIndex].parent = parentIndex;
+	nodes[leafIndex].parent = parentIndex;
+	AabbTreeRefitUpwards(tree, parentIndex);
+}
+
+//Takes the leaf out of the tree, its parent goes away and its sibling takes the parent's place
+void AabbTreeRemoveLeaf(AabbTree_t* tree, u32 leafIndex)
+{
+	AabbTreeNode_t* nodes = (AabbTreeNode_t*)tree->nodes.items;
+	if (leafIndex == tree->root) { tree->root = AABB_TREE_NULL_NODE; return; }
+	u32 parentIndex = nodes[leafIndex].parent;
+	u32 grandparentIndex = nodes[parentIndex].parent;
+	u32 siblingIndex = (nodes[parentIndex].child1 == leafIndex) ? nodes[parentIndex].child2 : nodes[parentIndex].child1;
+	AabbTreeReplaceChild(tree, nodes, grandparentIndex, parentIndex, siblingIndex);
+	AabbTreeFreeNode(tree, parentIndex);
+	AabbTreeRefitUpwards(tree, grandparentIndex);
+}
+
+//value is what queries hand back for this item. Returns a handle for AabbTreeRemove/Move, which stays the same until the item is removed
+u32 AabbTreeInsert(AabbTree_t* tree, rec bounds, u32 value)
+{
+	NotNull(tree);
+	Assert(bounds.width >= 0.0f && bounds.height >= 0.0f);
+	u32 leafIndex = AabbTreeAllocNode(tree);
+	AabbTreeNode_t* leaf = &((AabbTreeNode_t*)tree->nodes.items)[leafIndex];
+	leaf->bounds = RecExpand(bounds, tree->margin);
+	leaf->itemBounds = bounds;
+	leaf->value = value;
+	AabbTreeInsertLeaf(tree, leafIndex);
+	tree->numLeaves++;
+	return leafIndex;
+}
+
+void AabbTreeRemove(AabbTree_t* tree, u32 handle)
+{
+	NotNull(tree);
+	Assert(handle < tree->nodes.length && ((AabbTreeNode_t*)tree->nodes.items)[handle].height == 0);
+	AabbTreeRemoveLeaf(tree, handle);
+	AabbTreeFreeNode(tree, handle);
+	tree->numLeaves--;
+}
+
+//Only touches the tree if the new bounds leave the fattened ones, or have shrunk so much that the fattened ones are mostly empty.
+//Returns true if the leaf had to be reinserted
+bool AabbTreeMove(AabbTree_t* tree, u32 handle, rec newBounds)
+{
+	NotNull(tree);
+	Assert(handle < tree->nodes.length && ((AabbTreeNode_t*)tree->nodes.items)[handle].height == 0);
+	Assert(newBounds.width >= 0.0f && newBounds.height >= 0.0f);
+	AabbTreeNode_t* leaf = &((AabbTreeNode_t*)tree->nodes.items)[handle];
+	leaf->itemBounds = newBounds;
+	if (RecContains(leaf->bounds, newBounds) && RecContains(RecExpand(newBounds, tree->margin * 4), leaf->bounds)) { return false; }
+	AabbTreeRemoveLeaf(tree, handle);
+	leaf = &((AabbTreeNode_t*)tree->nodes.items)[handle];
+	leaf->bounds = RecExpand(newBounds, tree->margin);
+	AabbTreeInsertLeaf(tree, handle);
+	return true;
+}
+
+// +--------------------------------------------------------------+
+// |                            Access                            |
+// +--------------------------------------------------------------+
+INLINE u32 AabbTreeCount(const AabbTree_t* tree) { return tree->numLeaves; }
+INLINE i32 AabbTreeGetHeight(const AabbTree_t* tree) { return (tree->root != AABB_TREE_NULL_NODE) ? ((const AabbTreeNode_t*)tree->nodes.items)[tree->root].height : 0; }
+INLINE u32 AabbTreeGetValue(const AabbTree_t* tree, u32 handle) { DebugAssert(handle < tree->nodes.length); return ((const AabbTreeNode_t*)tree->nodes.items)[handle].value; }
+INLINE rec AabbTreeGetBounds(const AabbTree_t* tree, u32 handle) { DebugAssert(handle < tree->nodes.length); return ((const AabbTreeNode_t*)tree->nodes.items)[handle].itemBounds; }
+INLINE rec AabbTreeGetFatBounds(const AabbTree_t* tree, u32 handle) { DebugAssert(handle < tree->nodes.length); return ((const AabbTreeNode_t*)tree->nodes.items)[handle].bounds; }
+
+// +--------------------------------------------------------------+
+// |                           Queries                            |
+// +--------------------------------------------------------------+
+//Finds every item whose bounds intersect query (see RecIntersects). Returns how many there are, but only writes the first maxValues
+u32 AabbTreeQueryRec(const AabbTree_t* tree, rec query, u32* valuesOut, u32 maxValues)
+{
+	NotNull(tree);
+	Assert(valuesOut != nullptr || maxValues == 0);
+	if (tree->root == AABB_TREE_NULL_NODE) { return 0; }
+	const AabbTreeNode_t* nodes = (const AabbTreeNode_t*)tree->nodes.items;
+	u32 stack[AABB_TREE_STACK_SIZE];
+	u32 stackSize = 0;
+	stack[stackSize++] = tree->root;
+	u32 numFound = 0;
+	while (stackSize > 0)
+	{
+		const AabbTreeNode_t* node = &nodes[stack[--stackSize]];
+		if (!RecIntersects(node->bounds, query)) { continue; }
+		if (node->height == 0)
+		{
+			if (!RecIntersects(node->itemBounds, query)) { continue; }
+			if (numFound < maxValues) { valuesOut[numFound] = node->value; }
+			numFound++;
+		}
+		else
+		{
+			AssertMsg(stackSize + 2 <= AABB_TREE_STACK_SIZE, "AabbTree_t is too deep for the query stack");
+			stack[stackSize++] = node->child1;
+			stack[stackSize++] = node->child2;
+		}
+	}
+	return numFound;
+}
+
+//Finds every item whose bounds contain the point (see RecContains). Returns how many there are, but only writes the first maxValues
+u32 AabbTreeQueryPoint(const AabbTree_t* tree, v2 point, u32* valuesOut, u32 maxValues)
+{
+	NotNull(tree);
+	Assert(valuesOut != nullptr || maxValues == 0);
+	if (tree->root == AABB_TREE_NULL_NODE) { return 0; }
+	const AabbTreeNode_t* nodes = (const AabbTreeNode_t*)tree->nodes.items;
+	u32 stack[AABB_TREE_STACK_SIZE];
+	u32 stackSize = 0;
+	stack[stackSize++] = tree->root;
+	u32 numFound = 0;
+	while (stackSize > 0)
+	{
+		const AabbTreeNode_t* node = &nodes[stack[--stackSize]];
+		if (!RecContains(node->bounds, point)) { continue; }
+		if (node->height == 0)
+		{
+			if (!RecContains(node->itemBounds, point)) { continue; }
+			if (numFound < maxValues) { valuesOut[numFound] = node->value; }
+			numFound++;
+		}
+		else
+		{
+			AssertMsg(stackSize + 2 <= AABB_TREE_STACK_SIZE, "AabbTree_t is too deep for the query stack");
+			stack[stackSize++] = node->child1;
+			stack[stackSize++] = node->child2;
+		}
+	}
+	return numFound;
+}
+
+//Narrows [tMin, tMax] to where origin + direction*t is between slabMin and slabMax on one axis. Returns false if nothing is left
+INLINE bool AabbTreeClipRaySlab(r32 origin, r32 direction, r32 slabMin, r32 slabMax, r32* tMinPntr, r32* tMaxPntr)
+{
+	if (direction == 0.0f) { return (origin >= slabMin && origin <= slabMax); }
+	r32 invDirection = 1.0f / direction;
+	r32 t1 = (slabMin - origin) * invDirection;
+	r32 t2 = (slabMax - origin) * invDirection;
+	*tMinPntr = MaxR32(*tMinPntr, MinR32(t1, t2));
+	*tMaxPntr = MinR32(*tMaxPntr, MaxR32(t1, t2));
+	return (*tMinPntr <= *tMaxPntr);
+}
+//Returns true if origin + direction*t is inside bounds (edges included) for some t in [0, maxT], and the first such t in tOut
+INLINE bool AabbTreeRayHitsRec(v2 origin, v2 direction, rec bounds, r32 maxT, r32* tOut)
+{
+	r32 tMin = 0.0f;
+	r32 tMax = maxT;
+	if (!AabbTreeClipRaySlab(origin.x, direction.x, bounds.x, bounds.x + bounds.width, &tMin, &tMax)) { return false; }
+	if (!AabbTreeClipRaySlab(origin.y, direction.y, bounds.y, bounds.y + bounds.height, &tMin, &tMax)) { return false; }
+	*tOut = tMin;
+	return true;
+}
+
+//Finds the first item the ray origin + direction*t hits for t in [0, maxT] (t is in units of direction's length, so pass a
+//normalized direction to get distances). Items the ray starts inside of are hit at t = 0. Returns false if nothing was hit
+bool AabbTreeRaycast(const AabbTree_t* tree, v2 origin, v2 direction, r32 maxT, u32* valueOut = nullptr, r32* tOut = nullptr)
+{
+	NotNull(tree);
+	if (tree->root == AABB_TREE_NULL_NODE) { return false; }
+	const AabbTreeNode_t* nodes = (const AabbTreeNode_t*)tree->nodes.items;
+	u32 stack[AABB_TREE_STACK_SIZE];
+	u32 stackSize = 0;
+	stack[stackSize++] = tree->root;
+	bool foundHit = false;
+	u32 bestValue = 0;
+	r32 bestT = maxT; //anything further than the best hit so far can be skipped
+	while (stackSize > 0)
+	{
+		const AabbTreeNode_t* node = &nodes[stack[--stackSize]];
+		r32 hitT;
+		if (!AabbTreeRayHitsRec(origin, direction, node->bounds, bestT, &hitT)) { continue; }
+		if (node->height == 0)
+		{
+			if (!AabbTreeRayHitsRec(origin, direction, node->itemBounds, bestT, &hitT)) { continue; }
+			if (!foundHit || hitT < bestT)
+			{
+				foundHit = true;
+				bestT = hitT;
+				bestValue = node->value;
+			}
+		}
+		else
+		{
+			AssertMsg(stackSize + 2 <= AABB_TREE_STACK_SIZE, "AabbTree_t is too deep for the query stack");
+			stack[stackSize++] = node->child1;
+			stack[stackSize++] = node->child2;
+		}
+	}
+	if (foundHit)
+	{
+		SetOptionalOutPntr(valueOut, bestValue);
+		SetOptionalOutPntr(tOut, bestT);
+	}
+	return foundHit;
+}
+
+//Finds every pair of items whose bounds intersect each other (see RecIntersects), each pair once in no particular order.
+//Walks the tree against itself so whole subtrees that don't touch are skipped together. Returns how many pairs there are, but only writes the first maxPairs
+u32 AabbTreeFindPairs(const AabbTree_t* tree, AabbTreePair_t* pairsOut, u32 maxPairs)
+{
+	NotNull(tree);
+	Assert(pairsOut != nullptr || maxPairs == 0);
+	if (tree->root == AABB_TREE_NULL_NODE) { return 0; }
+	const AabbTreeNode_t* nodes = (const AabbTreeNode_t*)tree->nodes.items;
+	//Each stack item is a pair of subtrees to check against each other, or a subtree against itself when both are the same
+	u32 stack1[AABB_TREE_STACK_SIZE];
+	u32 stack2[AABB_TREE_STACK_SIZE];
+	u32 stackSize = 0;
+	stack1[stackSize] = tree->root; stack2[stackSize] = tree->root; stackSize++;
+	u32 numFound = 0;
+	while (stackSize > 0)
+	{
+		stackSize--;
+		u32 index1 = stack1[stackSize];
+		u32 index2 = stack2[stackSize];
+		const AabbTreeNode_t* node1 = &nodes[index1];
+		const AabbTreeNode_t* node2 = &nodes[index2];
+		if (index1 == index2)
+		{
+			if (node1->height == 0) { continue; }
+			AssertMsg(stackSize + 3 <= AABB_TREE_STACK_SIZE, "AabbTree_t is too deep for the query stack");
+			stack1[stackSize] = node1->child1; stack2[stackSize] = node1->child1; stackSize++;
+			stack1[stackSize] = node1->child2; stack2[stackSize] = node1->child2; stackSize++;
+			stack1[stackSize] = node1->child1; stack2[stackSize] = node1->child2; stackSize++;
+			continue;
+		}
+		if (!RecIntersects(node1->bounds, node2->bounds)) { continue; }
+		if (node1->height == 0 && node2->height == 0)
+		{
+			if (!RecIntersects(node1->itemBounds, node2->itemBounds)) { continue; }
+			if (numFound < maxPairs) { pairsOut[numFound].value1 = node1->value; pairsOut[numFound].value2 = node2->value; }
+			numFound++;
+			continue;
+		}
+		AssertMsg(stackSize + 2 <= AABB_TREE_STACK_SIZE, "AabbTree_t is too deep for the query stack");
+		//Split whichever side is bigger so the two halves being compared stay similar in size
+		if (node2->height == 0 || (node1->height > 0 && AabbTreePerimeter(node1->bounds) >= AabbTreePerimeter(node2->bounds)))
+		{
+			stack1[stackSize] = node1->child1; stack2[stackSize] = index2; stackSize++;
+			stack1[stackSize] = node1->child2; stack2[stackSize] = index2; stackSize++;
+		}
+		else
+		{
+			stack1[stackSize] = index1; stack2[stackSize] = node2->child1; stackSize++;
+			stack1[stackSize] = index1; stack2[stackSize] = node2->child2; stackSize++;
+		}
+	}
+	return numFound;
+}
+
+#endif //  _ORCA_AABB_TREE_H
+
+// +--------------------------------------------------------------+
+// |                   Autocomplete Dictionary                    |
+// +--------------------------------------------------------------+
+/*
+@Defines
+AABB_TREE_NULL_NODE
+AABB_TREE_STACK_SIZE
+@Types
+AabbTreeNode_t
+AabbTreePair_t
+AabbTree_t
+@Functions
+void FreeAabbTree(AabbTree_t* tree)
+void CreateAabbTree(AabbTree_t* treeOut, OC_Arena_t* arena, r32 margin, u32 initialCapacity = 0)
+INLINE r32 AabbTreePerimeter(rec bounds)
+u32 AabbTreeAllocNode(AabbTree_t* tree)
+INLINE void AabbTreeFreeNode(AabbTree_t* tree, u32 nodeIndex)
+INLINE void AabbTreeRefitNode(AabbTreeNode_t* nodes, u32 nodeIndex)
+INLINE void AabbTreeReplaceChild(AabbTree_t* tree, AabbTreeNode_t* nodes, u32 parentIndex, u32 oldChild, u32 newChild)
+INLINE void AabbTreeSwapNodes(AabbTree_t* tree, AabbTreeNode_t* nodes, u32 index1, u32 index2)
+void AabbTreeRotate(AabbTree_t* tree, u32 nodeIndex)
+INLINE void AabbTreeRefitUpwards(AabbTree_t* tree, u32 nodeIndex)
+u32 AabbTreeFindBestSibling(const AabbTree_t* tree, rec leafBounds)
+void AabbTreeInsertLeaf(AabbTree_t* tree, u32 leafIndex)
+void AabbTreeRemoveLeaf(AabbTree_t* tree, u32 leafIndex)
+u32 AabbTreeInsert(AabbTree_t* tree, rec bounds, u32 value)
+void AabbTreeRemove(AabbTree_t* tree, u32 handle)
+bool AabbTreeMove(AabbTree_t* tree, u32 handle, rec newBounds)
+INLINE u32 AabbTreeCount(const AabbTree_t* tree)
+INLINE i32 AabbTreeGetHeight(const AabbTree_t* tree)
+INLINE u32 AabbTreeGetValue(const AabbTree_t* tree, u32 handle)
+INLINE rec AabbTreeGetBounds(const AabbTree_t* tree, u32 handle)
+INLINE rec AabbTreeGetFatBounds(const AabbTree_t* tree, u32 handle)
+u32 AabbTreeQueryRec(const AabbTree_t* tree, rec query, u32* valuesOut, u32 maxValues)
+u32 AabbTreeQueryPoint(const AabbTree_t* tree, v2 point, u32* valuesOut, u32 maxValues)
+INLINE bool AabbTreeClipRaySlab(r32 origin, r32 direction, r32 slabMin, r32 slabMax, r32* tMinPntr, r32* tMaxPntr)
+INLINE bool AabbTreeRayHitsRec(v2 origin, v2 direction, rec bounds, r32 maxT, r32* tOut)
+bool AabbTreeRaycast(const AabbTree_t* tree, v2 origin, v2 direction, r32 maxT, u32* valueOut = nullptr, r32* tOut = nullptr)
+u32 AabbTreeFindPairs(const AabbTree_t* tree, AabbTreePair_t* pairsOut, u32 maxPairs)
+*/
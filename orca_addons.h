@@ -69,6 +69,12 @@ Description:
 #define Rec_Default        NewRec(0.0f, 0.0f, 1.0f, 1.0f)
 #define Rec_Default_Const  { 0.0f, 0.0f, 1.0f, 1.0f }
 
+#define Mat23_Identity       NewMat23(1.0f, 0.0f, 0.0f,   0.0f, 1.0f, 0.0f)
+#define Mat23_Identity_Const { 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f }
+#define Mat3_Identity        NewMat3(1.0f, 0.0f, 0.0f,   0.0f, 1.0f, 0.0f,   0.0f, 0.0f, 1.0f)
+#define Mat4_Identity        NewMat4(1.0f, 0.0f, 0.0f, 0.0f,   0.0f, 1.0f, 0.0f, 0.0f,   0.0f, 0.0f, 1.0f, 0.0f,   0.0f, 0.0f, 0.0f, 1.0f)
+#define Quat_Identity        NewQuat(0.0f, 0.0f, 0.0f, 1.0f)
+
 // +--------------------------------------------------------------+
 // |                 Vector / Rectangle Functions                 |
 // +--------------------------------------------------------------+
@@ -236,6 +242,118 @@ INLINE rec RecScale(rec rectangle, r32 scalar)
 //TODO: RecScale2/
 //TODO: RecBasicallyEqual?
 
+// +==============================+
+// |   Dot, Cross, and Length     |
+// +==============================+
+INLINE r32 Vec2Dot(v2 left, v2 right) { return left.x * right.x + left.y * right.y; }
+INLINE r32 Vec3Dot(v3 left, v3 right) { return left.x * right.x + left.y * right.y + left.z * right.z; }
+INLINE r32 Vec4Dot(v4 left, v4 right) { return left.x * right.x + left.y * right.y + left.z * right.z + left.w * right.w; }
+INLINE v3 Vec3Cross(v3 left, v3 right)
+{
+	v3 result;
+	result.x = left.y * right.z - left.z * right.y;
+	result.y = left.z * right.x - left.x * right.z;
+	result.z = left.x * right.y - left.y * right.x;
+	return result;
+}
+INLINE r32 Vec2Length(v2 vector) { return SqrtR32(Vec2Dot(vector, vector)); }
+INLINE r32 Vec3Length(v3 vector) { return SqrtR32(Vec3Dot(vector, vector)); }
+//Zero length vectors are returned unchanged
+INLINE v2 Vec2Normalize(v2 vector)
+{
+	r32 length = Vec2Length(vector);
+	return (length > 0.0f) ? Vec2Scale(vector, 1.0f / length) : vector;
+}
+INLINE v3 Vec3Normalize(v3 vector)
+{
+	r32 length = Vec3Length(vector);
+	return (length > 0.0f) ? Vec3Scale(vector, 1.0f / length) : vector;
+}
+
+// +==============================+
+// |     Rectangle Functions      |
+// +==============================+
+//NOTE: Rectangles are half-open, a rectangle covers [x, x+width) and [y, y+height). So rectangles that only share an edge do not intersect
+INLINE bool RecIntersects(rec left, rec right)
+{
+	return (left.x < right.x + right.width && right.x < left.x + left.width &&
+		left.y < right.y + right.height && right.y < left.y + left.height);
+}
+//Returns the intersection of the two rectangles. If they don't intersect the result has 0 width and/or height
+INLINE rec RecOverlap(rec left, rec right)
+{
+	r32 minX = MaxR32(left.x, right.x);
+	r32 minY = MaxR32(left.y, right.y);
+	r32 maxX = MinR32(left.x + left.width, right.x + right.width);
+	r32 maxY = MinR32(left.y + left.height, right.y + right.height);
+	return NewRec(minX, minY, MaxR32(maxX - minX, 0.0f), MaxR32(maxY - minY, 0.0f));
+}
+INLINE bool RecContains(rec rectangle, v2 point)
+{
+	return (point.x >= rectangle.x && point.x < rectangle.x + rectangle.width &&
+		point.y >= rectangle.y && point.y < rectangle.y + rectangle.height);
+}
+//True if inner lies completely inside of outer (sharing edges is allowed)
+INLINE bool RecContains(rec outer, rec inner)
+{
+	return (inner.x >= outer.x && inner.x + inner.width <= outer.x + outer.width &&
+		inner.y >= outer.y && inner.y + inner.height <= outer.y + outer.height);
+}
+//Smallest rectangle that contains both rectangles
+INLINE rec RecUnion(rec left, rec right)
+{
+	r32 minX = MinR32(left.x, right.x);
+	r32 minY = MinR32(left.y, right.y);
+	r32 maxX = MaxR32(left.x + left.width, right.x + right.width);
+	r32 maxY = MaxR32(left.y + left.height, right.y + right.height);
+	return NewRec(minX, minY, maxX - minX, maxY - minY);
+}
+//Grows the rectangle by amount on every side (negative amounts shrink it)
+INLINE rec RecExpand(rec rectangle, v2 amount)
+{
+	return NewRec(rectangle.x - amount.x, rectangle.y - amount.y, rectangle.width + amount.x*2, rectangle.height + amount.y*2);
+}
+INLINE rec RecExpand(rec rectangle, r32 amount) { return RecExpand(rectangle, NewVec2(amount, amount)); }
+
+//Writes the index of every item that intersects clip (see RecIntersects) into visibleIndicesOut and returns how many were written.
+//visibleIndicesOut must have room for count indices. Use OC_ClipTop() as the clip to skip items that are off screen before drawing them.
+//NOTE: count comes first, same as every other *Array function in this file (Vec2AddArray, Mat23TransformPoints, etc.)
+u32 RecCullArray(u32 count, const rec* items, rec clip, u32* visibleIndicesOut)
+{
+	if (count > 0) { NotNull2(items, visibleIndicesOut); }
+	u32 numVisible = 0;
+	u32 iIndex = 0;
+	#if ORCA_SIMD_ENABLED
+	simd4f clipLeft = Simd4fFill(clip.x);
+	simd4f clipTop = Simd4fFill(clip.y);
+	simd4f clipRight = Simd4fFill(clip.x + clip.width);
+	simd4f clipBottom = Simd4fFill(clip.y + clip.height);
+	const r32* itemValues = (const r32*)items;
+	for (; iIndex + 4 <= count; iIndex += 4)
+	{
+		//Load 4 rectangles and transpose them to (x0..x3), (y0..y3), (w0..w3), (h0..h3)
+		simd4f xs = Simd4fLoad(&itemValues[iIndex*4 + 0]);
+		simd4f ys = Simd4fLoad(&itemValues[iIndex*4 + 4]);
+		simd4f widths = Simd4fLoad(&itemValues[iIndex*4 + 8]);
+		simd4f heights = Simd4fLoad(&itemValues[iIndex*4 + 12]);
+		Simd4fTranspose(&xs, &ys, &widths, &heights);
+		simd4i visibleX = Simd4iAnd(Simd4fLessThan(xs, clipRight), Simd4fLessThan(clipLeft, Simd4fAdd(xs, widths)));
+		simd4i visibleY = Simd4iAnd(Simd4fLessThan(ys, clipBottom), Simd4fLessThan(clipTop, Simd4fAdd(ys, heights)));
+		u32 visibleBits = Simd4iMoveMask(Simd4iAnd(visibleX, visibleY));
+		//Branchless compaction: every lane writes its index but only visible lanes advance the output position
+		visibleIndicesOut[numVisible] = iIndex + 0; numVisible += ((visibleBits >> 0) & 1);
+		visibleIndicesOut[numVisible] = iIndex + 1; numVisible += ((visibleBits >> 1) & 1);
+		visibleIndicesOut[numVisible] = iIndex + 2; numVisible += ((visibleBits >> 2) & 1);
+		visibleIndicesOut[numVisible] = iIndex + 3; numVisible += ((visibleBits >> 3) & 1);
+	}
+	#endif
+	for (; iIndex < count; iIndex++)
+	{
+		if (RecIntersects(items[iIndex], clip)) { visibleIndicesOut[numVisible] = iIndex; numVisible++; }
+	}
+	return numVisible;
+}
+
 // +==============================+
 // |      Operator Overloads      |
 // +==============================+
@@ -300,15 +418,901 @@ INLINE rec operator / (rec rectangle, r32 scale)          { return RecScale(rect
 INLINE void operator += (rec& leftSide, const v2& vector) { leftSide.topLeft += vector; }
 INLINE void operator -= (rec& leftSide, const v2& vector) { leftSide.topLeft -= vector; }
 
+// +--------------------------------------------------------------+
+// |                   Vector Array Functions                     |
+// +--------------------------------------------------------------+
+//NOTE: These operate on packed arrays of vectors (v2* etc.) 4 floats at a time using orca_simd.h
+//      resultsOut may be the same array as an input (in-place) but arrays must not partially overlap
+// +==============================+
+// |        v2 Array (AoS)        |
+// +==============================+
+void Vec2AddArray(u32 count, const v2* left, const v2* right, v2* resultsOut)
+{
+	AddArrayR32(count*2, (const r32*)left, (const r32*)right, (r32*)resultsOut);
+}
+void Vec2SubtractArray(u32 count, const v2* left, const v2* right, v2* resultsOut)
+{
+	SubtractArrayR32(count*2, (const r32*)left, (const r32*)right, (r32*)resultsOut);
+}
+void Vec2ScaleArray(u32 count, const v2* vectors, r32 scalar, v2* resultsOut)
+{
+	ScaleArrayR32(count*2, (const r32*)vectors, scalar, (r32*)resultsOut);
+}
+//resultsOut[i] = base[i] + (vectors[i] * scalar) (Ex: positions += velocities * timeScale)
+void Vec2AddScaledArray(u32 count, const v2* base, const v2* vectors, r32 scalar, v2* resultsOut)
+{
+	AddScaledArrayR32(count*2, (const r32*)base, (const r32*)vectors, scalar, (r32*)resultsOut);
+}
+void Vec2ShiftArray(u32 count, const v2* vectors, v2 amount, v2* resultsOut)
+{
+	r32 pattern[4] = { amount.x, amount.y, amount.x, amount.y };
+	AddPatternArrayR32(count*2, (const r32*)vectors, pattern, (r32*)resultsOut);
+}
+
+// +==============================+
+// |        v3 Array (AoS)        |
+// +==============================+
+void Vec3AddArray(u32 count, const v3* left, const v3* right, v3* resultsOut)
+{
+	AddArrayR32(count*3, (const r32*)left, (const r32*)right, (r32*)resultsOut);
+}
+void Vec3SubtractArray(u32 count, const v3* left, const v3* right, v3* resultsOut)
+{
+	SubtractArrayR32(count*3, (const r32*)left, (const r32*)right, (r32*)resultsOut);
+}
+void Vec3ScaleArray(u32 count, const v3* vectors, r32 scalar, v3* resultsOut)
+{
+	ScaleArrayR32(count*3, (const r32*)vectors, scalar, (r32*)resultsOut);
+}
+void Vec3AddScaledArray(u32 count, const v3* base, const v3* vectors, r32 scalar, v3* resultsOut)
+{
+	AddScaledArrayR32(count*3, (const r32*)base, (const r32*)vectors, scalar, (r32*)resultsOut);
+}
+//v3 repeats every 12 floats so we walk 4 vectors (3 registers) per iteration
+void Vec3ShiftArray(u32 count, const v3* vectors, v3 amount, v3* resultsOut)
+{
+	simd4f pattern0 = NewSimd4f(amount.x, amount.y, amount.z, amount.x);
+	simd4f pattern1 = NewSimd4f(amount.y, amount.z, amount.x, amount.y);
+	simd4f pattern2 = NewSimd4f(amount.z, amount.x, amount.y, amount.z);
+	const r32* inPntr = (const r32*)vectors;
+	r32* outPntr = (r32*)resultsOut;
+	u32 vIndex = 0;
+	for (; vIndex + 4 <= count; vIndex += 4)
+	{
+		u32 fIndex = vIndex*3;
+		Simd4fStore(&outPntr[fIndex + 0], Simd4fAdd(Simd4fLoad(&inPntr[fIndex + 0]), pattern0));
+		Simd4fStore(&outPntr[fIndex + 4], Simd4fAdd(Simd4fLoad(&inPntr[fIndex + 4]), pattern1));
+		Simd4fStore(&outPntr[fIndex + 8], Simd4fAdd(Simd4fLoad(&inPntr[fIndex + 8]), pattern2));
+	}
+	for (; vIndex < count; vIndex++) { resultsOut[vIndex] = Vec3Add(vectors[vIndex], amount); }
+}
+
+// +==============================+
+// |        v4 Array (AoS)        |
+// +==============================+
+void Vec4AddArray(u32 count, const v4* left, const v4* right, v4* resultsOut)
+{
+	AddArrayR32(count*4, (const r32*)left, (const r32*)right, (r32*)resultsOut);
+}
+void Vec4SubtractArray(u32 count, const v4* left, const v4* right, v4* resultsOut)
+{
+	SubtractArrayR32(count*4, (const r32*)left, (const r32*)right, (r32*)resultsOut);
+}
+void Vec4ScaleArray(u32 count, const v4* vectors, r32 scalar, v4* resultsOut)
+{
+	ScaleArrayR32(count*4, (const r32*)vectors, scalar, (r32*)resultsOut);
+}
+void Vec4AddScaledArray(u32 count, const v4* base, const v4* vectors, r32 scalar, v4* resultsOut)
+{
+	AddScaledArrayR32(count*4, (const r32*)base, (const r32*)vectors, scalar, (r32*)resultsOut);
+}
+void Vec4ShiftArray(u32 count, const v4* vectors, v4 amount, v4* resultsOut)
+{
+	AddPatternArrayR32(count*4, (const r32*)vectors, amount.values, (r32*)resultsOut);
+}
+
+// +==============================+
+// |     Structure of Arrays      |
+// +==============================+
+//NOTE: The SoA forms keep each component in its own array. Every component array must hold at least count values.
+//      This layout is preferable when you need per-vector results (lengths, dots) since no shuffling is required
+struct Vec2Soa_t
+{
+	r32* x;
+	r32* y;
+};
+struct Vec3Soa_t
+{
+	r32* x;
+	r32* y;
+	r32* z;
+};
+
+INLINE Vec2Soa_t NewVec2Soa(r32* x, r32* y)
+{
+	Vec2Soa_t result;
+	result.x = x;
+	result.y = y;
+	return result;
+}
+INLINE Vec3Soa_t NewVec3Soa(r32* x, r32* y, r32* z)
+{
+	Vec3Soa_t result;
+	result.x = x;
+	result.y = y;
+	result.z = z;
+	return result;
+}
+
+void Vec2SoaAdd(u32 count, Vec2Soa_t left, Vec2Soa_t right, Vec2Soa_t resultsOut)
+{
+	AddArrayR32(count, left.x, right.x, resultsOut.x);
+	AddArrayR32(count, left.y, right.y, resultsOut.y);
+}
+void Vec2SoaSubtract(u32 count, Vec2Soa_t left, Vec2Soa_t right, Vec2Soa_t resultsOut)
+{
+	SubtractArrayR32(count, left.x, right.x, resultsOut.x);
+	SubtractArrayR32(count, left.y, right.y, resultsOut.y);
+}
+void Vec2SoaScale(u32 count, Vec2Soa_t vectors, r32 scalar, Vec2Soa_t resultsOut)
+{
+	ScaleArrayR32(count, vectors.x, scalar, resultsOut.x);
+	ScaleArrayR32(count, vectors.y, scalar, resultsOut.y);
+}
+void Vec2SoaAddScaled(u32 count, Vec2Soa_t base, Vec2Soa_t vectors, r32 scalar, Vec2Soa_t resultsOut)
+{
+	AddScaledArrayR32(count, base.x, vectors.x, scalar, resultsOut.x);
+	AddScaledArrayR32(count, base.y, vectors.y, scalar, resultsOut.y);
+}
+void Vec2SoaShift(u32 count, Vec2Soa_t vectors, v2 amount, Vec2Soa_t resultsOut)
+{
+	r32 patternX[4] = { amount.x, amount.x, amount.x, amount.x };
+	r32 patternY[4] = { amount.y, amount.y, amount.y, amount.y };
+	AddPatternArrayR32(count, vectors.x, patternX, resultsOut.x);
+	AddPatternArrayR32(count, vectors.y, patternY, resultsOut.y);
+}
+void Vec2SoaDot(u32 count, Vec2Soa_t left, Vec2Soa_t right, r32* dotsOut)
+{
+	u32 index = 0;
+	for (; index + 4 <= count; index += 4)
+	{
+		simd4f xProduct = Simd4fMultiply(Simd4fLoad(&left.x[index]), Simd4fLoad(&right.x[index]));
+		Simd4fStore(&dotsOut[index], Simd4fMulAdd(Simd4fLoad(&left.y[index]), Simd4fLoad(&right.y[index]), xProduct));
+	}
+	for (; index < count; index++) { dotsOut[index] = (left.x[index] * right.x[index]) + (left.y[index] * right.y[index]); }
+}
+void Vec2SoaLength(u32 count, Vec2Soa_t vectors, r32* lengthsOut)
+{
+	u32 index = 0;
+	for (; index + 4 <= count; index += 4)
+	{
+		simd4f xValues = Simd4fLoad(&vectors.x[index]);
+		simd4f yValues = Simd4fLoad(&vectors.y[index]);
+		Simd4fStore(&lengthsOut[index], Simd4fSqrt(Simd4fMulAdd(yValues, yValues, Simd4fMultiply(xValues, xValues))));
+	}
+	for (; index < count; index++) { lengthsOut[index] = sqrtf((vectors.x[index] * vectors.x[index]) + (vectors.y[index] * vectors.y[index])); }
+}
+void Vec2ArrayToSoa(u32 count, const v2* vectors, Vec2Soa_t resultsOut)
+{
+	for (u32 vIndex = 0; vIndex < count; vIndex++)
+	{
+		resultsOut.x[vIndex] = vectors[vIndex].x;
+		resultsOut.y[vIndex] = vectors[vIndex].y;
+	}
+}
+void Vec2SoaToArray(u32 count, Vec2Soa_t vectors, v2* resultsOut)
+{
+	for (u32 vIndex = 0; vIndex < count; vIndex++)
+	{
+		resultsOut[vIndex].x = vectors.x[vIndex];
+		resultsOut[vIndex].y = vectors.y[vIndex];
+	}
+}
+
+void Vec3SoaAdd(u32 count, Vec3Soa_t left, Vec3Soa_t right, Vec3Soa_t resultsOut)
+{
+	AddArrayR32(count, left.x, right.x, resultsOut.x);
+	AddArrayR32(count, left.y, right.y, resultsOut.y);
+	AddArrayR32(count, left.z, right.z, resultsOut.z);
+}
+void Vec3SoaSubtract(u32 count, Vec3Soa_t left, Vec3Soa_t right, Vec3Soa_t resultsOut)
+{
+	SubtractArrayR32(count, left.x, right.x, resultsOut.x);
+	SubtractArrayR32(count, left.y, right.y, resultsOut.y);
+	SubtractArrayR32(count, left.z, right.z, resultsOut.z);
+}
+void Vec3SoaScale(u32 count, Vec3Soa_t vectors, r32 scalar, Vec3Soa_t resultsOut)
+{
+	ScaleArrayR32(count, vectors.x, scalar, resultsOut.x);
+	ScaleArrayR32(count, vectors.y, scalar, resultsOut.y);
+	ScaleArrayR32(count, vectors.z, scalar, resultsOut.z);
+}
+void Vec3SoaAddScaled(u32 count, Vec3Soa_t base, Vec3Soa_t vectors, r32 scalar, Vec3Soa_t resultsOut)
+{
+	AddScaledArrayR32(count, base.x, vectors.x, scalar, resultsOut.x);
+	AddScaledArrayR32(count, base.y, vectors.y, scalar, resultsOut.y);
+	AddScaledArrayR32(count, base.z, vectors.z, scalar, resultsOut.z);
+}
+void Vec3SoaDot(u32 count, Vec3Soa_t left, Vec3Soa_t right, r32* dotsOut)
+{
+	u32 index = 0;
+	for (; index + 4 <= count; index += 4)
+	{
+		simd4f sum = Simd4fMultiply(Simd4fLoad(&left.x[index]), Simd4fLoad(&right.x[index]));
+		sum = Simd4fMulAdd(Simd4fLoad(&left.y[index]), Simd4fLoad(&right.y[index]), sum);
+		sum = Simd4fMulAdd(Simd4fLoad(&left.z[index]), Simd4fLoad(&right.z[index]), sum);
+		Simd4fStore(&dotsOut[index], sum);
+	}
+	for (; index < count; index++) { dotsOut[index] = (left.x[index] * right.x[index]) + (left.y[index] * right.y[index]) + (left.z[index] * right.z[index]); }
+}
+void Vec3SoaLength(u32 count, Vec3Soa_t vectors, r32* lengthsOut)
+{
+	Vec3SoaDot(count, vectors, vectors, lengthsOut);
+	u32 index = 0;
+	for (; index + 4 <= count; index += 4) { Simd4fStore(&lengthsOut[index], Simd4fSqrt(Simd4fLoad(&lengthsOut[index]))); }
+	for (; index < count; index++) { lengthsOut[index] = sqrtf(lengthsOut[index]); }
+}
+void Vec3ArrayToSoa(u32 count, const v3* vectors, Vec3Soa_t resultsOut)
+{
+	for (u32 vIndex = 0; vIndex < count; vIndex++)
+	{
+		resultsOut.x[vIndex] = vectors[vIndex].x;
+		resultsOut.y[vIndex] = vectors[vIndex].y;
+		resultsOut.z[vIndex] = vectors[vIndex].z;
+	}
+}
+void Vec3SoaToArray(u32 count, Vec3Soa_t vectors, v3* resultsOut)
+{
+	for (u32 vIndex = 0; vIndex < count; vIndex++)
+	{
+		resultsOut[vIndex].x = vectors.x[vIndex];
+		resultsOut[vIndex].y = vectors.y[vIndex];
+		resultsOut[vIndex].z = vectors.z[vIndex];
+	}
+}
+
+// +--------------------------------------------------------------+
+// |                       Matrix Functions                       |
+// +--------------------------------------------------------------+
+//NOTE: mat23 is row-major (see Matrix2x3_t). Mat23Multiply(left, right) produces a matrix that applies right first
+//      and then left, which matches what OC_MatrixMultiplyPush does to the top of the matrix stack
+// +==============================+
+// |       Matrix Builders        |
+// +==============================+
+INLINE mat23 Mat23Translate(v2 offset)
+{
+	return NewMat23(
+		1.0f, 0.0f, offset.x,
+		0.0f, 1.0f, offset.y
+	);
+}
+INLINE mat23 Mat23Translate(r32 x, r32 y) { return Mat23Translate(NewVec2(x, y)); }
+INLINE mat23 Mat23Scale(v2 scale)
+{
+	return NewMat23(
+		scale.x, 0.0f,    0.0f,
+		0.0f,    scale.y, 0.0f
+	);
+}
+INLINE mat23 Mat23Scale(r32 scale) { return Mat23Scale(NewVec2(scale, scale)); }
+//Positive angles rotate clockwise on screen since +y is down in Orca
+INLINE mat23 Mat23Rotate(r32 angle)
+{
+	r32 sinValue = SinR32(angle);
+	r32 cosValue = CosR32(angle);
+	return NewMat23(
+		cosValue, -sinValue, 0.0f,
+		sinValue,  cosValue, 0.0f
+	);
+}
+
+// +==============================+
+// |       Matrix Operations      |
+// +==============================+
+INLINE mat23 Mat23Multiply(mat23 left, mat23 right)
+{
+	mat23 result;
+	result.r0c0 = left.r0c0 * right.r0c0 + left.r0c1 * right.r1c0;
+	result.r0c1 = left.r0c0 * right.r0c1 + left.r0c1 * right.r1c1;
+	result.r0c2 = left.r0c0 * right.r0c2 + left.r0c1 * right.r1c2 + left.r0c2;
+	result.r1c0 = left.r1c0 * right.r0c0 + left.r1c1 * right.r1c0;
+	result.r1c1 = left.r1c0 * right.r0c1 + left.r1c1 * right.r1c1;
+	result.r1c2 = left.r1c0 * right.r0c2 + left.r1c1 * right.r1c2 + left.r1c2;
+	return result;
+}
+INLINE r32 Mat23Determinant(mat23 matrix)
+{
+	return (matrix.r0c0 * matrix.r1c1) - (matrix.r0c1 * matrix.r1c0);
+}
+//Returns the identity matrix (and sets isInvertibleOut to false) if the matrix has no inverse
+INLINE mat23 Mat23Inverse(mat23 matrix, bool* isInvertibleOut = nullptr)
+{
+	r32 determinant = Mat23Determinant(matrix);
+	if (determinant == 0.0f || IsInfiniteR32(determinant))
+	{
+		SetOptionalOutPntr(isInvertibleOut, false);
+		return Mat23_Identity;
+	}
+	r32 invDet = 1.0f / determinant;
+	mat23 result;
+	result.r0c0 =  matrix.r1c1 * invDet;
+	result.r0c1 = -matrix.r0c1 * invDet;
+	result.r1c0 = -matrix.r1c0 * invDet;
+	result.r1c1 =  matrix.r0c0 * invDet;
+	result.r0c2 = -(result.r0c0 * matrix.r0c2 + result.r0c1 * matrix.r1c2);
+	result.r1c2 = -(result.r1c0 * matrix.r0c2 + result.r1c1 * matrix.r1c2);
+	SetOptionalOutPntr(isInvertibleOut, true);
+	return result;
+}
+INLINE v2 Mat23TransformPoint(mat23 matrix, v2 point)
+{
+	v2 result;
+	result.x = matrix.r0c0 * point.x + matrix.r0c1 * point.y + matrix.r0c2;
+	result.y = matrix.r1c0 * point.x + matrix.r1c1 * point.y + matrix.r1c2;
+	return result;
+}
+//Like Mat23TransformPoint but ignores the translation column (for directions and sizes)
+INLINE v2 Mat23TransformVector(mat23 matrix, v2 vector)
+{
+	v2 result;
+	result.x = matrix.r0c0 * vector.x + matrix.r0c1 * vector.y;
+	result.y = matrix.r1c0 * vector.x + matrix.r1c1 * vector.y;
+	return result;
+}
+
+INLINE mat23 operator * (mat23 left, mat23 right)                 { return Mat23Multiply(left, right); }
+INLINE v2 operator * (mat23 matrix, v2 point)                     { return Mat23TransformPoint(matrix, point); }
+INLINE void operator *= (mat23& leftSide, const mat23& rightSide) { leftSide = Mat23Multiply(leftSide, rightSide); }
+
+// +==============================+
+// |   Batched Point Transforms   |
+// +==============================+
+//Two v2 fit in a simd4f as (x0, y0, x1, y1) so each register computes
+//  (x0, x0, x1, x1) * (r0c0, r1c0, r0c0, r1c0) + (y0, y0, y1, y1) * (r0c1, r1c1, r0c1, r1c1) + (r0c2, r1c2, r0c2, r1c2)
+void Mat23TransformPoints(u32 count, const v2* points, mat23 matrix, v2* resultsOut)
+{
+	simd4f column0 = NewSimd4f(matrix.r0c0, matrix.r1c0, matrix.r0c0, matrix.r1c0);
+	simd4f column1 = NewSimd4f(matrix.r0c1, matrix.r1c1, matrix.r0c1, matrix.r1c1);
+	simd4f column2 = NewSimd4f(matrix.r0c2, matrix.r1c2, matrix.r0c2, matrix.r1c2);
+	const r32* inPntr = (const r32*)points;
+	r32* outPntr = (r32*)resultsOut;
+	u32 pIndex = 0;
+	for (; pIndex + 4 <= count; pIndex += 4)
+	{
+		simd4f pair0 = Simd4fLoad(&inPntr[pIndex*2 + 0]);
+		simd4f pair1 = Simd4fLoad(&inPntr[pIndex*2 + 4]);
+		simd4f result0 = Simd4fMulAdd(Simd4fDuplicateOdd(pair0), column1, Simd4fMulAdd(Simd4fDuplicateEven(pair0), column0, column2));
+		simd4f result1 = Simd4fMulAdd(Simd4fDuplicateOdd(pair1), column1, Simd4fMulAdd(Simd4fDuplicateEven(pair1), column0, column2));
+		Simd4fStore(&outPntr[pIndex*2 + 0], result0);
+		Simd4fStore(&outPntr[pIndex*2 + 4], result1);
+	}
+	for (; pIndex < count; pIndex++) { resultsOut[pIndex] = Mat23TransformPoint(matrix, points[pIndex]); }
+}
+void Mat23TransformVectors(u32 count, const v2* vectors, mat23 matrix, v2* resultsOut)
+{
+	simd4f column0 = NewSimd4f(matrix.r0c0, matrix.r1c0, matrix.r0c0, matrix.r1c0);
+	simd4f column1 = NewSimd4f(matrix.r0c1, matrix.r1c1, matrix.r0c1, matrix.r1c1);
+	const r32* inPntr = (const r32*)vectors;
+	r32* outPntr = (r32*)resultsOut;
+	u32 vIndex = 0;
+	for (; vIndex + 2 <= count; vIndex += 2)
+	{
+		simd4f pair = Simd4fLoad(&inPntr[vIndex*2]);
+		Simd4fStore(&outPntr[vIndex*2], Simd4fMulAdd(Simd4fDuplicateOdd(pair), column1, Simd4fMultiply(Simd4fDuplicateEven(pair), column0)));
+	}
+	for (; vIndex < count; vIndex++) { resultsOut[vIndex] = Mat23TransformVector(matrix, vectors[vIndex]); }
+}
+
+// +==============================+
+// |       mat4 Operations        |
+// +==============================+
+//NOTE: mat3 and mat4 are column-major and multiply column vectors (matrix * vector), like GLSL.
+//      Mat4Multiply(left, right) applies right first and then left, same as Mat23Multiply
+INLINE mat4 Mat4Multiply(mat4 left, mat4 right)
+{
+	simd4f leftColumn0 = Simd4fLoad(&left.values[0][0]);
+	simd4f leftColumn1 = Simd4fLoad(&left.values[1][0]);
+	simd4f leftColumn2 = Simd4fLoad(&left.values[2][0]);
+	simd4f leftColumn3 = Simd4fLoad(&left.values[3][0]);
+	mat4 result;
+	for (u32 cIndex = 0; cIndex < 4; cIndex++)
+	{
+		simd4f column = Simd4fMultiply(leftColumn0, Simd4fFill(right.values[cIndex][0]));
+		column = Simd4fMulAdd(leftColumn1, Simd4fFill(right.values[cIndex][1]), column);
+		column = Simd4fMulAdd(leftColumn2, Simd4fFill(right.values[cIndex][2]), column);
+		column = Simd4fMulAdd(leftColumn3, Simd4fFill(right.values[cIndex][3]), column);
+		Simd4fStore(&result.values[cIndex][0], column);
+	}
+	return result;
+}
+INLINE v4 Mat4MultiplyVec4(mat4 matrix, v4 vector)
+{
+	simd4f column = Simd4fMultiply(Simd4fLoad(&matrix.values[0][0]), Simd4fFill(vector.x));
+	column = Simd4fMulAdd(Simd4fLoad(&matrix.values[1][0]), Simd4fFill(vector.y), column);
+	column = Simd4fMulAdd(Simd4fLoad(&matrix.values[2][0]), Simd4fFill(vector.z), column);
+	column = Simd4fMulAdd(Simd4fLoad(&matrix.values[3][0]), Simd4fFill(vector.w), column);
+	v4 result;
+	Simd4fStore(&result.x, column);
+	return result;
+}
+//Treats point as (x, y, z, 1) and drops the resulting w (use Mat4ProjectPoint for perspective matrices)
+INLINE v3 Mat4TransformPoint(mat4 matrix, v3 point)
+{
+	v4 result = Mat4MultiplyVec4(matrix, NewVec4(point.x, point.y, point.z, 1.0f));
+	return NewVec3(result.x, result.y, result.z);
+}
+//Treats vector as (x, y, z, 0) so translation is ignored (for directions)
+INLINE v3 Mat4TransformVector(mat4 matrix, v3 vector)
+{
+	v4 result = Mat4MultiplyVec4(matrix, NewVec4(vector.x, vector.y, vector.z, 0.0f));
+	return NewVec3(result.x, result.y, result.z);
+}
+//Like Mat4TransformPoint but divides by the resulting w
+INLINE v3 Mat4ProjectPoint(mat4 matrix, v3 point)
+{
+	v4 result = Mat4MultiplyVec4(matrix, NewVec4(point.x, point.y, point.z, 1.0f));
+	r32 invW = (result.w != 0.0f) ? (1.0f / result.w) : 1.0f;
+	return NewVec3(result.x * invW, result.y * invW, result.z * invW);
+}
+INLINE mat4 Mat4Transpose(mat4 matrix)
+{
+	simd4f column0 = Simd4fLoad(&matrix.values[0][0]);
+	simd4f column1 = Simd4fLoad(&matrix.values[1][0]);
+	simd4f column2 = Simd4fLoad(&matrix.values[2][0]);
+	simd4f column3 = Simd4fLoad(&matrix.values[3][0]);
+	Simd4fTranspose(&column0, &column1, &column2, &column3);
+	mat4 result;
+	Simd4fStore(&result.values[0][0], column0);
+	Simd4fStore(&result.values[1][0], column1);
+	Simd4fStore(&result.values[2][0], column2);
+	Simd4fStore(&result.values[3][0], column3);
+	return result;
+}
+//The determinant and inverse are built from the 2x2 sub-determinants of the top two rows (s#) and bottom two rows (c#)
+INLINE r32 Mat4Determinant(mat4 matrix)
+{
+	r32 s0 = matrix.r0c0 * matrix.r1c1 - matrix.r1c0 * matrix.r0c1;
+	r32 s1 = matrix.r0c0 * matrix.r1c2 - matrix.r1c0 * matrix.r0c2;
+	r32 s2 = matrix.r0c0 * matrix.r1c3 - matrix.r1c0 * matrix.r0c3;
+	r32 s3 = matrix.r0c1 * matrix.r1c2 - matrix.r1c1 * matrix.r0c2;
+	r32 s4 = matrix.r0c1 * matrix.r1c3 - matrix.r1c1 * matrix.r0c3;
+	r32 s5 = matrix.r0c2 * matrix.r1c3 - matrix.r1c2 * matrix.r0c3;
+	r32 c5 = matrix.r2c2 * matrix.r3c3 - matrix.r3c2 * matrix.r2c3;
+	r32 c4 = matrix.r2c1 * matrix.r3c3 - matrix.r3c1 * matrix.r2c3;
+	r32 c3 = matrix.r2c1 * matrix.r3c2 - matrix.r3c1 * matrix.r2c2;
+	r32 c2 = matrix.r2c0 * matrix.r3c3 - matrix.r3c0 * matrix.r2c3;
+	r32 c1 = matrix.r2c0 * matrix.r3c2 - matrix.r3c0 * matrix.r2c2;
+	r32 c0 = matrix.r2c0 * matrix.r3c1 - matrix.r3c0 * matrix.r2c1;
+	return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+}
+//Returns the identity matrix (and sets isInvertibleOut to false) if the matrix has no inverse
+mat4 Mat4Inverse(mat4 matrix, bool* isInvertibleOut = nullptr)
+{
+	r32 s0 = matrix.r0c0 * matrix.r1c1 - matrix.r1c0 * matrix.r0c1;
+	r32 s1 = matrix.r0c0 * matrix.r1c2 - matrix.r1c0 * matrix.r0c2;
+	r32 s2 = matrix.r0c0 * matrix.r1c3 - matrix.r1c0 * matrix.r0c3;
+	r32 s3 = matrix.r0c1 * matrix.r1c2 - matrix.r1c1 * matrix.r0c2;
+	r32 s4 = matrix.r0c1 * matrix.r1c3 - matrix.r1c1 * matrix.r0c3;
+	r32 s5 = matrix.r0c2 * matrix.r1c3 - matrix.r1c2 * matrix.r0c3;
+	r32 c5 = matrix.r2c2 * matrix.r3c3 - matrix.r3c2 * matrix.r2c3;
+	r32 c4 = matrix.r2c1 * matrix.r3c3 - matrix.r3c1 * matrix.r2c3;
+	r32 c3 = matrix.r2c1 * matrix.r3c2 - matrix.r3c1 * matrix.r2c2;
+	r32 c2 = matrix.r2c0 * matrix.r3c3 - matrix.r3c0 * matrix.r2c3;
+	r32 c1 = matrix.r2c0 * matrix.r3c2 - matrix.r3c0 * matrix.r2c2;
+	r32 c0 = matrix.r2c0 * matrix.r3c1 - matrix.r3c0 * matrix.r2c1;
+	r32 determinant = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+	if (determinant == 0.0f || IsInfiniteR32(determinant))
+	{
+		SetOptionalOutPntr(isInvertibleOut, false);
+		return Mat4_Identity;
+	}
+	r32 invDet = 1.0f / determinant;
+	mat4 result;
+	result.r0c0 = ( matrix.r1c1 * c5 - matrix.r1c2 * c4 + matrix.r1c3 * c3) * invDet;
+	result.r0c1 = (-matrix.r0c1 * c5 + matrix.r0c2 * c4 - matrix.r0c3 * c3) * invDet;
+	result.r0c2 = ( matrix.r3c1 * s5 - matrix.r3c2 * s4 + matrix.r3c3 * s3) * invDet;
+	result.r0c3 = (-matrix.r2c1 * s5 + matrix.r2c2 * s4 - matrix.r2c3 * s3) * invDet;
+	result.r1c0 = (-matrix.r1c0 * c5 + matrix.r1c2 * c2 - matrix.r1c3 * c1) * invDet;
+	result.r1c1 = ( matrix.r0c0 * c5 - matrix.r0c2 * c2 + matrix.r0c3 * c1) * invDet;
+	result.r1c2 = (-matrix.r3c0 * s5 + matrix.r3c2 * s2 - matrix.r3c3 * s1) * invDet;
+	result.r1c3 = ( matrix.r2c0 * s5 - matrix.r2c2 * s2 + matrix.r2c3 * s1) * invDet;
+	result.r2c0 = ( matrix.r1c0 * c4 - matrix.r1c1 * c2 + matrix.r1c3 * c0) * invDet;
+	result.r2c1 = (-matrix.r0c0 * c4 + matrix.r0c1 * c2 - matrix.r0c3 * c0) * invDet;
+	result.r2c2 = ( matrix.r3c0 * s4 - matrix.r3c1 * s2 + matrix.r3c3 * s0) * invDet;
+	result.r2c3 = (-matrix.r2c0 * s4 + matrix.r2c1 * s2 - matrix.r2c3 * s0) * invDet;
+	result.r3c0 = (-matrix.r1c0 * c3 + matrix.r1c1 * c1 - matrix.r1c2 * c0) * invDet;
+	result.r3c1 = ( matrix.r0c0 * c3 - matrix.r0c1 * c1 + matrix.r0c2 * c0) * invDet;
+	result.r3c2 = (-matrix.r3c0 * s3 + matrix.r3c1 * s1 - matrix.r3c2 * s0) * invDet;
+	result.r3c3 = ( matrix.r2c0 * s3 - matrix.r2c1 * s1 + matrix.r2c2 * s0) * invDet;
+	SetOptionalOutPntr(isInvertibleOut, true);
+	return result;
+}
+void Mat4MultiplyVec4Array(u32 count, const v4* vectors, mat4 matrix, v4* resultsOut)
+{
+	simd4f column0 = Simd4fLoad(&matrix.values[0][0]);
+	simd4f column1 = Simd4fLoad(&matrix.values[1][0]);
+	simd4f column2 = Simd4fLoad(&matrix.values[2][0]);
+	simd4f column3 = Simd4fLoad(&matrix.values[3][0]);
+	for (u32 vIndex = 0; vIndex < count; vIndex++)
+	{
+		v4 vector = vectors[vIndex];
+		simd4f result = Simd4fMultiply(column0, Simd4fFill(vector.x));
+		result = Simd4fMulAdd(column1, Simd4fFill(vector.y), result);
+		result = Simd4fMulAdd(column2, Simd4fFill(vector.z), result);
+		result = Simd4fMulAdd(column3, Simd4fFill(vector.w), result);
+		Simd4fStore(&resultsOut[vIndex].x, result);
+	}
+}
+
+// +==============================+
+// |        mat4 Builders         |
+// +==============================+
+INLINE mat4 Mat4Translate(v3 offset)
+{
+	return NewMat4(
+		1.0f, 0.0f, 0.0f, offset.x,
+		0.0f, 1.0f, 0.0f, offset.y,
+		0.0f, 0.0f, 1.0f, offset.z,
+		0.0f, 0.0f, 0.0f, 1.0f
+	);
+}
+INLINE mat4 Mat4Scale(v3 scale)
+{
+	return NewMat4(
+		scale.x, 0.0f,    0.0f,    0.0f,
+		0.0f,    scale.y, 0.0f,    0.0f,
+		0.0f,    0.0f,    scale.z, 0.0f,
+		0.0f,    0.0f,    0.0f,    1.0f
+	);
+}
+INLINE mat4 Mat4Scale(r32 scale) { return Mat4Scale(NewVec3(scale, scale, scale)); }
+//Right-handed view matrix looking from eye towards target (the camera looks down -z in view space, like gluLookAt)
+INLINE mat4 Mat4LookAt(v3 eye, v3 target, v3 up)
+{
+	v3 forward = Vec3Normalize(Vec3Subtract(target, eye));
+	v3 side = Vec3Normalize(Vec3Cross(forward, up));
+	v3 cameraUp = Vec3Cross(side, forward);
+	return NewMat4(
+		 side.x,      side.y,      side.z,     -Vec3Dot(side, eye),
+		 cameraUp.x,  cameraUp.y,  cameraUp.z, -Vec3Dot(cameraUp, eye),
+		-forward.x,  -forward.y,  -forward.z,   Vec3Dot(forward, eye),
+		 0.0f,        0.0f,        0.0f,        1.0f
+	);
+}
+//Maps view space depth [-zNear, -zFar] to clip space z [-1, 1] (the OpenGL convention, like gluPerspective)
+INLINE mat4 Mat4Perspective(r32 fovY, r32 aspectRatio, r32 zNear, r32 zFar)
+{
+	r32 focalLength = 1.0f / TanR32(fovY / 2.0f);
+	r32 invDepth = 1.0f / (zNear - zFar);
+	return NewMat4(
+		focalLength / aspectRatio, 0.0f,        0.0f,                       0.0f,
+		0.0f,                      focalLength, 0.0f,                       0.0f,
+		0.0f,                      0.0f,        (zFar + zNear) * invDepth, 2.0f * zFar * zNear * invDepth,
+		0.0f,                      0.0f,        -1.0f,                      0.0f
+	);
+}
+//Same arguments as glOrtho, pass top < bottom to get Orca's y-down convention
+INLINE mat4 Mat4Orthographic(r32 left, r32 right, r32 bottom, r32 top, r32 zNear, r32 zFar)
+{
+	r32 invWidth = 1.0f / (right - left);
+	r32 invHeight = 1.0f / (top - bottom);
+	r32 invDepth = 1.0f / (zFar - zNear);
+	return NewMat4(
+		2.0f * invWidth, 0.0f,             0.0f,             -(right + left) * invWidth,
+		0.0f,            2.0f * invHeight, 0.0f,             -(top + bottom) * invHeight,
+		0.0f,            0.0f,             -2.0f * invDepth, -(zFar + zNear) * invDepth,
+		0.0f,            0.0f,             0.0f,             1.0f
+	);
+}
+
+// +==============================+
+// |       mat3 Operations        |
+// +==============================+
+INLINE mat3 Mat3Multiply(mat3 left, mat3 right)
+{
+	simd4f leftColumn0 = Simd4fLoad(&left.values[0][0]);
+	simd4f leftColumn1 = Simd4fLoad(&left.values[1][0]);
+	simd4f leftColumn2 = Simd4fLoad(&left.values[2][0]);
+	mat3 result;
+	for (u32 cIndex = 0; cIndex < 3; cIndex++)
+	{
+		simd4f column = Simd4fMultiply(leftColumn0, Simd4fFill(right.values[cIndex][0]));
+		column = Simd4fMulAdd(leftColumn1, Simd4fFill(right.values[cIndex][1]), column);
+		column = Simd4fMulAdd(leftColumn2, Simd4fFill(right.values[cIndex][2]), column);
+		Simd4fStore(&result.values[cIndex][0], column);
+	}
+	return result;
+}
+INLINE v3 Mat3MultiplyVec3(mat3 matrix, v3 vector)
+{
+	v3 result;
+	result.x = matrix.r0c0 * vector.x + matrix.r0c1 * vector.y + matrix.r0c2 * vector.z;
+	result.y = matrix.r1c0 * vector.x + matrix.r1c1 * vector.y + matrix.r1c2 * vector.z;
+	result.z = matrix.r2c0 * vector.x + matrix.r2c1 * vector.y + matrix.r2c2 * vector.z;
+	return result;
+}
+INLINE mat3 Mat3Transpose(mat3 matrix)
+{
+	return NewMat3(
+		matrix.r0c0, matrix.r1c0, matrix.r2c0,
+		matrix.r0c1, matrix.r1c1, matrix.r2c1,
+		matrix.r0c2, matrix.r1c2, matrix.r2c2
+	);
+}
+INLINE r32 Mat3Determinant(mat3 matrix)
+{
+	return matrix.r0c0 * (matrix.r1c1 * matrix.r2c2 - matrix.r1c2 * matrix.r2c1)
+		- matrix.r0c1 * (matrix.r1c0 * matrix.r2c2 - matrix.r1c2 * matrix.r2c0)
+		+ matrix.r0c2 * (matrix.r1c0 * matrix.r2c1 - matrix.r1c1 * matrix.r2c0);
+}
+//Returns the identity matrix (and sets isInvertibleOut to false) if the matrix has no inverse
+INLINE mat3 Mat3Inverse(mat3 matrix, bool* isInvertibleOut = nullptr)
+{
+	r32 determinant = Mat3Determinant(matrix);
+	if (determinant == 0.0f || IsInfiniteR32(determinant))
+	{
+		SetOptionalOutPntr(isInvertibleOut, false);
+		return Mat3_Identity;
+	}
+	r32 invDet = 1.0f / determinant;
+	mat3 result = NewMat3(
+		(matrix.r1c1 * matrix.r2c2 - matrix.r1c2 * matrix.r2c1) * invDet,
+		(matrix.r0c2 * matrix.r2c1 - matrix.r0c1 * matrix.r2c2) * invDet,
+		(matrix.r0c1 * matrix.r1c2 - matrix.r0c2 * matrix.r1c1) * invDet,
+		(matrix.r1c2 * matrix.r2c0 - matrix.r1c0 * matrix.r2c2) * invDet,
+		(matrix.r0c0 * matrix.r2c2 - matrix.r0c2 * matrix.r2c0) * invDet,
+		(matrix.r0c2 * matrix.r1c0 - matrix.r0c0 * matrix.r1c2) * invDet,
+		(matrix.r1c0 * matrix.r2c1 - matrix.r1c1 * matrix.r2c0) * invDet,
+		(matrix.r0c1 * matrix.r2c0 - matrix.r0c0 * matrix.r2c1) * invDet,
+		(matrix.r0c0 * matrix.r1c1 - matrix.r0c1 * matrix.r1c0) * invDet
+	);
+	SetOptionalOutPntr(isInvertibleOut, true);
+	return result;
+}
+//The upper-left 3x3 of a mat4. Mat3Transpose(Mat3Inverse(Mat3FromMat4(model))) gives the normal matrix
+INLINE mat3 Mat3FromMat4(mat4 matrix)
+{
+	return NewMat3(
+		matrix.r0c0, matrix.r0c1, matrix.r0c2,
+		matrix.r1c0, matrix.r1c1, matrix.r1c2,
+		matrix.r2c0, matrix.r2c1, matrix.r2c2
+	);
+}
+INLINE mat4 Mat4FromMat3(mat3 matrix)
+{
+	return NewMat4(
+		matrix.r0c0, matrix.r0c1, matrix.r0c2, 0.0f,
+		matrix.r1c0, matrix.r1c1, matrix.r1c2, 0.0f,
+		matrix.r2c0, matrix.r2c1, matrix.r2c2, 0.0f,
+		0.0f,        0.0f,        0.0f,        1.0f
+	);
+}
+
+// +==============================+
+// |     Quaternion Functions     |
+// +==============================+
+//NOTE: Quaternions are (x, y, z, w) with w as the real part. QuatMultiply(left, right) applies right first and then left
+INLINE quat QuatFromAxisAngle(v3 axis, r32 angle)
+{
+	v3 normalAxis = Vec3Normalize(axis);
+	r32 sinHalf = SinR32(angle / 2.0f);
+	return NewQuat(normalAxis.x * sinHalf, normalAxis.y * sinHalf, normalAxis.z * sinHalf, CosR32(angle / 2.0f));
+}
+INLINE quat QuatMultiply(quat left, quat right)
+{
+	quat result;
+	result.x = left.w * right.x + left.x * right.w + left.y * right.z - left.z * right.y;
+	result.y = left.w * right.y - left.x * right.z + left.y * right.w + left.z * right.x;
+	result.z = left.w * right.z + left.x * right.y - left.y * right.x + left.z * right.w;
+	result.w = left.w * right.w - left.x * right.x - left.y * right.y - left.z * right.z;
+	return result;
+}
+INLINE quat QuatConjugate(quat quaternion) { return NewQuat(-quaternion.x, -quaternion.y, -quaternion.z, quaternion.w); }
+INLINE r32 QuatDot(quat left, quat right) { return Vec4Dot(left.vec4, right.vec4); }
+INLINE r32 QuatLength(quat quaternion) { return SqrtR32(QuatDot(quaternion, quaternion)); }
+//Zero length quaternions return Quat_Identity
+INLINE quat QuatNormalize(quat quaternion)
+{
+	r32 length = QuatLength(quaternion);
+	if (length <= 0.0f) { return Quat_Identity; }
+	r32 invLength = 1.0f / length;
+	return NewQuat(quaternion.x * invLength, quaternion.y * invLength, quaternion.z * invLength, quaternion.w * invLength);
+}
+INLINE quat QuatInverse(quat quaternion)
+{
+	r32 lengthSquared = QuatDot(quaternion, quaternion);
+	if (lengthSquared <= 0.0f) { return Quat_Identity; }
+	r32 invLengthSquared = 1.0f / lengthSquared;
+	return NewQuat(-quaternion.x * invLengthSquared, -quaternion.y * invLengthSquared, -quaternion.z * invLengthSquared, quaternion.w * invLengthSquared);
+}
+//Rotates vector by a unit quaternion: v + 2w(u x v) + 2u x (u x v)
+INLINE v3 QuatRotateVec3(quat quaternion, v3 vector)
+{
+	v3 twiceCross = Vec3Scale(Vec3Cross(quaternion.imaginary, vector), 2.0f);
+	return Vec3Add(Vec3Add(vector, Vec3Scale(twiceCross, quaternion.w)), Vec3Cross(quaternion.imaginary, twiceCross));
+}
+//Normalized linear interpolation, always takes the shortest path
+INLINE quat QuatLerp(quat start, quat end, r32 amount)
+{
+	r32 endSign = (QuatDot(start, end) < 0.0f) ? -1.0f : 1.0f;
+	r32 startWeight = 1.0f - amount;
+	r32 endWeight = amount * endSign;
+	return QuatNormalize(NewQuat(
+		start.x * startWeight + end.x * endWeight,
+		start.y * startWeight + end.y * endWeight,
+		start.z * startWeight + end.z * endWeight,
+		start.w * startWeight + end.w * endWeight
+	));
+}
+//Spherical interpolation with constant angular velocity, always takes the shortest path.
+//Falls back to QuatLerp when the quaternions are nearly parallel (where the slerp weights lose precision)
+INLINE quat QuatSlerp(quat start, quat end, r32 amount)
+{
+	r32 cosAngle = QuatDot(start, end);
+	r32 endSign = 1.0f;
+	if (cosAngle < 0.0f) { cosAngle = -cosAngle; endSign = -1.0f; }
+	if (cosAngle > 0.9995f) { return QuatLerp(start, end, amount); }
+	r32 angle = AcosR32(cosAngle);
+	r32 invSinAngle = 1.0f / SinR32(angle);
+	r32 startWeight = SinR32((1.0f - amount) * angle) * invSinAngle;
+	r32 endWeight = SinR32(amount * angle) * invSinAngle * endSign;
+	return NewQuat(
+		start.x * startWeight + end.x * endWeight,
+		start.y * startWeight + end.y * endWeight,
+		start.z * startWeight + end.z * endWeight,
+		start.w * startWeight + end.w * endWeight
+	);
+}
+//Expects a unit quaternion
+INLINE mat3 Mat3FromQuat(quat quaternion)
+{
+	r32 xx = quaternion.x * quaternion.x; r32 yy = quaternion.y * quaternion.y; r32 zz = quaternion.z * quaternion.z;
+	r32 xy = quaternion.x * quaternion.y; r32 xz = quaternion.x * quaternion.z; r32 yz = quaternion.y * quaternion.z;
+	r32 wx = quaternion.w * quaternion.x; r32 wy = quaternion.w * quaternion.y; r32 wz = quaternion.w * quaternion.z;
+	return NewMat3(
+		1.0f - 2.0f * (yy + zz), 2.0f * (xy - wz),        2.0f * (xz + wy),
+		2.0f * (xy + wz),        1.0f - 2.0f * (xx + zz), 2.0f * (yz - wx),
+		2.0f * (xz - wy),        2.0f * (yz + wx),        1.0f - 2.0f * (xx + yy)
+	);
+}
+INLINE mat4 Mat4FromQuat(quat quaternion) { return Mat4FromMat3(Mat3FromQuat(quaternion)); }
+INLINE mat4 Mat4Rotate(v3 axis, r32 angle) { return Mat4FromQuat(QuatFromAxisAngle(axis, angle)); }
+
+INLINE mat4 operator * (mat4 left, mat4 right)                  { return Mat4Multiply(left, right); }
+INLINE v4 operator * (mat4 matrix, v4 vector)                   { return Mat4MultiplyVec4(matrix, vector); }
+INLINE void operator *= (mat4& leftSide, const mat4& rightSide) { leftSide = Mat4Multiply(leftSide, rightSide); }
+INLINE mat3 operator * (mat3 left, mat3 right)                  { return Mat3Multiply(left, right); }
+INLINE v3 operator * (mat3 matrix, v3 vector)                   { return Mat3MultiplyVec3(matrix, vector); }
+INLINE void operator *= (mat3& leftSide, const mat3& rightSide) { leftSide = Mat3Multiply(leftSide, rightSide); }
+INLINE quat operator * (quat left, quat right)                  { return QuatMultiply(left, right); }
+INLINE v3 operator * (quat quaternion, v3 vector)               { return QuatRotateVec3(quaternion, vector); }
+INLINE void operator *= (quat& leftSide, const quat& rightSide) { leftSide = QuatMultiply(leftSide, rightSide); }
+
 // +--------------------------------------------------------------+
 // |                       String Functions                       |
 // +--------------------------------------------------------------+
+//NOTE: These all work 16 bytes at a time. The last partial block of a buffer goes through Simd4iLoadPartial so nothing past the end is ever read
+
+//Returns a bit for each byte (bit 0 = chars[0]) that equals the byte filled in targetFill. numBytes below 16 only checks that many bytes
+INLINE u32 StrMatchBlock(const char* chars, u32 numBytes, simd4i targetFill)
+{
+	if (numBytes >= sizeof(simd4i)) { return Simd4iMoveMaskU8(Simd4iEqualU8(Simd4iLoad(chars), targetFill)); }
+	return Simd4iMoveMaskU8(Simd4iEqualU8(Simd4iLoadPartial(chars, numBytes), targetFill)) & ((1U << numBytes) - 1);
+}
+
 bool BufferIsNullTerminated(u32 bufferSize, const char* bufferPntr)
 {
 	if (bufferSize > 0) { OC_Assert(bufferPntr != nullptr, "Passed nullptr bufferPntr to BufferIsNullTerminated"); }
-	for (u32 cIndex = 0; cIndex < bufferSize; cIndex++)
+	simd4i zeroFill = Simd4iFillU8(0x00);
+	for (u32 cIndex = 0; cIndex < bufferSize; cIndex += sizeof(simd4i))
+	{
+		if (StrMatchBlock(&bufferPntr[cIndex], bufferSize - cIndex, zeroFill) != 0) { return true; }
+	}
+	return false;
+}
+
+bool BufferEquals(u32 bufferSize, const void* leftPntr, const void* rightPntr)
+{
+	if (bufferSize > 0) { NotNull2(leftPntr, rightPntr); }
+	const u8* leftBytes = (const u8*)leftPntr;
+	const u8* rightBytes = (const u8*)rightPntr;
+	u32 bIndex = 0;
+	for (; bIndex + sizeof(simd4i) <= bufferSize; bIndex += sizeof(simd4i))
+	{
+		if (Simd4iMoveMaskU8(Simd4iEqualU8(Simd4iLoad(&leftBytes[bIndex]), Simd4iLoad(&rightBytes[bIndex]))) != 0xFFFF) { return false; }
+	}
+	if (bIndex < bufferSize)
+	{
+		//Both sides are padded with the same zeroes so the padding always matches
+		simd4i leftTail = Simd4iLoadPartial(&leftBytes[bIndex], bufferSize - bIndex);
+		simd4i rightTail = Simd4iLoadPartial(&rightBytes[bIndex], bufferSize - bIndex);
+		if (Simd4iMoveMaskU8(Simd4iEqualU8(leftTail, rightTail)) != 0xFFFF) { return false; }
+	}
+	return true;
+}
+
+INLINE bool StrEquals(MyStr_t left, MyStr_t right)
+{
+	return (left.length == right.length && BufferEquals(left.length, left.chars, right.chars));
+}
+INLINE bool StrStartsWith(MyStr_t str, MyStr_t prefix)
+{
+	return (prefix.length <= str.length && BufferEquals(prefix.length, str.chars, prefix.chars));
+}
+INLINE bool StrEndsWith(MyStr_t str, MyStr_t suffix)
+{
+	return (suffix.length <= str.length && BufferEquals(suffix.length, &str.chars[str.length - suffix.length], suffix.chars));
+}
+
+//Finds the first target at or after startIndex. Returns false if there are none
+bool StrFindChar(MyStr_t str, char target, u32* indexOut = nullptr, u32 startIndex = 0)
+{
+	Assert(str.chars != nullptr || str.length == 0);
+	simd4i targetFill = Simd4iFillU8((u8)target);
+	for (u32 cIndex = startIndex; cIndex < str.length; cIndex += sizeof(simd4i))
+	{
+		u32 matchBits = StrMatchBlock(&str.chars[cIndex], str.length - cIndex, targetFill);
+		if (matchBits != 0)
+		{
+			SetOptionalOutPntr(indexOut, cIndex + CountTrailingZerosU32(matchBits));
+			return true;
+		}
+	}
+	return false;
+}
+
+u32 StrCountChar(MyStr_t str, char target)
+{
+	Assert(str.chars != nullptr || str.length == 0);
+	simd4i targetFill = Simd4iFillU8((u8)target);
+	u32 result = 0;
+	u32 cIndex = 0;
+	//Each byte lane counts its own matches, and they get added up before any of them can reach 256
+	while (cIndex + sizeof(simd4i) <= str.length)
+	{
+		simd4i laneCounts = Simd4iFillU8(0x00);
+		u32 numBlocks = Min<u32>((str.length - cIndex) / sizeof(simd4i), 255);
+		for (u32 bIndex = 0; bIndex < numBlocks; bIndex++)
+		{
+			laneCounts = Simd4iSubtractU8(laneCounts, Simd4iEqualU8(Simd4iLoad(&str.chars[cIndex]), targetFill));
+			cIndex += sizeof(simd4i);
+		}
+		result += Simd4iSumU8(laneCounts);
+	}
+	if (cIndex < str.length) { result += PopCountU32(StrMatchBlock(&str.chars[cIndex], str.length - cIndex, targetFill)); }
+	return result;
+}
+
+//Finds the first occurrence of target that starts at or after startIndex. An empty target is found at startIndex
+bool StrFindStr(MyStr_t str, MyStr_t target, u32* indexOut = nullptr, u32 startIndex = 0)
+{
+	Assert(str.chars != nullptr || str.length == 0);
+	Assert(target.chars != nullptr || target.length == 0);
+	if (target.length == 0)
+	{
+		if (startIndex > str.length) { return false; }
+		SetOptionalOutPntr(indexOut, startIndex);
+		return true;
+	}
+	if (target.length > str.length || startIndex > str.length - target.length) { return false; }
+	u32 lastStart = str.length - target.length;
+	simd4i firstFill = Simd4iFillU8((u8)target.chars[0]);
+	simd4i lastFill = Simd4iFillU8((u8)target.chars[target.length - 1]);
+	for (u32 cIndex = startIndex; cIndex <= lastStart; cIndex += sizeof(simd4i))
 	{
-		if (bufferPntr[cIndex] == '\0') { return true; }
+		u32 numStarts = Min<u32>(lastStart - cIndex + 1, sizeof(simd4i));
+		//A start position needs the first and last char of target in the right spots, which rules out nearly everything before a full compare
+		u32 candidates = StrMatchBlock(&str.chars[cIndex], numStarts, firstFill) & StrMatchBlock(&str.chars[cIndex + target.length - 1], numStarts, lastFill);
+		while (candidates != 0)
+		{
+			u32 matchIndex = cIndex + CountTrailingZerosU32(candidates);
+			if (BufferEquals(target.length, &str.chars[matchIndex], target.chars))
+			{
+				SetOptionalOutPntr(indexOut, matchIndex);
+				return true;
+			}
+			candidates &= (candidates - 1);
+		}
 	}
 	return false;
 }
@@ -370,7 +1374,14 @@ Rec_Zero
 Rec_Zero_Const
 Rec_Default
 Rec_Default_Const
+Mat23_Identity
+Mat23_Identity_Const
+Mat3_Identity
+Mat4_Identity
+Quat_Identity
 @Types
+Vec2Soa_t
+Vec3Soa_t
 @Functions
 INLINE v2 Vec2Add(v2 left, v2 right)
 INLINE v2 Vec2Subtract(v2 left, v2 right)
@@ -390,5 +1401,110 @@ INLINE v2i Vec2iScale(v2i vector, i32 scalar)
 INLINE v2i Vec2iShrink(v2i vector, i32 divisor)
 INLINE rec RecShift(rec rectangle, v2 amount)
 INLINE rec RecScale(rec rectangle, r32 scalar)
+INLINE r32 Vec2Dot(v2 left, v2 right)
+INLINE r32 Vec3Dot(v3 left, v3 right)
+INLINE r32 Vec4Dot(v4 left, v4 right)
+INLINE v3 Vec3Cross(v3 left, v3 right)
+INLINE r32 Vec2Length(v2 vector)
+INLINE r32 Vec3Length(v3 vector)
+INLINE v2 Vec2Normalize(v2 vector)
+INLINE v3 Vec3Normalize(v3 vector)
+INLINE bool RecIntersects(rec left, rec right)
+INLINE rec RecOverlap(rec left, rec right)
+INLINE bool RecContains(rec rectangle, v2 point)
+INLINE bool RecContains(rec outer, rec inner)
+INLINE rec RecUnion(rec left, rec right)
+INLINE rec RecExpand(rec rectangle, v2 amount)
+INLINE rec RecExpand(rec rectangle, r32 amount)
+u32 RecCullArray(u32 count, const rec* items, rec clip, u32* visibleIndicesOut)
+void Vec2AddArray(u32 count, const v2* left, const v2* right, v2* resultsOut)
+void Vec2SubtractArray(u32 count, const v2* left, const v2* right, v2* resultsOut)
+void Vec2ScaleArray(u32 count, const v2* vectors, r32 scalar, v2* resultsOut)
+void Vec2AddScaledArray(u32 count, const v2* base, const v2* vectors, r32 scalar, v2* resultsOut)
+void Vec2ShiftArray(u32 count, const v2* vectors, v2 amount, v2* resultsOut)
+void Vec3AddArray(u32 count, const v3* left, const v3* right, v3* resultsOut)
+void Vec3SubtractArray(u32 count, const v3* left, const v3* right, v3* resultsOut)
+void Vec3ScaleArray(u32 count, const v3* vectors, r32 scalar, v3* resultsOut)
+void Vec3AddScaledArray(u32 count, const v3* base, const v3* vectors, r32 scalar, v3* resultsOut)
+void Vec3ShiftArray(u32 count, const v3* vectors, v3 amount, v3* resultsOut)
+void Vec4AddArray(u32 count, const v4* left, const v4* right, v4* resultsOut)
+void Vec4SubtractArray(u32 count, const v4* left, const v4* right, v4* resultsOut)
+void Vec4ScaleArray(u32 count, const v4* vectors, r32 scalar, v4* resultsOut)
+void Vec4AddScaledArray(u32 count, const v4* base, const v4* vectors, r32 scalar, v4* resultsOut)
+void Vec4ShiftArray(u32 count, const v4* vectors, v4 amount, v4* resultsOut)
+INLINE Vec2Soa_t NewVec2Soa(r32* x, r32* y)
+INLINE Vec3Soa_t NewVec3Soa(r32* x, r32* y, r32* z)
+void Vec2SoaAdd(u32 count, Vec2Soa_t left, Vec2Soa_t right, Vec2Soa_t resultsOut)
+void Vec2SoaSubtract(u32 count, Vec2Soa_t left, Vec2Soa_t right, Vec2Soa_t resultsOut)
+void Vec2SoaScale(u32 count, Vec2Soa_t vectors, r32 scalar, Vec2Soa_t resultsOut)
+void Vec2SoaAddScaled(u32 count, Vec2Soa_t base, Vec2Soa_t vectors, r32 scalar, Vec2Soa_t resultsOut)
+void Vec2SoaShift(u32 count, Vec2Soa_t vectors, v2 amount, Vec2Soa_t resultsOut)
+void Vec2SoaDot(u32 count, Vec2Soa_t left, Vec2Soa_t right, r32* dotsOut)
+void Vec2SoaLength(u32 count, Vec2Soa_t vectors, r32* lengthsOut)
+void Vec2ArrayToSoa(u32 count, const v2* vectors, Vec2Soa_t resultsOut)
+void Vec2SoaToArray(u32 count, Vec2Soa_t vectors, v2* resultsOut)
+void Vec3SoaAdd(u32 count, Vec3Soa_t left, Vec3Soa_t right, Vec3Soa_t resultsOut)
+void Vec3SoaSubtract(u32 count, Vec3Soa_t left, Vec3Soa_t right, Vec3Soa_t resultsOut)
+void Vec3SoaScale(u32 count, Vec3Soa_t vectors, r32 scalar, Vec3Soa_t resultsOut)
+void Vec3SoaAddScaled(u32 count, Vec3Soa_t base, Vec3Soa_t vectors, r32 scalar, Vec3Soa_t resultsOut)
+void Vec3SoaDot(u32 count, Vec3Soa_t left, Vec3Soa_t right, r32* dotsOut)
+void Vec3SoaLength(u32 count, Vec3Soa_t vectors, r32* lengthsOut)
+void Vec3ArrayToSoa(u32 count, const v3* vectors, Vec3Soa_t resultsOut)
+void Vec3SoaToArray(u32 count, Vec3Soa_t vectors, v3* resultsOut)
+INLINE mat23 Mat23Translate(v2 offset)
+INLINE mat23 Mat23Translate(r32 x, r32 y)
+INLINE mat23 Mat23Scale(v2 scale)
+INLINE mat23 Mat23Scale(r32 scale)
+INLINE mat23 Mat23Rotate(r32 angle)
+INLINE mat23 Mat23Multiply(mat23 left, mat23 right)
+INLINE r32 Mat23Determinant(mat23 matrix)
+INLINE mat23 Mat23Inverse(mat23 matrix, bool* isInvertibleOut = nullptr)
+INLINE v2 Mat23TransformPoint(mat23 matrix, v2 point)
+INLINE v2 Mat23TransformVector(mat23 matrix, v2 vector)
+void Mat23TransformPoints(u32 count, const v2* points, mat23 matrix, v2* resultsOut)
+void Mat23TransformVectors(u32 count, const v2* vectors, mat23 matrix, v2* resultsOut)
+INLINE mat4 Mat4Multiply(mat4 left, mat4 right)
+INLINE v4 Mat4MultiplyVec4(mat4 matrix, v4 vector)
+INLINE v3 Mat4TransformPoint(mat4 matrix, v3 point)
+INLINE v3 Mat4TransformVector(mat4 matrix, v3 vector)
+INLINE v3 Mat4ProjectPoint(mat4 matrix, v3 point)
+INLINE mat4 Mat4Transpose(mat4 matrix)
+INLINE r32 Mat4Determinant(mat4 matrix)
+mat4 Mat4Inverse(mat4 matrix, bool* isInvertibleOut = nullptr)
+void Mat4MultiplyVec4Array(u32 count, const v4* vectors, mat4 matrix, v4* resultsOut)
+INLINE mat4 Mat4Translate(v3 offset)
+INLINE mat4 Mat4Scale(v3 scale)
+INLINE mat4 Mat4Scale(r32 scale)
+INLINE mat4 Mat4LookAt(v3 eye, v3 target, v3 up)
+INLINE mat4 Mat4Perspective(r32 fovY, r32 aspectRatio, r32 zNear, r32 zFar)
+INLINE mat4 Mat4Orthographic(r32 left, r32 right, r32 bottom, r32 top, r32 zNear, r32 zFar)
+INLINE mat3 Mat3Multiply(mat3 left, mat3 right)
+INLINE v3 Mat3MultiplyVec3(mat3 matrix, v3 vector)
+INLINE mat3 Mat3Transpose(mat3 matrix)
+INLINE r32 Mat3Determinant(mat3 matrix)
+INLINE mat3 Mat3Inverse(mat3 matrix, bool* isInvertibleOut = nullptr)
+INLINE mat3 Mat3FromMat4(mat4 matrix)
+INLINE mat4 Mat4FromMat3(mat3 matrix)
+INLINE quat QuatFromAxisAngle(v3 axis, r32 angle)
+INLINE quat QuatMultiply(quat left, quat right)
+INLINE quat QuatConjugate(quat quaternion)
+INLINE r32 QuatDot(quat left, quat right)
+INLINE r32 QuatLength(quat quaternion)
+INLINE quat QuatNormalize(quat quaternion)
+INLINE quat QuatInverse(quat quaternion)
+INLINE v3 QuatRotateVec3(quat quaternion, v3 vector)
+INLINE quat QuatLerp(quat start, quat end, r32 amount)
+INLINE quat QuatSlerp(quat start, quat end, r32 amount)
+INLINE mat3 Mat3FromQuat(quat quaternion)
+INLINE mat4 Mat4FromQuat(quat quaternion)
+INLINE mat4 Mat4Rotate(v3 axis, r32 angle)
+INLINE u32 StrMatchBlock(const char* chars, u32 numBytes, simd4i targetFill)
 bool BufferIsNullTerminated(u32 bufferSize, const char* bufferPntr)
+bool BufferEquals(u32 bufferSize, const void* leftPntr, const void* rightPntr)
+INLINE bool StrEquals(MyStr_t left, MyStr_t right)
+INLINE bool StrStartsWith(MyStr_t str, MyStr_t prefix)
+INLINE bool StrEndsWith(MyStr_t str, MyStr_t suffix)
+bool StrFindChar(MyStr_t str, char target, u32* indexOut = nullptr, u32 startIndex = 0)
+u32 StrCountChar(MyStr_t str, char target)
+bool StrFindStr(MyStr_t str, MyStr_t target, u32* indexOut = nullptr, u32 startIndex = 0)
 */
\ No newline at end of file
@@ -52,6 +52,7 @@ typedef oc_image_region                 OC_ImageRegion_t;
 typedef oc_gradient_blend_space         OC_GradientBlendSpace_t;
 typedef oc_unicode_range                OC_UnicodeRange_t;
 typedef oc_arena                        OC_Arena_t;
+typedef oc_arena_chunk                  OC_ArenaChunk_t;
 typedef oc_arena_options                OC_ArenaOptions_t;
 typedef oc_arena_scope                  OC_ArenaScope_t;
 typedef oc_font_metrics                 OC_FontMetrics_t;
@@ -166,8 +167,11 @@ typedef Colorf_t colf;
 union Matrix2x3_t
 {
 	oc_mat2x3 oc;
-	//         R  C
-	r32 values[3][2]; //TODO: Is this the right order?
+	//NOTE: oc_mat2x3 is row-major, m[0..2] is the first row and m[3..5] is the second row.
+	//      Transforming a point does x' = r0c0*x + r0c1*y + r0c2 and y' = r1c0*x + r1c1*y + r1c2
+	//      values keeps its original [3][2] shape so existing code that indexes it doesn't silently change meaning,
+	//      but that shape doesn't line up with the rows (values[1][0] is r0c2). Prefer the rNcN fields or row0/row1
+	r32 values[3][2];
 	struct { v3 row0; v3 row1; };
 	struct
 	{
@@ -177,7 +181,48 @@ union Matrix2x3_t
 };
 typedef Matrix2x3_t mat23;
 
-//TODO: Should we add mat4? Or even mat3?
+//NOTE: Unlike mat23, mat3 and mat4 are stored column-major (the layout glUniformMatrix*fv expects with transpose = GL_FALSE)
+//      so each column can be loaded straight into a simd4f. The rNcN names still read row-first (r1c0 = row 1, column 0)
+union alignas(16) Matrix3x3_t
+{
+	//         C  R
+	r32 values[3][4]; //NOTE: Each column is padded to 4 floats (matches the std140 layout of a mat3), the padding should be left as 0
+	v4 columns[3];
+	struct
+	{
+		r32 r0c0, r1c0, r2c0, pad0;
+		r32 r0c1, r1c1, r2c1, pad1;
+		r32 r0c2, r1c2, r2c2, pad2;
+	};
+};
+typedef Matrix3x3_t mat3;
+
+union alignas(16) Matrix4x4_t
+{
+	//         C  R
+	r32 values[4][4];
+	v4 columns[4];
+	struct
+	{
+		r32 r0c0, r1c0, r2c0, r3c0;
+		r32 r0c1, r1c1, r2c1, r3c1;
+		r32 r0c2, r1c2, r2c2, r3c2;
+		r32 r0c3, r1c3, r2c3, r3c3;
+	};
+};
+typedef Matrix4x4_t mat4;
+
+// +==============================+
+// |         Quaternions          |
+// +==============================+
+union alignas(16) Quaternion_t
+{
+	v4 vec4;
+	r32 values[4];
+	struct { r32 x, y, z, w; }; //NOTE: w is the real (scalar) part
+	struct { v3 imaginary; r32 real; };
+};
+typedef Quaternion_t quat;
 
 // +==============================+
 // |          Rectangles          |
@@ -279,6 +324,41 @@ INLINE mat23 NewMat23(
 	result.r1c0 = r1c0; result.r1c1 = r1c1; result.r1c2 = r1c2;
 	return result;
 }
+//NOTE: Arguments are given in reading order (row by row) even though storage is column-major
+INLINE mat3 NewMat3(
+	r32 r0c0, r32 r0c1, r32 r0c2,
+	r32 r1c0, r32 r1c1, r32 r1c2,
+	r32 r2c0, r32 r2c1, r32 r2c2)
+{
+	mat3 result;
+	result.r0c0 = r0c0; result.r0c1 = r0c1; result.r0c2 = r0c2;
+	result.r1c0 = r1c0; result.r1c1 = r1c1; result.r1c2 = r1c2;
+	result.r2c0 = r2c0; result.r2c1 = r2c1; result.r2c2 = r2c2;
+	result.pad0 = 0.0f; result.pad1 = 0.0f; result.pad2 = 0.0f;
+	return result;
+}
+INLINE mat4 NewMat4(
+	r32 r0c0, r32 r0c1, r32 r0c2, r32 r0c3,
+	r32 r1c0, r32 r1c1, r32 r1c2, r32 r1c3,
+	r32 r2c0, r32 r2c1, r32 r2c2, r32 r2c3,
+	r32 r3c0, r32 r3c1, r32 r3c2, r32 r3c3)
+{
+	mat4 result;
+	result.r0c0 = r0c0; result.r0c1 = r0c1; result.r0c2 = r0c2; result.r0c3 = r0c3;
+	result.r1c0 = r1c0; result.r1c1 = r1c1; result.r1c2 = r1c2; result.r1c3 = r1c3;
+	result.r2c0 = r2c0; result.r2c1 = r2c1; result.r2c2 = r2c2; result.r2c3 = r2c3;
+	result.r3c0 = r3c0; result.r3c1 = r3c1; result.r3c2 = r3c2; result.r3c3 = r3c3;
+	return result;
+}
+INLINE quat NewQuat(r32 x, r32 y, r32 z, r32 w)
+{
+	quat result;
+	result.x = x;
+	result.y = y;
+	result.z = z;
+	result.w = w;
+	return result;
+}
 INLINE rec NewRec(r32 x, r32 y, r32 width, r32 height)
 {
 	rec result;
@@ -660,6 +740,12 @@ Vec3i_t
 v3i
 Matrix2x3_t
 mat23
+Matrix3x3_t
+mat3
+Matrix4x4_t
+mat4
+Quaternion_t
+quat
 Rectangle_t
 rec
 @Functions
@@ -669,6 +755,9 @@ INLINE v3 NewVec3(r32 x, r32 y, r32 z)
 INLINE v4 NewVec4(r32 x, r32 y, r32 z, r32 w)
 INLINE v2i NewVec2i(i32 x, i32 y)
 INLINE mat23 NewMat23(r32 r0c0, r32 r0c1, r32 r0c2, r32 r1c0, r32 r1c1, r32 r1c2)
+INLINE mat3 NewMat3(r32 r0c0, r32 r0c1, r32 r0c2, r32 r1c0, r32 r1c1, r32 r1c2, r32 r2c0, r32 r2c1, r32 r2c2)
+INLINE mat4 NewMat4(r32 r0c0, r32 r0c1, r32 r0c2, r32 r0c3, r32 r1c0, r32 r1c1, r32 r1c2, r32 r1c3, r32 r2c0, r32 r2c1, r32 r2c2, r32 r2c3, r32 r3c0, r32 r3c1, r32 r3c2, r32 r3c3)
+INLINE quat NewQuat(r32 x, r32 y, r32 z, r32 w)
 INLINE rec NewRec(r32 x, r32 y, r32 width, r32 height)
 INLINE colf NewColorf(r32 r, r32 g, r32 b, r32 a)
 INLINE colf NewColorfBytes(u8 r, u8 g, u8 b, u8 a)
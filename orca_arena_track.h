@@ -0,0 +1,478 @@
+/*
+File:   orca_arena_track.h
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Holds an opt-in instrumentation layer for OC_Arena_t. Define ORCA_ARENA_TRACKING
+	** to 1 (in a DEBUG_BUILD) before including my_orca.h and every OC_ArenaPush*,
+	** OC_Str8Push*, OC_ArenaScope* and OC_Scratch* call gets recorded against its
+	** call site (and the innermost ArenaTrackPushTag tag). ArenaTrackPrintReport then
+	** lists bytes per call site and per tag, the peak usage and scope depth of each
+	** arena, and any scopes that were begun and never ended.
+	** With tracking off, the OC_ functions are left exactly as they are and the
+	** ArenaTrack functions compile to nothing
+*/
+
+#ifndef _ORCA_ARENA_TRACK_H
+#define _ORCA_ARENA_TRACK_H
+
+#if !defined(ORCA_ARENA_TRACKING) || !DEBUG_BUILD
+#undef ORCA_ARENA_TRACKING
+#define ORCA_ARENA_TRACKING 0
+#endif
+
+#if ORCA_ARENA_TRACKING
+
+//NOTE: All of the tracking state is fixed size so recording never allocates. Anything past these limits is dropped and counted
+#define ARENA_TRACK_MAX_SITES  512
+#define ARENA_TRACK_MAX_ARENAS 32
+#define ARENA_TRACK_MAX_SCOPES 64
+#define ARENA_TRACK_MAX_TAGS   16
+
+struct ArenaTrackSite_t
+{
+	const char* filePath;
+	u32 lineNum;
+	const char* tag;
+	u64 numBytes;
+	u64 numPushes;
+};
+struct ArenaTrackArena_t
+{
+	const OC_Arena_t* arena;
+	const char* name;
+	u64 numBytesUsed; //since the last clear, scopes that ended are subtracted
+	u64 peakBytesUsed;
+	u64 totalBytesPushed; //never goes down
+	u64 numPushes;
+	u32 scopeDepth;
+	u32 maxScopeDepth;
+};
+struct ArenaTrackScope_t
+{
+	const OC_Arena_t* arena;
+	u64 numBytesUsedAtBegin;
+	const char* filePath;
+	u32 lineNum;
+};
+struct ArenaTrackState_t
+{
+	u32 numSites;
+	ArenaTrackSite_t sites[ARENA_TRACK_MAX_SITES];
+	u32 numArenas;
+	ArenaTrackArena_t arenas[ARENA_TRACK_MAX_ARENAS];
+	u32 numScopes;
+	ArenaTrackScope_t scopes[ARENA_TRACK_MAX_SCOPES];
+	u32 numTags;
+	const char* tags[ARENA_TRACK_MAX_TAGS];
+	u64 numDroppedRecords;
+};
+
+ArenaTrackState_t arenaTrack = {};
+
+// +--------------------------------------------------------------+
+// |                          Recording                           |
+// +--------------------------------------------------------------+
+ArenaTrackArena_t* ArenaTrackGetArena(const OC_Arena_t* arena)
+{
+	for (u32 aIndex = 0; aIndex < arenaTrack.numArenas; aIndex++)
+	{
+		if (arenaTrack.arenas[aIndex].arena == arena) { return &arenaTrack.arenas[aIndex]; }
+	}
+	if (arenaTrack.numArenas >= ARENA_TRACK_MAX_ARENAS) { arenaTrack.numDroppedRecords++; return nullptr; }
+	ArenaTrackArena_t* result = &arenaTrack.arenas[arenaTrack.numArenas++];
+	ClearPointer(result);
+	result->arena = arena;
+	return result;
+}
+ArenaTrackSite_t* ArenaTrackGetSite(const char* filePath, u32 lineNum, const char* tag)
+{
+	//NOTE: __FILE__ strings are unique per file within a build so comparing pointers is enough
+	for (u32 sIndex = 0; sIndex < arenaTrack.numSites; sIndex++)
+	{
+		ArenaTrackSite_t* site = &arenaTrack.sites[sIndex];
+		if (site->lineNum == lineNum && site->filePath == filePath && site->tag == tag) { return site; }
+	}
+	if (arenaTrack.numSites >= ARENA_TRACK_MAX_SITES) { arenaTrack.numDroppedRecords++; return nullptr; }
+	ArenaTrackSite_t* result = &arenaTrack.sites[arenaTrack.numSites++];
+	ClearPointer(result);
+	result->filePath = filePath;
+	result->lineNum = lineNum;
+	result->tag = tag;
+	return result;
+}
+
+//The chunk and offset of the arena, so we can measure how much a push really took (including alignment padding)
+OC_ArenaScope_t ArenaTrackGetPos(OC_Arena_t* arena)
+{
+	OC_ArenaScope_t result = {};
+	result.arena = arena;
+	result.chunk = arena->currentChunk;
+	result.offset = (arena->currentChunk != nullptr) ? arena->currentChunk->offset : 0;
+	return result;
+}
+void ArenaTrackRecordPush(OC_ArenaScope_t posBefore, const char* filePath, u32 lineNum)
+{
+	OC_Arena_t* arena = posBefore.arena;
+	if (arena == nullptr || arena->currentChunk == nullptr) { return; }
+	//When the push spilled into a new chunk we only count what landed in the new chunk
+	u64 numBytes = (arena->currentChunk == posBefore.chunk) ? (arena->currentChunk->offset - posBefore.offset) : arena->currentChunk->offset;
+	const char* tag = (arenaTrack.numTags > 0) ? arenaTrack.tags[arenaTrack.numTags-1] : nullptr;
+	ArenaTrackSite_t* site = ArenaTrackGetSite(filePath, lineNum, tag);
+	if (site != nullptr)
+	{
+		site->numBytes += numBytes;
+		site->numPushes++;
+	}
+	ArenaTrackArena_t* arenaInfo = ArenaTrackGetArena(arena);
+	if (arenaInfo != nullptr)
+	{
+		arenaInfo->numBytesUsed += numBytes;
+		arenaInfo->totalBytesPushed += numBytes;
+		arenaInfo->numPushes++;
+		if (arenaInfo->numBytesUsed > arenaInfo->peakBytesUsed) { arenaInfo->peakBytesUsed = arenaInfo->numBytesUsed; }
+	}
+}
+void ArenaTrackRecordScopeBegin(const OC_Arena_t* arena, const char* filePath, u32 lineNum)
+{
+	ArenaTrackArena_t* arenaInfo = ArenaTrackGetArena(arena);
+	if (arenaInfo == nullptr) { return; }
+	arenaInfo->scopeDepth++;
+	if (arenaInfo->scopeDepth > arenaInfo->maxScopeDepth) { arenaInfo->maxScopeDepth = arenaInfo->scopeDepth; }
+	if (arenaTrack.numScopes >= ARENA_TRACK_MAX_SCOPES) { arenaTrack.numDroppedRecords++; return; }
+	ArenaTrackScope_t* scope = &arenaTrack.scopes[arenaTrack.numScopes++];
+	scope->arena = arena;
+	scope->numBytesUsedAtBegin = arenaInfo->numBytesUsed;
+	scope->filePath = filePath;
+	scope->lineNum = lineNum;
+}
+void ArenaTrackRecordScopeEnd(const OC_Arena_t* arena)
+{
+	ArenaTrackArena_t* arenaInfo = ArenaTrackGetArena(arena);
+	if (arenaInfo == nullptr) { return; }
+	if (arenaInfo->scopeDepth > 0) { arenaInfo->scopeDepth--; }
+	//Scopes normally end in reverse order but scopes on different arenas can interleave
+	for (u32 sIndex = arenaTrack.numScopes; sIndex > 0; sIndex--)
+	{
+		if (arenaTrack.scopes[sIndex-1].arena == arena)
+		{
+			arenaInfo->numBytesUsed = arenaTrack.scopes[sIndex-1].numBytesUsedAtBegin;
+			for (u32 moveIndex = sIndex; moveIndex < arenaTrack.numScopes; moveIndex++) { arenaTrack.scopes[moveIndex-1] = arenaTrack.scopes[moveIndex]; }
+			arenaTrack.numScopes--;
+			break;
+		}
+	}
+}
+void ArenaTrackRecordClear(const OC_Arena_t* arena)
+{
+	ArenaTrackArena_t* arenaInfo = ArenaTrackGetArena(arena);
+	if (arenaInfo != nullptr) { arenaInfo->numBytesUsed = 0; }
+}
+//Forgets the arena (and any scopes left open on it) so the next arena that lands at the same address starts fresh
+void ArenaTrackRecordCleanup(const OC_Arena_t* arena)
+{
+	u32 numScopesKept = 0;
+	for (u32 sIndex = 0; sIndex < arenaTrack.numScopes; sIndex++)
+	{
+		if (arenaTrack.scopes[sIndex].arena != arena) { arenaTrack.scopes[numScopesKept++] = arenaTrack.scopes[sIndex]; }
+	}
+	arenaTrack.numScopes = numScopesKept;
+	for (u32 aIndex = 0; aIndex < arenaTrack.numArenas; aIndex++)
+	{
+		if (arenaTrack.arenas[aIndex].arena == arena)
+		{
+			arenaTrack.arenas[aIndex] = arenaTrack.arenas[arenaTrack.numArenas-1];
+			arenaTrack.numArenas--;
+			break;
+		}
+	}
+}
+
+// +--------------------------------------------------------------+
+// |                      Tracked Wrappers                        |
+// +--------------------------------------------------------------+
+//NOTE: (OC_ArenaPush)(...) with the name in parenthesis calls the real function instead of expanding the macros below
+void* ArenaTrackPush(OC_Arena_t* arena, u64 size, const char* filePath, u32 lineNum)
+{
+	OC_ArenaScope_t posBefore = ArenaTrackGetPos(arena);
+	void* result = (OC_ArenaPush)(arena, size);
+	ArenaTrackRecordPush(posBefore, filePath, lineNum);
+	return result;
+}
+void* ArenaTrackPushAligned(OC_Arena_t* arena, u64 size, u32 alignment, const char* filePath, u32 lineNum)
+{
+	OC_ArenaScope_t posBefore = ArenaTrackGetPos(arena);
+	void* result = (OC_ArenaPushAligned)(arena, size, alignment);
+	ArenaTrackRecordPush(posBefore, filePath, lineNum);
+	return result;
+}
+void ArenaTrackClear(OC_Arena_t* arena)
+{
+	(OC_ArenaClear)(arena);
+	ArenaTrackRecordClear(arena);
+}
+void ArenaTrackCleanup(OC_Arena_t* arena)
+{
+	(OC_ArenaCleanup)(arena);
+	ArenaTrackRecordCleanup(arena);
+}
+OC_ArenaScope_t ArenaTrackScopeBegin(OC_Arena_t* arena, const char* filePath, u32 lineNum)
+{
+	ArenaTrackRecordScopeBegin(arena, filePath, lineNum);
+	return (OC_ArenaScopeBegin)(arena);
+}
+void ArenaTrackScopeEnd(OC_ArenaScope_t scope)
+{
+	(OC_ArenaScopeEnd)(scope);
+	ArenaTrackRecordScopeEnd(scope.arena);
+}
+OC_ArenaScope_t ArenaTrackScratchBegin(const char* filePath, u32 lineNum)
+{
+	OC_ArenaScope_t result = (OC_ScratchBegin)();
+	ArenaTrackRecordScopeBegin(result.arena, filePath, lineNum);
+	return result;
+}
+OC_ArenaScope_t ArenaTrackScratchBeginNext(OC_Arena_t* used, const char* filePath, u32 lineNum)
+{
+	OC_ArenaScope_t result = (OC_ScratchBeginNext)(used);
+	ArenaTrackRecordScopeBegin(result.arena, filePath, lineNum);
+	return result;
+}
+MyStr_t ArenaTrackStr8PushBuffer(OC_Arena_t* arena, u64 len, char* buffer, const char* filePath, u32 lineNum)
+{
+	OC_ArenaScope_t posBefore = ArenaTrackGetPos(arena);
+	MyStr_t result = (OC_Str8PushBuffer)(arena, len, buffer);
+	ArenaTrackRecordPush(posBefore, filePath, lineNum);
+	return result;
+}
+MyStr_t ArenaTrackStr8PushCstring(OC_Arena_t* arena, const char* str, const char* filePath, u32 lineNum)
+{
+	OC_ArenaScope_t posBefore = ArenaTrackGetPos(arena);
+	MyStr_t result = (OC_Str8PushCstring)(arena, str);
+	ArenaTrackRecordPush(posBefore, filePath, lineNum);
+	return result;
+}
+MyStr_t ArenaTrackStr8PushCopy(OC_Arena_t* arena, MyStr_t str, const char* filePath, u32 lineNum)
+{
+	OC_ArenaScope_t posBefore = ArenaTrackGetPos(arena);
+	MyStr_t result = (OC_Str8PushCopy)(arena, str);
+	ArenaTrackRecordPush(posBefore, filePath, lineNum);
+	return result;
+}
+MyStr_t ArenaTrackStr8PushSlice(OC_Arena_t* arena, MyStr_t str, u64 start, u64 end, const char* filePath, u32 lineNum)
+{
+	OC_ArenaScope_t posBefore = ArenaTrackGetPos(arena);
+	MyStr_t result = (OC_Str8PushSlice)(arena, str, start, end);
+	ArenaTrackRecordPush(posBefore, filePath, lineNum);
+	return result;
+}
+MyStr_t ArenaTrackStr8Pushfv(OC_Arena_t* arena, const char* filePath, u32 lineNum, const char* format, va_list args)
+{
+	OC_ArenaScope_t posBefore = ArenaTrackGetPos(arena);
+	MyStr_t result = (OC_Str8Pushfv)(arena, format, args);
+	ArenaTrackRecordPush(posBefore, filePath, lineNum);
+	return result;
+}
+MyStr_t ArenaTrackStr8Pushf(OC_Arena_t* arena, const char* filePath, u32 lineNum, const char* format, ...)
+{
+	va_list args;
+	va_start(args, format);
+	MyStr_t result = ArenaTrackStr8Pushfv(arena, filePath, lineNum, format, args);
+	va_end(args);
+	return result;
+}
+char* ArenaTrackStr8ToCstring(OC_Arena_t* arena, MyStr_t str, const char* filePath, u32 lineNum)
+{
+	OC_ArenaScope_t posBefore = ArenaTrackGetPos(arena);
+	char* result = (OC_Str8ToCstring)(arena, str);
+	ArenaTrackRecordPush(posBefore, filePath, lineNum);
+	return result;
+}
+
+#undef OC_Str8Pushf
+#undef OC_ScratchEnd
+#define OC_ArenaPush(arena, size)                     ArenaTrackPush((arena), (size), __FILE__, __LINE__)
+#define OC_ArenaPushAligned(arena, size, alignment)   ArenaTrackPushAligned((arena), (size), (alignment), __FILE__, __LINE__)
+#define OC_ArenaClear(arena)                          ArenaTrackClear(arena)
+#define OC_ArenaCleanup(arena)                        ArenaTrackCleanup(arena)
+#define OC_ArenaScopeBegin(arena)                     ArenaTrackScopeBegin((arena), __FILE__, __LINE__)
+#define OC_ArenaScopeEnd(scope)                       ArenaTrackScopeEnd(scope)
+#define OC_ScratchBegin()                             ArenaTrackScratchBegin(__FILE__, __LINE__)
+#define OC_ScratchBeginNext(used)                     ArenaTrackScratchBeginNext((used), __FILE__, __LINE__)
+#define OC_ScratchEnd(scope)                          ArenaTrackScopeEnd(scope)
+#define OC_Str8PushBuffer(arena, len, buffer)         ArenaTrackStr8PushBuffer((arena), (len), (buffer), __FILE__, __LINE__)
+#define OC_Str8PushCstring(arena, str)                ArenaTrackStr8PushCstring((arena), (str), __FILE__, __LINE__)
+#define OC_Str8PushCopy(arena, str)                   ArenaTrackStr8PushCopy((arena), (str), __FILE__, __LINE__)
+#define OC_Str8PushSlice(arena, str, start, end)      ArenaTrackStr8PushSlice((arena), (str), (start), (end), __FILE__, __LINE__)
+#define OC_Str8Pushfv(arena, format, args)            ArenaTrackStr8Pushfv((arena), __FILE__, __LINE__, (format), (args))
+#define OC_Str8Pushf(arena, format, ...)              ArenaTrackStr8Pushf((arena), __FILE__, __LINE__, (format), ##__VA_ARGS__)
+#define OC_Str8ToCstring(arena, str)                  ArenaTrackStr8ToCstring((arena), (str), __FILE__, __LINE__)
+
+// +--------------------------------------------------------------+
+// |                        Tags and Names                        |
+// +--------------------------------------------------------------+
+//Everything pushed between PushTag and PopTag gets attributed to the tag (as well as the call site). Tags nest, the innermost one wins
+void ArenaTrackPushTag(const char* tag)
+{
+	if (arenaTrack.numTags >= ARENA_TRACK_MAX_TAGS) { arenaTrack.numDroppedRecords++; return; }
+	arenaTrack.tags[arenaTrack.numTags++] = tag;
+}
+void ArenaTrackPopTag()
+{
+	Assert(arenaTrack.numTags > 0);
+	arenaTrack.numTags--;
+}
+#define ArenaTrackTagBlock(tag) oc_defer_loop(ArenaTrackPushTag(tag), ArenaTrackPopTag())
+//Gives an arena a readable name in the report
+void ArenaTrackSetName(const OC_Arena_t* arena, const char* name)
+{
+	ArenaTrackArena_t* arenaInfo = ArenaTrackGetArena(arena);
+	if (arenaInfo != nullptr) { arenaInfo->name = name; }
+}
+//Forgets all sites and totals but keeps arena names and any open scopes
+void ArenaTrackReset()
+{
+	arenaTrack.numSites = 0;
+	arenaTrack.numDroppedRecords = 0;
+	for (u32 aIndex = 0; aIndex < arenaTrack.numArenas; aIndex++)
+	{
+		ArenaTrackArena_t* arenaInfo = &arenaTrack.arenas[aIndex];
+		arenaInfo->peakBytesUsed = arenaInfo->numBytesUsed;
+		arenaInfo->totalBytesPushed = 0;
+		arenaInfo->numPushes = 0;
+		arenaInfo->maxScopeDepth = arenaInfo->scopeDepth;
+	}
+}
+
+// +--------------------------------------------------------------+
+// |                            Report                            |
+// +--------------------------------------------------------------+
+void ArenaTrackPrintReport()
+{
+	//Sort site indices by bytes, largest first. Insertion sort is plenty for ARENA_TRACK_MAX_SITES
+	u16 order[ARENA_TRACK_MAX_SITES];
+	for (u32 sIndex = 0; sIndex < arenaTrack.numSites; sIndex++)
+	{
+		u32 insertIndex = sIndex;
+		while (insertIndex > 0 && arenaTrack.sites[order[insertIndex-1]].numBytes < arenaTrack.sites[sIndex].numBytes)
+		{
+			order[insertIndex] = order[insertIndex-1];
+			insertIndex--;
+		}
+		order[insertIndex] = (u16)sIndex;
+	}
+
+	OC_Log_I("Arena report: %u call site%s, %u arena%s", arenaTrack.numSites, Plural(arenaTrack.numSites, "s"), arenaTrack.numArenas, Plural(arenaTrack.numArenas, "s"));
+	for (u32 sIndex = 0; sIndex < arenaTrack.numSites; sIndex++)
+	{
+		const ArenaTrackSite_t* site = &arenaTrack.sites[order[sIndex]];
+		OC_Log_I("  %10llu bytes %8llu push%s  %s:%u%s%s", (unsigned long long)site->numBytes, (unsigned long long)site->numPushes, Plural(site->numPushes, "es"),
+			site->filePath, site->lineNum, (site->tag != nullptr) ? " #" : "", (site->tag != nullptr) ? site->tag : "");
+	}
+
+	//Tags are summed from the sites, in first-seen order
+	for (u32 sIndex = 0; sIndex < arenaTrack.numSites; sIndex++)
+	{
+		const char* tag = arenaTrack.sites[sIndex].tag;
+		bool seenBefore = false;
+		for (u32 prevIndex = 0; prevIndex < sIndex; prevIndex++) { if (arenaTrack.sites[prevIndex].tag == tag) { seenBefore = true; break; } }
+		if (seenBefore) { continue; }
+		u64 tagBytes = 0;
+		for (u32 otherIndex = sIndex; otherIndex < arenaTrack.numSites; otherIndex++) { if (arenaTrack.sites[otherIndex].tag == tag) { tagBytes += arenaTrack.sites[otherIndex].numBytes; } }
+		OC_Log_I("  tag %s: %llu bytes", (tag != nullptr) ? tag : "(none)", (unsigned long long)tagBytes);
+	}
+
+	for (u32 aIndex = 0; aIndex < arenaTrack.numArenas; aIndex++)
+	{
+		const ArenaTrackArena_t* arenaInfo = &arenaTrack.arenas[aIndex];
+		OC_Log_I("  arena %s (%p): %llu used, %llu peak, %llu total in %llu push%s, scope depth %u (max %u)",
+			(arenaInfo->name != nullptr) ? arenaInfo->name : "?", arenaInfo->arena,
+			(unsigned long long)arenaInfo->numBytesUsed, (unsigned long long)arenaInfo->peakBytesUsed,
+			(unsigned long long)arenaInfo->totalBytesPushed, (unsigned long long)arenaInfo->numPushes, Plural(arenaInfo->numPushes, "es"),
+			arenaInfo->scopeDepth, arenaInfo->maxScopeDepth);
+	}
+
+	//Scopes that are still open are the arena version of a leak, everything pushed since they began is still held
+	for (u32 sIndex = 0; sIndex < arenaTrack.numScopes; sIndex++)
+	{
+		const ArenaTrackScope_t* scope = &arenaTrack.scopes[sIndex];
+		OC_Log_W("  scope still open from %s:%u", scope->filePath, scope->lineNum);
+	}
+	if (arenaTrack.numDroppedRecords > 0) { OC_Log_W("  %llu records were dropped, raise the ARENA_TRACK_MAX defines", (unsigned long long)arenaTrack.numDroppedRecords); }
+}
+
+#else //!ORCA_ARENA_TRACKING
+
+#define ArenaTrackPushTag(tag)             //nothing
+#define ArenaTrackPopTag()                 //nothing
+#define ArenaTrackTagBlock(tag)            //nothing
+#define ArenaTrackSetName(arena, name)     //nothing
+#define ArenaTrackReset()                  //nothing
+#define ArenaTrackPrintReport()            //nothing
+
+#endif //ORCA_ARENA_TRACKING
+
+#endif //  _ORCA_ARENA_TRACK_H
+
+// +--------------------------------------------------------------+
+// |                   Autocomplete Dictionary                    |
+// +--------------------------------------------------------------+
+/*
+@Defines
+ORCA_ARENA_TRACKING
+ARENA_TRACK_MAX_SITES
+ARENA_TRACK_MAX_ARENAS
+ARENA_TRACK_MAX_SCOPES
+ARENA_TRACK_MAX_TAGS
+@Types
+ArenaTrackSite_t
+ArenaTrackArena_t
+ArenaTrackScope_t
+ArenaTrackState_t
+@Functions
+ArenaTrackArena_t* ArenaTrackGetArena(const OC_Arena_t* arena)
+ArenaTrackSite_t* ArenaTrackGetSite(const char* filePath, u32 lineNum, const char* tag)
+OC_ArenaScope_t ArenaTrackGetPos(OC_Arena_t* arena)
+void ArenaTrackRecordPush(OC_ArenaScope_t posBefore, const char* filePath, u32 lineNum)
+void ArenaTrackRecordScopeBegin(const OC_Arena_t* arena, const char* filePath, u32 lineNum)
+void ArenaTrackRecordScopeEnd(const OC_Arena_t* arena)
+void ArenaTrackRecordClear(const OC_Arena_t* arena)
+void ArenaTrackRecordCleanup(const OC_Arena_t* arena)
+void* ArenaTrackPush(OC_Arena_t* arena, u64 size, const char* filePath, u32 lineNum)
+void* ArenaTrackPushAligned(OC_Arena_t* arena, u64 size, u32 alignment, const char* filePath, u32 lineNum)
+void ArenaTrackClear(OC_Arena_t* arena)
+void ArenaTrackCleanup(OC_Arena_t* arena)
+OC_ArenaScope_t ArenaTrackScopeBegin(OC_Arena_t* arena, const char* filePath, u32 lineNum)
+void ArenaTrackScopeEnd(OC_ArenaScope_t scope)
+OC_ArenaScope_t ArenaTrackScratchBegin(const char* filePath, u32 lineNum)
+OC_ArenaScope_t ArenaTrackScratchBeginNext(OC_Arena_t* used, const char* filePath, u32 lineNum)
+MyStr_t ArenaTrackStr8PushBuffer(OC_Arena_t* arena, u64 len, char* buffer, const char* filePath, u32 lineNum)
+MyStr_t ArenaTrackStr8PushCstring(OC_Arena_t* arena, const char* str, const char* filePath, u32 lineNum)
+MyStr_t ArenaTrackStr8PushCopy(OC_Arena_t* arena, MyStr_t str, const char* filePath, u32 lineNum)
+MyStr_t ArenaTrackStr8PushSlice(OC_Arena_t* arena, MyStr_t str, u64 start, u64 end, const char* filePath, u32 lineNum)
+MyStr_t ArenaTrackStr8Pushfv(OC_Arena_t* arena, const char* filePath, u32 lineNum, const char* format, va_list args)
+MyStr_t ArenaTrackStr8Pushf(OC_Arena_t* arena, const char* filePath, u32 lineNum, const char* format, ...)
+char* ArenaTrackStr8ToCstring(OC_Arena_t* arena, MyStr_t str, const char* filePath, u32 lineNum)
+#define OC_ArenaPush(arena, size)
+#define OC_ArenaPushAligned(arena, size, alignment)
+#define OC_ArenaClear(arena)
+#define OC_ArenaCleanup(arena)
+#define OC_ArenaScopeBegin(arena)
+#define OC_ArenaScopeEnd(scope)
+#define OC_ScratchBegin()
+#define OC_ScratchBeginNext(used)
+#define OC_ScratchEnd(scope)
+#define OC_Str8PushBuffer(arena, len, buffer)
+#define OC_Str8PushCstring(arena, str)
+#define OC_Str8PushCopy(arena, str)
+#define OC_Str8PushSlice(arena, str, start, end)
+#define OC_Str8Pushfv(arena, format, args)
+#define OC_Str8Pushf(arena, format, ...)
+#define OC_Str8ToCstring(arena, str)
+void ArenaTrackPushTag(const char* tag)
+void ArenaTrackPopTag()
+#define ArenaTrackTagBlock(tag)
+void ArenaTrackSetName(const OC_Arena_t* arena, const char* name)
+void ArenaTrackReset()
+void ArenaTrackPrintReport()
+*/
@@ -0,0 +1,308 @@
+/*
+File:   orca_audio.h
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Holds functions that convert whole buffers of audio samples between r32 and
+	** the i8/i16/i32 formats that audio devices and files use, as well as
+	** converting between planar (one buffer per channel) and interleaved layouts.
+	** Integer results saturate the same way the ClampCast functions in
+	** orca_intrinsics.h do and the results match ConvertSampleR32ToI16 and friends
+	** exactly when dithering is off
+*/
+
+#ifndef _ORCA_AUDIO_H
+#define _ORCA_AUDIO_H
+
+//NOTE: Holds the state for TPDF (triangular) dither noise. One xorshift32 state per simd lane.
+//      Dither is optional, pass nullptr to any of the conversion functions to get plain rounding
+struct AudioDither_t
+{
+	u32 seeds[4];
+};
+
+// +--------------------------------------------------------------+
+// |                            Dither                            |
+// +--------------------------------------------------------------+
+void InitAudioDither(AudioDither_t* dither, u32 seed)
+{
+	NotNull(dither);
+	for (u32 sIndex = 0; sIndex < ArrayCount(dither->seeds); sIndex++)
+	{
+		//xorshift gets stuck at 0 so make sure each lane gets a distinct nonzero seed
+		u32 laneSeed = (seed + sIndex) * 0x9E3779B9U;
+		dither->seeds[sIndex] = (laneSeed != 0) ? laneSeed : 0x6D2B79F5U;
+	}
+}
+
+//The difference of two uniform 16-bit values gives a triangular distribution over (-1, 1) LSB
+INLINE r32 AudioDitherNextR32(AudioDither_t* dither)
+{
+	u32 state = dither->seeds[0];
+	state ^= (state << 13);
+	state ^= (state >> 17);
+	state ^= (state << 5);
+	dither->seeds[0] = state;
+	return (r32)((i32)(state & 0xFFFF) - (i32)(state >> 16)) * (1.0f / 65536.0f);
+}
+INLINE simd4f AudioDitherNextSimd4f(simd4i* state)
+{
+	*state = Simd4iXor(*state, Simd4iShiftLeft(*state, 13));
+	*state = Simd4iXor(*state, Simd4iShiftRight(*state, 17));
+	*state = Simd4iXor(*state, Simd4iShiftLeft(*state, 5));
+	simd4i triangle = Simd4iSubtract(Simd4iAnd(*state, Simd4iFill(0xFFFF)), Simd4iShiftRight(*state, 16));
+	return Simd4fMultiply(Simd4iToR32(triangle), Simd4fFill(1.0f / 65536.0f));
+}
+
+// +--------------------------------------------------------------+
+// |                       Lane Conversions                       |
+// +--------------------------------------------------------------+
+//Scales, dithers (if ditherState is not nullptr), clamps and rounds 4 samples. minValue and maxValue are in the scaled range
+INLINE simd4i AudioR32ToI32Lanes(simd4f samples, simd4f scale, simd4f minValue, simd4f maxValue, simd4i* ditherState)
+{
+	simd4f scaled = Simd4fMultiply(samples, scale);
+	if (ditherState != nullptr) { scaled = Simd4fAdd(scaled, AudioDitherNextSimd4f(ditherState)); }
+	//NaN samples give the minimum, same as ClampCast, instead of whatever each backend's conversion does with them
+	scaled = Simd4fSelect(Simd4fEqual(scaled, scaled), scaled, minValue);
+	return Simd4fRoundToI32(Simd4fClamp(scaled, minValue, maxValue));
+}
+INLINE simd4i AudioR32ToI16Lanes(simd4f low, simd4f high, simd4i* ditherState)
+{
+	simd4f scale = Simd4fFill((r32)INT16_MAX);
+	simd4f minValue = Simd4fFill((r32)INT16_MIN);
+	simd4f maxValue = Simd4fFill((r32)INT16_MAX);
+	return Simd4iPackI32ToI16(
+		AudioR32ToI32Lanes(low, scale, minValue, maxValue, ditherState),
+		AudioR32ToI32Lanes(high, scale, minValue, maxValue, ditherState)
+	);
+}
+INLINE void AudioI16LanesToR32(simd4i samples, simd4f* lowOut, simd4f* highOut)
+{
+	simd4f scale = Simd4fFill(1.0f / (r32)INT16_MAX);
+	*lowOut = Simd4fMultiply(Simd4iToR32(Simd4iExtendLowI16(samples)), scale);
+	*highOut = Simd4fMultiply(Simd4iToR32(Simd4iExtendHighI16(samples)), scale);
+}
+
+// +--------------------------------------------------------------+
+// |                      Format Conversions                      |
+// +--------------------------------------------------------------+
+//NOTE: These convert sample by sample, so they work for interleaved and planar buffers alike (pass numFrames * numChannels for interleaved)
+void ConvertSamplesR32ToI16(u32 numSamples, const r32* samples, i16* resultsOut, AudioDither_t* dither = nullptr)
+{
+	NotNull2(samples, resultsOut);
+	simd4i ditherState = (dither != nullptr) ? Simd4iLoad(&dither->seeds[0]) : Simd4iFill(0);
+	simd4i* ditherStatePntr = (dither != nullptr) ? &ditherState : nullptr;
+	u32 sIndex = 0;
+	for (; sIndex + 8 <= numSamples; sIndex += 8)
+	{
+		Simd4iStore(&resultsOut[sIndex], AudioR32ToI16Lanes(Simd4fLoad(&samples[sIndex + 0]), Simd4fLoad(&samples[sIndex + 4]), ditherStatePntr));
+	}
+	if (dither != nullptr) { Simd4iStore(&dither->seeds[0], ditherState); }
+	for (; sIndex < numSamples; sIndex++)
+	{
+		r32 dithered = samples[sIndex] * (r32)INT16_MAX + ((dither != nullptr) ? AudioDitherNextR32(dither) : 0.0f);
+		resultsOut[sIndex] = ClampCastR32ToI16(dithered);
+	}
+}
+void ConvertSamplesR32ToI8(u32 numSamples, const r32* samples, i8* resultsOut, AudioDither_t* dither = nullptr)
+{
+	NotNull2(samples, resultsOut);
+	simd4i ditherState = (dither != nullptr) ? Simd4iLoad(&dither->seeds[0]) : Simd4iFill(0);
+	simd4i* ditherStatePntr = (dither != nullptr) ? &ditherState : nullptr;
+	simd4f scale = Simd4fFill((r32)INT8_MAX);
+	simd4f minValue = Simd4fFill((r32)INT8_MIN);
+	simd4f maxValue = Simd4fFill((r32)INT8_MAX);
+	u32 sIndex = 0;
+	for (; sIndex + 16 <= numSamples; sIndex += 16)
+	{
+		//Everything is already in i8 range after the clamp so the i32->i16 pack never saturates
+		simd4i low = Simd4iPackI32ToI16(
+			AudioR32ToI32Lanes(Simd4fLoad(&samples[sIndex + 0]), scale, minValue, maxValue, ditherStatePntr),
+			AudioR32ToI32Lanes(Simd4fLoad(&samples[sIndex + 4]), scale, minValue, maxValue, ditherStatePntr)
+		);
+		simd4i high = Simd4iPackI32ToI16(
+			AudioR32ToI32Lanes(Simd4fLoad(&samples[sIndex + 8]), scale, minValue, maxValue, ditherStatePntr),
+			AudioR32ToI32Lanes(Simd4fLoad(&samples[sIndex + 12]), scale, minValue, maxValue, ditherStatePntr)
+		);
+		Simd4iStore(&resultsOut[sIndex], Simd4iPackI16ToI8(low, high));
+	}
+	if (dither != nullptr) { Simd4iStore(&dither->seeds[0], ditherState); }
+	for (; sIndex < numSamples; sIndex++)
+	{
+		r32 dithered = samples[sIndex] * (r32)INT8_MAX + ((dither != nullptr) ? AudioDitherNextR32(dither) : 0.0f);
+		resultsOut[sIndex] = ClampCastI32ToI8(ClampCastR32ToI32(dithered));
+	}
+}
+//NOTE: r32 only has 24 bits of precision so dithering a 32-bit output would do nothing, there is no dither parameter here
+void ConvertSamplesR32ToI32(u32 numSamples, const r32* samples, i32* resultsOut)
+{
+	NotNull2(samples, resultsOut);
+	simd4f scale = Simd4fFill((r32)INT32_MAX);
+	simd4f minValue = Simd4fFill((r32)INT32_MIN);
+	simd4f maxValue = Simd4fFill(2147483520.0f); //the largest float below 2^31, see ClampCastR32ToI32
+	u32 sIndex = 0;
+	for (; sIndex + 4 <= numSamples; sIndex += 4)
+	{
+		Simd4iStore(&resultsOut[sIndex], AudioR32ToI32Lanes(Simd4fLoad(&samples[sIndex]), scale, minValue, maxValue, nullptr));
+	}
+	for (; sIndex < numSamples; sIndex++) { resultsOut[sIndex] = ConvertSampleR32ToI32(samples[sIndex]); }
+}
+
+void ConvertSamplesI16ToR32(u32 numSamples, const i16* samples, r32* resultsOut)
+{
+	NotNull2(samples, resultsOut);
+	u32 sIndex = 0;
+	for (; sIndex + 8 <= numSamples; sIndex += 8)
+	{
+		simd4f low, high;
+		AudioI16LanesToR32(Simd4iLoad(&samples[sIndex]), &low, &high);
+		Simd4fStore(&resultsOut[sIndex + 0], low);
+		Simd4fStore(&resultsOut[sIndex + 4], high);
+	}
+	for (; sIndex < numSamples; sIndex++) { resultsOut[sIndex] = ConvertSampleI16ToR32(samples[sIndex]); }
+}
+void ConvertSamplesI8ToR32(u32 numSamples, const i8* samples, r32* resultsOut)
+{
+	NotNull2(samples, resultsOut);
+	simd4f scale = Simd4fFill(1.0f / (r32)INT8_MAX);
+	u32 sIndex = 0;
+	for (; sIndex + 16 <= numSamples; sIndex += 16)
+	{
+		simd4i packed = Simd4iLoad(&samples[sIndex]);
+		simd4i low = Simd4iExtendLowI8(packed);
+		simd4i high = Simd4iExtendHighI8(packed);
+		Simd4fStore(&resultsOut[sIndex + 0], Simd4fMultiply(Simd4iToR32(Simd4iExtendLowI16(low)), scale));
+		Simd4fStore(&resultsOut[sIndex + 4], Simd4fMultiply(Simd4iToR32(Simd4iExtendHighI16(low)), scale));
+		Simd4fStore(&resultsOut[sIndex + 8], Simd4fMultiply(Simd4iToR32(Simd4iExtendLowI16(high)), scale));
+		Simd4fStore(&resultsOut[sIndex + 12], Simd4fMultiply(Simd4iToR32(Simd4iExtendHighI16(high)), scale));
+	}
+	for (; sIndex < numSamples; sIndex++) { resultsOut[sIndex] = ConvertSampleI8ToR32(samples[sIndex]); }
+}
+void ConvertSamplesI32ToR32(u32 numSamples, const i32* samples, r32* resultsOut)
+{
+	NotNull2(samples, resultsOut);
+	simd4f scale = Simd4fFill(1.0f / (r32)INT32_MAX);
+	u32 sIndex = 0;
+	for (; sIndex + 4 <= numSamples; sIndex += 4)
+	{
+		Simd4fStore(&resultsOut[sIndex], Simd4fMultiply(Simd4iToR32(Simd4iLoad(&samples[sIndex])), scale));
+	}
+	for (; sIndex < numSamples; sIndex++) { resultsOut[sIndex] = ConvertSampleI32ToR32(samples[sIndex]); }
+}
+
+// +--------------------------------------------------------------+
+// |                  Interleaving and Planar                     |
+// +--------------------------------------------------------------+
+//NOTE: channels holds numChannels pointers, each to numFrames samples. Stereo takes a simd path, other channel counts are scalar
+void InterleaveSamplesR32(u32 numFrames, u32 numChannels, const r32* const* channels, r32* interleavedOut)
+{
+	NotNull2(channels, interleavedOut);
+	u32 fIndex = 0;
+	if (numChannels == 2)
+	{
+		for (; fIndex + 4 <= numFrames; fIndex += 4)
+		{
+			simd4f left = Simd4fLoad(&channels[0][fIndex]);
+			simd4f right = Simd4fLoad(&channels[1][fIndex]);
+			Simd4fStore(&interleavedOut[fIndex*2 + 0], Simd4fInterleaveLow(left, right));
+			Simd4fStore(&interleavedOut[fIndex*2 + 4], Simd4fInterleaveHigh(left, right));
+		}
+	}
+	for (; fIndex < numFrames; fIndex++)
+	{
+		for (u32 cIndex = 0; cIndex < numChannels; cIndex++) { interleavedOut[fIndex*numChannels + cIndex] = channels[cIndex][fIndex]; }
+	}
+}
+void DeinterleaveSamplesR32(u32 numFrames, u32 numChannels, const r32* interleaved, r32* const* channelsOut)
+{
+	NotNull2(interleaved, channelsOut);
+	u32 fIndex = 0;
+	if (numChannels == 2)
+	{
+		for (; fIndex + 4 <= numFrames; fIndex += 4)
+		{
+			simd4f first = Simd4fLoad(&interleaved[fIndex*2 + 0]);
+			simd4f second = Simd4fLoad(&interleaved[fIndex*2 + 4]);
+			Simd4fStore(&channelsOut[0][fIndex], Simd4fGatherEven(first, second));
+			Simd4fStore(&channelsOut[1][fIndex], Simd4fGatherOdd(first, second));
+		}
+	}
+	for (; fIndex < numFrames; fIndex++)
+	{
+		for (u32 cIndex = 0; cIndex < numChannels; cIndex++) { channelsOut[cIndex][fIndex] = interleaved[fIndex*numChannels + cIndex]; }
+	}
+}
+
+//The usual path from a mixer (planar r32) to an output device (interleaved i16) in one pass
+void ConvertPlanarR32ToInterleavedI16(u32 numFrames, u32 numChannels, const r32* const* channels, i16* interleavedOut, AudioDither_t* dither = nullptr)
+{
+	NotNull2(channels, interleavedOut);
+	u32 fIndex = 0;
+	if (numChannels == 2)
+	{
+		simd4i ditherState = (dither != nullptr) ? Simd4iLoad(&dither->seeds[0]) : Simd4iFill(0);
+		simd4i* ditherStatePntr = (dither != nullptr) ? &ditherState : nullptr;
+		for (; fIndex + 4 <= numFrames; fIndex += 4)
+		{
+			simd4f left = Simd4fLoad(&channels[0][fIndex]);
+			simd4f right = Simd4fLoad(&channels[1][fIndex]);
+			Simd4iStore(&interleavedOut[fIndex*2], AudioR32ToI16Lanes(Simd4fInterleaveLow(left, right), Simd4fInterleaveHigh(left, right), ditherStatePntr));
+		}
+		if (dither != nullptr) { Simd4iStore(&dither->seeds[0], ditherState); }
+	}
+	for (; fIndex < numFrames; fIndex++)
+	{
+		for (u32 cIndex = 0; cIndex < numChannels; cIndex++)
+		{
+			r32 dithered = channels[cIndex][fIndex] * (r32)INT16_MAX + ((dither != nullptr) ? AudioDitherNextR32(dither) : 0.0f);
+			interleavedOut[fIndex*numChannels + cIndex] = ClampCastR32ToI16(dithered);
+		}
+	}
+}
+//The usual path from a decoded file (interleaved i16) to a mixer (planar r32) in one pass
+void ConvertInterleavedI16ToPlanarR32(u32 numFrames, u32 numChannels, const i16* interleaved, r32* const* channelsOut)
+{
+	NotNull2(interleaved, channelsOut);
+	u32 fIndex = 0;
+	if (numChannels == 2)
+	{
+		for (; fIndex + 4 <= numFrames; fIndex += 4)
+		{
+			simd4f first, second;
+			AudioI16LanesToR32(Simd4iLoad(&interleaved[fIndex*2]), &first, &second);
+			Simd4fStore(&channelsOut[0][fIndex], Simd4fGatherEven(first, second));
+			Simd4fStore(&channelsOut[1][fIndex], Simd4fGatherOdd(first, second));
+		}
+	}
+	for (; fIndex < numFrames; fIndex++)
+	{
+		for (u32 cIndex = 0; cIndex < numChannels; cIndex++) { channelsOut[cIndex][fIndex] = ConvertSampleI16ToR32(interleaved[fIndex*numChannels + cIndex]); }
+	}
+}
+
+#endif //  _ORCA_AUDIO_H
+
+// +--------------------------------------------------------------+
+// |                   Autocomplete Dictionary                    |
+// +--------------------------------------------------------------+
+/*
+@Types
+AudioDither_t
+@Functions
+void InitAudioDither(AudioDither_t* dither, u32 seed)
+INLINE r32 AudioDitherNextR32(AudioDither_t* dither)
+INLINE simd4f AudioDitherNextSimd4f(simd4i* state)
+INLINE simd4i AudioR32ToI32Lanes(simd4f samples, simd4f scale, simd4f minValue, simd4f maxValue, simd4i* ditherState)
+INLINE simd4i AudioR32ToI16Lanes(simd4f low, simd4f high, simd4i* ditherState)
+INLINE void AudioI16LanesToR32(simd4i samples, simd4f* lowOut, simd4f* highOut)
+void ConvertSamplesR32ToI16(u32 numSamples, const r32* samples, i16* resultsOut, AudioDither_t* dither = nullptr)
+void ConvertSamplesR32ToI8(u32 numSamples, const r32* samples, i8* resultsOut, AudioDither_t* dither = nullptr)
+void ConvertSamplesR32ToI32(u32 numSamples, const r32* samples, i32* resultsOut)
+void ConvertSamplesI16ToR32(u32 numSamples, const i16* samples, r32* resultsOut)
+void ConvertSamplesI8ToR32(u32 numSamples, const i8* samples, r32* resultsOut)
+void ConvertSamplesI32ToR32(u32 numSamples, const i32* samples, r32* resultsOut)
+void InterleaveSamplesR32(u32 numFrames, u32 numChannels, const r32* const* channels, r32* interleavedOut)
+void DeinterleaveSamplesR32(u32 numFrames, u32 numChannels, const r32* interleaved, r32* const* channelsOut)
+void ConvertPlanarR32ToInterleavedI16(u32 numFrames, u32 numChannels, const r32* const* channels, i16* interleavedOut, AudioDither_t* dither = nullptr)
+void ConvertInterleavedI16ToPlanarR32(u32 numFrames, u32 numChannels, const i16* interleaved, r32* const* channelsOut)
+*/
@@ -0,0 +1,187 @@
+/*
+File:   orca_bit_set.h
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Holds BitSet_t, a fixed size array of bits that is allocated from an arena.
+	** Use this instead of FlagSet/IsFlagSet when a mask is wider than 64 bits
+	** (entity masks, visited lists, etc.). Bulk operations and searches work on
+	** 128 bits at a time using the simd4i functions in orca_simd.h
+*/
+
+#ifndef _ORCA_BIT_SET_H
+#define _ORCA_BIT_SET_H
+
+#define BIT_SET_WORD_NUM_BITS   32
+#define BIT_SET_BLOCK_NUM_WORDS 4 //words per simd4i, the allocation is always a whole number of blocks
+
+struct BitSet_t
+{
+	OC_Arena_t* arena;
+	u32 numBits;
+	u32 numWords; //always a multiple of BIT_SET_BLOCK_NUM_WORDS. Bits past numBits are always 0
+	u32* words;
+};
+
+// +--------------------------------------------------------------+
+// |                       Create and Free                        |
+// +--------------------------------------------------------------+
+//NOTE: Arena memory can't be given back individually, so this just clears the structure
+void FreeBitSet(BitSet_t* bitSet)
+{
+	NotNull(bitSet);
+	ClearPointer(bitSet);
+}
+//All bits start cleared
+void CreateBitSet(BitSet_t* bitSetOut, OC_Arena_t* arena, u32 numBits)
+{
+	NotNull2(bitSetOut, arena);
+	ClearPointer(bitSetOut);
+	bitSetOut->arena = arena;
+	bitSetOut->numBits = numBits;
+	bitSetOut->numWords = RoundUpToU32(CeilDivU32(numBits, BIT_SET_WORD_NUM_BITS), BIT_SET_BLOCK_NUM_WORDS);
+	if (bitSetOut->numWords > 0)
+	{
+		bitSetOut->words = (u32*)OC_ArenaPushAligned(arena, sizeof(u32) * bitSetOut->numWords, sizeof(u32) * BIT_SET_BLOCK_NUM_WORDS);
+		NotNull(bitSetOut->words);
+		memset(bitSetOut->words, 0x00, sizeof(u32) * bitSetOut->numWords);
+	}
+}
+
+// +--------------------------------------------------------------+
+// |                        Single Bit Ops                        |
+// +--------------------------------------------------------------+
+INLINE void BitSetSet(BitSet_t* bitSet, u32 index)
+{
+	DebugAssert(index < bitSet->numBits);
+	bitSet->words[index / BIT_SET_WORD_NUM_BITS] |= (1U << (index % BIT_SET_WORD_NUM_BITS));
+}
+INLINE void BitSetClear(BitSet_t* bitSet, u32 index)
+{
+	DebugAssert(index < bitSet->numBits);
+	bitSet->words[index / BIT_SET_WORD_NUM_BITS] &= ~(1U << (index % BIT_SET_WORD_NUM_BITS));
+}
+INLINE void BitSetSetTo(BitSet_t* bitSet, u32 index, bool value)
+{
+	if (value) { BitSetSet(bitSet, index); }
+	else { BitSetClear(bitSet, index); }
+}
+INLINE bool BitSetTest(const BitSet_t* bitSet, u32 index)
+{
+	DebugAssert(index < bitSet->numBits);
+	return ((bitSet->words[index / BIT_SET_WORD_NUM_BITS] & (1U << (index % BIT_SET_WORD_NUM_BITS))) != 0);
+}
+
+// +--------------------------------------------------------------+
+// |                        Whole Set Ops                         |
+// +--------------------------------------------------------------+
+void BitSetClearAll(BitSet_t* bitSet)
+{
+	NotNull(bitSet);
+	if (bitSet->numWords > 0) { memset(bitSet->words, 0x00, sizeof(u32) * bitSet->numWords); }
+}
+void BitSetSetAll(BitSet_t* bitSet)
+{
+	NotNull(bitSet);
+	if (bitSet->numBits == 0) { return; }
+	u32 numUsedWords = CeilDivU32(bitSet->numBits, BIT_SET_WORD_NUM_BITS);
+	memset(bitSet->words, 0xFF, sizeof(u32) * numUsedWords);
+	u32 numBitsInLastWord = bitSet->numBits % BIT_SET_WORD_NUM_BITS;
+	if (numBitsInLastWord != 0) { bitSet->words[numUsedWords-1] = (1U << numBitsInLastWord) - 1; }
+}
+u32 BitSetCount(const BitSet_t* bitSet)
+{
+	NotNull(bitSet);
+	u32 result = 0;
+	for (u32 wIndex = 0; wIndex < bitSet->numWords; wIndex++) { result += PopCountU32(bitSet->words[wIndex]); }
+	return result;
+}
+
+//Finds the first set bit at or after startIndex. Returns false if there are none
+bool BitSetFindNext(const BitSet_t* bitSet, u32 startIndex, u32* indexOut)
+{
+	NotNull(bitSet);
+	if (startIndex >= bitSet->numBits) { return false; }
+	simd4i zeroBlock = Simd4iFill(0);
+	u32 wIndex = startIndex / BIT_SET_WORD_NUM_BITS;
+	u32 word = bitSet->words[wIndex] & (0xFFFFFFFFU << (startIndex % BIT_SET_WORD_NUM_BITS));
+	while (word == 0)
+	{
+		wIndex++;
+		//Once we are at the start of a block we can skip 128 bits at a time until we find a block with something in it
+		if ((wIndex % BIT_SET_BLOCK_NUM_WORDS) == 0)
+		{
+			while (wIndex < bitSet->numWords && Simd4iMoveMask(Simd4iEqual(Simd4iLoad(&bitSet->words[wIndex]), zeroBlock)) == 0xF)
+			{
+				wIndex += BIT_SET_BLOCK_NUM_WORDS;
+			}
+		}
+		if (wIndex >= bitSet->numWords) { return false; }
+		word = bitSet->words[wIndex];
+	}
+	SetOptionalOutPntr(indexOut, (wIndex * BIT_SET_WORD_NUM_BITS) + CountTrailingZerosU32(word));
+	return true;
+}
+//Loops over the index of every set bit in ascending order
+#define BitSetLoop(bitSetPntr, indexName) for (u32 indexName = 0; BitSetFindNext((bitSetPntr), indexName, &indexName); indexName++)
+
+// +--------------------------------------------------------------+
+// |                          Bulk Ops                            |
+// +--------------------------------------------------------------+
+//NOTE: All 3 sets must have the same numBits. resultOut is allowed to be the same set as left or right
+void BitSetAnd(const BitSet_t* left, const BitSet_t* right, BitSet_t* resultOut)
+{
+	NotNull3(left, right, resultOut);
+	Assert(left->numBits == right->numBits && left->numBits == resultOut->numBits);
+	for (u32 wIndex = 0; wIndex < resultOut->numWords; wIndex += BIT_SET_BLOCK_NUM_WORDS)
+	{
+		Simd4iStore(&resultOut->words[wIndex], Simd4iAnd(Simd4iLoad(&left->words[wIndex]), Simd4iLoad(&right->words[wIndex])));
+	}
+}
+void BitSetOr(const BitSet_t* left, const BitSet_t* right, BitSet_t* resultOut)
+{
+	NotNull3(left, right, resultOut);
+	Assert(left->numBits == right->numBits && left->numBits == resultOut->numBits);
+	for (u32 wIndex = 0; wIndex < resultOut->numWords; wIndex += BIT_SET_BLOCK_NUM_WORDS)
+	{
+		Simd4iStore(&resultOut->words[wIndex], Simd4iOr(Simd4iLoad(&left->words[wIndex]), Simd4iLoad(&right->words[wIndex])));
+	}
+}
+//left & ~right (the bits in left that are not in right)
+void BitSetAndNot(const BitSet_t* left, const BitSet_t* right, BitSet_t* resultOut)
+{
+	NotNull3(left, right, resultOut);
+	Assert(left->numBits == right->numBits && left->numBits == resultOut->numBits);
+	for (u32 wIndex = 0; wIndex < resultOut->numWords; wIndex += BIT_SET_BLOCK_NUM_WORDS)
+	{
+		Simd4iStore(&resultOut->words[wIndex], Simd4iAndNot(Simd4iLoad(&left->words[wIndex]), Simd4iLoad(&right->words[wIndex])));
+	}
+}
+
+#endif //  _ORCA_BIT_SET_H
+
+// +--------------------------------------------------------------+
+// |                   Autocomplete Dictionary                    |
+// +--------------------------------------------------------------+
+/*
+@Defines
+BIT_SET_WORD_NUM_BITS
+BIT_SET_BLOCK_NUM_WORDS
+@Types
+BitSet_t
+@Functions
+void FreeBitSet(BitSet_t* bitSet)
+void CreateBitSet(BitSet_t* bitSetOut, OC_Arena_t* arena, u32 numBits)
+INLINE void BitSetSet(BitSet_t* bitSet, u32 index)
+INLINE void BitSetClear(BitSet_t* bitSet, u32 index)
+INLINE void BitSetSetTo(BitSet_t* bitSet, u32 index, bool value)
+INLINE bool BitSetTest(const BitSet_t* bitSet, u32 index)
+void BitSetClearAll(BitSet_t* bitSet)
+void BitSetSetAll(BitSet_t* bitSet)
+u32 BitSetCount(const BitSet_t* bitSet)
+bool BitSetFindNext(const BitSet_t* bitSet, u32 startIndex, u32* indexOut)
+#define BitSetLoop(bitSetPntr, indexName)
+void BitSetAnd(const BitSet_t* left, const BitSet_t* right, BitSet_t* resultOut)
+void BitSetOr(const BitSet_t* left, const BitSet_t* right, BitSet_t* resultOut)
+void BitSetAndNot(const BitSet_t* left, const BitSet_t* right, BitSet_t* resultOut)
+*/
@@ -0,0 +1,115 @@
+/*
+File:   orca_frame_arena.h
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Holds FrameArena_t, a pair of OC_Arena_t that trade places once per frame.
+	** Anything pushed during a frame stays valid for that frame and the one after
+	** it, then gets thrown away in bulk when the arena comes around again. Call
+	** FrameArenaSwap at the top of OC_OnFrameRefresh and never free anything
+	** that came from a frame arena individually
+*/
+
+#ifndef _ORCA_FRAME_ARENA_H
+#define _ORCA_FRAME_ARENA_H
+
+struct FrameArena_t
+{
+	OC_Arena_t arenas[2];
+	u32 currentIndex; //which of the arenas is being pushed to this frame
+	u64 frameIndex; //number of times FrameArenaSwap has been called
+};
+
+// +--------------------------------------------------------------+
+// |                       Create and Free                        |
+// +--------------------------------------------------------------+
+void FreeFrameArena(FrameArena_t* frameArena)
+{
+	NotNull(frameArena);
+	OC_ArenaCleanup(&frameArena->arenas[0]);
+	OC_ArenaCleanup(&frameArena->arenas[1]);
+	ClearPointer(frameArena);
+}
+//options is optional, pass it to pick a larger reserve than the Orca default. Both arenas get the same options
+void CreateFrameArena(FrameArena_t* frameArenaOut, OC_ArenaOptions_t* options = nullptr)
+{
+	NotNull(frameArenaOut);
+	ClearPointer(frameArenaOut);
+	for (u32 aIndex = 0; aIndex < ArrayCount(frameArenaOut->arenas); aIndex++)
+	{
+		if (options != nullptr) { OC_ArenaInitWithOptions(&frameArenaOut->arenas[aIndex], options); }
+		else { OC_ArenaInit(&frameArenaOut->arenas[aIndex]); }
+	}
+}
+
+// +--------------------------------------------------------------+
+// |                         Frame Update                         |
+// +--------------------------------------------------------------+
+//Call once at the start of OC_OnFrameRefresh. Clears everything pushed two frames ago and makes that arena current
+void FrameArenaSwap(FrameArena_t* frameArena)
+{
+	NotNull(frameArena);
+	frameArena->currentIndex ^= 1;
+	OC_ArenaClear(&frameArena->arenas[frameArena->currentIndex]);
+	frameArena->frameIndex++;
+}
+
+//The current arena can be passed to anything that takes an OC_Arena_t (OC_Str8Pushf, OC_ArenaScopeBegin, etc.)
+INLINE OC_Arena_t* FrameArenaGet(FrameArena_t* frameArena)
+{
+	return &frameArena->arenas[frameArena->currentIndex];
+}
+//Holds whatever was pushed last frame. Still valid until the next FrameArenaSwap
+INLINE OC_Arena_t* FrameArenaGetPrev(FrameArena_t* frameArena)
+{
+	return &frameArena->arenas[frameArena->currentIndex ^ 1];
+}
+
+// +--------------------------------------------------------------+
+// |                        Push Functions                        |
+// +--------------------------------------------------------------+
+INLINE void* FrameArenaPush(FrameArena_t* frameArena, u64 size)
+{
+	return OC_ArenaPush(FrameArenaGet(frameArena), size);
+}
+INLINE void* FrameArenaPushAligned(FrameArena_t* frameArena, u64 size, u32 alignment)
+{
+	return OC_ArenaPushAligned(FrameArenaGet(frameArena), size, alignment);
+}
+#define FrameArenaPushType(frameArenaPntr, type)         OC_ArenaPushType(FrameArenaGet(frameArenaPntr), type)
+#define FrameArenaPushArray(frameArenaPntr, type, count) OC_ArenaPushArray(FrameArenaGet(frameArenaPntr), type, (count))
+
+//Copies a value or buffer into the frame arena so it survives until the end of next frame
+INLINE void* FrameArenaPushCopy(FrameArena_t* frameArena, const void* data, u64 size, u32 alignment)
+{
+	void* result = FrameArenaPushAligned(frameArena, size, alignment);
+	NotNull(result);
+	if (size > 0) { memcpy(result, data, size); }
+	return result;
+}
+INLINE MyStr_t FrameArenaPushStr(FrameArena_t* frameArena, MyStr_t str)
+{
+	return OC_Str8PushCopy(FrameArenaGet(frameArena), str);
+}
+
+#endif //  _ORCA_FRAME_ARENA_H
+
+// +--------------------------------------------------------------+
+// |                   Autocomplete Dictionary                    |
+// +--------------------------------------------------------------+
+/*
+@Types
+FrameArena_t
+@Functions
+void FreeFrameArena(FrameArena_t* frameArena)
+void CreateFrameArena(FrameArena_t* frameArenaOut, OC_ArenaOptions_t* options = nullptr)
+void FrameArenaSwap(FrameArena_t* frameArena)
+INLINE OC_Arena_t* FrameArenaGet(FrameArena_t* frameArena)
+INLINE OC_Arena_t* FrameArenaGetPrev(FrameArena_t* frameArena)
+INLINE void* FrameArenaPush(FrameArena_t* frameArena, u64 size)
+INLINE void* FrameArenaPushAligned(FrameArena_t* frameArena, u64 size, u32 alignment)
+#define FrameArenaPushType(frameArenaPntr, type)
+#define FrameArenaPushArray(frameArenaPntr, type, count)
+INLINE void* FrameArenaPushCopy(FrameArena_t* frameArena, const void* data, u64 size, u32 alignment)
+INLINE MyStr_t FrameArenaPushStr(FrameArena_t* frameArena, MyStr_t str)
+*/
@@ -0,0 +1,419 @@
+/*
+File:   orca_hash_map.h
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Holds HashMap_t, an open-addressing hash map keyed by either MyStr_t or
+	** u32/u64 integers with fixed-size values, all stored in an OC_Arena_t.
+	** The layout follows SwissTable: every slot has a control byte that is either
+	** empty, deleted, or the low 7 bits of the key's hash. Slots are probed 16 at a
+	** time by comparing a whole group of control bytes at once (see the byte lane
+	** functions in orca_simd.h) so a lookup usually touches one group and compares
+	** one key. The full 64-bit hash is cached next to each key.
+	** String keys are copied into the arena when they are added so the caller's
+	** string doesn't need to stay alive
+*/
+
+#ifndef _ORCA_HASH_MAP_H
+#define _ORCA_HASH_MAP_H
+
+// +--------------------------------------------------------------+
+// |                        Hash Functions                        |
+// +--------------------------------------------------------------+
+//Finalizer from splitmix64, every input bit affects every output bit
+INLINE u64 HashU64(u64 value)
+{
+	value ^= (value >> 30);
+	value *= 0xBF58476D1CE4E5B9ULL;
+	value ^= (value >> 27);
+	value *= 0x94D049BB133111EBULL;
+	value ^= (value >> 31);
+	return value;
+}
+//Reads 8 bytes at a time. Not cryptographic, just fast and well distributed
+u64 HashBytes(const void* data, u64 numBytes, u64 seed = 0)
+{
+	Assert(data != nullptr || numBytes == 0);
+	const u8* bytes = (const u8*)data;
+	u64 result = seed ^ (numBytes * 0x9E3779B97F4A7C15ULL);
+	u64 bIndex = 0;
+	for (; bIndex + sizeof(u64) <= numBytes; bIndex += sizeof(u64))
+	{
+		u64 word;
+		memcpy(&word, &bytes[bIndex], sizeof(word));
+		result = RotateLeftU64(result ^ (word * 0x87C37B91114253D5ULL), 31) * 0x4CF5AD432745937FULL;
+	}
+	if (bIndex < numBytes)
+	{
+		u64 word = 0;
+		memcpy(&word, &bytes[bIndex], numBytes - bIndex);
+		result = RotateLeftU64(result ^ (word * 0x87C37B91114253D5ULL), 31) * 0x4CF5AD432745937FULL;
+	}
+	return HashU64(result);
+}
+INLINE u64 HashStr(MyStr_t str)
+{
+	return HashBytes(str.pntr, str.length);
+}
+
+// +--------------------------------------------------------------+
+// |                           Hash Map                           |
+// +--------------------------------------------------------------+
+#define HASH_MAP_GROUP_SIZE    16 //slots per control group, one simd4i worth of control bytes
+#define HASH_MAP_CTRL_EMPTY    0x80
+#define HASH_MAP_CTRL_DELETED  0xFE
+//Full slots have a control byte of 0x00-0x7F (the low 7 bits of the hash) so the top bit means "not full"
+
+enum HashMapKeyType_t
+{
+	HashMapKeyType_U64 = 0, //u32 keys are stored as u64
+	HashMapKeyType_Str,
+	HashMapKeyType_NumTypes,
+};
+
+struct HashMapEntry_t
+{
+	u64 hash;
+	union
+	{
+		u64 intKey;
+		MyStr_t strKey;
+	};
+	//value follows at valueOffset
+};
+
+struct HashMap_t
+{
+	OC_Arena_t* arena;
+	HashMapKeyType_t keyType;
+	u64 valueSize;
+	u32 valueAlignment;
+	u64 valueOffset; //from the start of each entry
+	u64 entryStride;
+
+	u32 numGroups; //always a power of 2
+	u32 capacity; //numGroups * HASH_MAP_GROUP_SIZE
+	u32 count;
+	u32 numDeleted; //tombstones, they count against the load factor until the next rehash
+	u8* controls; //capacity bytes, 16-byte aligned
+	u8* entries; //capacity * entryStride bytes
+};
+
+// +==============================+
+// |       Create and Free        |
+// +==============================+
+//NOTE: Arena memory can't be given back individually, so this just clears the structure
+void FreeHashMap(HashMap_t* map)
+{
+	NotNull(map);
+	ClearPointer(map);
+}
+
+//Points the map at fresh control and entry arrays with room for at least numSlots. Doesn't move the old entries
+void HashMapAllocSlots(HashMap_t* map, u32 numSlots)
+{
+	u32 numGroups = NextPowerOfTwoU32(Max<u32>(CeilDivU32(numSlots, HASH_MAP_GROUP_SIZE), 1));
+	Assert(numGroups != 0);
+	map->numGroups = numGroups;
+	map->capacity = numGroups * HASH_MAP_GROUP_SIZE;
+	map->count = 0;
+	map->numDeleted = 0;
+	map->controls = (u8*)OC_ArenaPushAligned(map->arena, map->capacity, sizeof(simd4i));
+	map->entries = (u8*)OC_ArenaPushAligned(map->arena, map->entryStride * map->capacity, Max<u32>(map->valueAlignment, _Alignof(HashMapEntry_t)));
+	NotNull2(map->controls, map->entries);
+	memset(map->controls, HASH_MAP_CTRL_EMPTY, map->capacity);
+}
+
+//initialCapacity is how many items can be added before the first rehash. valueSize may be 0 to use the map as a set
+void CreateHashMap(HashMap_t* mapOut, OC_Arena_t* arena, HashMapKeyType_t keyType, u64 valueSize, u32 initialCapacity = 0, u32 valueAlignment = 0)
+{
+	NotNull2(mapOut, arena);
+	Assert(keyType < HashMapKeyType_NumTypes);
+	ClearPointer(mapOut);
+	mapOut->arena = arena;
+	mapOut->keyType = keyType;
+	mapOut->valueSize = valueSize;
+	mapOut->valueAlignment = (valueAlignment > 0) ? valueAlignment : 1;
+	Assert(IsPowerOfTwoU32(mapOut->valueAlignment));
+	mapOut->valueOffset = RoundUpToU64(sizeof(HashMapEntry_t), mapOut->valueAlignment);
+	mapOut->entryStride = RoundUpToU64(mapOut->valueOffset + valueSize, Max<u32>(mapOut->valueAlignment, _Alignof(HashMapEntry_t)));
+	if (initialCapacity > 0) { HashMapAllocSlots(mapOut, initialCapacity + (initialCapacity / 7)); }
+}
+#define CreateHashMapType(mapOutPntr, arena, keyType, valueType, initialCapacity) CreateHashMap((mapOutPntr), (arena), (keyType), sizeof(valueType), (initialCapacity), _Alignof(valueType))
+
+// +==============================+
+// |         Slot Access          |
+// +==============================+
+INLINE HashMapEntry_t* HashMapGetEntry(const HashMap_t* map, u32 slotIndex)
+{
+	return (HashMapEntry_t*)(map->entries + (slotIndex * map->entryStride));
+}
+INLINE void* HashMapGetValue(const HashMap_t* map, u32 slotIndex)
+{
+	return map->entries + (slotIndex * map->entryStride) + map->valueOffset;
+}
+//Turns a value pointer returned by Get/Add back into its entry (to read the cached hash or the arena copy of a string key)
+INLINE HashMapEntry_t* HashMapGetEntryForValue(const HashMap_t* map, const void* valuePntr)
+{
+	return (HashMapEntry_t*)((u8*)valuePntr - map->valueOffset);
+}
+INLINE bool HashMapIsSlotFull(const HashMap_t* map, u32 slotIndex)
+{
+	return ((map->controls[slotIndex] & 0x80) == 0);
+}
+//Loops over the slot index of every item, use HashMapGetEntry and HashMapGetValue to get at them. Don't add or remove inside the loop
+#define HashMapLoop(mapPntr, slotIndexName) for (u32 slotIndexName = 0; slotIndexName < (mapPntr)->capacity; slotIndexName++) if (HashMapIsSlotFull((mapPntr), slotIndexName))
+
+INLINE u8 HashMapGetCtrl(u64 hash)
+{
+	return (u8)(hash & 0x7F);
+}
+//The low 7 bits go in the control byte so the group is picked from the rest of the hash
+INLINE u32 HashMapGetStartGroup(const HashMap_t* map, u64 hash)
+{
+	return (u32)(hash >> 7) & (map->numGroups - 1);
+}
+
+// +==============================+
+// |            Lookup            |
+// +==============================+
+//Returns the slot index holding the key, or -1 if it's not in the map. strKey is only used for string maps and intKey for integer maps
+i32 HashMapFindSlot(const HashMap_t* map, u64 hash, MyStr_t strKey, u64 intKey)
+{
+	if (map->count == 0) { return -1; }
+	simd4i ctrlMatch = Simd4iFillU8(HashMapGetCtrl(hash));
+	simd4i ctrlEmpty = Simd4iFillU8(HASH_MAP_CTRL_EMPTY);
+	u32 groupIndex = HashMapGetStartGroup(map, hash);
+	//Triangular probing visits every group exactly once when numGroups is a power of 2
+	for (u32 probeIndex = 0; probeIndex < map->numGroups; probeIndex++)
+	{
+		simd4i group = Simd4iLoad(&map->controls[groupIndex * HASH_MAP_GROUP_SIZE]);
+		u32 matchBits = Simd4iMoveMaskU8(Simd4iEqualU8(group, ctrlMatch));
+		while (matchBits != 0)
+		{
+			u32 slotIndex = (groupIndex * HASH_MAP_GROUP_SIZE) + CountTrailingZerosU32(matchBits);
+			const HashMapEntry_t* entry = HashMapGetEntry(map, slotIndex);
+			if (entry->hash == hash)
+			{
+				if (map->keyType == HashMapKeyType_U64)
+				{
+					if (entry->intKey == intKey) { return (i32)slotIndex; }
+				}
+				else if (entry->strKey.length == strKey.length && (strKey.length == 0 || memcmp(entry->strKey.pntr, strKey.pntr, strKey.length) == 0))
+				{
+					return (i32)slotIndex;
+				}
+			}
+			matchBits &= (matchBits - 1);
+		}
+		//A group with an empty slot ends every probe sequence that reaches it, so the key can't be any further along
+		if (Simd4iMoveMaskU8(Simd4iEqualU8(group, ctrlEmpty)) != 0) { return -1; }
+		groupIndex = (groupIndex + probeIndex + 1) & (map->numGroups - 1);
+	}
+	return -1;
+}
+
+INLINE void* HashMapGetU64(const HashMap_t* map, u64 key)
+{
+	i32 slotIndex = HashMapFindSlot(map, HashU64(key), NewStr(0, nullptr), key);
+	return (slotIndex >= 0) ? HashMapGetValue(map, (u32)slotIndex) : nullptr;
+}
+INLINE void* HashMapGetU32(const HashMap_t* map, u32 key)
+{
+	return HashMapGetU64(map, (u64)key);
+}
+INLINE void* HashMapGetStr(const HashMap_t* map, MyStr_t key)
+{
+	i32 slotIndex = HashMapFindSlot(map, HashStr(key), key, 0);
+	return (slotIndex >= 0) ? HashMapGetValue(map, (u32)slotIndex) : nullptr;
+}
+
+// +==============================+
+// |             Add              |
+// +==============================+
+//Finds the first empty or deleted slot along the key's probe sequence. The map must have at least one free slot
+u32 HashMapFindFreeSlot(const HashMap_t* map, u64 hash)
+{
+	u32 groupIndex = HashMapGetStartGroup(map, hash);
+	for (u32 probeIndex = 0; probeIndex < map->numGroups; probeIndex++)
+	{
+		//Both empty and deleted have the top bit set, so the control bytes are already the mask we want
+		u32 freeBits = Simd4iMoveMaskU8(Simd4iLoad(&map->controls[groupIndex * HASH_MAP_GROUP_SIZE]));
+		if (freeBits != 0) { return (groupIndex * HASH_MAP_GROUP_SIZE) + CountTrailingZerosU32(freeBits); }
+		groupIndex = (groupIndex + probeIndex + 1) & (map->numGroups - 1);
+	}
+	Assert(false); //map is completely full, HashMapReserve should have prevented this
+	return 0;
+}
+
+//Re-inserts every item into new control and entry arrays with at least numSlots slots. The old arrays are left in the arena
+void HashMapRehash(HashMap_t* map, u32 numSlots)
+{
+	NotNull(map);
+	Assert(numSlots - (numSlots / 8) >= map->count);
+	u8* oldControls = map->controls;
+	u8* oldEntries = map->entries;
+	u32 oldCapacity = map->capacity;
+	u32 oldCount = map->count;
+	HashMapAllocSlots(map, numSlots);
+	for (u32 oldIndex = 0; oldIndex < oldCapacity; oldIndex++)
+	{
+		if ((oldControls[oldIndex] & 0x80) != 0) { continue; }
+		const HashMapEntry_t* oldEntry = (const HashMapEntry_t*)(oldEntries + (oldIndex * map->entryStride));
+		u32 newIndex = HashMapFindFreeSlot(map, oldEntry->hash);
+		map->controls[newIndex] = HashMapGetCtrl(oldEntry->hash);
+		memcpy(HashMapGetEntry(map, newIndex), oldEntry, map->entryStride);
+	}
+	map->count = oldCount;
+}
+//Makes sure numItemsToAdd more items fit while keeping the load (items plus tombstones) at or under 7/8
+void HashMapReserve(HashMap_t* map, u32 numItemsToAdd)
+{
+	NotNull(map);
+	u32 numRequired = map->count + map->numDeleted + numItemsToAdd;
+	if (map->capacity > 0 && numRequired <= map->capacity - (map->capacity / 8)) { return; }
+	//When it's mostly tombstones a rehash at the same size is enough to clean them up, otherwise double
+	u32 numItems = map->count + numItemsToAdd;
+	u32 numSlots = Max<u32>(map->capacity, HASH_MAP_GROUP_SIZE);
+	while (numItems > numSlots - (numSlots / 8)) { numSlots *= 2; }
+	HashMapRehash(map, numSlots);
+}
+
+//Returns the value for the key, adding it (with a zeroed value) if it's not already in the map. isNewOut is optional
+void* HashMapAddSlot(HashMap_t* map, u64 hash, MyStr_t strKey, u64 intKey, bool* isNewOut)
+{
+	i32 existingIndex = HashMapFindSlot(map, hash, strKey, intKey);
+	if (existingIndex >= 0)
+	{
+		SetOptionalOutPntr(isNewOut, false);
+		return HashMapGetValue(map, (u32)existingIndex);
+	}
+	HashMapReserve(map, 1);
+	u32 slotIndex = HashMapFindFreeSlot(map, hash);
+	if (map->controls[slotIndex] == HASH_MAP_CTRL_DELETED) { map->numDeleted--; }
+	map->controls[slotIndex] = HashMapGetCtrl(hash);
+	map->count++;
+	HashMapEntry_t* entry = HashMapGetEntry(map, slotIndex);
+	entry->hash = hash;
+	if (map->keyType == HashMapKeyType_U64) { entry->intKey = intKey; }
+	else
+	{
+		entry->strKey = NewStr(strKey.length, nullptr);
+		if (strKey.length > 0)
+		{
+			entry->strKey.pntr = (char*)OC_ArenaPush(map->arena, strKey.length);
+			NotNull(entry->strKey.pntr);
+			memcpy(entry->strKey.pntr, strKey.pntr, strKey.length);
+		}
+	}
+	void* result = HashMapGetValue(map, slotIndex);
+	if (map->valueSize > 0) { memset(result, 0x00, map->valueSize); }
+	SetOptionalOutPntr(isNewOut, true);
+	return result;
+}
+INLINE void* HashMapAddU64(HashMap_t* map, u64 key, bool* isNewOut = nullptr)
+{
+	DebugAssert(map->keyType == HashMapKeyType_U64);
+	return HashMapAddSlot(map, HashU64(key), NewStr(0, nullptr), key, isNewOut);
+}
+INLINE void* HashMapAddU32(HashMap_t* map, u32 key, bool* isNewOut = nullptr)
+{
+	return HashMapAddU64(map, (u64)key, isNewOut);
+}
+INLINE void* HashMapAddStr(HashMap_t* map, MyStr_t key, bool* isNewOut = nullptr)
+{
+	DebugAssert(map->keyType == HashMapKeyType_Str);
+	return HashMapAddSlot(map, HashStr(key), key, 0, isNewOut);
+}
+
+// +==============================+
+// |            Remove            |
+// +==============================+
+void HashMapRemoveSlot(HashMap_t* map, u32 slotIndex)
+{
+	NotNull(map);
+	Assert(slotIndex < map->capacity && HashMapIsSlotFull(map, slotIndex));
+	//If this group still has an empty slot no probe sequence ever continued past it, so the slot can go straight back to empty
+	u32 groupStart = slotIndex - (slotIndex % HASH_MAP_GROUP_SIZE);
+	bool groupHasEmpty = (Simd4iMoveMaskU8(Simd4iEqualU8(Simd4iLoad(&map->controls[groupStart]), Simd4iFillU8(HASH_MAP_CTRL_EMPTY))) != 0);
+	map->controls[slotIndex] = groupHasEmpty ? HASH_MAP_CTRL_EMPTY : HASH_MAP_CTRL_DELETED;
+	if (!groupHasEmpty) { map->numDeleted++; }
+	map->count--;
+}
+INLINE bool HashMapRemoveU64(HashMap_t* map, u64 key)
+{
+	i32 slotIndex = HashMapFindSlot(map, HashU64(key), NewStr(0, nullptr), key);
+	if (slotIndex < 0) { return false; }
+	HashMapRemoveSlot(map, (u32)slotIndex);
+	return true;
+}
+INLINE bool HashMapRemoveU32(HashMap_t* map, u32 key)
+{
+	return HashMapRemoveU64(map, (u64)key);
+}
+INLINE bool HashMapRemoveStr(HashMap_t* map, MyStr_t key)
+{
+	i32 slotIndex = HashMapFindSlot(map, HashStr(key), key, 0);
+	if (slotIndex < 0) { return false; }
+	HashMapRemoveSlot(map, (u32)slotIndex);
+	return true;
+}
+
+//Removes everything but keeps the slot arrays. String keys that were copied stay in the arena
+void HashMapClear(HashMap_t* map)
+{
+	NotNull(map);
+	if (map->capacity > 0) { memset(map->controls, HASH_MAP_CTRL_EMPTY, map->capacity); }
+	map->count = 0;
+	map->numDeleted = 0;
+}
+
+#endif //  _ORCA_HASH_MAP_H
+
+// +--------------------------------------------------------------+
+// |                   Autocomplete Dictionary                    |
+// +--------------------------------------------------------------+
+/*
+@Defines
+HASH_MAP_GROUP_SIZE
+HASH_MAP_CTRL_EMPTY
+HASH_MAP_CTRL_DELETED
+HashMapKeyType_U64
+HashMapKeyType_Str
+HashMapKeyType_NumTypes
+@Types
+HashMapKeyType_t
+HashMapEntry_t
+HashMap_t
+@Functions
+INLINE u64 HashU64(u64 value)
+u64 HashBytes(const void* data, u64 numBytes, u64 seed = 0)
+INLINE u64 HashStr(MyStr_t str)
+void FreeHashMap(HashMap_t* map)
+void HashMapAllocSlots(HashMap_t* map, u32 numSlots)
+void CreateHashMap(HashMap_t* mapOut, OC_Arena_t* arena, HashMapKeyType_t keyType, u64 valueSize, u32 initialCapacity = 0, u32 valueAlignment = 0)
+#define CreateHashMapType(mapOutPntr, arena, keyType, valueType, initialCapacity)
+INLINE HashMapEntry_t* HashMapGetEntry(const HashMap_t* map, u32 slotIndex)
+INLINE void* HashMapGetValue(const HashMap_t* map, u32 slotIndex)
+INLINE HashMapEntry_t* HashMapGetEntryForValue(const HashMap_t* map, const void* valuePntr)
+INLINE bool HashMapIsSlotFull(const HashMap_t* map, u32 slotIndex)
+#define HashMapLoop(mapPntr, slotIndexName)
+INLINE u8 HashMapGetCtrl(u64 hash)
+INLINE u32 HashMapGetStartGroup(const HashMap_t* map, u64 hash)
+i32 HashMapFindSlot(const HashMap_t* map, u64 hash, MyStr_t strKey, u64 intKey)
+INLINE void* HashMapGetU64(const HashMap_t* map, u64 key)
+INLINE void* HashMapGetU32(const HashMap_t* map, u32 key)
+INLINE void* HashMapGetStr(const HashMap_t* map, MyStr_t key)
+u32 HashMapFindFreeSlot(const HashMap_t* map, u64 hash)
+void HashMapRehash(HashMap_t* map, u32 numSlots)
+void HashMapReserve(HashMap_t* map, u32 numItemsToAdd)
+void* HashMapAddSlot(HashMap_t* map, u64 hash, MyStr_t strKey, u64 intKey, bool* isNewOut)
+INLINE void* HashMapAddU64(HashMap_t* map, u64 key, bool* isNewOut = nullptr)
+INLINE void* HashMapAddU32(HashMap_t* map, u32 key, bool* isNewOut = nullptr)
+INLINE void* HashMapAddStr(HashMap_t* map, MyStr_t key, bool* isNewOut = nullptr)
+void HashMapRemoveSlot(HashMap_t* map, u32 slotIndex)
+INLINE bool HashMapRemoveU64(HashMap_t* map, u64 key)
+INLINE bool HashMapRemoveU32(HashMap_t* map, u32 key)
+INLINE bool HashMapRemoveStr(HashMap_t* map, MyStr_t key)
+void HashMapClear(HashMap_t* map)
+*/
@@ -13,121 +13,140 @@ Description:
 #ifndef _ORCA_INTRINSICS_H
 #define _ORCA_INTRINSICS_H
 
+// +--------------------------------------------------------------+
+// |                      Generic Functions                       |
+// +--------------------------------------------------------------+
+//NOTE: The typed functions below (MinR32, ClampI32, AbsDiffU8, etc.) are thin wrappers around these templates.
+//      Everything is a single ternary/arithmetic expression so it can be evaluated at compile time and so the
+//      compiler emits min/max/select instructions instead of branches (which lets loops that use them auto-vectorize).
+//      Min/Max keep the argument order of the old hand-written versions, and Clamp keeps the old compare order:
+//      a NaN value passes through, and when min > max values below min give min and everything else gives max
+template <typename T> constexpr T Min(T value1, T value2) { return (value1 < value2) ? value1 : value2; }
+template <typename T> constexpr T Max(T value1, T value2) { return (value1 > value2) ? value1 : value2; }
+template <typename T, typename... Rest> constexpr T Min(T value1, T value2, T value3, Rest... rest) { return Min(value1, Min(value2, value3, rest...)); }
+template <typename T, typename... Rest> constexpr T Max(T value1, T value2, T value3, Rest... rest) { return Max(value1, Max(value2, value3, rest...)); }
+//NOTE: Same result as (value < min) ? min : ((value > max) ? max : value), but working out the upper side first lets gcc use minss and a select for floats instead of a branch
+template <typename T> constexpr T Clamp(T value, T min, T max) { T upper = (value > max) ? max : value; return (value < min) ? min : upper; }
+template <typename T> constexpr T Abs(T value) { return (value < 0) ? (T)(-value) : value; }
+template <typename T> constexpr T SignOf(T value) { return (T)((value > 0) - (value < 0)); }
+template <typename T> constexpr T AbsDiff(T value1, T value2) { return (value1 > value2) ? (T)(value1 - value2) : (T)(value2 - value1); }
+template <typename T> constexpr T Lerp(T start, T end, T amount) { return start + (end - start) * amount; }
+
 // +--------------------------------------------------------------+
 // |                        Min Functions                         |
 // +--------------------------------------------------------------+
-	inline u32 MinU32(u32 value1, u32 value2)
+	constexpr u32 MinU32(u32 value1, u32 value2)
 	{
-		return (value1 < value2) ? value1 : value2;
+		return Min(value1, value2);
 	}
-	inline u32 MinU32(u32 value1, u32 value2, u32 value3)
+	constexpr u32 MinU32(u32 value1, u32 value2, u32 value3)
 	{
 		return MinU32(value1, MinU32(value2, value3));
 	}
-	inline u32 MinU32(u32 value1, u32 value2, u32 value3, u32 value4)
+	constexpr u32 MinU32(u32 value1, u32 value2, u32 value3, u32 value4)
 	{
 		return MinU32(value1, MinU32(value2, MinU32(value3, value4)));
 	}
-	inline u32 MinU32(u32 value1, u32 value2, u32 value3, u32 value4, u32 value5)
+	constexpr u32 MinU32(u32 value1, u32 value2, u32 value3, u32 value4, u32 value5)
 	{
 		return MinU32(value1, MinU32(value2, MinU32(value3, MinU32(value4, value5))));
 	}
-	inline u32 MinU32(u32 value1, u32 value2, u32 value3, u32 value4, u32 value5, u32 value6)
+	constexpr u32 MinU32(u32 value1, u32 value2, u32 value3, u32 value4, u32 value5, u32 value6)
 	{
 		return MinU32(value1, MinU32(value2, MinU32(value3, MinU32(value4, MinU32(value5, value6)))));
 	}
-	inline u32 MinU32(u32 value1, u32 value2, u32 value3, u32 value4, u32 value5, u32 value6, u32 value7)
+	constexpr u32 MinU32(u32 value1, u32 value2, u32 value3, u32 value4, u32 value5, u32 value6, u32 value7)
 	{
 		return MinU32(value1, MinU32(value2, MinU32(value3, MinU32(value4, MinU32(value5, MinU32(value6, value7))))));
 	}
-	inline u32 MinU32(u32 value1, u32 value2, u32 value3, u32 value4, u32 value5, u32 value6, u32 value7, u32 value8)
+	constexpr u32 MinU32(u32 value1, u32 value2, u32 value3, u32 value4, u32 value5, u32 value6, u32 value7, u32 value8)
 	{
 		return MinU32(value1, MinU32(value2, MinU32(value3, MinU32(value4, MinU32(value5, MinU32(value6, MinU32(value7, value8)))))));
 	}
 	
-	inline i32 MinI32(i32 value1, i32 value2)
+	constexpr i32 MinI32(i32 value1, i32 value2)
 	{
-		return (value1 < value2) ? value1 : value2;
+		return Min(value1, value2);
 	}
-	inline i32 MinI32(i32 value1, i32 value2, i32 value3)
+	constexpr i32 MinI32(i32 value1, i32 value2, i32 value3)
 	{
 		return MinI32(value1, MinI32(value2, value3));
 	}
-	inline i32 MinI32(i32 value1, i32 value2, i32 value3, i32 value4)
+	constexpr i32 MinI32(i32 value1, i32 value2, i32 value3, i32 value4)
 	{
 		return MinI32(value1, MinI32(value2, MinI32(value3, value4)));
 	}
-	inline i32 MinI32(i32 value1, i32 value2, i32 value3, i32 value4, i32 value5)
+	constexpr i32 MinI32(i32 value1, i32 value2, i32 value3, i32 value4, i32 value5)
 	{
 		return MinI32(value1, MinI32(value2, MinI32(value3, MinI32(value4, value5))));
 	}
-	inline i32 MinI32(i32 value1, i32 value2, i32 value3, i32 value4, i32 value5, i32 value6)
+	constexpr i32 MinI32(i32 value1, i32 value2, i32 value3, i32 value4, i32 value5, i32 value6)
 	{
 		return MinI32(value1, MinI32(value2, MinI32(value3, MinI32(value4, MinI32(value5, value6)))));
 	}
-	inline i32 MinI32(i32 value1, i32 value2, i32 value3, i32 value4, i32 value5, i32 value6, i32 value7)
+	constexpr i32 MinI32(i32 value1, i32 value2, i32 value3, i32 value4, i32 value5, i32 value6, i32 value7)
 	{
 		return MinI32(value1, MinI32(value2, MinI32(value3, MinI32(value4, MinI32(value5, MinI32(value6, value7))))));
 	}
-	inline i32 MinI32(i32 value1, i32 value2, i32 value3, i32 value4, i32 value5, i32 value6, i32 value7, i32 value8)
+	constexpr i32 MinI32(i32 value1, i32 value2, i32 value3, i32 value4, i32 value5, i32 value6, i32 value7, i32 value8)
 	{
 		return MinI32(value1, MinI32(value2, MinI32(value3, MinI32(value4, MinI32(value5, MinI32(value6, MinI32(value7, value8)))))));
 	}
 	
-	inline r32 MinR32(r32 value1, r32 value2)
+	constexpr r32 MinR32(r32 value1, r32 value2)
 	{
-		return ((value1 < value2) ? value1 : value2);
+		return Min(value1, value2);
 	}
-	inline r32 MinR32(r32 value1, r32 value2, r32 value3)
+	constexpr r32 MinR32(r32 value1, r32 value2, r32 value3)
 	{
 		return MinR32(value1, MinR32(value2, value3));
 	}
-	inline r32 MinR32(r32 value1, r32 value2, r32 value3, r32 value4)
+	constexpr r32 MinR32(r32 value1, r32 value2, r32 value3, r32 value4)
 	{
 		return MinR32(value1, MinR32(value2, MinR32(value3, value4)));
 	}
-	inline r32 MinR32(r32 value1, r32 value2, r32 value3, r32 value4, r32 value5)
+	constexpr r32 MinR32(r32 value1, r32 value2, r32 value3, r32 value4, r32 value5)
 	{
 		return MinR32(value1, MinR32(value2, MinR32(value3, MinR32(value4, value5))));
 	}
-	inline r32 MinR32(r32 value1, r32 value2, r32 value3, r32 value4, r32 value5, r32 value6)
+	constexpr r32 MinR32(r32 value1, r32 value2, r32 value3, r32 value4, r32 value5, r32 value6)
 	{
 		return MinR32(value1, MinR32(value2, MinR32(value3, MinR32(value4, MinR32(value5, value6)))));
 	}
-	inline r32 MinR32(r32 value1, r32 value2, r32 value3, r32 value4, r32 value5, r32 value6, r32 value7)
+	constexpr r32 MinR32(r32 value1, r32 value2, r32 value3, r32 value4, r32 value5, r32 value6, r32 value7)
 	{
 		return MinR32(value1, MinR32(value2, MinR32(value3, MinR32(value4, MinR32(value5, MinR32(value6, value7))))));
 	}
-	inline r32 MinR32(r32 value1, r32 value2, r32 value3, r32 value4, r32 value5, r32 value6, r32 value7, r32 value8)
+	constexpr r32 MinR32(r32 value1, r32 value2, r32 value3, r32 value4, r32 value5, r32 value6, r32 value7, r32 value8)
 	{
 		return MinR32(value1, MinR32(value2, MinR32(value3, MinR32(value4, MinR32(value5, MinR32(value6, MinR32(value7, value8)))))));
 	}
 	
-	inline r64 MinR64(r64 value1, r64 value2)
+	constexpr r64 MinR64(r64 value1, r64 value2)
 	{
-		return ((value1 < value2) ? value1 : value2);
+		return Min(value1, value2);
 	}
-	inline r64 MinR64(r64 value1, r64 value2, r64 value3)
+	constexpr r64 MinR64(r64 value1, r64 value2, r64 value3)
 	{
 		return MinR64(value1, MinR64(value2, value3));
 	}
-	inline r64 MinR64(r64 value1, r64 value2, r64 value3, r64 value4)
+	constexpr r64 MinR64(r64 value1, r64 value2, r64 value3, r64 value4)
 	{
 		return MinR64(value1, MinR64(value2, MinR64(value3, value4)));
 	}
-	inline r64 MinR64(r64 value1, r64 value2, r64 value3, r64 value4, r64 value5)
+	constexpr r64 MinR64(r64 value1, r64 value2, r64 value3, r64 value4, r64 value5)
 	{
 		return MinR64(value1, MinR64(value2, MinR64(value3, MinR64(value4, value5))));
 	}
-	inline r64 MinR64(r64 value1, r64 value2, r64 value3, r64 value4, r64 value5, r64 value6)
+	constexpr r64 MinR64(r64 value1, r64 value2, r64 value3, r64 value4, r64 value5, r64 value6)
 	{
 		return MinR64(value1, MinR64(value2, MinR64(value3, MinR64(value4, MinR64(value5, value6)))));
 	}
-	inline r64 MinR64(r64 value1, r64 value2, r64 value3, r64 value4, r64 value5, r64 value6, r64 value7)
+	constexpr r64 MinR64(r64 value1, r64 value2, r64 value3, r64 value4, r64 value5, r64 value6, r64 value7)
 	{
 		return MinR64(value1, MinR64(value2, MinR64(value3, MinR64(value4, MinR64(value5, MinR64(value6, value7))))));
 	}
-	inline r64 MinR64(r64 value1, r64 value2, r64 value3, r64 value4, r64 value5, r64 value6, r64 value7, r64 value8)
+	constexpr r64 MinR64(r64 value1, r64 value2, r64 value3, r64 value4, r64 value5, r64 value6, r64 value7, r64 value8)
 	{
 		return MinR64(value1, MinR64(value2, MinR64(value3, MinR64(value4, MinR64(value5, MinR64(value6, MinR64(value7, value8)))))));
 	}
@@ -136,118 +155,118 @@ Description:
 // +--------------------------------------------------------------+
 // |                        Max Functions                         |
 // +--------------------------------------------------------------+
-	inline u32 MaxU32(u32 value1, u32 value2)
+	constexpr u32 MaxU32(u32 value1, u32 value2)
 	{
-		return (value1 > value2) ? value1 : value2;
+		return Max(value1, value2);
 	}
-	inline u32 MaxU32(u32 value1, u32 value2, u32 value3)
+	constexpr u32 MaxU32(u32 value1, u32 value2, u32 value3)
 	{
 		return MaxU32(value1, MaxU32(value2, value3));
 	}
-	inline u32 MaxU32(u32 value1, u32 value2, u32 value3, u32 value4)
+	constexpr u32 MaxU32(u32 value1, u32 value2, u32 value3, u32 value4)
 	{
 		return MaxU32(value1, MaxU32(value2, MaxU32(value3, value4)));
 	}
-	inline u32 MaxU32(u32 value1, u32 value2, u32 value3, u32 value4, u32 value5)
+	constexpr u32 MaxU32(u32 value1, u32 value2, u32 value3, u32 value4, u32 value5)
 	{
 		return MaxU32(value1, MaxU32(value2, MaxU32(value3, MaxU32(value4, value5))));
 	}
-	inline u32 MaxU32(u32 value1, u32 value2, u32 value3, u32 value4, u32 value5, u32 value6)
+	constexpr u32 MaxU32(u32 value1, u32 value2, u32 value3, u32 value4, u32 value5, u32 value6)
 	{
 		return MaxU32(value1, MaxU32(value2, MaxU32(value3, MaxU32(value4, MaxU32(value5, value6)))));
 	}
-	inline u32 MaxU32(u32 value1, u32 value2, u32 value3, u32 value4, u32 value5, u32 value6, u32 value7)
+	constexpr u32 MaxU32(u32 value1, u32 value2, u32 value3, u32 value4, u32 value5, u32 value6, u32 value7)
 	{
 		return MaxU32(value1, MaxU32(value2, MaxU32(value3, MaxU32(value4, MaxU32(value5, MaxU32(value6, value7))))));
 	}
-	inline u32 MaxU32(u32 value1, u32 value2, u32 value3, u32 value4, u32 value5, u32 value6, u32 value7, u32 value8)
+	constexpr u32 MaxU32(u32 value1, u32 value2, u32 value3, u32 value4, u32 value5, u32 value6, u32 value7, u32 value8)
 	{
 		return MaxU32(value1, MaxU32(value2, MaxU32(value3, MaxU32(value4, MaxU32(value5, MaxU32(value6, MaxU32(value7, value8)))))));
 	}
 	
-	inline i32 MaxI32(i32 value1, i32 value2)
+	constexpr i32 MaxI32(i32 value1, i32 value2)
 	{
-		return (value1 > value2) ? value1 : value2;
+		return Max(value1, value2);
 	}
-	inline i32 MaxI32(i32 value1, i32 value2, i32 value3)
+	constexpr i32 MaxI32(i32 value1, i32 value2, i32 value3)
 	{
 		return MaxI32(value1, MaxI32(value2, value3));
 	}
-	inline i32 MaxI32(i32 value1, i32 value2, i32 value3, i32 value4)
+	constexpr i32 MaxI32(i32 value1, i32 value2, i32 value3, i32 value4)
 	{
 		return MaxI32(value1, MaxI32(value2, MaxI32(value3, value4)));
 	}
-	inline i32 MaxI32(i32 value1, i32 value2, i32 value3, i32 value4, i32 value5)
+	constexpr i32 MaxI32(i32 value1, i32 value2, i32 value3, i32 value4, i32 value5)
 	{
 		return MaxI32(value1, MaxI32(value2, MaxI32(value3, MaxI32(value4, value5))));
 	}
-	inline i32 MaxI32(i32 value1, i32 value2, i32 value3, i32 value4, i32 value5, i32 value6)
+	constexpr i32 MaxI32(i32 value1, i32 value2, i32 value3, i32 value4, i32 value5, i32 value6)
 	{
 		return MaxI32(value1, MaxI32(value2, MaxI32(value3, MaxI32(value4, MaxI32(value5, value6)))));
 	}
-	inline i32 MaxI32(i32 value1, i32 value2, i32 value3, i32 value4, i32 value5, i32 value6, i32 value7)
+	constexpr i32 MaxI32(i32 value1, i32 value2, i32 value3, i32 value4, i32 value5, i32 value6, i32 value7)
 	{
 		return MaxI32(value1, MaxI32(value2, MaxI32(value3, MaxI32(value4, MaxI32(value5, MaxI32(value6, value7))))));
 	}
-	inline i32 MaxI32(i32 value1, i32 value2, i32 value3, i32 value4, i32 value5, i32 value6, i32 value7, i32 value8)
+	constexpr i32 MaxI32(i32 value1, i32 value2, i32 value3, i32 value4, i32 value5, i32 value6, i32 value7, i32 value8)
 	{
 		return MaxI32(value1, MaxI32(value2, MaxI32(value3, MaxI32(value4, MaxI32(value5, MaxI32(value6, MaxI32(value7, value8)))))));
 	}
 	
-	inline r32 MaxR32(r32 value1, r32 value2)
+	constexpr r32 MaxR32(r32 value1, r32 value2)
 	{
-		return ((value1 > value2) ? value1 : value2);
+		return Max(value1, value2);
 	}
-	inline r32 MaxR32(r32 value1, r32 value2, r32 value3)
+	constexpr r32 MaxR32(r32 value1, r32 value2, r32 value3)
 	{
 		return MaxR32(value1, MaxR32(value2, value3));
 	}
-	inline r32 MaxR32(r32 value1, r32 value2, r32 value3, r32 value4)
+	constexpr r32 MaxR32(r32 value1, r32 value2, r32 value3, r32 value4)
 	{
 		return MaxR32(value1, MaxR32(value2, MaxR32(value3, value4)));
 	}
-	inline r32 MaxR32(r32 value1, r32 value2, r32 value3, r32 value4, r32 value5)
+	constexpr r32 MaxR32(r32 value1, r32 value2, r32 value3, r32 value4, r32 value5)
 	{
 		return MaxR32(value1, MaxR32(value2, MaxR32(value3, MaxR32(value4, value5))));
 	}
-	inline r32 MaxR32(r32 value1, r32 value2, r32 value3, r32 value4, r32 value5, r32 value6)
+	constexpr r32 MaxR32(r32 value1, r32 value2, r32 value3, r32 value4, r32 value5, r32 value6)
 	{
 		return MaxR32(value1, MaxR32(value2, MaxR32(value3, MaxR32(value4, MaxR32(value5, value6)))));
 	}
-	inline r32 MaxR32(r32 value1, r32 value2, r32 value3, r32 value4, r32 value5, r32 value6, r32 value7)
+	constexpr r32 MaxR32(r32 value1, r32 value2, r32 value3, r32 value4, r32 value5, r32 value6, r32 value7)
 	{
 		return MaxR32(value1, MaxR32(value2, MaxR32(value3, MaxR32(value4, MaxR32(value5, MaxR32(value6, value7))))));
 	}
-	inline r32 MaxR32(r32 value1, r32 value2, r32 value3, r32 value4, r32 value5, r32 value6, r32 value7, r32 value8)
+	constexpr r32 MaxR32(r32 value1, r32 value2, r32 value3, r32 value4, r32 value5, r32 value6, r32 value7, r32 value8)
 	{
 		return MaxR32(value1, MaxR32(value2, MaxR32(value3, MaxR32(value4, MaxR32(value5, MaxR32(value6, MaxR32(value7, value8)))))));
 	}
 	
-	inline r64 MaxR64(r64 value1, r64 value2)
+	constexpr r64 MaxR64(r64 value1, r64 value2)
 	{
-		return ((value1 > value2) ? value1 : value2);
+		return Max(value1, value2);
 	}
-	inline r64 MaxR64(r64 value1, r64 value2, r64 value3)
+	constexpr r64 MaxR64(r64 value1, r64 value2, r64 value3)
 	{
 		return MaxR64(value1, MaxR64(value2, value3));
 	}
-	inline r64 MaxR64(r64 value1, r64 value2, r64 value3, r64 value4)
+	constexpr r64 MaxR64(r64 value1, r64 value2, r64 value3, r64 value4)
 	{
 		return MaxR64(value1, MaxR64(value2, MaxR64(value3, value4)));
 	}
-	inline r64 MaxR64(r64 value1, r64 value2, r64 value3, r64 value4, r64 value5)
+	constexpr r64 MaxR64(r64 value1, r64 value2, r64 value3, r64 value4, r64 value5)
 	{
 		return MaxR64(value1, MaxR64(value2, MaxR64(value3, MaxR64(value4, value5))));
 	}
-	inline r64 MaxR64(r64 value1, r64 value2, r64 value3, r64 value4, r64 value5, r64 value6)
+	constexpr r64 MaxR64(r64 value1, r64 value2, r64 value3, r64 value4, r64 value5, r64 value6)
 	{
 		return MaxR64(value1, MaxR64(value2, MaxR64(value3, MaxR64(value4, MaxR64(value5, value6)))));
 	}
-	inline r64 MaxR64(r64 value1, r64 value2, r64 value3, r64 value4, r64 value5, r64 value6, r64 value7)
+	constexpr r64 MaxR64(r64 value1, r64 value2, r64 value3, r64 value4, r64 value5, r64 value6, r64 value7)
 	{
 		return MaxR64(value1, MaxR64(value2, MaxR64(value3, MaxR64(value4, MaxR64(value5, MaxR64(value6, value7))))));
 	}
-	inline r64 MaxR64(r64 value1, r64 value2, r64 value3, r64 value4, r64 value5, r64 value6, r64 value7, r64 value8)
+	constexpr r64 MaxR64(r64 value1, r64 value2, r64 value3, r64 value4, r64 value5, r64 value6, r64 value7, r64 value8)
 	{
 		return MaxR64(value1, MaxR64(value2, MaxR64(value3, MaxR64(value4, MaxR64(value5, MaxR64(value6, MaxR64(value7, value8)))))));
 	}
@@ -267,26 +286,27 @@ inline r64 AbsR64(r64 value)
 {
 	return fabs(value);
 }
-inline i8 AbsI8(i8 value)
+constexpr i8 AbsI8(i8 value)
 {
-	return (value < 0) ? -value : value;
+	return Abs(value);
 }
-inline i16 AbsI16(i16 value)
+constexpr i16 AbsI16(i16 value)
 {
-	return (value < 0) ? -value : value;
+	return Abs(value);
 }
-inline i32 AbsI32(i32 value)
+constexpr i32 AbsI32(i32 value)
 {
-	return (value < 0 ? -value : value);
+	return Abs(value);
 }
-inline i64 AbsI64(i64 value)
+constexpr i64 AbsI64(i64 value)
 {
-	return (value < 0 ? -value : value);
+	return Abs(value);
 }
 
 // +==============================+
 // |            Round             |
 // +==============================+
+//NOTE: These truncate value + 0.5, so negative values round towards zero (-1.7 => -1) rather than to the nearest. Known and left as is for now, tests/test_intrinsics.cpp pins it down
 inline r32 RoundR32(r32 value)
 {
 	return (r32)((i32)(value + 0.5f));
@@ -549,127 +569,93 @@ inline r64 CbrtR64(r64 value)
 // +==============================+
 // |             Sign             |
 // +==============================+
-//TODO: Should this use intrinsic calls?
-inline r32 SignOfR32(r32 value)
+constexpr r32 SignOfR32(r32 value)
 {
-	     if (value < 0) { return -1; }
-	else if (value > 0) { return  1; }
-	else                { return  0; }
+	return SignOf(value);
 }
-inline r64 SignOfR64(r64 value)
+constexpr r64 SignOfR64(r64 value)
 {
-	     if (value < 0) { return -1; }
-	else if (value > 0) { return  1; }
-	else                { return  0; }
+	return SignOf(value);
 }
-inline i8 SignOfI8(i8 value)
+constexpr i8 SignOfI8(i8 value)
 {
-	     if (value < 0) { return -1; }
-	else if (value > 0) { return  1; }
-	else                { return  0; }
+	return SignOf(value);
 }
-inline i16 SignOfI16(i16 value)
+constexpr i16 SignOfI16(i16 value)
 {
-	     if (value < 0) { return -1; }
-	else if (value > 0) { return  1; }
-	else                { return  0; }
+	return SignOf(value);
 }
-inline i32 SignOfI32(i32 value)
+constexpr i32 SignOfI32(i32 value)
 {
-	     if (value < 0) { return -1; }
-	else if (value > 0) { return  1; }
-	else                { return  0; }
+	return SignOf(value);
 }
-inline i64 SignOfI64(i64 value)
+constexpr i64 SignOfI64(i64 value)
 {
-	     if (value < 0) { return -1; }
-	else if (value > 0) { return  1; }
-	else                { return  0; }
+	return SignOf(value);
 }
 
 // +==============================+
 // |            Clamp             |
 // +==============================+
-//TODO: Should these use intrinsic calls of some sort?
-inline r32 ClampR32(r32 value, r32 min, r32 max)
+constexpr r32 ClampR32(r32 value, r32 min, r32 max)
 {
-	if (value < min) { return min; }
-	else if (value > max) { return max; }
-	else { return value; }
+	return Clamp(value, min, max);
 }
-inline r64 ClampR64(r64 value, r64 min, r64 max)
+constexpr r64 ClampR64(r64 value, r64 min, r64 max)
 {
-	if (value < min) { return min; }
-	else if (value > max) { return max; }
-	else { return value; }
+	return Clamp(value, min, max);
 }
-inline i8 ClampI8(i8 value, i8 min, i8 max)
+constexpr i8 ClampI8(i8 value, i8 min, i8 max)
 {
-	if (value < min) { return min; }
-	else if (value > max) { return max; }
-	else { return value; }
+	return Clamp(value, min, max);
 }
-inline i16 ClampI16(i16 value, i16 min, i16 max)
+constexpr i16 ClampI16(i16 value, i16 min, i16 max)
 {
-	if (value < min) { return min; }
-	else if (value > max) { return max; }
-	else { return value; }
+	return Clamp(value, min, max);
 }
-inline i32 ClampI32(i32 value, i32 min, i32 max)
+constexpr i32 ClampI32(i32 value, i32 min, i32 max)
 {
-	if (value < min) { return min; }
-	else if (value > max) { return max; }
-	else { return value; }
+	return Clamp(value, min, max);
 }
-inline i64 ClampI64(i64 value, i64 min, i64 max)
+constexpr i64 ClampI64(i64 value, i64 min, i64 max)
 {
-	if (value < min) { return min; }
-	else if (value > max) { return max; }
-	else { return value; }
+	return Clamp(value, min, max);
 }
-inline u8 ClampU8(u8 value, u8 min, u8 max)
+constexpr u8 ClampU8(u8 value, u8 min, u8 max)
 {
-	if (value < min) { return min; }
-	else if (value > max) { return max; }
-	else { return value; }
+	return Clamp(value, min, max);
 }
-inline u16 ClampU16(u16 value, u16 min, u16 max)
+constexpr u16 ClampU16(u16 value, u16 min, u16 max)
 {
-	if (value < min) { return min; }
-	else if (value > max) { return max; }
-	else { return value; }
+	return Clamp(value, min, max);
 }
-inline u32 ClampU32(u32 value, u32 min, u32 max)
+constexpr u32 ClampU32(u32 value, u32 min, u32 max)
 {
-	if (value < min) { return min; }
-	else if (value > max) { return max; }
-	else { return value; }
+	return Clamp(value, min, max);
 }
-inline u64 ClampU64(u64 value, u64 min, u64 max)
+constexpr u64 ClampU64(u64 value, u64 min, u64 max)
 {
-	if (value < min) { return min; }
-	else if (value > max) { return max; }
-	else { return value; }
+	return Clamp(value, min, max);
 }
 
 // +==============================+
 // |             Lerp             |
 // +==============================+
-inline r32 LerpR32(r32 val1, r32 val2, r32 amount)
+constexpr r32 LerpR32(r32 val1, r32 val2, r32 amount)
 {
-	return (val1 + (val2 - val1) * amount);
+	return Lerp(val1, val2, amount);
 }
-inline r64 LerpR64(r64 val1, r64 val2, r64 amount)
+constexpr r64 LerpR64(r64 val1, r64 val2, r64 amount)
 {
-	return (val1 + (val2 - val1) * amount);
+	return Lerp(val1, val2, amount);
 }
-inline r32 LerpClampR32(r32 val1, r32 val2, r32 amount)
+constexpr r32 LerpClampR32(r32 val1, r32 val2, r32 amount)
 {
-	return ClampR32(val1 + (val2 - val1) * amount, MinR32(val1, val2), MaxR32(val1, val2));
+	return Clamp(Lerp(val1, val2, amount), Min(val1, val2), Max(val1, val2));
 }
-inline r64 LerpClampR64(r64 val1, r64 val2, r64 amount)
+constexpr r64 LerpClampR64(r64 val1, r64 val2, r64 amount)
 {
-	return ClampR64(val1 + (val2 - val1) * amount, MinR64(val1, val2), MaxR64(val1, val2));
+	return Clamp(Lerp(val1, val2, amount), Min(val1, val2), Max(val1, val2));
 }
 
 // +==============================+
@@ -688,6 +674,34 @@ inline r64 InverseLerpR64(r64 start, r64 end, r64 value, bool clamp = false)
 	return result;
 }
 
+// +==============================+
+// |            Remap             |
+// +==============================+
+//Maps value from the range [fromMin, fromMax] to [toMin, toMax] (values outside the range are extrapolated)
+inline r32 RemapR32(r32 value, r32 fromMin, r32 fromMax, r32 toMin, r32 toMax)
+{
+	return toMin + (value - fromMin) * ((toMax - toMin) / (fromMax - fromMin));
+}
+inline r64 RemapR64(r64 value, r64 fromMin, r64 fromMax, r64 toMin, r64 toMax)
+{
+	return toMin + (value - fromMin) * ((toMax - toMin) / (fromMax - fromMin));
+}
+
+// +==============================+
+// |          SmoothStep          |
+// +==============================+
+//Hermite curve (3t^2 - 2t^3) that goes from 0 at edge0 to 1 at edge1, same as the GLSL smoothstep
+inline r32 SmoothStepR32(r32 edge0, r32 edge1, r32 value)
+{
+	r32 amount = ClampR32((value - edge0) / (edge1 - edge0), 0.0f, 1.0f);
+	return amount * amount * (3.0f - 2.0f * amount);
+}
+inline r64 SmoothStepR64(r64 edge0, r64 edge1, r64 value)
+{
+	r64 amount = ClampR64((value - edge0) / (edge1 - edge0), 0.0, 1.0);
+	return amount * amount * (3.0 - 2.0 * amount);
+}
+
 //TODO: Rename to FractionalPart
 //TODO: This returns what I think is an unexpected result for negative numbers. For example DecimalPartR32(-7.2f) = 0.8f
 // +==============================+
@@ -716,7 +730,6 @@ inline r64 ModR64(r64 numerator, r64 denominator)
 	return fmod(numerator, denominator);
 }
 
-//TODO: Rename these "ClampCast"
 // +================================+
 // | Primitive Conversion Functions |
 // +================================+
@@ -731,57 +744,99 @@ inline i8 ReadI8FromU8(u8 value)
 	i8 result = *((i8*)&value);
 	return result;
 }
-inline i8 ClampI32toI8(i32 value)
+
+// +==============================+
+// |          ClampCast           |
+// +==============================+
+//Casts to a smaller type, saturating at the edges of the destination range instead of wrapping
+constexpr i8 ClampCastI32ToI8(i32 value)
 {
-	if (value > 127) { return 127; }
-	if (value < -128) { return -128; }
-	return (i8)value;
+	return (i8)Clamp<i32>(value, INT8_MIN, INT8_MAX);
 }
-inline u8 ClampI32toU8(i32 value)
+constexpr u8 ClampCastI32ToU8(i32 value)
 {
-	if (value > 255) { return 255; }
-	if (value < 0) { return 0; }
-	return (u8)value;
+	return (u8)Clamp<i32>(value, 0, UINT8_MAX);
 }
-inline i16 ClampI32toI16(i32 value)
+constexpr i16 ClampCastI32ToI16(i32 value)
 {
-	if (value > 32767) { return 32767; }
-	if (value < -32768) { return -32768; }
-	return (i16)value;
+	return (i16)Clamp<i32>(value, INT16_MIN, INT16_MAX);
 }
-inline u32 ClampI32toU32(i32 value)
+constexpr u32 ClampCastI32ToU32(i32 value)
 {
-	if (value < 0) { return 0; }
-	return (u32)value;
+	return (u32)Max<i32>(value, 0);
 }
-inline i32 ClampU32toI32(u32 value)
+constexpr i32 ClampCastU32ToI32(u32 value)
 {
-	if (value > 0x7FFFFFFF) { return (i32)0x7FFFFFFF; }
-	return (i32)value;
+	return (i32)Min<u32>(value, INT32_MAX);
 }
-inline i16 ClampR32toI16(r32 value)
+//The float versions round to nearest (ties to even, the same as the simd conversions). NaN becomes the minimum of the range
+//NOTE: ClampR32/ClampR64 pass NaN through and casting NaN to an integer is undefined, so it gets checked for explicitly
+inline i16 ClampCastR32ToI16(r32 value)
+{
+	if (isnan(value)) { return INT16_MIN; }
+	return (i16)rintf(ClampR32(value, (r32)INT16_MIN, (r32)INT16_MAX));
+}
+//NOTE: r32 can't represent INT32_MAX, so the largest result is 2147483520 (the biggest float below 2^31)
+inline i32 ClampCastR32ToI32(r32 value)
+{
+	if (isnan(value)) { return INT32_MIN; }
+	return (i32)rintf(ClampR32(value, (r32)INT32_MIN, 2147483520.0f));
+}
+inline i32 ClampCastR64ToI32(r64 value)
 {
-	i32 roundedValue = RoundR32i(value);
-	if (roundedValue > 0x7FFF) { return 0x7FFF; }
-	else if (roundedValue < -0x8000) { return -0x8000; }
-	else { return (i16)roundedValue; }
+	if (isnan(value)) { return INT32_MIN; }
+	return (i32)rint(ClampR64(value, (r64)INT32_MIN, (r64)INT32_MAX));
+}
+
+//NOTE: Older names for the ClampCast functions
+inline i8 ClampI32toI8(i32 value) { return ClampCastI32ToI8(value); }
+inline u8 ClampI32toU8(i32 value) { return ClampCastI32ToU8(value); }
+inline i16 ClampI32toI16(i32 value) { return ClampCastI32ToI16(value); }
+inline u32 ClampI32toU32(i32 value) { return ClampCastI32ToU32(value); }
+inline i32 ClampU32toI32(u32 value) { return ClampCastU32ToI32(value); }
+inline i16 ClampR32toI16(r32 value) { return ClampCastR32ToI16(value); }
+//Reinterpret the bits of a float as an integer (and back) without any conversion
+inline u32 R32ToBits(r32 value)
+{
+	u32 result;
+	memcpy(&result, &value, sizeof(result));
+	return result;
+}
+inline r32 BitsToR32(u32 bits)
+{
+	r32 result;
+	memcpy(&result, &bits, sizeof(result));
+	return result;
+}
+inline u64 R64ToBits(r64 value)
+{
+	u64 result;
+	memcpy(&result, &value, sizeof(result));
+	return result;
+}
+inline r64 BitsToR64(u64 bits)
+{
+	r64 result;
+	memcpy(&result, &bits, sizeof(result));
+	return result;
 }
 
-// TODO: Use ClampCast in these conversions!
 // +==============================+
 // |      ConvertSampleXToY       |
 // +==============================+
+//NOTE: Samples are scaled by the positive max of the integer type (so -1.0 maps to -INT16_MAX, not INT16_MIN).
+//      Integer conversions go through ClampCast so samples outside [-1, 1] clip instead of wrapping
 inline i8 ConvertSampleR64ToI8(r64 sample)
 {
-	return (i8)RoundR64i(sample * INT8_MAX);
+	return ClampCastI32ToI8(ClampCastR64ToI32(sample * INT8_MAX));
 }
 inline i16 ConvertSampleR64ToI16(r64 sample)
 {
-	return (i16)RoundR64i(sample * INT16_MAX);
+	return ClampCastI32ToI16(ClampCastR64ToI32(sample * INT16_MAX));
 }
 inline i32 ConvertSampleR64ToI32(r64 sample)
 {
-	return (i32)RoundR64i(sample * INT32_MAX);
+	return ClampCastR64ToI32(sample * INT32_MAX);
 }
 inline r64 ConvertSampleI8ToR64(i8 sampleI8)
 {
@@ -795,6 +850,31 @@ inline r64 ConvertSampleI32ToR64(i32 sampleI32)
 {
 	return ((r64)sampleI32 / (r64)INT32_MAX);
 }
+//The r32 versions multiply by the reciprocal so they give exactly the same results as the buffer converters in orca_audio.h
+inline i8 ConvertSampleR32ToI8(r32 sample)
+{
+	return ClampCastI32ToI8(ClampCastR32ToI32(sample * (r32)INT8_MAX));
+}
+inline i16 ConvertSampleR32ToI16(r32 sample)
+{
+	return ClampCastR32ToI16(sample * (r32)INT16_MAX);
+}
+inline i32 ConvertSampleR32ToI32(r32 sample)
+{
+	return ClampCastR32ToI32(sample * (r32)INT32_MAX);
+}
+inline r32 ConvertSampleI8ToR32(i8 sampleI8)
+{
+	return (r32)sampleI8 * (1.0f / (r32)INT8_MAX);
+}
+inline r32 ConvertSampleI16ToR32(i16 sampleI16)
+{
+	return (r32)sampleI16 * (1.0f / (r32)INT16_MAX);
+}
+inline r32 ConvertSampleI32ToR32(i32 sampleI32)
+{
+	return (r32)sampleI32 * (1.0f / (r32)INT32_MAX);
+}
 
 // +==============================+
 // |        BasicallyEqual        |
@@ -835,65 +915,156 @@ inline bool BasicallyBetweenR64(r64 value, r64 min, r64 max, r64 tolerance = 0.0
 	return ((value > min && value < max) || BasicallyEqualR64(value, min, tolerance) || BasicallyEqualR64(value, max, tolerance));
 }
 
+// +==============================+
+// |           PopCount           |
+// +==============================+
+//Number of bits that are set
+inline u8 PopCountU32(u32 value)
+{
+	return (u8)__builtin_popcount(value);
+}
+inline u8 PopCountU64(u64 value)
+{
+	return (u8)__builtin_popcountll(value);
+}
+
+// +==============================+
+// |    Count Leading/Trailing    |
+// +==============================+
+//NOTE: These return the bit width (32 or 64) when value is 0 (the builtins are undefined for 0)
+inline u8 CountLeadingZerosU32(u32 value)
+{
+	return (value != 0) ? (u8)__builtin_clz(value) : 32;
+}
+inline u8 CountLeadingZerosU64(u64 value)
+{
+	return (value != 0) ? (u8)__builtin_clzll(value) : 64;
+}
+inline u8 CountTrailingZerosU32(u32 value)
+{
+	return (value != 0) ? (u8)__builtin_ctz(value) : 32;
+}
+inline u8 CountTrailingZerosU64(u64 value)
+{
+	return (value != 0) ? (u8)__builtin_ctzll(value) : 64;
+}
+
+// +==============================+
+// |          PowerOfTwo          |
+// +==============================+
+inline bool IsPowerOfTwoU32(u32 value)
+{
+	return (value != 0 && (value & (value - 1)) == 0);
+}
+inline bool IsPowerOfTwoU64(u64 value)
+{
+	return (value != 0 && (value & (value - 1)) == 0);
+}
+//Smallest power of two that is >= value (0 and 1 both give 1). Returns 0 if the result doesn't fit
+inline u32 NextPowerOfTwoU32(u32 value)
+{
+	if (value <= 1) { return 1; }
+	if (value > 0x80000000U) { return 0; }
+	return (1U << (32 - CountLeadingZerosU32(value - 1)));
+}
+inline u64 NextPowerOfTwoU64(u64 value)
+{
+	if (value <= 1) { return 1; }
+	if (value > 0x8000000000000000ULL) { return 0; }
+	return (1ULL << (64 - CountLeadingZerosU64(value - 1)));
+}
+
+// +==============================+
+// |            Rotate            |
+// +==============================+
+//NOTE: The compiler recognizes this pattern and emits a single rotate instruction (i32.rotl in WASM)
+inline u32 RotateLeftU32(u32 value, u8 amount)
+{
+	amount &= 31;
+	return (value << amount) | (value >> ((32 - amount) & 31));
+}
+inline u32 RotateRightU32(u32 value, u8 amount)
+{
+	amount &= 31;
+	return (value >> amount) | (value << ((32 - amount) & 31));
+}
+inline u64 RotateLeftU64(u64 value, u8 amount)
+{
+	amount &= 63;
+	return (value << amount) | (value >> ((64 - amount) & 63));
+}
+inline u64 RotateRightU64(u64 value, u8 amount)
+{
+	amount &= 63;
+	return (value >> amount) | (value << ((64 - amount) & 63));
+}
+
+// +==============================+
+// |       Wide Multiplies        |
+// +==============================+
+//Full 128-bit product of two u64, returns the high half and writes the low half to lowOut
+inline u64 MultiplyU64Full(u64 left, u64 right, u64* lowOut)
+{
+	#if defined(__SIZEOF_INT128__)
+	unsigned __int128 product = (unsigned __int128)left * right;
+	*lowOut = (u64)product;
+	return (u64)(product >> 64);
+	#else
+	u64 leftLow = (left & 0xFFFFFFFF), leftHigh = (left >> 32);
+	u64 rightLow = (right & 0xFFFFFFFF), rightHigh = (right >> 32);
+	u64 lowLow = leftLow * rightLow;
+	u64 lowHigh = leftLow * rightHigh;
+	u64 highLow = leftHigh * rightLow;
+	u64 middle = (lowLow >> 32) + (lowHigh & 0xFFFFFFFF) + (highLow & 0xFFFFFFFF);
+	*lowOut = (middle << 32) | (lowLow & 0xFFFFFFFF);
+	return (leftHigh * rightHigh) + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+	#endif
+}
+
 // +==============================+
 // |          FlagsDiff           |
 // +==============================+
 //Counts the number of bits that are different between 2 u8 values
 inline u8 FlagsDiffU8(u8 flags1, u8 flags2)
 {
-	u8 diff = (u8)(flags1 ^ flags2); //TODO: Can we get a garunteed u8 XOR on VS2013 and not have to do a u8 cast?
-	u8 result = 0;
-	while (diff != 0)
-	{
-		if (diff & 0x01) { result++; }
-		diff >>= 1;
-	}
-	return result;
+	return PopCountU32((u32)(flags1 ^ flags2));
 }
 
 // +==============================+
 // |           AbsDiff            |
 // +==============================+
-inline u8 AbsDiffU8(u8 value1, u8 value2)
+constexpr u8 AbsDiffU8(u8 value1, u8 value2)
 {
-	if (value1 > value2) { return value1 - value2; }
-	else { return value2 - value1; }
+	return AbsDiff(value1, value2);
 }
-inline u16 AbsDiffU16(u16 value1, u16 value2)
+constexpr u16 AbsDiffU16(u16 value1, u16 value2)
 {
-	if (value1 > value2) { return value1 - value2; }
-	else { return value2 - value1; }
+	return AbsDiff(value1, value2);
 }
-inline u32 AbsDiffU32(u32 value1, u32 value2)
+constexpr u32 AbsDiffU32(u32 value1, u32 value2)
 {
-	if (value1 > value2) { return value1 - value2; }
-	else { return value2 - value1; }
+	return AbsDiff(value1, value2);
 }
-inline u64 AbsDiffU64(u64 value1, u64 value2)
+constexpr u64 AbsDiffU64(u64 value1, u64 value2)
 {
-	if (value1 > value2) { return value1 - value2; }
-	else { return value2 - value1; }
+	return AbsDiff(value1, value2);
 }
 
-inline i8 AbsDiffI8(i8 value1, i8 value2)
+constexpr i8 AbsDiffI8(i8 value1, i8 value2)
 {
-	if (value1 > value2) { return value1 - value2; }
-	else { return value2 - value1; }
+	return AbsDiff(value1, value2);
 }
-inline i16 AbsDiffI16(i16 value1, i16 value2)
+constexpr i16 AbsDiffI16(i16 value1, i16 value2)
 {
-	if (value1 > value2) { return value1 - value2; }
-	else { return value2 - value1; }
+	return AbsDiff(value1, value2);
 }
-inline i32 AbsDiffI32(i32 value1, i32 value2)
+constexpr i32 AbsDiffI32(i32 value1, i32 value2)
 {
-	if (value1 > value2) { return value1 - value2; }
-	else { return value2 - value1; }
+	return AbsDiff(value1, value2);
 }
-inline i64 AbsDiffI64(i64 value1, i64 value2)
+constexpr i64 AbsDiffI64(i64 value1, i64 value2)
 {
-	if (value1 > value2) { return value1 - value2; }
-	else { return value2 - value1; }
+	return AbsDiff(value1, value2);
 }
 
 // +==============================+
@@ -1061,6 +1232,479 @@ r64 AngleLerpR64(r64 angleFrom, r64 angleTo, r64 amount)
 	return from + (to - from) * amount;
 }
 
+// +--------------------------------------------------------------+
+// |                   Fast Math Approximations                   |
+// +--------------------------------------------------------------+
+//NOTE: These are opt-in replacements for the libm wrappers above (SinR32, AtanR32, PowR32, etc.)
+//      They never call into libm, are branchless (so the Array versions map directly onto orca_simd.h)
+//      and are built from range reduction plus the minimax polynomials from the Cephes single precision library.
+//      The error bounds listed on each function were measured by sweeping the stated domain against the r64 libm result
+//      (tests/test_fast_math.cpp, which fails if any of them are exceeded). ULP means the error divided by the spacing
+//      of r32 values at the exact result, epsilon is 2^-23.
+//      Don't build these with -ffast-math, FastRoundR32 relies on the add and subtract not being folded together!
+#define FAST_ROUND_MAGIC_R32  12582912.0f              //1.5 * 2^23, adding this pushes all fractional bits out of the mantissa
+#define FAST_PIO2_PART1_R32   1.5703125f               //Pi/2 split into 3 parts so (angle - quadrant*Pi/2) stays exact for |quadrant| < 2^13
+#define FAST_PIO2_PART2_R32   4.837512969970703125e-4f
+#define FAST_PIO2_PART3_R32   7.54978995489188216e-8f
+#define FAST_TWO_OVER_PI_R32  0.636619772367581343f
+#define FAST_LOG2_E_R32       1.44269504088896341f
+#define FAST_LN2_HI_R32       0.693359375f             //ln(2) split so (exponent * FAST_LN2_HI_R32) is exact
+#define FAST_LN2_LO_R32       -2.12194440e-4f
+#define FAST_SQRT_HALF_BITS   0x3F3504F3               //bits of sqrtf(0.5f)
+
+//Rounds to the nearest integer (ties to even). Only valid for |value| < 2^22
+inline r32 FastRoundR32(r32 value)
+{
+	return (value + FAST_ROUND_MAGIC_R32) - FAST_ROUND_MAGIC_R32;
+}
+
+// +==============================+
+// |         Sin/Cos Fast         |
+// +==============================+
+//Max absolute error 7.8e-8 for |angle| <= 8192 (both sin and cos) (accuracy falls off past that because of the range reduction)
+inline void SinCosFastR32(r32 angle, r32* sinOut, r32* cosOut)
+{
+	r32 quadrant = FastRoundR32(angle * FAST_TWO_OVER_PI_R32);
+	i32 quadrantInt = (i32)quadrant;
+	r32 reduced = ((angle - quadrant*FAST_PIO2_PART1_R32) - quadrant*FAST_PIO2_PART2_R32) - quadrant*FAST_PIO2_PART3_R32; //[-Pi/4, Pi/4]
+	r32 z = reduced * reduced;
+	r32 sinValue = ((-1.9515295891e-4f*z + 8.3321608736e-3f)*z - 1.6666654611e-1f)*z*reduced + reduced;
+	r32 cosValue = ((2.443315711809948e-5f*z - 1.388731625493765e-3f)*z + 4.166664568298827e-2f)*z*z - 0.5f*z + 1.0f;
+	bool swap = ((quadrantInt & 1) != 0);
+	r32 sinResult = (swap ? cosValue : sinValue);
+	r32 cosResult = (swap ? sinValue : cosValue);
+	//quadrants 2 and 3 negate sin, quadrants 1 and 2 negate cos
+	if (sinOut != nullptr) { *sinOut = BitsToR32(R32ToBits(sinResult) ^ ((u32)(quadrantInt & 2) << 30)); }
+	if (cosOut != nullptr) { *cosOut = BitsToR32(R32ToBits(cosResult) ^ ((u32)((quadrantInt + 1) & 2) << 30)); }
+}
+inline r32 SinFastR32(r32 angle)
+{
+	r32 result;
+	SinCosFastR32(angle, &result, nullptr);
+	return result;
+}
+inline r32 CosFastR32(r32 angle)
+{
+	r32 result;
+	SinCosFastR32(angle, nullptr, &result);
+	return result;
+}
+
+// +==============================+
+// |          Atan Fast           |
+// +==============================+
+//Max absolute error 2.75e-7 radians over all finite inputs. Matches atan2f for signed zeros: (±0, +0) gives ±0 and (±0, -0) gives ±Pi
+inline r32 AtanFastR32(r32 y, r32 x)
+{
+	r32 absX = AbsR32(x);
+	r32 absY = AbsR32(y);
+	r32 maxValue = ((absX > absY) ? absX : absY);
+	r32 minValue = ((absX > absY) ? absY : absX);
+	r32 ratio = ((maxValue > 0.0f) ? (minValue / maxValue) : 0.0f); //[0, 1]
+	bool reduce = (ratio > 0.414213562f); //tan(Pi/8)
+	r32 t = (reduce ? ((ratio - 1.0f) / (ratio + 1.0f)) : ratio);
+	r32 z = t * t;
+	r32 result = (((8.05374449538e-2f*z - 1.38776856032e-1f)*z + 1.99777106478e-1f)*z - 3.33329491539e-1f)*z*t + t;
+	result = (reduce ? (result + QuarterPi32) : result);
+	result = ((absY > absX) ? (HalfPi32 - result) : result);
+	result = (((R32ToBits(x) & 0x80000000) != 0) ? (Pi32 - result) : result); //sign bit rather than (x < 0) so -0 counts as negative
+	return BitsToR32(R32ToBits(result) ^ (R32ToBits(y) & 0x80000000));
+}
+inline r32 AtanJoinedFastR32(r32 value)
+{
+	return AtanFastR32(value, 1.0f);
+}
+
+// +==============================+
+// |          Exp2 Fast           |
+// +==============================+
+//Max relative error 9.7e-8 (0.81 * epsilon, at most 1.15 ULP). Inputs are clamped to [-126, 127] so the result is never denormal or infinite
+//NaN is passed through (it is swapped for 0 before the i32 conversion, which would be undefined for NaN)
+inline r32 Exp2FastR32(r32 value)
+{
+	bool isNan = (value != value);
+	r32 clamped = (isNan ? 0.0f : ((value < -126.0f) ? -126.0f : ((value > 127.0f) ? 127.0f : value)));
+	r32 whole = FastRoundR32(clamped);
+	r32 fraction = clamped - whole; //[-0.5, 0.5]
+	r32 poly = (((((1.535336188319500e-4f*fraction + 1.339887440266574e-3f)*fraction + 9.618437357674640e-3f)*fraction + 5.550332471162809e-2f)*fraction + 2.402264791363012e-1f)*fraction + 6.931472028550421e-1f)*fraction + 1.0f;
+	r32 scale = BitsToR32((u32)((i32)whole + 127) << 23);
+	return (isNan ? value : (poly * scale));
+}
+//Same error as Exp2FastR32 plus the rounding of (value * log2(e)), which grows with |value|. Max error 64 ULP
+//(relative 3.9e-6) at the ends of the range, under 2 ULP for |value| < 1. Inputs are clamped to about [-87.3, 88.0]
+inline r32 ExpFastR32(r32 value)
+{
+	return Exp2FastR32(value * FAST_LOG2_E_R32);
+}
+
+// +==============================+
+// |          Log Fast            |
+// +==============================+
+//Splits value into 2^exponent * mantissa where mantissa is in [sqrt(0.5), sqrt(2)) and returns ln(mantissa)
+//NOTE: value must be positive, finite and normal. 0, negatives, infinity, NaN and denormals give garbage rather than -inf or NaN
+inline r32 LnMantissaFastR32(r32 value, i32* exponentOut)
+{
+	u32 offsetBits = R32ToBits(value) - FAST_SQRT_HALF_BITS;
+	*exponentOut = ((i32)offsetBits >> 23);
+	r32 x = BitsToR32((offsetBits & 0x007FFFFF) + FAST_SQRT_HALF_BITS) - 1.0f;
+	r32 z = x * x;
+	r32 poly = ((((((((7.0376836292e-2f*x - 1.1514610310e-1f)*x + 1.1676998740e-1f)*x - 1.2420140846e-1f)*x + 1.4249322787e-1f)*x - 1.6668057665e-1f)*x + 2.0000714765e-1f)*x - 2.4999993993e-1f)*x + 3.3333331174e-1f);
+	return x + (x*z*poly - 0.5f*z);
+}
+//Max error 1.4 ULP where |result| > 0.5 and max absolute error 5.4e-8 otherwise, for value in [2^-126, 2^128)
+inline r32 Log2FastR32(r32 value)
+{
+	i32 exponent;
+	r32 lnMantissa = LnMantissaFastR32(value, &exponent);
+	return (r32)exponent + lnMantissa * FAST_LOG2_E_R32;
+}
+//Max error 0.81 ULP where |result| > 0.5 and max absolute error 2.6e-8 otherwise, for value in [2^-126, 2^128)
+inline r32 LnFastR32(r32 value)
+{
+	i32 exponent;
+	r32 lnMantissa = LnMantissaFastR32(value, &exponent);
+	return (r32)exponent * FAST_LN2_HI_R32 + ((r32)exponent * FAST_LN2_LO_R32 + lnMantissa);
+}
+//Only valid for value > 0. Relative error grows with |power * log2(value)|, measured max relative error
+//is 2.8e-6 for value in [1e-3, 1e3] and power in [-4, 4]
+inline r32 PowFastR32(r32 value, r32 power)
+{
+	return Exp2FastR32(power * Log2FastR32(value));
+}
+
+// +==============================+
+// |     Simd4f Fast Versions     |
+// +==============================+
+//NOTE: These do the exact same operations as the scalar versions above so the results match bit for bit (barring FMA contraction)
+INLINE void Simd4fSinCosFast(simd4f angles, simd4f* sinOut, simd4f* cosOut)
+{
+	simd4f magic = Simd4fFill(FAST_ROUND_MAGIC_R32);
+	simd4f quadrant = Simd4fSubtract(Simd4fAdd(Simd4fMultiply(angles, Simd4fFill(FAST_TWO_OVER_PI_R32)), magic), magic);
+	simd4i quadrantInt = Simd4fToI32(quadrant);
+	simd4f reduced = Simd4fSubtract(angles, Simd4fMultiply(quadrant, Simd4fFill(FAST_PIO2_PART1_R32)));
+	reduced = Simd4fSubtract(reduced, Simd4fMultiply(quadrant, Simd4fFill(FAST_PIO2_PART2_R32)));
+	reduced = Simd4fSubtract(reduced, Simd4fMultiply(quadrant, Simd4fFill(FAST_PIO2_PART3_R32)));
+	simd4f z = Simd4fMultiply(reduced, reduced);
+	
+	simd4f sinValue = Simd4fMulAdd(Simd4fFill(-1.9515295891e-4f), z, Simd4fFill(8.3321608736e-3f));
+	sinValue = Simd4fMulAdd(sinValue, z, Simd4fFill(-1.6666654611e-1f));
+	sinValue = Simd4fMulAdd(Simd4fMultiply(sinValue, z), reduced, reduced);
+	
+	simd4f cosValue = Simd4fMulAdd(Simd4fFill(2.443315711809948e-5f), z, Simd4fFill(-1.388731625493765e-3f));
+	cosValue = Simd4fMulAdd(cosValue, z, Simd4fFill(4.166664568298827e-2f));
+	cosValue = Simd4fAdd(Simd4fSubtract(Simd4fMultiply(Simd4fMultiply(cosValue, z), z), Simd4fMultiply(Simd4fFill(0.5f), z)), Simd4fFill(1.0f));
+	
+	simd4i one = Simd4iFill(1);
+	simd4i two = Simd4iFill(2);
+	simd4i swapMask = Simd4iEqual(Simd4iAnd(quadrantInt, one), one);
+	if (sinOut != nullptr) { *sinOut = Simd4fXorSign(Simd4fSelect(swapMask, cosValue, sinValue), Simd4iShiftLeft(Simd4iAnd(quadrantInt, two), 30)); }
+	if (cosOut != nullptr) { *cosOut = Simd4fXorSign(Simd4fSelect(swapMask, sinValue, cosValue), Simd4iShiftLeft(Simd4iAnd(Simd4iAdd(quadrantInt, one), two), 30)); }
+}
+INLINE simd4f Simd4fAtanFast(simd4f y, simd4f x)
+{
+	simd4f zero = Simd4fFill(0.0f);
+	simd4f one = Simd4fFill(1.0f);
+	simd4f absX = Simd4fAbs(x);
+	simd4f absY = Simd4fAbs(y);
+	simd4f maxValue = Simd4fMax(absX, absY);
+	simd4f minValue = Simd4fMin(absX, absY);
+	simd4f ratio = Simd4fSelect(Simd4fGreaterThan(maxValue, zero), Simd4fDivide(minValue, maxValue), zero);
+	simd4i reduceMask = Simd4fGreaterThan(ratio, Simd4fFill(0.414213562f));
+	simd4f t = Simd4fSelect(reduceMask, Simd4fDivide(Simd4fSubtract(ratio, one), Simd4fAdd(ratio, one)), ratio);
+	simd4f z = Simd4fMultiply(t, t);
+	simd4f result = Simd4fMulAdd(Simd4fFill(8.05374449538e-2f), z, Simd4fFill(-1.38776856032e-1f));
+	result = Simd4fMulAdd(result, z, Simd4fFill(1.99777106478e-1f));
+	result = Simd4fMulAdd(result, z, Simd4fFill(-3.33329491539e-1f));
+	result = Simd4fMulAdd(Simd4fMultiply(result, z), t, t);
+	result = Simd4fSelect(reduceMask, Simd4fAdd(result, Simd4fFill(QuarterPi32)), result);
+	result = Simd4fSelect(Simd4fGreaterThan(absY, absX), Simd4fSubtract(Simd4fFill(HalfPi32), result), result);
+	result = Simd4fSelect(Simd4iShiftRightSigned(Simd4fAsI32(x), 31), Simd4fSubtract(Simd4fFill(Pi32), result), result);
+	return Simd4fXorSign(result, Simd4fAsI32(y));
+}
+INLINE simd4f Simd4fExp2Fast(simd4f values)
+{
+	simd4f magic = Simd4fFill(FAST_ROUND_MAGIC_R32);
+	simd4i nanMask = Simd4iShiftRightSigned(Simd4iSubtract(Simd4iFill(0x7F800000), Simd4fAsI32(Simd4fAbs(values))), 31); //abs bits above infinity
+	simd4f clamped = Simd4fSelect(nanMask, Simd4fFill(0.0f), Simd4fMin(Simd4fMax(values, Simd4fFill(-126.0f)), Simd4fFill(127.0f)));
+	simd4f whole = Simd4fSubtract(Simd4fAdd(clamped, magic), magic);
+	simd4f fraction = Simd4fSubtract(clamped, whole);
+	simd4f poly = Simd4fMulAdd(Simd4fFill(1.535336188319500e-4f), fraction, Simd4fFill(1.339887440266574e-3f));
+	poly = Simd4fMulAdd(poly, fraction, Simd4fFill(9.618437357674640e-3f));
+	poly = Simd4fMulAdd(poly, fraction, Simd4fFill(5.550332471162809e-2f));
+	poly = Simd4fMulAdd(poly, fraction, Simd4fFill(2.402264791363012e-1f));
+	poly = Simd4fMulAdd(poly, fraction, Simd4fFill(6.931472028550421e-1f));
+	poly = Simd4fMulAdd(poly, fraction, Simd4fFill(1.0f));
+	simd4f scale = Simd4iAsR32(Simd4iShiftLeft(Simd4iAdd(Simd4fToI32(whole), Simd4iFill(127)), 23));
+	return Simd4fSelect(nanMask, values, Simd4fMultiply(poly, scale));
+}
+INLINE simd4f Simd4fLnMantissaFast(simd4f values, simd4f* exponentOut)
+{
+	simd4i offsetBits = Simd4iSubtract(Simd4fAsI32(values), Simd4iFill(FAST_SQRT_HALF_BITS));
+	*exponentOut = Simd4iToR32(Simd4iShiftRightSigned(offsetBits, 23));
+	simd4f x = Simd4fSubtract(Simd4iAsR32(Simd4iAdd(Simd4iAnd(offsetBits, Simd4iFill(0x007FFFFF)), Simd4iFill(FAST_SQRT_HALF_BITS))), Simd4fFill(1.0f));
+	simd4f z = Simd4fMultiply(x, x);
+	simd4f poly = Simd4fMulAdd(Simd4fFill(7.0376836292e-2f), x, Simd4fFill(-1.1514610310e-1f));
+	poly = Simd4fMulAdd(poly, x, Simd4fFill(1.1676998740e-1f));
+	poly = Simd4fMulAdd(poly, x, Simd4fFill(-1.2420140846e-1f));
+	poly = Simd4fMulAdd(poly, x, Simd4fFill(1.4249322787e-1f));
+	poly = Simd4fMulAdd(poly, x, Simd4fFill(-1.6668057665e-1f));
+	poly = Simd4fMulAdd(poly, x, Simd4fFill(2.0000714765e-1f));
+	poly = Simd4fMulAdd(poly, x, Simd4fFill(-2.4999993993e-1f));
+	poly = Simd4fMulAdd(poly, x, Simd4fFill(3.3333331174e-1f));
+	return Simd4fAdd(x, Simd4fSubtract(Simd4fMultiply(Simd4fMultiply(x, z), poly), Simd4fMultiply(Simd4fFill(0.5f), z)));
+}
+INLINE simd4f Simd4fLog2Fast(simd4f values)
+{
+	simd4f exponent;
+	simd4f lnMantissa = Simd4fLnMantissaFast(values, &exponent);
+	return Simd4fMulAdd(lnMantissa, Simd4fFill(FAST_LOG2_E_R32), exponent);
+}
+INLINE simd4f Simd4fLnFast(simd4f values)
+{
+	simd4f exponent;
+	simd4f lnMantissa = Simd4fLnMantissaFast(values, &exponent);
+	return Simd4fAdd(Simd4fMultiply(exponent, Simd4fFill(FAST_LN2_HI_R32)), Simd4fMulAdd(exponent, Simd4fFill(FAST_LN2_LO_R32), lnMantissa));
+}
+
+// +==============================+
+// |      Fast Array Versions     |
+// +==============================+
+//NOTE: Same error bounds as the scalar versions. resultsOut may be the same array as the input
+void SinCosFastArrayR32(u32 count, const r32* angles, r32* sinsOut, r32* cosinesOut)
+{
+	u32 index = 0;
+	for (; index + 4 <= count; index += 4)
+	{
+		simd4f sinValues, cosValues;
+		Simd4fSinCosFast(Simd4fLoad(&angles[index]), &sinValues, &cosValues);
+		Simd4fStore(&sinsOut[index], sinValues);
+		Simd4fStore(&cosinesOut[index], cosValues);
+	}
+	for (; index < count; index++) { SinCosFastR32(angles[index], &sinsOut[index], &cosinesOut[index]); }
+}
+void SinFastArrayR32(u32 count, const r32* angles, r32* resultsOut)
+{
+	u32 index = 0;
+	for (; index + 4 <= count; index += 4)
+	{
+		simd4f sinValues;
+		Simd4fSinCosFast(Simd4fLoad(&angles[index]), &sinValues, nullptr);
+		Simd4fStore(&resultsOut[index], sinValues);
+	}
+	for (; index < count; index++) { resultsOut[index] = SinFastR32(angles[index]); }
+}
+void CosFastArrayR32(u32 count, const r32* angles, r32* resultsOut)
+{
+	u32 index = 0;
+	for (; index + 4 <= count; index += 4)
+	{
+		simd4f cosValues;
+		Simd4fSinCosFast(Simd4fLoad(&angles[index]), nullptr, &cosValues);
+		Simd4fStore(&resultsOut[index], cosValues);
+	}
+	for (; index < count; index++) { resultsOut[index] = CosFastR32(angles[index]); }
+}
+void AtanFastArrayR32(u32 count, const r32* ys, const r32* xs, r32* resultsOut)
+{
+	u32 index = 0;
+	for (; index + 4 <= count; index += 4)
+	{
+		Simd4fStore(&resultsOut[index], Simd4fAtanFast(Simd4fLoad(&ys[index]), Simd4fLoad(&xs[index])));
+	}
+	for (; index < count; index++) { resultsOut[index] = AtanFastR32(ys[index], xs[index]); }
+}
+void Exp2FastArrayR32(u32 count, const r32* values, r32* resultsOut)
+{
+	u32 index = 0;
+	for (; index + 4 <= count; index += 4)
+	{
+		Simd4fStore(&resultsOut[index], Simd4fExp2Fast(Simd4fLoad(&values[index])));
+	}
+	for (; index < count; index++) { resultsOut[index] = Exp2FastR32(values[index]); }
+}
+void ExpFastArrayR32(u32 count, const r32* values, r32* resultsOut)
+{
+	simd4f log2E = Simd4fFill(FAST_LOG2_E_R32);
+	u32 index = 0;
+	for (; index + 4 <= count; index += 4)
+	{
+		Simd4fStore(&resultsOut[index], Simd4fExp2Fast(Simd4fMultiply(Simd4fLoad(&values[index]), log2E)));
+	}
+	for (; index < count; index++) { resultsOut[index] = ExpFastR32(values[index]); }
+}
+void Log2FastArrayR32(u32 count, const r32* values, r32* resultsOut)
+{
+	u32 index = 0;
+	for (; index + 4 <= count; index += 4)
+	{
+		Simd4fStore(&resultsOut[index], Simd4fLog2Fast(Simd4fLoad(&values[index])));
+	}
+	for (; index < count; index++) { resultsOut[index] = Log2FastR32(values[index]); }
+}
+void LnFastArrayR32(u32 count, const r32* values, r32* resultsOut)
+{
+	u32 index = 0;
+	for (; index + 4 <= count; index += 4)
+	{
+		Simd4fStore(&resultsOut[index], Simd4fLnFast(Simd4fLoad(&values[index])));
+	}
+	for (; index < count; index++) { resultsOut[index] = LnFastR32(values[index]); }
+}
+void PowFastArrayR32(u32 count, const r32* values, r32 power, r32* resultsOut)
+{
+	simd4f powerVec = Simd4fFill(power);
+	u32 index = 0;
+	for (; index + 4 <= count; index += 4)
+	{
+		Simd4fStore(&resultsOut[index], Simd4fExp2Fast(Simd4fMultiply(powerVec, Simd4fLog2Fast(Simd4fLoad(&values[index])))));
+	}
+	for (; index < count; index++) { resultsOut[index] = PowFastR32(values[index], power); }
+}
+
+// +--------------------------------------------------------------+
+// |                    Range Array Functions                     |
+// +--------------------------------------------------------------+
+//NOTE: Like the array functions in orca_simd.h these allow resultsOut to be the same pointer as the input (in-place)
+//      and handle any count and alignment. Values always have the start of the range subtracted before they are scaled
+//      (folding the start into the multiply-add cancels badly for ranges far from zero). InverseLerp and SmoothStep
+//      multiply by a reciprocal computed once up front, so they can differ from the scalar versions (which divide)
+//      by 1 ULP. RemapArrayR32 does the same operations as RemapR32
+void ClampArrayR32(u32 count, const r32* values, r32 min, r32 max, r32* resultsOut)
+{
+	simd4f minVec = Simd4fFill(min);
+	simd4f maxVec = Simd4fFill(max);
+	u32 index = 0;
+	for (; index + 16 <= count; index += 16)
+	{
+		simd4f result0 = Simd4fClamp(Simd4fLoad(&values[index + 0]), minVec, maxVec);
+		simd4f result1 = Simd4fClamp(Simd4fLoad(&values[index + 4]), minVec, maxVec);
+		simd4f result2 = Simd4fClamp(Simd4fLoad(&values[index + 8]), minVec, maxVec);
+		simd4f result3 = Simd4fClamp(Simd4fLoad(&values[index + 12]), minVec, maxVec);
+		Simd4fStore(&resultsOut[index + 0], result0);
+		Simd4fStore(&resultsOut[index + 4], result1);
+		Simd4fStore(&resultsOut[index + 8], result2);
+		Simd4fStore(&resultsOut[index + 12], result3);
+	}
+	for (; index + 4 <= count; index += 4)
+	{
+		Simd4fStore(&resultsOut[index], Simd4fClamp(Simd4fLoad(&values[index]), minVec, maxVec));
+	}
+	for (; index < count; index++) { resultsOut[index] = ClampR32(values[index], min, max); }
+}
+//Lerps each pair of starts[i] and ends[i] by the same amount
+void LerpArrayR32(u32 count, const r32* starts, const r32* ends, r32 amount, r32* resultsOut)
+{
+	simd4f amountVec = Simd4fFill(amount);
+	u32 index = 0;
+	for (; index + 16 <= count; index += 16)
+	{
+		simd4f start0 = Simd4fLoad(&starts[index + 0]);
+		simd4f start1 = Simd4fLoad(&starts[index + 4]);
+		simd4f start2 = Simd4fLoad(&starts[index + 8]);
+		simd4f start3 = Simd4fLoad(&starts[index + 12]);
+		simd4f result0 = Simd4fMulAdd(Simd4fSubtract(Simd4fLoad(&ends[index + 0]), start0), amountVec, start0);
+		simd4f result1 = Simd4fMulAdd(Simd4fSubtract(Simd4fLoad(&ends[index + 4]), start1), amountVec, start1);
+		simd4f result2 = Simd4fMulAdd(Simd4fSubtract(Simd4fLoad(&ends[index + 8]), start2), amountVec, start2);
+		simd4f result3 = Simd4fMulAdd(Simd4fSubtract(Simd4fLoad(&ends[index + 12]), start3), amountVec, start3);
+		Simd4fStore(&resultsOut[index + 0], result0);
+		Simd4fStore(&resultsOut[index + 4], result1);
+		Simd4fStore(&resultsOut[index + 8], result2);
+		Simd4fStore(&resultsOut[index + 12], result3);
+	}
+	for (; index + 4 <= count; index += 4)
+	{
+		simd4f start = Simd4fLoad(&starts[index]);
+		Simd4fStore(&resultsOut[index], Simd4fMulAdd(Simd4fSubtract(Simd4fLoad(&ends[index]), start), amountVec, start));
+	}
+	for (; index < count; index++) { resultsOut[index] = LerpR32(starts[index], ends[index], amount); }
+}
+void InverseLerpArrayR32(u32 count, const r32* values, r32 start, r32 end, bool clamp, r32* resultsOut)
+{
+	r32 invRange = 1.0f / (end - start);
+	simd4f startVec = Simd4fFill(start);
+	simd4f scaleVec = Simd4fFill(invRange);
+	simd4f zeroVec = Simd4fFill(0.0f);
+	simd4f oneVec = Simd4fFill(1.0f);
+	u32 index = 0;
+	for (; index + 4 <= count; index += 4)
+	{
+		simd4f result = Simd4fMultiply(Simd4fSubtract(Simd4fLoad(&values[index]), startVec), scaleVec);
+		if (clamp) { result = Simd4fClamp(result, zeroVec, oneVec); }
+		Simd4fStore(&resultsOut[index], result);
+	}
+	for (; index < count; index++)
+	{
+		r32 result = (values[index] - start) * invRange;
+		resultsOut[index] = clamp ? ClampR32(result, 0.0f, 1.0f) : result;
+	}
+}
+//Same as RemapR32 on every value: toMin + (value - fromMin) * scale
+void RemapArrayR32(u32 count, const r32* values, r32 fromMin, r32 fromMax, r32 toMin, r32 toMax, r32* resultsOut)
+{
+	r32 scale = (toMax - toMin) / (fromMax - fromMin);
+	simd4f fromMinVec = Simd4fFill(fromMin);
+	simd4f scaleVec = Simd4fFill(scale);
+	simd4f toMinVec = Simd4fFill(toMin);
+	u32 index = 0;
+	for (; index + 16 <= count; index += 16)
+	{
+		simd4f result0 = Simd4fMulAdd(Simd4fSubtract(Simd4fLoad(&values[index + 0]), fromMinVec), scaleVec, toMinVec);
+		simd4f result1 = Simd4fMulAdd(Simd4fSubtract(Simd4fLoad(&values[index + 4]), fromMinVec), scaleVec, toMinVec);
+		simd4f result2 = Simd4fMulAdd(Simd4fSubtract(Simd4fLoad(&values[index + 8]), fromMinVec), scaleVec, toMinVec);
+		simd4f result3 = Simd4fMulAdd(Simd4fSubtract(Simd4fLoad(&values[index + 12]), fromMinVec), scaleVec, toMinVec);
+		Simd4fStore(&resultsOut[index + 0], result0);
+		Simd4fStore(&resultsOut[index + 4], result1);
+		Simd4fStore(&resultsOut[index + 8], result2);
+		Simd4fStore(&resultsOut[index + 12], result3);
+	}
+	for (; index + 4 <= count; index += 4)
+	{
+		Simd4fStore(&resultsOut[index], Simd4fMulAdd(Simd4fSubtract(Simd4fLoad(&values[index]), fromMinVec), scaleVec, toMinVec));
+	}
+	for (; index < count; index++) { resultsOut[index] = toMin + (values[index] - fromMin) * scale; }
+}
+void SmoothStepArrayR32(u32 count, const r32* values, r32 edge0, r32 edge1, r32* resultsOut)
+{
+	r32 invRange = 1.0f / (edge1 - edge0);
+	simd4f edge0Vec = Simd4fFill(edge0);
+	simd4f scaleVec = Simd4fFill(invRange);
+	simd4f zeroVec = Simd4fFill(0.0f);
+	simd4f oneVec = Simd4fFill(1.0f);
+	simd4f twoVec = Simd4fFill(2.0f);
+	simd4f threeVec = Simd4fFill(3.0f);
+	u32 index = 0;
+	for (; index + 4 <= count; index += 4)
+	{
+		simd4f amount = Simd4fClamp(Simd4fMultiply(Simd4fSubtract(Simd4fLoad(&values[index]), edge0Vec), scaleVec), zeroVec, oneVec);
+		simd4f curve = Simd4fSubtract(threeVec, Simd4fMultiply(twoVec, amount));
+		Simd4fStore(&resultsOut[index], Simd4fMultiply(Simd4fMultiply(amount, amount), curve));
+	}
+	for (; index < count; index++)
+	{
+		r32 amount = ClampR32((values[index] - edge0) * invRange, 0.0f, 1.0f);
+		resultsOut[index] = amount * amount * (3.0f - 2.0f * amount);
+	}
+}
+//Multiplies values by a scale that moves linearly from startScale (at index 0) towards endScale (reached at index count).
+//This is the usual click-free gain ramp for an audio buffer
+void ScaleRampArrayR32(u32 count, const r32* values, r32 startScale, r32 endScale, r32* resultsOut)
+{
+	if (count == 0) { return; }
+	r32 step = (endScale - startScale) / (r32)count;
+	simd4f startVec = Simd4fFill(startScale);
+	simd4f stepVec = Simd4fFill(step);
+	simd4f laneIndices = NewSimd4f(0.0f, 1.0f, 2.0f, 3.0f);
+	u32 index = 0;
+	for (; index + 4 <= count; index += 4)
+	{
+		//Computing the scale from the index (rather than adding step every iteration) keeps error from accumulating over long buffers
+		simd4f indices = Simd4fAdd(Simd4fFill((r32)index), laneIndices);
+		simd4f scale = Simd4fMulAdd(indices, stepVec, startVec);
+		Simd4fStore(&resultsOut[index], Simd4fMultiply(Simd4fLoad(&values[index]), scale));
+	}
+	for (; index < count; index++) { resultsOut[index] = values[index] * ((r32)index * step + startScale); }
+}
+
 #endif //  _ORCA_INTRINSICS_H
 
 // +--------------------------------------------------------------+
@@ -1068,24 +1712,40 @@ r64 AngleLerpR64(r64 angleFrom, r64 angleTo, r64 amount)
 // +--------------------------------------------------------------+
 /*
 @Defines
+FAST_ROUND_MAGIC_R32
+FAST_PIO2_PART1_R32
+FAST_PIO2_PART2_R32
+FAST_PIO2_PART3_R32
+FAST_TWO_OVER_PI_R32
+FAST_LOG2_E_R32
+FAST_LN2_HI_R32
+FAST_LN2_LO_R32
+FAST_SQRT_HALF_BITS
 @Types
 @Functions
+template <typename T> constexpr T Min(T value1, T value2)
+template <typename T> constexpr T Max(T value1, T value2)
+template <typename T> constexpr T Clamp(T value, T min, T max)
+template <typename T> constexpr T Abs(T value)
+template <typename T> constexpr T SignOf(T value)
+template <typename T> constexpr T AbsDiff(T value1, T value2)
+template <typename T> constexpr T Lerp(T start, T end, T amount)
 #define Square(value)
 #define Cube(value)
-inline u32 MinU32(u32 value1, u32 value2)
-inline i32 MinI32(i32 value1, i32 value2)
-inline r32 MinR32(r32 value1, r32 value2)
-inline r64 MinR64(r64 value1, r64 value2)
-inline u32 MaxU32(u32 value1, u32 value2)
-inline i32 MaxI32(i32 value1, i32 value2)
-inline r32 MaxR32(r32 value1, r32 value2)
-inline r64 MaxR64(r64 value1, r64 value2)
+constexpr u32 MinU32(u32 value1, u32 value2)
+constexpr i32 MinI32(i32 value1, i32 value2)
+constexpr r32 MinR32(r32 value1, r32 value2)
+constexpr r64 MinR64(r64 value1, r64 value2)
+constexpr u32 MaxU32(u32 value1, u32 value2)
+constexpr i32 MaxI32(i32 value1, i32 value2)
+constexpr r32 MaxR32(r32 value1, r32 value2)
+constexpr r64 MaxR64(r64 value1, r64 value2)
 inline r32 AbsR32(r32 value)
 inline r64 AbsR64(r64 value)
-inline i8 AbsI8(i8 value)
-inline i16 AbsI16(i16 value)
-inline i32 AbsI32(i32 value)
-inline i64 AbsI64(i64 value)
+constexpr i8 AbsI8(i8 value)
+constexpr i16 AbsI16(i16 value)
+constexpr i32 AbsI32(i32 value)
+constexpr i64 AbsI64(i64 value)
 inline r32 RoundR32(r32 value)
 inline i32 RoundR32i(r32 value)
 inline r64 RoundR64(r64 value)
@@ -1129,46 +1789,68 @@ inline r32 SqrtR32(r32 value)
 inline r64 SqrtR64(r64 value)
 inline r32 CbrtR32(r32 value)
 inline r64 CbrtR64(r64 value)
-inline r32 SignOfR32(r32 value)
-inline r64 SignOfR64(r64 value)
-inline i8 SignOfI8(i8 value)
-inline i16 SignOfI16(i16 value)
-inline i32 SignOfI32(i32 value)
-inline i64 SignOfI64(i64 value)
-inline r32 ClampR32(r32 value, r32 min, r32 max)
-inline r64 ClampR64(r64 value, r64 min, r64 max)
-inline i8 ClampI8(i8 value, i8 min, i8 max)
-inline i16 ClampI16(i16 value, i16 min, i16 max)
-inline i32 ClampI32(i32 value, i32 min, i32 max)
-inline i64 ClampI64(i64 value, i64 min, i64 max)
-inline u8 ClampU8(u8 value, u8 min, u8 max)
-inline u16 ClampU16(u16 value, u16 min, u16 max)
-inline u32 ClampU32(u32 value, u32 min, u32 max)
-inline u64 ClampU64(u64 value, u64 min, u64 max)
-inline r32 LerpR32(r32 val1, r32 val2, r32 amount)
-inline r64 LerpR64(r64 val1, r64 val2, r64 amount)
-inline r32 LerpClampR32(r32 val1, r32 val2, r32 amount)
-inline r64 LerpClampR64(r64 val1, r64 val2, r64 amount)
+constexpr r32 SignOfR32(r32 value)
+constexpr r64 SignOfR64(r64 value)
+constexpr i8 SignOfI8(i8 value)
+constexpr i16 SignOfI16(i16 value)
+constexpr i32 SignOfI32(i32 value)
+constexpr i64 SignOfI64(i64 value)
+constexpr r32 ClampR32(r32 value, r32 min, r32 max)
+constexpr r64 ClampR64(r64 value, r64 min, r64 max)
+constexpr i8 ClampI8(i8 value, i8 min, i8 max)
+constexpr i16 ClampI16(i16 value, i16 min, i16 max)
+constexpr i32 ClampI32(i32 value, i32 min, i32 max)
+constexpr i64 ClampI64(i64 value, i64 min, i64 max)
+constexpr u8 ClampU8(u8 value, u8 min, u8 max)
+constexpr u16 ClampU16(u16 value, u16 min, u16 max)
+constexpr u32 ClampU32(u32 value, u32 min, u32 max)
+constexpr u64 ClampU64(u64 value, u64 min, u64 max)
+constexpr r32 LerpR32(r32 val1, r32 val2, r32 amount)
+constexpr r64 LerpR64(r64 val1, r64 val2, r64 amount)
+constexpr r32 LerpClampR32(r32 val1, r32 val2, r32 amount)
+constexpr r64 LerpClampR64(r64 val1, r64 val2, r64 amount)
 inline r32 InverseLerpR32(r32 start, r32 end, r32 value, bool clamp = false)
 inline r64 InverseLerpR64(r64 start, r64 end, r64 value, bool clamp = false)
+inline r32 RemapR32(r32 value, r32 fromMin, r32 fromMax, r32 toMin, r32 toMax)
+inline r64 RemapR64(r64 value, r64 fromMin, r64 fromMax, r64 toMin, r64 toMax)
+inline r32 SmoothStepR32(r32 edge0, r32 edge1, r32 value)
+inline r64 SmoothStepR64(r64 edge0, r64 edge1, r64 value)
 inline r32 DecimalPartR32(r32 value)
 inline r64 DecimalPartR64(r64 value)
 inline r32 ModR32(r32 numerator, r32 denominator)
 inline r64 ModR64(r64 numerator, r64 denominator)
 inline u8 StoreI8inU8(i8 value)
 inline i8 ReadI8FromU8(u8 value)
+constexpr i8 ClampCastI32ToI8(i32 value)
+constexpr u8 ClampCastI32ToU8(i32 value)
+constexpr i16 ClampCastI32ToI16(i32 value)
+constexpr u32 ClampCastI32ToU32(i32 value)
+constexpr i32 ClampCastU32ToI32(u32 value)
+inline i16 ClampCastR32ToI16(r32 value)
+inline i32 ClampCastR32ToI32(r32 value)
+inline i32 ClampCastR64ToI32(r64 value)
 inline i8 ClampI32toI8(i32 value)
 inline u8 ClampI32toU8(i32 value)
 inline i16 ClampI32toI16(i32 value)
 inline u32 ClampI32toU32(i32 value)
 inline i32 ClampU32toI32(u32 value)
 inline i16 ClampR32toI16(r32 value)
+inline u32 R32ToBits(r32 value)
+inline r32 BitsToR32(u32 bits)
+inline u64 R64ToBits(r64 value)
+inline r64 BitsToR64(u64 bits)
 inline i8 ConvertSampleR64ToI8(r64 sample)
 inline i16 ConvertSampleR64ToI16(r64 sample)
 inline i32 ConvertSampleR64ToI32(r64 sample)
 inline r64 ConvertSampleI8ToR64(i8 sampleI8)
 inline r64 ConvertSampleI16ToR64(i16 sampleI16)
 inline r64 ConvertSampleI32ToR64(i32 sampleI32)
+inline i8 ConvertSampleR32ToI8(r32 sample)
+inline i16 ConvertSampleR32ToI16(r32 sample)
+inline i32 ConvertSampleR32ToI32(r32 sample)
+inline r32 ConvertSampleI8ToR32(i8 sampleI8)
+inline r32 ConvertSampleI16ToR32(i16 sampleI16)
+inline r32 ConvertSampleI32ToR32(i32 sampleI32)
 inline bool BasicallyEqualR32(r32 value1, r32 value2, r32 tolerance = 0.001f)
 inline bool BasicallyEqualR64(r64 value1, r64 value2, r64 tolerance = 0.001)
 inline bool BasicallyGreaterThanR32(r32 value1, r32 value2, r32 tolerance = 0.001f)
@@ -1177,15 +1859,30 @@ inline bool BasicallyLessThanR32(r32 value1, r32 value2, r32 tolerance = 0.001f)
 inline bool BasicallyLessThanR64(r64 value1, r64 value2, r64 tolerance = 0.001)
 inline bool BasicallyBetweenR32(r32 value, r32 min, r32 max, r32 tolerance = 0.001f)
 inline bool BasicallyBetweenR64(r64 value, r64 min, r64 max, r64 tolerance = 0.001)
+inline u8 PopCountU32(u32 value)
+inline u8 PopCountU64(u64 value)
+inline u8 CountLeadingZerosU32(u32 value)
+inline u8 CountLeadingZerosU64(u64 value)
+inline u8 CountTrailingZerosU32(u32 value)
+inline u8 CountTrailingZerosU64(u64 value)
+inline bool IsPowerOfTwoU32(u32 value)
+inline bool IsPowerOfTwoU64(u64 value)
+inline u32 NextPowerOfTwoU32(u32 value)
+inline u64 NextPowerOfTwoU64(u64 value)
+inline u32 RotateLeftU32(u32 value, u8 amount)
+inline u32 RotateRightU32(u32 value, u8 amount)
+inline u64 RotateLeftU64(u64 value, u8 amount)
+inline u64 RotateRightU64(u64 value, u8 amount)
+inline u64 MultiplyU64Full(u64 left, u64 right, u64* lowOut)
 inline u8 FlagsDiffU8(u8 flags1, u8 flags2)
-inline u8 AbsDiffU8(u8 value1, u8 value2)
-inline u16 AbsDiffU16(u16 value1, u16 value2)
-inline u32 AbsDiffU32(u32 value1, u32 value2)
-inline u64 AbsDiffU64(u64 value1, u64 value2)
-inline i8 AbsDiffI8(i8 value1, i8 value2)
-inline i16 AbsDiffI16(i16 value1, i16 value2)
-inline i32 AbsDiffI32(i32 value1, i32 value2)
-inline i64 AbsDiffI64(i64 value1, i64 value2)
+constexpr u8 AbsDiffU8(u8 value1, u8 value2)
+constexpr u16 AbsDiffU16(u16 value1, u16 value2)
+constexpr u32 AbsDiffU32(u32 value1, u32 value2)
+constexpr u64 AbsDiffU64(u64 value1, u64 value2)
+constexpr i8 AbsDiffI8(i8 value1, i8 value2)
+constexpr i16 AbsDiffI16(i16 value1, i16 value2)
+constexpr i32 AbsDiffI32(i32 value1, i32 value2)
+constexpr i64 AbsDiffI64(i64 value1, i64 value2)
 inline bool IsInfiniteR32(r32 value)
 inline bool IsInfiniteR64(r64 value)
 u32 RoundUpToU32(u32 value, u32 chunkSize)
@@ -1208,4 +1905,37 @@ r64 AngleFlipVerticalR64(r64 angle, bool normalize = true)
 r64 AngleFlipHorizontalR64(r64 angle, bool normalize = true)
 r32 AngleLerpR32(r32 angleFrom, r32 angleTo, r32 amount)
 r64 AngleLerpR64(r64 angleFrom, r64 angleTo, r64 amount)
+inline r32 FastRoundR32(r32 value)
+inline void SinCosFastR32(r32 angle, r32* sinOut, r32* cosOut)
+inline r32 SinFastR32(r32 angle)
+inline r32 CosFastR32(r32 angle)
+inline r32 AtanFastR32(r32 y, r32 x)
+inline r32 AtanJoinedFastR32(r32 value)
+inline r32 Exp2FastR32(r32 value)
+inline r32 ExpFastR32(r32 value)
+inline r32 LnMantissaFastR32(r32 value, i32* exponentOut)
+inline r32 Log2FastR32(r32 value)
+inline r32 LnFastR32(r32 value)
+inline r32 PowFastR32(r32 value, r32 power)
+INLINE void Simd4fSinCosFast(simd4f angles, simd4f* sinOut, simd4f* cosOut)
+INLINE simd4f Simd4fAtanFast(simd4f y, simd4f x)
+INLINE simd4f Simd4fExp2Fast(simd4f values)
+INLINE simd4f Simd4fLnMantissaFast(simd4f values, simd4f* exponentOut)
+INLINE simd4f Simd4fLog2Fast(simd4f values)
+INLINE simd4f Simd4fLnFast(simd4f values)
+void SinCosFastArrayR32(u32 count, const r32* angles, r32* sinsOut, r32* cosinesOut)
+void SinFastArrayR32(u32 count, const r32* angles, r32* resultsOut)
+void CosFastArrayR32(u32 count, const r32* angles, r32* resultsOut)
+void AtanFastArrayR32(u32 count, const r32* ys, const r32* xs, r32* resultsOut)
+void Exp2FastArrayR32(u32 count, const r32* values, r32* resultsOut)
+void ExpFastArrayR32(u32 count, const r32* values, r32* resultsOut)
+void Log2FastArrayR32(u32 count, const r32* values, r32* resultsOut)
+void LnFastArrayR32(u32 count, const r32* values, r32* resultsOut)
+void PowFastArrayR32(u32 count, const r32* values, r32 power, r32* resultsOut)
+void ClampArrayR32(u32 count, const r32* values, r32 min, r32 max, r32* resultsOut)
+void LerpArrayR32(u32 count, const r32* starts, const r32* ends, r32 amount, r32* resultsOut)
+void InverseLerpArrayR32(u32 count, const r32* values, r32 start, r32 end, bool clamp, r32* resultsOut)
+void RemapArrayR32(u32 count, const r32* values, r32 fromMin, r32 fromMax, r32 toMin, r32 toMax, r32* resultsOut)
+void SmoothStepArrayR32(u32 count, const r32* values, r32 edge0, r32 edge1, r32* resultsOut)
+void ScaleRampArrayR32(u32 count, const r32* values, r32 startScale, r32 endScale, r32* resultsOut)
 */
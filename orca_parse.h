@@ -0,0 +1,971 @@
+/*
+File:   orca_parse.h
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Holds TryParse functions that read numbers out of a MyStr_t, the other half of
+	** orca_format.h. The whole string has to be the number (no whitespace is skipped)
+	** and on failure the value is left untouched and failureOut says why. Runs of
+	** digits are read 8 at a time as a single u64 (SWAR), and floats are rounded
+	** exactly with the Eisel-Lemire algorithm (Daniel Lemire, 2020) so anything
+	** printed by FormatR64/FormatR32 reads back as exactly the same value
+*/
+
+#ifndef _ORCA_PARSE_H
+#define _ORCA_PARSE_H
+
+#define PARSE_MAX_MANTISSA_DIGITS    19 //most decimal digits that always fit in a u64
+#define PARSE_MIN_POW10              -342 //first entry of ParsePow5Table
+#define PARSE_BIG_DECIMAL_MAX_DIGITS 800 //enough for any input to round correctly, digits past this only matter as "not exactly halfway"
+
+enum ParseFailure_t
+{
+	ParseFailure_None = 0,
+	ParseFailure_Empty,
+	ParseFailure_InvalidCharacter, //also used when there are no digits where some are required ("-", "1e", ".")
+	ParseFailure_Overflow, //too big for the integer type, or rounds to infinity for floats
+	ParseFailure_NumFailures,
+};
+const char* GetParseFailureStr(ParseFailure_t failure)
+{
+	switch (failure)
+	{
+		case ParseFailure_None:             return "None";
+		case ParseFailure_Empty:            return "Empty";
+		case ParseFailure_InvalidCharacter: return "InvalidCharacter";
+		case ParseFailure_Overflow:         return "Overflow";
+		default: return "Unknown";
+	}
+}
+
+//Describes an IEEE binary float for the float parsing functions, see ParseFloatFormatR64 and ParseFloatFormatR32
+struct ParseFloatFormat_t
+{
+	u32 numMantissaBits;
+	u32 numExponentBits;
+	i32 exponentBias;
+	i32 minPow10; //mantissa * 10^exponent rounds to zero for any exponent below this
+	i32 maxPow10; //and to infinity for any exponent above this (unless the mantissa is zero)
+	i32 minRoundToEvenPow10; //the only powers of 10 where mantissa * 10^exponent can land exactly halfway between two floats
+	i32 maxRoundToEvenPow10;
+};
+const ParseFloatFormat_t ParseFloatFormatR64 = { 52, 11, 1023, -342, 308, -4, 23 };
+const ParseFloatFormat_t ParseFloatFormatR32 = { 23,  8,  127,  -64,  38, -17, 10 };
+
+//The digits of a float as written, value = mantissa * 10^exponent
+struct ParseDecimal_t
+{
+	bool isNegative;
+	bool isInfinity;
+	bool isNan;
+	bool isTruncated; //there were non-zero digits after the first PARSE_MAX_MANTISSA_DIGITS significant ones, so the real value is a little above mantissa
+	u64 mantissa;
+	i64 exponent;
+	//Where the digits (and point) are in the string, and the number after the 'e', for ParseBigDecimalInit
+	u64 digitsStart;
+	u64 digitsEnd;
+	i64 explicitExponent;
+};
+
+//The slow but always exact fallback, value = 0.digits * 10^decimalPoint
+struct ParseBigDecimal_t
+{
+	u32 numDigits;
+	i64 decimalPoint;
+	bool isTruncated; //non-zero digits were dropped past PARSE_BIG_DECIMAL_MAX_DIGITS
+	u8 digits[PARSE_BIG_DECIMAL_MAX_DIGITS]; //0-9, not characters
+};
+
+// +--------------------------------------------------------------+
+// |                            Tables                            |
+// +--------------------------------------------------------------+
+const r64 ParsePowersOf10R64[23] = {
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+	1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+const r32 ParsePowersOf10R32[11] = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+
+//5^i for i = -342 to 308 normalized to exactly 128 bits (the top bit is always set), split into { low 64 bits, high 64 bits }.
+//Negative powers are rounded up. Generated with exact integer math
+const u64 ParsePow5Table[651][2] = {
+	{ 0x113FAA2906A13B3FULL, 0xEEF453D6923BD65AULL }, { 0x4AC7CA59A424C507ULL, 0x9558B4661B6565F8ULL },
+	{ 0x5D79BCF00D2DF649ULL, 0xBAAEE17FA23EBF76ULL }, { 0xF4D82C2C107973DCULL, 0xE95A99DF8ACE6F53ULL },
+	{ 0x79071B9B8A4BE869ULL, 0x91D8A02BB6C10594ULL }, { 0x9748E2826CDEE284ULL, 0xB64EC836A47146F9ULL },
+	{ 0xFD1B1B2308169B25ULL, 0xE3E27A444D8D98B7ULL }, { 0xFE30F0F5E50E20F7ULL, 0x8E6D8C6AB0787F72ULL },
+	{ 0xBDBD2D335E51A935ULL, 0xB208EF855C969F4FULL }, { 0xAD2C788035E61382ULL, 0xDE8B2B66B3BC4723ULL },
+	{ 0x4C3BCB5021AFCC31ULL, 0x8B16FB203055AC76ULL }, { 0xDF4ABE242A1BBF3DULL, 0xADDCB9E83C6B1793ULL },
+	{ 0xD71D6DAD34A2AF0DULL, 0xD953E8624B85DD78ULL }, { 0x8672648C40E5AD68ULL, 0x87D4713D6F33AA6BULL },
+	{ 0x680EFDAF511F18C2ULL, 0xA9C98D8CCB009506ULL }, { 0x0212BD1B2566DEF2ULL, 0xD43BF0EFFDC0BA48ULL },
+	{ 0x014BB630F7604B57ULL, 0x84A57695FE98746DULL }, { 0x419EA3BD35385E2DULL, 0xA5CED43B7E3E9188ULL },
+	{ 0x52064CAC828675B9ULL, 0xCF42894A5DCE35EAULL }, { 0x7343EFEBD1940993ULL, 0x818995CE7AA0E1B2ULL },
+	{ 0x1014EBE6C5F90BF8ULL, 0xA1EBFB4219491A1FULL }, { 0xD41A26E077774EF6ULL, 0xCA66FA129F9B60A6ULL },
+	{ 0x8920B098955522B4ULL, 0xFD00B897478238D0ULL }, { 0x55B46E5F5D5535B0ULL, 0x9E20735E8CB16382ULL },
+	{ 0xEB2189F734AA831DULL, 0xC5A890362FDDBC62ULL }, { 0xA5E9EC7501D523E4ULL, 0xF712B443BBD52B7BULL },
+	{ 0x47B233C92125366EULL, 0x9A6BB0AA55653B2DULL }, { 0x999EC0BB696E840AULL, 0xC1069CD4EABE89F8ULL },
+	{ 0xC00670EA43CA250DULL, 0xF148440A256E2C76ULL }, { 0x380406926A5E5728ULL, 0x96CD2A865764DBCAULL },
+	{ 0xC605083704F5ECF2ULL, 0xBC807527ED3E12BCULL }, { 0xF7864A44C633682EULL, 0xEBA09271E88D976BULL },
+	{ 0x7AB3EE6AFBE0211DULL, 0x93445B8731587EA3ULL }, { 0x5960EA05BAD82964ULL, 0xB8157268FDAE9E4CULL },
+	{ 0x6FB92487298E33BDULL, 0xE61ACF033D1A45DFULL }, { 0xA5D3B6D479F8E056ULL, 0x8FD0C16206306BABULL },
+	{ 0x8F48A4899877186CULL, 0xB3C4F1BA87BC8696ULL }, { 0x331ACDABFE94DE87ULL, 0xE0B62E2929ABA83CULL },
+	{ 0x9FF0C08B7F1D0B14ULL, 0x8C71DCD9BA0B4925ULL }, { 0x07ECF0AE5EE44DD9ULL, 0xAF8E5410288E1B6FULL },
+	{ 0xC9E82CD9F69D6150ULL, 0xDB71E91432B1A24AULL }, { 0xBE311C083A225CD2ULL, 0x892731AC9FAF056EULL },
+	{ 0x6DBD630A48AAF406ULL, 0xAB70FE17C79AC6CAULL }, { 0x092CBBCCDAD5B108ULL, 0xD64D3D9DB981787DULL },
+	{ 0x25BBF56008C58EA5ULL, 0x85F0468293F0EB4EULL }, { 0xAF2AF2B80AF6F24EULL, 0xA76C582338ED2621ULL },
+	{ 0x1AF5AF660DB4AEE1ULL, 0xD1476E2C07286FAAULL }, { 0x50D98D9FC890ED4DULL, 0x82CCA4DB847945CAULL },
+	{ 0xE50FF107BAB528A0ULL, 0xA37FCE126597973CULL }, { 0x1E53ED49A96272C8ULL, 0xCC5FC196FEFD7D0CULL },
+	{ 0x25E8E89C13BB0F7AULL, 0xFF77B1FCBEBCDC4FULL }, { 0x77B191618C54E9ACULL, 0x9FAACF3DF73609B1ULL },
+	{ 0xD59DF5B9EF6A2417ULL, 0xC795830D75038C1DULL }, { 0x4B0573286B44AD1DULL, 0xF97AE3D0D2446F25ULL },
+	{ 0x4EE367F9430AEC32ULL, 0x9BECCE62836AC577ULL }, { 0x229C41F793CDA73FULL, 0xC2E801FB244576D5ULL },
+	{ 0x6B43527578C1110FULL, 0xF3A20279ED56D48AULL }, { 0x830A13896B78AAA9ULL, 0x9845418C345644D6ULL },
+	{ 0x23CC986BC656D553ULL, 0xBE5691EF416BD60CULL }, { 0x2CBFBE86B7EC8AA8ULL, 0xEDEC366B11C6CB8FULL },
+	{ 0x7BF7D71432F3D6A9ULL, 0x94B3A202EB1C3F39ULL }, { 0xDAF5CCD93FB0CC53ULL, 0xB9E08A83A5E34F07ULL },
+	{ 0xD1B3400F8F9CFF68ULL, 0xE858AD248F5C22C9ULL }, { 0x23100809B9C21FA1ULL, 0x91376C36D99995BEULL },
+	{ 0xABD40A0C2832A78AULL, 0xB58547448FFFFB2DULL }, { 0x16C90C8F323F516CULL, 0xE2E69915B3FFF9F9ULL },
+	{ 0xAE3DA7D97F6792E3ULL, 0x8DD01FAD907FFC3BULL }, { 0x99CD11CFDF41779CULL, 0xB1442798F49FFB4AULL },
+	{ 0x40405643D711D583ULL, 0xDD95317F31C7FA1DULL }, { 0x482835EA666B2572ULL, 0x8A7D3EEF7F1CFC52ULL },
+	{ 0xDA3243650005EECFULL, 0xAD1C8EAB5EE43B66ULL }, { 0x90BED43E40076A82ULL, 0xD863B256369D4A40ULL },
+	{ 0x5A7744A6E804A291ULL, 0x873E4F75E2224E68ULL }, { 0x711515D0A205CB36ULL, 0xA90DE3535AAAE202ULL },
+	{ 0x0D5A5B44CA873E03ULL, 0xD3515C2831559A83ULL }, { 0xE858790AFE9486C2ULL, 0x8412D9991ED58091ULL },
+	{ 0x626E974DBE39A872ULL, 0xA5178FFF668AE0B6ULL }, { 0xFB0A3D212DC8128FULL, 0xCE5D73FF402D98E3ULL },
+	{ 0x7CE66634BC9D0B99ULL, 0x80FA687F881C7F8EULL }, { 0x1C1FFFC1EBC44E80ULL, 0xA139029F6A239F72ULL },
+	{ 0xA327FFB266B56220ULL, 0xC987434744AC874EULL }, { 0x4BF1FF9F0062BAA8ULL, 0xFBE9141915D7A922ULL },
+	{ 0x6F773FC3603DB4A9ULL, 0x9D71AC8FADA6C9B5ULL }, { 0xCB550FB4384D21D3ULL, 0xC4CE17B399107C22ULL },
+	{ 0x7E2A53A146606A48ULL, 0xF6019DA07F549B2BULL }, { 0x2EDA7444CBFC426DULL, 0x99C102844F94E0FBULL },
+	{ 0xFA911155FEFB5308ULL, 0xC0314325637A1939ULL }, { 0x793555AB7EBA27CAULL, 0xF03D93EEBC589F88ULL },
+	{ 0x4BC1558B2F3458DEULL, 0x96267C7535B763B5ULL }, { 0x9EB1AAEDFB016F16ULL, 0xBBB01B9283253CA2ULL },
+	{ 0x465E15A979C1CADCULL, 0xEA9C227723EE8BCBULL }, { 0x0BFACD89EC191EC9ULL, 0x92A1958A7675175FULL },
+	{ 0xCEF980EC671F667BULL, 0xB749FAED14125D36ULL }, { 0x82B7E12780E7401AULL, 0xE51C79A85916F484ULL },
+	{ 0xD1B2ECB8B0908810ULL, 0x8F31CC0937AE58D2ULL }, { 0x861FA7E6DCB4AA15ULL, 0xB2FE3F0B8599EF07ULL },
+	{ 0x67A791E093E1D49AULL, 0xDFBDCECE67006AC9ULL }, { 0xE0C8BB2C5C6D24E0ULL, 0x8BD6A141006042BDULL },
+	{ 0x58FAE9F773886E18ULL, 0xAECC49914078536DULL }, { 0xAF39A475506A899EULL, 0xDA7F5BF590966848ULL },
+	{ 0x6D8406C952429603ULL, 0x888F99797A5E012DULL }, { 0xC8E5087BA6D33B83ULL, 0xAAB37FD7D8F58178ULL },
+	{ 0xFB1E4A9A90880A64ULL, 0xD5605FCDCF32E1D6ULL }, { 0x5CF2EEA09A55067FULL, 0x855C3BE0A17FCD26ULL },
+	{ 0xF42FAA48C0EA481EULL, 0xA6B34AD8C9DFC06FULL }, { 0xF13B94DAF124DA26ULL, 0xD0601D8EFC57B08BULL },
+	{ 0x76C53D08D6B70858ULL, 0x823C12795DB6CE57ULL }, { 0x54768C4B0C64CA6EULL, 0xA2CB1717B52481EDULL },
+	{ 0xA9942F5DCF7DFD09ULL, 0xCB7DDCDDA26DA268ULL }, { 0xD3F93B35435D7C4CULL, 0xFE5D54150B090B02ULL },
+	{ 0xC47BC5014A1A6DAFULL, 0x9EFA548D26E5A6E1ULL }, { 0x359AB6419CA1091BULL, 0xC6B8E9B0709F109AULL },
+	{ 0xC30163D203C94B62ULL, 0xF867241C8CC6D4C0ULL }, { 0x79E0DE63425DCF1DULL, 0x9B407691D7FC44F8ULL },
+	{ 0x985915FC12F542E4ULL, 0xC21094364DFB5636ULL }, { 0x3E6F5B7B17B2939DULL, 0xF294B943E17A2BC4ULL },
+	{ 0xA705992CEECF9C42ULL, 0x979CF3CA6CEC5B5AULL }, { 0x50C6FF782A838353ULL, 0xBD8430BD08277231ULL },
+	{ 0xA4F8BF5635246428ULL, 0xECE53CEC4A314EBDULL }, { 0x871B7795E136BE99ULL, 0x940F4613AE5ED136ULL },
+	{ 0x28E2557B59846E3FULL, 0xB913179899F68584ULL }, { 0x331AEADA2FE589CFULL, 0xE757DD7EC07426E5ULL },
+	{ 0x3FF0D2C85DEF7621ULL, 0x9096EA6F3848984FULL }, { 0x0FED077A756B53A9ULL, 0xB4BCA50B065ABE63ULL },
+	{ 0xD3E8495912C62894ULL, 0xE1EBCE4DC7F16DFBULL }, { 0x64712DD7ABBBD95CULL, 0x8D3360F09CF6E4BDULL },
+	{ 0xBD8D794D96AACFB3ULL, 0xB080392CC4349DECULL }, { 0xECF0D7A0FC5583A0ULL, 0xDCA04777F541C567ULL },
+	{ 0xF41686C49DB57244ULL, 0x89E42CAAF9491B60ULL }, { 0x311C2875C522CED5ULL, 0xAC5D37D5B79B6239ULL },
+	{ 0x7D633293366B828BULL, 0xD77485CB25823AC7ULL }, { 0xAE5DFF9C02033197ULL, 0x86A8D39EF77164BCULL },
+	{ 0xD9F57F830283FDFCULL, 0xA8530886B54DBDEBULL }, { 0xD072DF63C324FD7BULL, 0xD267CAA862A12D66ULL },
+	{ 0x4247CB9E59F71E6DULL, 0x8380DEA93DA4BC60ULL }, { 0x52D9BE85F074E608ULL, 0xA46116538D0DEB78ULL },
+	{ 0x67902E276C921F8BULL, 0xCD795BE870516656ULL }, { 0x00BA1CD8A3DB53B6ULL, 0x806BD9714632DFF6ULL },
+	{ 0x80E8A40ECCD228A4ULL, 0xA086CFCD97BF97F3ULL }, { 0x6122CD128006B2CDULL, 0xC8A883C0FDAF7DF0ULL },
+	{ 0x796B805720085F81ULL, 0xFAD2A4B13D1B5D6CULL }, { 0xCBE3303674053BB0ULL, 0x9CC3A6EEC6311A63ULL },
+	{ 0xBEDBFC4411068A9CULL, 0xC3F490AA77BD60FCULL }, { 0xEE92FB5515482D44ULL, 0xF4F1B4D515ACB93BULL },
+	{ 0x751BDD152D4D1C4AULL, 0x991711052D8BF3C5ULL }, { 0xD262D45A78A0635DULL, 0xBF5CD54678EEF0B6ULL },
+	{ 0x86FB897116C87C34ULL, 0xEF340A98172AACE4ULL }, { 0xD45D35E6AE3D4DA0ULL, 0x9580869F0E7AAC0EULL },
+	{ 0x8974836059CCA109ULL, 0xBAE0A846D2195712ULL }, { 0x2BD1A438703FC94BULL, 0xE998D258869FACD7ULL },
+	{ 0x7B6306A34627DDCFULL, 0x91FF83775423CC06ULL }, { 0x1A3BC84C17B1D542ULL, 0xB67F6455292CBF08ULL },
+	{ 0x20CABA5F1D9E4A93ULL, 0xE41F3D6A7377EECAULL }, { 0x547EB47B7282EE9CULL, 0x8E938662882AF53EULL },
+	{ 0xE99E619A4F23AA43ULL, 0xB23867FB2A35B28DULL }, { 0x6405FA00E2EC94D4ULL, 0xDEC681F9F4C31F31ULL },
+	{ 0xDE83BC408DD3DD04ULL, 0x8B3C113C38F9F37EULL }, { 0x9624AB50B148D445ULL, 0xAE0B158B4738705EULL },
+	{ 0x3BADD624DD9B0957ULL, 0xD98DDAEE19068C76ULL }, { 0xE54CA5D70A80E5D6ULL, 0x87F8A8D4CFA417C9ULL },
+	{ 0x5E9FCF4CCD211F4CULL, 0xA9F6D30A038D1DBCULL }, { 0x7647C3200069671FULL, 0xD47487CC8470652BULL },
+	{ 0x29ECD9F40041E073ULL, 0x84C8D4DFD2C63F3BULL }, { 0xF468107100525890ULL, 0xA5FB0A17C777CF09ULL },
+	{ 0x7182148D4066EEB4ULL, 0xCF79CC9DB955C2CCULL }, { 0xC6F14CD848405530ULL, 0x81AC1FE293D599BFULL },
+	{ 0xB8ADA00E5A506A7CULL, 0xA21727DB38CB002FULL }, { 0xA6D90811F0E4851CULL, 0xCA9CF1D206FDC03BULL },
+	{ 0x908F4A166D1DA663ULL, 0xFD442E4688BD304AULL }, { 0x9A598E4E043287FEULL, 0x9E4A9CEC15763E2EULL },
+	{ 0x40EFF1E1853F29FDULL, 0xC5DD44271AD3CDBAULL }, { 0xD12BEE59E68EF47CULL, 0xF7549530E188C128ULL },
+	{ 0x82BB74F8301958CEULL, 0x9A94DD3E8CF578B9ULL }, { 0xE36A52363C1FAF01ULL, 0xC13A148E3032D6E7ULL },
+	{ 0xDC44E6C3CB279AC1ULL, 0xF18899B1BC3F8CA1ULL }, { 0x29AB103A5EF8C0B9ULL, 0x96F5600F15A7B7E5ULL },
+	{ 0x7415D448F6B6F0E7ULL, 0xBCB2B812DB11A5DEULL }, { 0x111B495B3464AD21ULL, 0xEBDF661791D60F56ULL },
+	{ 0xCAB10DD900BEEC34ULL, 0x936B9FCEBB25C995ULL }, { 0x3D5D514F40EEA742ULL, 0xB84687C269EF3BFBULL },
+	{ 0x0CB4A5A3112A5112ULL, 0xE65829B3046B0AFAULL }, { 0x47F0E785EABA72ABULL, 0x8FF71A0FE2C2E6DCULL },
+	{ 0x59ED216765690F56ULL, 0xB3F4E093DB73A093ULL }, { 0x306869C13EC3532CULL, 0xE0F218B8D25088B8ULL },
+	{ 0x1E414218C73A13FBULL, 0x8C974F7383725573ULL }, { 0xE5D1929EF90898FAULL, 0xAFBD2350644EEACFULL },
+	{ 0xDF45F746B74ABF39ULL, 0xDBAC6C247D62A583ULL }, { 0x6B8BBA8C328EB783ULL, 0x894BC396CE5DA772ULL },
+	{ 0x066EA92F3F326564ULL, 0xAB9EB47C81F5114FULL }, { 0xC80A537B0EFEFEBDULL, 0xD686619BA27255A2ULL },
+	{ 0xBD06742CE95F5F36ULL, 0x8613FD0145877585ULL }, { 0x2C48113823B73704ULL, 0xA798FC4196E952E7ULL },
+	{ 0xF75A15862CA504C5ULL, 0xD17F3B51FCA3A7A0ULL }, { 0x9A984D73DBE722FBULL, 0x82EF85133DE648C4ULL },
+	{ 0xC13E60D0D2E0EBBAULL, 0xA3AB66580D5FDAF5ULL }, { 0x318DF905079926A8ULL, 0xCC963FEE10B7D1B3ULL },
+	{ 0xFDF17746497F7052ULL, 0xFFBBCFE994E5C61FULL }, { 0xFEB6EA8BEDEFA633ULL, 0x9FD561F1FD0F9BD3ULL },
+	{ 0xFE64A52EE96B8FC0ULL, 0xC7CABA6E7C5382C8ULL }, { 0x3DFDCE7AA3C673B0ULL, 0xF9BD690A1B68637BULL },
+	{ 0x06BEA10CA65C084EULL, 0x9C1661A651213E2DULL }, { 0x486E494FCFF30A62ULL, 0xC31BFA0FE5698DB8ULL },
+	{ 0x5A89DBA3C3EFCCFAULL, 0xF3E2F893DEC3F126ULL }, { 0xF89629465A75E01CULL, 0x986DDB5C6B3A76B7ULL },
+	{ 0xF6BBB397F1135823ULL, 0xBE89523386091465ULL }, { 0x746AA07DED582E2CULL, 0xEE2BA6C0678B597FULL },
+	{ 0xA8C2A44EB4571CDCULL, 0x94DB483840B717EFULL }, { 0x92F34D62616CE413ULL, 0xBA121A4650E4DDEBULL },
+	{ 0x77B020BAF9C81D17ULL, 0xE896A0D7E51E1566ULL }, { 0x0ACE1474DC1D122EULL, 0x915E2486EF32CD60ULL },
+	{ 0x0D819992132456BAULL, 0xB5B5ADA8AAFF80B8ULL }, { 0x10E1FFF697ED6C69ULL, 0xE3231912D5BF60E6ULL },
+	{ 0xCA8D3FFA1EF463C1ULL, 0x8DF5EFABC5979C8FULL }, { 0xBD308FF8A6B17CB2ULL, 0xB1736B96B6FD83B3ULL },
+	{ 0xAC7CB3F6D05DDBDEULL, 0xDDD0467C64BCE4A0ULL }, { 0x6BCDF07A423AA96BULL, 0x8AA22C0DBEF60EE4ULL },
+	{ 0x86C16C98D2C953C6ULL, 0xAD4AB7112EB3929DULL }, { 0xE871C7BF077BA8B7ULL, 0xD89D64D57A607744ULL },
+	{ 0x11471CD764AD4972ULL, 0x87625F056C7C4A8BULL }, { 0xD598E40D3DD89BCFULL, 0xA93AF6C6C79B5D2DULL },
+	{ 0x4AFF1D108D4EC2C3ULL, 0xD389B47879823479ULL }, { 0xCEDF722A585139BAULL, 0x843610CB4BF160CBULL },
+	{ 0xC2974EB4EE658828ULL, 0xA54394FE1EEDB8FEULL }, { 0x733D226229FEEA32ULL, 0xCE947A3DA6A9273EULL },
+	{ 0x0806357D5A3F525FULL, 0x811CCC668829B887ULL }, { 0xCA07C2DCB0CF26F7ULL, 0xA163FF802A3426A8ULL },
+	{ 0xFC89B393DD02F0B5ULL, 0xC9BCFF6034C13052ULL }, { 0xBBAC2078D443ACE2ULL, 0xFC2C3F3841F17C67ULL },
+	{ 0xD54B944B84AA4C0DULL, 0x9D9BA7832936EDC0ULL }, { 0x0A9E795E65D4DF11ULL, 0xC5029163F384A931ULL },
+	{ 0x4D4617B5FF4A16D5ULL, 0xF64335BCF065D37DULL }, { 0x504BCED1BF8E4E45ULL, 0x99EA0196163FA42EULL },
+	{ 0xE45EC2862F71E1D6ULL, 0xC06481FB9BCF8D39ULL }, { 0x5D767327BB4E5A4CULL, 0xF07DA27A82C37088ULL },
+	{ 0x3A6A07F8D510F86FULL, 0x964E858C91BA2655ULL }, { 0x890489F70A55368BULL, 0xBBE226EFB628AFEAULL },
+	{ 0x2B45AC74CCEA842EULL, 0xEADAB0ABA3B2DBE5ULL }, { 0x3B0B8BC90012929DULL, 0x92C8AE6B464FC96FULL },
+	{ 0x09CE6EBB40173744ULL, 0xB77ADA0617E3BBCBULL }, { 0xCC420A6A101D0515ULL, 0xE55990879DDCAABDULL },
+	{ 0x9FA946824A12232DULL, 0x8F57FA54C2A9EAB6ULL }, { 0x47939822DC96ABF9ULL, 0xB32DF8E9F3546564ULL },
+	{ 0x59787E2B93BC56F7ULL, 0xDFF9772470297EBDULL }, { 0x57EB4EDB3C55B65AULL, 0x8BFBEA76C619EF36ULL },
+	{ 0xEDE622920B6B23F1ULL, 0xAEFAE51477A06B03ULL }, { 0xE95FAB368E45ECEDULL, 0xDAB99E59958885C4ULL },
+	{ 0x11DBCB0218EBB414ULL, 0x88B402F7FD75539BULL }, { 0xD652BDC29F26A119ULL, 0xAAE103B5FCD2A881ULL },
+	{ 0x4BE76D3346F0495FULL, 0xD59944A37C0752A2ULL }, { 0x6F70A4400C562DDBULL, 0x857FCAE62D8493A5ULL },
+	{ 0xCB4CCD500F6BB952ULL, 0xA6DFBD9FB8E5B88EULL }, { 0x7E2000A41346A7A7ULL, 0xD097AD07A71F26B2ULL },
+	{ 0x8ED400668C0C28C8ULL, 0x825ECC24C873782FULL }, { 0x728900802F0F32FAULL, 0xA2F67F2DFA90563BULL },
+	{ 0x4F2B40A03AD2FFB9ULL, 0xCBB41EF979346BCAULL }, { 0xE2F610C84987BFA8ULL, 0xFEA126B7D78186BCULL },
+	{ 0x0DD9CA7D2DF4D7C9ULL, 0x9F24B832E6B0F436ULL }, { 0x91503D1C79720DBBULL, 0xC6EDE63FA05D3143ULL },
+	{ 0x75A44C6397CE912AULL, 0xF8A95FCF88747D94ULL }, { 0xC986AFBE3EE11ABAULL, 0x9B69DBE1B548CE7CULL },
+	{ 0xFBE85BADCE996168ULL, 0xC24452DA229B021BULL }, { 0xFAE27299423FB9C3ULL, 0xF2D56790AB41C2A2ULL },
+	{ 0xDCCD879FC967D41AULL, 0x97C560BA6B0919A5ULL }, { 0x5400E987BBC1C920ULL, 0xBDB6B8E905CB600FULL },
+	{ 0x290123E9AAB23B68ULL, 0xED246723473E3813ULL }, { 0xF9A0B6720AAF6521ULL, 0x9436C0760C86E30BULL },
+	{ 0xF808E40E8D5B3E69ULL, 0xB94470938FA89BCEULL }, { 0xB60B1D1230B20E04ULL, 0xE7958CB87392C2C2ULL },
+	{ 0xB1C6F22B5E6F48C2ULL, 0x90BD77F3483BB9B9ULL }, { 0x1E38AEB6360B1AF3ULL, 0xB4ECD5F01A4AA828ULL },
+	{ 0x25C6DA63C38DE1B0ULL, 0xE2280B6C20DD5232ULL }, { 0x579C487E5A38AD0EULL, 0x8D590723948A535FULL },
+	{ 0x2D835A9DF0C6D851ULL, 0xB0AF48EC79ACE837ULL }, { 0xF8E431456CF88E65ULL, 0xDCDB1B2798182244ULL },
+	{ 0x1B8E9ECB641B58FFULL, 0x8A08F0F8BF0F156BULL }, { 0xE272467E3D222F3FULL, 0xAC8B2D36EED2DAC5ULL },
+	{ 0x5B0ED81DCC6ABB0FULL, 0xD7ADF884AA879177ULL }, { 0x98E947129FC2B4E9ULL, 0x86CCBB52EA94BAEAULL },
+	{ 0x3F2398D747B36224ULL, 0xA87FEA27A539E9A5ULL }, { 0x8EEC7F0D19A03AADULL, 0xD29FE4B18E88640EULL },
+	{ 0x1953CF68300424ACULL, 0x83A3EEEEF9153E89ULL }, { 0x5FA8C3423C052DD7ULL, 0xA48CEAAAB75A8E2BULL },
+	{ 0x3792F412CB06794DULL, 0xCDB02555653131B6ULL }, { 0xE2BBD88BBEE40BD0ULL, 0x808E17555F3EBF11ULL },
+	{ 0x5B6ACEAEAE9D0EC4ULL, 0xA0B19D2AB70E6ED6ULL }, { 0xF245825A5A445275ULL, 0xC8DE047564D20A8BULL },
+	{ 0xEED6E2F0F0D56712ULL, 0xFB158592BE068D2EULL }, { 0x55464DD69685606BULL, 0x9CED737BB6C4183DULL },
+	{ 0xAA97E14C3C26B886ULL, 0xC428D05AA4751E4CULL }, { 0xD53DD99F4B3066A8ULL, 0xF53304714D9265DFULL },
+	{ 0xE546A8038EFE4029ULL, 0x993FE2C6D07B7FABULL }, { 0xDE98520472BDD033ULL, 0xBF8FDB78849A5F96ULL },
+	{ 0x963E66858F6D4440ULL, 0xEF73D256A5C0F77CULL }, { 0xDDE7001379A44AA8ULL, 0x95A8637627989AADULL },
+	{ 0x5560C018580D5D52ULL, 0xBB127C53B17EC159ULL }, { 0xAAB8F01E6E10B4A6ULL, 0xE9D71B689DDE71AFULL },
+	{ 0xCAB3961304CA70E8ULL, 0x9226712162AB070DULL }, { 0x3D607B97C5FD0D22ULL, 0xB6B00D69BB55C8D1ULL },
+	{ 0x8CB89A7DB77C506AULL, 0xE45C10C42A2B3B05ULL }, { 0x77F3608E92ADB242ULL, 0x8EB98A7A9A5B04E3ULL },
+	{ 0x55F038B237591ED3ULL, 0xB267ED1940F1C61CULL }, { 0x6B6C46DEC52F6688ULL, 0xDF01E85F912E37A3ULL },
+	{ 0x2323AC4B3B3DA015ULL, 0x8B61313BBABCE2C6ULL }, { 0xABEC975E0A0D081AULL, 0xAE397D8AA96C1B77ULL },
+	{ 0x96E7BD358C904A21ULL, 0xD9C7DCED53C72255ULL }, { 0x7E50D64177DA2E54ULL, 0x881CEA14545C7575ULL },
+	{ 0xDDE50BD1D5D0B9E9ULL, 0xAA242499697392D2ULL }, { 0x955E4EC64B44E864ULL, 0xD4AD2DBFC3D07787ULL },
+	{ 0xBD5AF13BEF0B113EULL, 0x84EC3C97DA624AB4ULL }, { 0xECB1AD8AEACDD58EULL, 0xA6274BBDD0FADD61ULL },
+	{ 0x67DE18EDA5814AF2ULL, 0xCFB11EAD453994BAULL }, { 0x80EACF948770CED7ULL, 0x81CEB32C4B43FCF4ULL },
+	{ 0xA1258379A94D028DULL, 0xA2425FF75E14FC31ULL }, { 0x096EE45813A04330ULL, 0xCAD2F7F5359A3B3EULL },
+	{ 0x8BCA9D6E188853FCULL, 0xFD87B5F28300CA0DULL }, { 0x775EA264CF55347EULL, 0x9E74D1B791E07E48ULL },
+	{ 0x95364AFE032A819EULL, 0xC612062576589DDAULL }, { 0x3A83DDBD83F52205ULL, 0xF79687AED3EEC551ULL },
+	{ 0xC4926A9672793543ULL, 0x9ABE14CD44753B52ULL }, { 0x75B7053C0F178294ULL, 0xC16D9A0095928A27ULL },
+	{ 0x5324C68B12DD6339ULL, 0xF1C90080BAF72CB1ULL }, { 0xD3F6FC16EBCA5E04ULL, 0x971DA05074DA7BEEULL },
+	{ 0x88F4BB1CA6BCF585ULL, 0xBCE5086492111AEAULL }, { 0x2B31E9E3D06C32E6ULL, 0xEC1E4A7DB69561A5ULL },
+	{ 0x3AFF322E62439FD0ULL, 0x9392EE8E921D5D07ULL }, { 0x09BEFEB9FAD487C3ULL, 0xB877AA3236A4B449ULL },
+	{ 0x4C2EBE687989A9B4ULL, 0xE69594BEC44DE15BULL }, { 0x0F9D37014BF60A11ULL, 0x901D7CF73AB0ACD9ULL },
+	{ 0x538484C19EF38C95ULL, 0xB424DC35095CD80FULL }, { 0x2865A5F206B06FBAULL, 0xE12E13424BB40E13ULL },
+	{ 0xF93F87B7442E45D4ULL, 0x8CBCCC096F5088CBULL }, { 0xF78F69A51539D749ULL, 0xAFEBFF0BCB24AAFEULL },
+	{ 0xB573440E5A884D1CULL, 0xDBE6FECEBDEDD5BEULL }, { 0x31680A88F8953031ULL, 0x89705F4136B4A597ULL },
+	{ 0xFDC20D2B36BA7C3EULL, 0xABCC77118461CEFCULL }, { 0x3D32907604691B4DULL, 0xD6BF94D5E57A42BCULL },
+	{ 0xA63F9A49C2C1B110ULL, 0x8637BD05AF6C69B5ULL }, { 0x0FCF80DC33721D54ULL, 0xA7C5AC471B478423ULL },
+	{ 0xD3C36113404EA4A9ULL, 0xD1B71758E219652BULL }, { 0x645A1CAC083126EAULL, 0x83126E978D4FDF3BULL },
+	{ 0x3D70A3D70A3D70A4ULL, 0xA3D70A3D70A3D70AULL }, { 0xCCCCCCCCCCCCCCCDULL, 0xCCCCCCCCCCCCCCCCULL },
+	{ 0x0000000000000000ULL, 0x8000000000000000ULL }, { 0x0000000000000000ULL, 0xA000000000000000ULL },
+	{ 0x0000000000000000ULL, 0xC800000000000000ULL }, { 0x0000000000000000ULL, 0xFA00000000000000ULL },
+	{ 0x0000000000000000ULL, 0x9C40000000000000ULL }, { 0x0000000000000000ULL, 0xC350000000000000ULL },
+	{ 0x0000000000000000ULL, 0xF424000000000000ULL }, { 0x0000000000000000ULL, 0x9896800000000000ULL },
+	{ 0x0000000000000000ULL, 0xBEBC200000000000ULL }, { 0x0000000000000000ULL, 0xEE6B280000000000ULL },
+	{ 0x0000000000000000ULL, 0x9502F90000000000ULL }, { 0x0000000000000000ULL, 0xBA43B74000000000ULL },
+	{ 0x0000000000000000ULL, 0xE8D4A51000000000ULL }, { 0x0000000000000000ULL, 0x9184E72A00000000ULL },
+	{ 0x0000000000000000ULL, 0xB5E620F480000000ULL }, { 0x0000000000000000ULL, 0xE35FA931A0000000ULL },
+	{ 0x0000000000000000ULL, 0x8E1BC9BF04000000ULL }, { 0x0000000000000000ULL, 0xB1A2BC2EC5000000ULL },
+	{ 0x0000000000000000ULL, 0xDE0B6B3A76400000ULL }, { 0x0000000000000000ULL, 0x8AC7230489E80000ULL },
+	{ 0x0000000000000000ULL, 0xAD78EBC5AC620000ULL }, { 0x0000000000000000ULL, 0xD8D726B7177A8000ULL },
+	{ 0x0000000000000000ULL, 0x878678326EAC9000ULL }, { 0x0000000000000000ULL, 0xA968163F0A57B400ULL },
+	{ 0x0000000000000000ULL, 0xD3C21BCECCEDA100ULL }, { 0x0000000000000000ULL, 0x84595161401484A0ULL },
+	{ 0x0000000000000000ULL, 0xA56FA5B99019A5C8ULL }, { 0x0000000000000000ULL, 0xCECB8F27F4200F3AULL },
+	{ 0x4000000000000000ULL, 0x813F3978F8940984ULL }, { 0x5000000000000000ULL, 0xA18F07D736B90BE5ULL },
+	{ 0xA400000000000000ULL, 0xC9F2C9CD04674EDEULL }, { 0x4D00000000000000ULL, 0xFC6F7C4045812296ULL },
+	{ 0xF020000000000000ULL, 0x9DC5ADA82B70B59DULL }, { 0x6C28000000000000ULL, 0xC5371912364CE305ULL },
+	{ 0xC732000000000000ULL, 0xF684DF56C3E01BC6ULL }, { 0x3C7F400000000000ULL, 0x9A130B963A6C115CULL },
+	{ 0x4B9F100000000000ULL, 0xC097CE7BC90715B3ULL }, { 0x1E86D40000000000ULL, 0xF0BDC21ABB48DB20ULL },
+	{ 0x1314448000000000ULL, 0x96769950B50D88F4ULL }, { 0x17D955A000000000ULL, 0xBC143FA4E250EB31ULL },
+	{ 0x5DCFAB0800000000ULL, 0xEB194F8E1AE525FDULL }, { 0x5AA1CAE500000000ULL, 0x92EFD1B8D0CF37BEULL },
+	{ 0xF14A3D9E40000000ULL, 0xB7ABC627050305ADULL }, { 0x6D9CCD05D0000000ULL, 0xE596B7B0C643C719ULL },
+	{ 0xE4820023A2000000ULL, 0x8F7E32CE7BEA5C6FULL }, { 0xDDA2802C8A800000ULL, 0xB35DBF821AE4F38BULL },
+	{ 0xD50B2037AD200000ULL, 0xE0352F62A19E306EULL }, { 0x4526F422CC340000ULL, 0x8C213D9DA502DE45ULL },
+	{ 0x9670B12B7F410000ULL, 0xAF298D050E4395D6ULL }, { 0x3C0CDD765F114000ULL, 0xDAF3F04651D47B4CULL },
+	{ 0xA5880A69FB6AC800ULL, 0x88D8762BF324CD0FULL }, { 0x8EEA0D047A457A00ULL, 0xAB0E93B6EFEE0053ULL },
+	{ 0x72A4904598D6D880ULL, 0xD5D238A4ABE98068ULL }, { 0x47A6DA2B7F864750ULL, 0x85A36366EB71F041ULL },
+	{ 0x999090B65F67D924ULL, 0xA70C3C40A64E6C51ULL }, { 0xFFF4B4E3F741CF6DULL, 0xD0CF4B50CFE20765ULL },
+	{ 0xBFF8F10E7A8921A4ULL, 0x82818F1281ED449FULL }, { 0xAFF72D52192B6A0DULL, 0xA321F2D7226895C7ULL },
+	{ 0x9BF4F8A69F764490ULL, 0xCBEA6F8CEB02BB39ULL }, { 0x02F236D04753D5B4ULL, 0xFEE50B7025C36A08ULL },
+	{ 0x01D762422C946590ULL, 0x9F4F2726179A2245ULL }, { 0x424D3AD2B7B97EF5ULL, 0xC722F0EF9D80AAD6ULL },
+	{ 0xD2E0898765A7DEB2ULL, 0xF8EBAD2B84E0D58BULL }, { 0x63CC55F49F88EB2FULL, 0x9B934C3B330C8577ULL },
+	{ 0x3CBF6B71C76B25FBULL, 0xC2781F49FFCFA6D5ULL }, { 0x8BEF464E3945EF7AULL, 0xF316271C7FC3908AULL },
+	{ 0x97758BF0E3CBB5ACULL, 0x97EDD871CFDA3A56ULL }, { 0x3D52EEED1CBEA317ULL, 0xBDE94E8E43D0C8ECULL },
+	{ 0x4CA7AAA863EE4BDDULL, 0xED63A231D4C4FB27ULL }, { 0x8FE8CAA93E74EF6AULL, 0x945E455F24FB1CF8ULL },
+	{ 0xB3E2FD538E122B44ULL, 0xB975D6B6EE39E436ULL }, { 0x60DBBCA87196B616ULL, 0xE7D34C64A9C85D44ULL },
+	{ 0xBC8955E946FE31CDULL, 0x90E40FBEEA1D3A4AULL }, { 0x6BABAB6398BDBE41ULL, 0xB51D13AEA4A488DDULL },
+	{ 0xC696963C7EED2DD1ULL, 0xE264589A4DCDAB14ULL }, { 0xFC1E1DE5CF543CA2ULL, 0x8D7EB76070A08AECULL },
+	{ 0x3B25A55F43294BCBULL, 0xB0DE65388CC8ADA8ULL }, { 0x49EF0EB713F39EBEULL, 0xDD15FE86AFFAD912ULL },
+	{ 0x6E3569326C784337ULL, 0x8A2DBF142DFCC7ABULL }, { 0x49C2C37F07965404ULL, 0xACB92ED9397BF996ULL },
+	{ 0xDC33745EC97BE906ULL, 0xD7E77A8F87DAF7FBULL }, { 0x69A028BB3DED71A3ULL, 0x86F0AC99B4E8DAFDULL },
+	{ 0xC40832EA0D68CE0CULL, 0xA8ACD7C0222311BCULL }, { 0xF50A3FA490C30190ULL, 0xD2D80DB02AABD62BULL },
+	{ 0x792667C6DA79E0FAULL, 0x83C7088E1AAB65DBULL }, { 0x577001B891185938ULL, 0xA4B8CAB1A1563F52ULL },
+	{ 0xED4C0226B55E6F86ULL, 0xCDE6FD5E09ABCF26ULL }, { 0x544F8158315B05B4ULL, 0x80B05E5AC60B6178ULL },
+	{ 0x696361AE3DB1C721ULL, 0xA0DC75F1778E39D6ULL }, { 0x03BC3A19CD1E38E9ULL, 0xC913936DD571C84CULL },
+	{ 0x04AB48A04065C723ULL, 0xFB5878494ACE3A5FULL }, { 0x62EB0D64283F9C76ULL, 0x9D174B2DCEC0E47BULL },
+	{ 0x3BA5D0BD324F8394ULL, 0xC45D1DF942711D9AULL }, { 0xCA8F44EC7EE36479ULL, 0xF5746577930D6500ULL },
+	{ 0x7E998B13CF4E1ECBULL, 0x9968BF6ABBE85F20ULL }, { 0x9E3FEDD8C321A67EULL, 0xBFC2EF456AE276E8ULL },
+	{ 0xC5CFE94EF3EA101EULL, 0xEFB3AB16C59B14A2ULL }, { 0xBBA1F1D158724A12ULL, 0x95D04AEE3B80ECE5ULL },
+	{ 0x2A8A6E45AE8EDC97ULL, 0xBB445DA9CA61281FULL }, { 0xF52D09D71A3293BDULL, 0xEA1575143CF97226ULL },
+	{ 0x593C2626705F9C56ULL, 0x924D692CA61BE758ULL }, { 0x6F8B2FB00C77836CULL, 0xB6E0C377CFA2E12EULL },
+	{ 0x0B6DFB9C0F956447ULL, 0xE498F455C38B997AULL }, { 0x4724BD4189BD5EACULL, 0x8EDF98B59A373FECULL },
+	{ 0x58EDEC91EC2CB657ULL, 0xB2977EE300C50FE7ULL }, { 0x2F2967B66737E3EDULL, 0xDF3D5E9BC0F653E1ULL },
+	{ 0xBD79E0D20082EE74ULL, 0x8B865B215899F46CULL }, { 0xECD8590680A3AA11ULL, 0xAE67F1E9AEC07187ULL },
+	{ 0xE80E6F4820CC9495ULL, 0xDA01EE641A708DE9ULL }, { 0x3109058D147FDCDDULL, 0x884134FE908658B2ULL },
+	{ 0xBD4B46F0599FD415ULL, 0xAA51823E34A7EEDEULL }, { 0x6C9E18AC7007C91AULL, 0xD4E5E2CDC1D1EA96ULL },
+	{ 0x03E2CF6BC604DDB0ULL, 0x850FADC09923329EULL }, { 0x84DB8346B786151CULL, 0xA6539930BF6BFF45ULL },
+	{ 0xE612641865679A63ULL, 0xCFE87F7CEF46FF16ULL }, { 0x4FCB7E8F3F60C07EULL, 0x81F14FAE158C5F6EULL },
+	{ 0xE3BE5E330F38F09DULL, 0xA26DA3999AEF7749ULL }, { 0x5CADF5BFD3072CC5ULL, 0xCB090C8001AB551CULL },
+	{ 0x73D9732FC7C8F7F6ULL, 0xFDCB4FA002162A63ULL }, { 0x2867E7FDDCDD9AFAULL, 0x9E9F11C4014DDA7EULL },
+	{ 0xB281E1FD541501B8ULL, 0xC646D63501A1511DULL }, { 0x1F225A7CA91A4226ULL, 0xF7D88BC24209A565ULL },
+	{ 0x3375788DE9B06958ULL, 0x9AE757596946075FULL }, { 0x0052D6B1641C83AEULL, 0xC1A12D2FC3978937ULL },
+	{ 0xC0678C5DBD23A49AULL, 0xF209787BB47D6B84ULL }, { 0xF840B7BA963646E0ULL, 0x9745EB4D50CE6332ULL },
+	{ 0xB650E5A93BC3D898ULL, 0xBD176620A501FBFFULL }, { 0xA3E51F138AB4CEBEULL, 0xEC5D3FA8CE427AFFULL },
+	{ 0xC66F336C36B10137ULL, 0x93BA47C980E98CDFULL }, { 0xB80B0047445D4184ULL, 0xB8A8D9BBE123F017ULL },
+	{ 0xA60DC059157491E5ULL, 0xE6D3102AD96CEC1DULL }, { 0x87C89837AD68DB2FULL, 0x9043EA1AC7E41392ULL },
+	{ 0x29BABE4598C311FBULL, 0xB454E4A179DD1877ULL }, { 0xF4296DD6FEF3D67AULL, 0xE16A1DC9D8545E94ULL },
+	{ 0x1899E4A65F58660CULL, 0x8CE2529E2734BB1DULL }, { 0x5EC05DCFF72E7F8FULL, 0xB01AE745B101E9E4ULL },
+	{ 0x76707543F4FA1F73ULL, 0xDC21A1171D42645DULL }, { 0x6A06494A791C53A8ULL, 0x899504AE72497EBAULL },
+	{ 0x0487DB9D17636892ULL, 0xABFA45DA0EDBDE69ULL }, { 0x45A9D2845D3C42B6ULL, 0xD6F8D7509292D603ULL },
+	{ 0x0B8A2392BA45A9B2ULL, 0x865B86925B9BC5C2ULL }, { 0x8E6CAC7768D7141EULL, 0xA7F26836F282B732ULL },
+	{ 0x3207D795430CD926ULL, 0xD1EF0244AF2364FFULL }, { 0x7F44E6BD49E807B8ULL, 0x8335616AED761F1FULL },
+	{ 0x5F16206C9C6209A6ULL, 0xA402B9C5A8D3A6E7ULL }, { 0x36DBA887C37A8C0FULL, 0xCD036837130890A1ULL },
+	{ 0xC2494954DA2C9789ULL, 0x802221226BE55A64ULL }, { 0xF2DB9BAA10B7BD6CULL, 0xA02AA96B06DEB0FDULL },
+	{ 0x6F92829494E5ACC7ULL, 0xC83553C5C8965D3DULL }, { 0xCB772339BA1F17F9ULL, 0xFA42A8B73ABBF48CULL },
+	{ 0xFF2A760414536EFBULL, 0x9C69A97284B578D7ULL }, { 0xFEF5138519684ABAULL, 0xC38413CF25E2D70DULL },
+	{ 0x7EB258665FC25D69ULL, 0xF46518C2EF5B8CD1ULL }, { 0xEF2F773FFBD97A61ULL, 0x98BF2F79D5993802ULL },
+	{ 0xAAFB550FFACFD8FAULL, 0xBEEEFB584AFF8603ULL }, { 0x95BA2A53F983CF38ULL, 0xEEAABA2E5DBF6784ULL },
+	{ 0xDD945A747BF26183ULL, 0x952AB45CFA97A0B2ULL }, { 0x94F971119AEEF9E4ULL, 0xBA756174393D88DFULL },
+	{ 0x7A37CD5601AAB85DULL, 0xE912B9D1478CEB17ULL }, { 0xAC62E055C10AB33AULL, 0x91ABB422CCB812EEULL },
+	{ 0x577B986B314D6009ULL, 0xB616A12B7FE617AAULL }, { 0xED5A7E85FDA0B80BULL, 0xE39C49765FDF9D94ULL },
+	{ 0x14588F13BE847307ULL, 0x8E41ADE9FBEBC27DULL }, { 0x596EB2D8AE258FC8ULL, 0xB1D219647AE6B31CULL },
+	{ 0x6FCA5F8ED9AEF3BBULL, 0xDE469FBD99A05FE3ULL }, { 0x25DE7BB9480D5854ULL, 0x8AEC23D680043BEEULL },
+	{ 0xAF561AA79A10AE6AULL, 0xADA72CCC20054AE9ULL }, { 0x1B2BA1518094DA04ULL, 0xD910F7FF28069DA4ULL },
+	{ 0x90FB44D2F05D0842ULL, 0x87AA9AFF79042286ULL }, { 0x353A1607AC744A53ULL, 0xA99541BF57452B28ULL },
+	{ 0x42889B8997915CE8ULL, 0xD3FA922F2D1675F2ULL }, { 0x69956135FEBADA11ULL, 0x847C9B5D7C2E09B7ULL },
+	{ 0x43FAB9837E699095ULL, 0xA59BC234DB398C25ULL }, { 0x94F967E45E03F4BBULL, 0xCF02B2C21207EF2EULL },
+	{ 0x1D1BE0EEBAC278F5ULL, 0x8161AFB94B44F57DULL }, { 0x6462D92A69731732ULL, 0xA1BA1BA79E1632DCULL },
+	{ 0x7D7B8F7503CFDCFEULL, 0xCA28A291859BBF93ULL }, { 0x5CDA735244C3D43EULL, 0xFCB2CB35E702AF78ULL },
+	{ 0x3A0888136AFA64A7ULL, 0x9DEFBF01B061ADABULL }, { 0x088AAA1845B8FDD0ULL, 0xC56BAEC21C7A1916ULL },
+	{ 0x8AAD549E57273D45ULL, 0xF6C69A72A3989F5BULL }, { 0x36AC54E2F678864BULL, 0x9A3C2087A63F6399ULL },
+	{ 0x84576A1BB416A7DDULL, 0xC0CB28A98FCF3C7FULL }, { 0x656D44A2A11C51D5ULL, 0xF0FDF2D3F3C30B9FULL },
+	{ 0x9F644AE5A4B1B325ULL, 0x969EB7C47859E743ULL }, { 0x873D5D9F0DDE1FEEULL, 0xBC4665B596706114ULL },
+	{ 0xA90CB506D155A7EAULL, 0xEB57FF22FC0C7959ULL }, { 0x09A7F12442D588F2ULL, 0x9316FF75DD87CBD8ULL },
+	{ 0x0C11ED6D538AEB2FULL, 0xB7DCBF5354E9BECEULL }, { 0x8F1668C8A86DA5FAULL, 0xE5D3EF282A242E81ULL },
+	{ 0xF96E017D694487BCULL, 0x8FA475791A569D10ULL }, { 0x37C981DCC395A9ACULL, 0xB38D92D760EC4455ULL },
+	{ 0x85BBE253F47B1417ULL, 0xE070F78D3927556AULL }, { 0x93956D7478CCEC8EULL, 0x8C469AB843B89562ULL },
+	{ 0x387AC8D1970027B2ULL, 0xAF58416654A6BABBULL }, { 0x06997B05FCC0319EULL, 0xDB2E51BFE9D0696AULL },
+	{ 0x441FECE3BDF81F03ULL, 0x88FCF317F22241E2ULL }, { 0xD527E81CAD7626C3ULL, 0xAB3C2FDDEEAAD25AULL },
+	{ 0x8A71E223D8D3B074ULL, 0xD60B3BD56A5586F1ULL }, { 0xF6872D5667844E49ULL, 0x85C7056562757456ULL },
+	{ 0xB428F8AC016561DBULL, 0xA738C6BEBB12D16CULL }, { 0xE13336D701BEBA52ULL, 0xD106F86E69D785C7ULL },
+	{ 0xECC0024661173473ULL, 0x82A45B450226B39CULL }, { 0x27F002D7F95D0190ULL, 0xA34D721642B06084ULL },
+	{ 0x31EC038DF7B441F4ULL, 0xCC20CE9BD35C78A5ULL }, { 0x7E67047175A15271ULL, 0xFF290242C83396CEULL },
+	{ 0x0F0062C6E984D386ULL, 0x9F79A169BD203E41ULL }, { 0x52C07B78A3E60868ULL, 0xC75809C42C684DD1ULL },
+	{ 0xA7709A56CCDF8A82ULL, 0xF92E0C3537826145ULL }, { 0x88A66076400BB691ULL, 0x9BBCC7A142B17CCBULL },
+	{ 0x6ACFF893D00EA435ULL, 0xC2ABF989935DDBFEULL }, { 0x0583F6B8C4124D43ULL, 0xF356F7EBF83552FEULL },
+	{ 0xC3727A337A8B704AULL, 0x98165AF37B2153DEULL }, { 0x744F18C0592E4C5CULL, 0xBE1BF1B059E9A8D6ULL },
+	{ 0x1162DEF06F79DF73ULL, 0xEDA2EE1C7064130CULL }, { 0x8ADDCB5645AC2BA8ULL, 0x9485D4D1C63E8BE7ULL },
+	{ 0x6D953E2BD7173692ULL, 0xB9A74A0637CE2EE1ULL }, { 0xC8FA8DB6CCDD0437ULL, 0xE8111C87C5C1BA99ULL },
+	{ 0x1D9C9892400A22A2ULL, 0x910AB1D4DB9914A0ULL }, { 0x2503BEB6D00CAB4BULL, 0xB54D5E4A127F59C8ULL },
+	{ 0x2E44AE64840FD61DULL, 0xE2A0B5DC971F303AULL }, { 0x5CEAECFED289E5D2ULL, 0x8DA471A9DE737E24ULL },
+	{ 0x7425A83E872C5F47ULL, 0xB10D8E1456105DADULL }, { 0xD12F124E28F77719ULL, 0xDD50F1996B947518ULL },
+	{ 0x82BD6B70D99AAA6FULL, 0x8A5296FFE33CC92FULL }, { 0x636CC64D1001550BULL, 0xACE73CBFDC0BFB7BULL },
+	{ 0x3C47F7E05401AA4EULL, 0xD8210BEFD30EFA5AULL }, { 0x65ACFAEC34810A71ULL, 0x8714A775E3E95C78ULL },
+	{ 0x7F1839A741A14D0DULL, 0xA8D9D1535CE3B396ULL }, { 0x1EDE48111209A050ULL, 0xD31045A8341CA07CULL },
+	{ 0x934AED0AAB460432ULL, 0x83EA2B892091E44DULL }, { 0xF81DA84D5617853FULL, 0xA4E4B66B68B65D60ULL },
+	{ 0x36251260AB9D668EULL, 0xCE1DE40642E3F4B9ULL }, { 0xC1D72B7C6B426019ULL, 0x80D2AE83E9CE78F3ULL },
+	{ 0xB24CF65B8612F81FULL, 0xA1075A24E4421730ULL }, { 0xDEE033F26797B627ULL, 0xC94930AE1D529CFCULL },
+	{ 0x169840EF017DA3B1ULL, 0xFB9B7CD9A4A7443CULL }, { 0x8E1F289560EE864EULL, 0x9D412E0806E88AA5ULL },
+	{ 0xF1A6F2BAB92A27E2ULL, 0xC491798A08A2AD4EULL }, { 0xAE10AF696774B1DBULL, 0xF5B5D7EC8ACB58A2ULL },
+	{ 0xACCA6DA1E0A8EF29ULL, 0x9991A6F3D6BF1765ULL }, { 0x17FD090A58D32AF3ULL, 0xBFF610B0CC6EDD3FULL },
+	{ 0xDDFC4B4CEF07F5B0ULL, 0xEFF394DCFF8A948EULL }, { 0x4ABDAF101564F98EULL, 0x95F83D0A1FB69CD9ULL },
+	{ 0x9D6D1AD41ABE37F1ULL, 0xBB764C4CA7A4440FULL }, { 0x84C86189216DC5EDULL, 0xEA53DF5FD18D5513ULL },
+	{ 0x32FD3CF5B4E49BB4ULL, 0x92746B9BE2F8552CULL }, { 0x3FBC8C33221DC2A1ULL, 0xB7118682DBB66A77ULL },
+	{ 0x0FABAF3FEAA5334AULL, 0xE4D5E82392A40515ULL }, { 0x29CB4D87F2A7400EULL, 0x8F05B1163BA6832DULL },
+	{ 0x743E20E9EF511012ULL, 0xB2C71D5BCA9023F8ULL }, { 0x914DA9246B255416ULL, 0xDF78E4B2BD342CF6ULL },
+	{ 0x1AD089B6C2F7548EULL, 0x8BAB8EEFB6409C1AULL }, { 0xA184AC2473B529B1ULL, 0xAE9672ABA3D0C320ULL },
+	{ 0xC9E5D72D90A2741EULL, 0xDA3C0F568CC4F3E8ULL }, { 0x7E2FA67C7A658892ULL, 0x8865899617FB1871ULL },
+	{ 0xDDBB901B98FEEAB7ULL, 0xAA7EEBFB9DF9DE8DULL }, { 0x552A74227F3EA565ULL, 0xD51EA6FA85785631ULL },
+	{ 0xD53A88958F87275FULL, 0x8533285C936B35DEULL }, { 0x8A892ABAF368F137ULL, 0xA67FF273B8460356ULL },
+	{ 0x2D2B7569B0432D85ULL, 0xD01FEF10A657842CULL }, { 0x9C3B29620E29FC73ULL, 0x8213F56A67F6B29BULL },
+	{ 0x8349F3BA91B47B8FULL, 0xA298F2C501F45F42ULL }, { 0x241C70A936219A73ULL, 0xCB3F2F7642717713ULL },
+	{ 0xED238CD383AA0110ULL, 0xFE0EFB53D30DD4D7ULL }, { 0xF4363804324A40AAULL, 0x9EC95D1463E8A506ULL },
+	{ 0xB143C6053EDCD0D5ULL, 0xC67BB4597CE2CE48ULL }, { 0xDD94B7868E94050AULL, 0xF81AA16FDC1B81DAULL },
+	{ 0xCA7CF2B4191C8326ULL, 0x9B10A4E5E9913128ULL }, { 0xFD1C2F611F63A3F0ULL, 0xC1D4CE1F63F57D72ULL },
+	{ 0xBC633B39673C8CECULL, 0xF24A01A73CF2DCCFULL }, { 0xD5BE0503E085D813ULL, 0x976E41088617CA01ULL },
+	{ 0x4B2D8644D8A74E18ULL, 0xBD49D14AA79DBC82ULL }, { 0xDDF8E7D60ED1219EULL, 0xEC9C459D51852BA2ULL },
+	{ 0xCABB90E5C942B503ULL, 0x93E1AB8252F33B45ULL }, { 0x3D6A751F3B936243ULL, 0xB8DA1662E7B00A17ULL },
+	{ 0x0CC512670A783AD4ULL, 0xE7109BFBA19C0C9DULL }, { 0x27FB2B80668B24C5ULL, 0x906A617D450187E2ULL },
+	{ 0xB1F9F660802DEDF6ULL, 0xB484F9DC9641E9DAULL }, { 0x5E7873F8A0396973ULL, 0xE1A63853BBD26451ULL },
+	{ 0xDB0B487B6423E1E8ULL, 0x8D07E33455637EB2ULL }, { 0x91CE1A9A3D2CDA62ULL, 0xB049DC016ABC5E5FULL },
+	{ 0x7641A140CC7810FBULL, 0xDC5C5301C56B75F7ULL }, { 0xA9E904C87FCB0A9DULL, 0x89B9B3E11B6329BAULL },
+	{ 0x546345FA9FBDCD44ULL, 0xAC2820D9623BF429ULL }, { 0xA97C177947AD4095ULL, 0xD732290FBACAF133ULL },
+	{ 0x49ED8EABCCCC485DULL, 0x867F59A9D4BED6C0ULL }, { 0x5C68F256BFFF5A74ULL, 0xA81F301449EE8C70ULL },
+	{ 0x73832EEC6FFF3111ULL, 0xD226FC195C6A2F8CULL }, { 0xC831FD53C5FF7EABULL, 0x83585D8FD9C25DB7ULL },
+	{ 0xBA3E7CA8B77F5E55ULL, 0xA42E74F3D032F525ULL }, { 0x28CE1BD2E55F35EBULL, 0xCD3A1230C43FB26FULL },
+	{ 0x7980D163CF5B81B3ULL, 0x80444B5E7AA7CF85ULL }, { 0xD7E105BCC332621FULL, 0xA0555E361951C366ULL },
+	{ 0x8DD9472BF3FEFAA7ULL, 0xC86AB5C39FA63440ULL }, { 0xB14F98F6F0FEB951ULL, 0xFA856334878FC150ULL },
+	{ 0x6ED1BF9A569F33D3ULL, 0x9C935E00D4B9D8D2ULL }, { 0x0A862F80EC4700C8ULL, 0xC3B8358109E84F07ULL },
+	{ 0xCD27BB612758C0FAULL, 0xF4A642E14C6262C8ULL }, { 0x8038D51CB897789CULL, 0x98E7E9CCCFBD7DBDULL },
+	{ 0xE0470A63E6BD56C3ULL, 0xBF21E44003ACDD2CULL }, { 0x1858CCFCE06CAC74ULL, 0xEEEA5D5004981478ULL },
+	{ 0x0F37801E0C43EBC8ULL, 0x95527A5202DF0CCBULL }, { 0xD30560258F54E6BAULL, 0xBAA718E68396CFFDULL },
+	{ 0x47C6B82EF32A2069ULL, 0xE950DF20247C83FDULL }, { 0x4CDC331D57FA5441ULL, 0x91D28B7416CDD27EULL },
+	{ 0xE0133FE4ADF8E952ULL, 0xB6472E511C81471DULL }, { 0x58180FDDD97723A6ULL, 0xE3D8F9E563A198E5ULL },
+	{ 0x570F09EAA7EA7648ULL, 0x8E679C2F5E44FF8FULL },
+};
+
+INLINE bool ParseFail(ParseFailure_t* failureOut, ParseFailure_t failure)
+{
+	SetOptionalOutPntr(failureOut, failure);
+	return false;
+}
+
+// +--------------------------------------------------------------+
+// |                         SWAR Digits                          |
+// +--------------------------------------------------------------+
+//NOTE: These treat the 8 characters as a little-endian u64 (WASM and x86 both are), so chars[0] is the low byte
+INLINE u64 ParseLoadU64(const char* chars)
+{
+	u64 result;
+	memcpy(&result, chars, sizeof(result));
+	return result;
+}
+//True if all 8 bytes are '0'-'9'. The high nibble must be 3, and adding 6 must not carry out of the low nibble
+INLINE bool ParseIsEightDigits(u64 block)
+{
+	return (((block & 0xF0F0F0F0F0F0F0F0ULL) | (((block + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) == 0x3333333333333333ULL);
+}
+//Combines 8 digit characters into their value with 3 multiplies, merging pairs of digits, then pairs of pairs, then the two halves
+INLINE u32 ParseEightDigits(u64 block)
+{
+	const u64 mask = 0x000000FF000000FFULL;
+	const u64 multiplier1 = 100 + (1000000ULL << 32);
+	const u64 multiplier2 = 1 + (10000ULL << 32);
+	block -= 0x3030303030303030ULL;
+	block = (block * 10) + (block >> 8);
+	block = (((block & mask) * multiplier1) + (((block >> 16) & mask) * multiplier2)) >> 32;
+	return (u32)block;
+}
+
+//Reads digits starting at *indexPntr until a non-digit. Digits are added to *mantissaPntr as long as it stays below 10^19 (leading zeros
+//always fit), after that they are only counted in numDroppedOut and set *isTruncatedPntr if non-zero. Returns the number of digits read
+INLINE u64 ParseDigitRun(MyStr_t str, u64* indexPntr, u64* mantissaPntr, u64* numDroppedOut, bool* isTruncatedPntr)
+{
+	u64 index = *indexPntr;
+	u64 mantissa = *mantissaPntr;
+	u64 numDropped = 0;
+	//A block of 8 only goes in while the mantissa has 11 digits or less, so it can't get past 19
+	while (index + 8 <= str.length && mantissa < 100000000000ULL)
+	{
+		u64 block = ParseLoadU64(&str.chars[index]);
+		if (!ParseIsEightDigits(block)) { break; }
+		mantissa = (mantissa * 100000000ULL) + ParseEightDigits(block);
+		index += 8;
+	}
+	for (; index < str.length; index++)
+	{
+		u8 digit = (u8)(str.chars[index] - '0');
+		if (digit > 9) { break; }
+		if (mantissa < 1000000000000000000ULL) { mantissa = (mantissa * 10) + digit; }
+		else
+		{
+			numDropped++;
+			if (digit != 0) { *isTruncatedPntr = true; }
+		}
+	}
+	u64 numDigits = index - *indexPntr;
+	*indexPntr = index;
+	*mantissaPntr = mantissa;
+	*numDroppedOut = numDropped;
+	return numDigits;
+}
+
+// +--------------------------------------------------------------+
+// |                           Integers                           |
+// +--------------------------------------------------------------+
+//Parses everything from index to the end of str as an unsigned decimal number. Leading zeros are fine
+bool ParseDigitsU64(MyStr_t str, u64 index, u64* valueOut, ParseFailure_t* failureOut)
+{
+	if (index >= str.length) { return ParseFail(failureOut, ParseFailure_InvalidCharacter); }
+	while (index + 1 < str.length && str.chars[index] == '0') { index++; }
+	u64 value = 0;
+	u64 numDigits = 0;
+	while (index + 8 <= str.length && numDigits + 8 <= PARSE_MAX_MANTISSA_DIGITS)
+	{
+		u64 block = ParseLoadU64(&str.chars[index]);
+		if (!ParseIsEightDigits(block)) { break; }
+		value = (value * 100000000ULL) + ParseEightDigits(block);
+		numDigits += 8;
+		index += 8;
+	}
+	for (; index < str.length; index++)
+	{
+		u8 digit = (u8)(str.chars[index] - '0');
+		if (digit > 9) { return ParseFail(failureOut, ParseFailure_InvalidCharacter); }
+		if (numDigits >= PARSE_MAX_MANTISSA_DIGITS && (numDigits > PARSE_MAX_MANTISSA_DIGITS || value > (UINT64_MAX - digit) / 10))
+		{
+			return ParseFail(failureOut, ParseFailure_Overflow);
+		}
+		value = (value * 10) + digit;
+		numDigits++;
+	}
+	*valueOut = value;
+	return true;
+}
+
+//Optional leading '+'
+bool TryParseU64(MyStr_t str, u64* valueOut, ParseFailure_t* failureOut = nullptr)
+{
+	NotNull(valueOut);
+	if (str.length == 0) { return ParseFail(failureOut, ParseFailure_Empty); }
+	u64 value = 0;
+	if (!ParseDigitsU64(str, (str.chars[0] == '+') ? 1 : 0, &value, failureOut)) { return false; }
+	*valueOut = value;
+	SetOptionalOutPntr(failureOut, ParseFailure_None);
+	return true;
+}
+//Optional leading '+' or '-'
+bool TryParseI64(MyStr_t str, i64* valueOut, ParseFailure_t* failureOut = nullptr)
+{
+	NotNull(valueOut);
+	if (str.length == 0) { return ParseFail(failureOut, ParseFailure_Empty); }
+	bool isNegative = (str.chars[0] == '-');
+	u64 magnitude = 0;
+	if (!ParseDigitsU64(str, (isNegative || str.chars[0] == '+') ? 1 : 0, &magnitude, failureOut)) { return false; }
+	if (magnitude > (u64)INT64_MAX + (isNegative ? 1 : 0)) { return ParseFail(failureOut, ParseFailure_Overflow); }
+	*valueOut = isNegative ? (i64)(0 - magnitude) : (i64)magnitude;
+	SetOptionalOutPntr(failureOut, ParseFailure_None);
+	return true;
+}
+bool TryParseI32(MyStr_t str, i32* valueOut, ParseFailure_t* failureOut = nullptr)
+{
+	NotNull(valueOut);
+	i64 value = 0;
+	if (!TryParseI64(str, &value, failureOut)) { return false; }
+	if (value < INT32_MIN || value > INT32_MAX) { return ParseFail(failureOut, ParseFailure_Overflow); }
+	*valueOut = (i32)value;
+	return true;
+}
+
+// +--------------------------------------------------------------+
+// |                         Float Digits                         |
+// +--------------------------------------------------------------+
+//True if the rest of str from index is word, ignoring case. word must be lowercase
+INLINE bool ParseMatchWord(MyStr_t str, u64 index, const char* word)
+{
+	u64 wordLength = (u64)strlen(word);
+	if (str.length - index != wordLength) { return false; }
+	for (u64 cIndex = 0; cIndex < wordLength; cIndex++)
+	{
+		if ((str.chars[index + cIndex] | 0x20) != word[cIndex]) { return false; }
+	}
+	return true;
+}
+
+//Accepts [+-]digits[.digits][(e|E)[+-]digits] where either side of the point can be empty (but not both), plus "inf", "infinity" and "nan"
+INLINE bool ParseFloatText(MyStr_t str, ParseDecimal_t* decimalOut, ParseFailure_t* failureOut)
+{
+	if (str.length == 0) { return ParseFail(failureOut, ParseFailure_Empty); }
+	ClearPointer(decimalOut);
+	u64 index = 0;
+	if (str.chars[0] == '-' || str.chars[0] == '+') { decimalOut->isNegative = (str.chars[0] == '-'); index++; }
+
+	if (index < str.length && (str.chars[index] | 0x20) >= 'a' && (str.chars[index] | 0x20) <= 'z')
+	{
+		if (ParseMatchWord(str, index, "inf") || ParseMatchWord(str, index, "infinity")) { decimalOut->isInfinity = true; return true; }
+		if (ParseMatchWord(str, index, "nan")) { decimalOut->isNan = true; return true; }
+		return ParseFail(failureOut, ParseFailure_InvalidCharacter);
+	}
+
+	decimalOut->digitsStart = index;
+	u64 numDropped = 0;
+	u64 numDigits = ParseDigitRun(str, &index, &decimalOut->mantissa, &numDropped, &decimalOut->isTruncated);
+	decimalOut->exponent = (i64)numDropped;
+	if (index < str.length && str.chars[index] == '.')
+	{
+		index++;
+		u64 numFractionDigits = ParseDigitRun(str, &index, &decimalOut->mantissa, &numDropped, &decimalOut->isTruncated);
+		decimalOut->exponent -= (i64)(numFractionDigits - numDropped);
+		numDigits += numFractionDigits;
+	}
+	if (numDigits == 0) { return ParseFail(failureOut, ParseFailure_InvalidCharacter); }
+	decimalOut->digitsEnd = index;
+
+	if (index < str.length && (str.chars[index] == 'e' || str.chars[index] == 'E'))
+	{
+		index++;
+		bool isExponentNegative = false;
+		if (index < str.length && (str.chars[index] == '-' || str.chars[index] == '+')) { isExponentNegative = (str.chars[index] == '-'); index++; }
+		u64 exponentStart = index;
+		i64 explicitExponent = 0;
+		for (; index < str.length; index++)
+		{
+			u8 digit = (u8)(str.chars[index] - '0');
+			if (digit > 9) { break; }
+			if (explicitExponent < 100000000) { explicitExponent = (explicitExponent * 10) + digit; } //anything this big is already 0 or infinity
+		}
+		if (index == exponentStart) { return ParseFail(failureOut, ParseFailure_InvalidCharacter); }
+		decimalOut->explicitExponent = isExponentNegative ? -explicitExponent : explicitExponent;
+		decimalOut->exponent += decimalOut->explicitExponent;
+	}
+	if (index != str.length) { return ParseFail(failureOut, ParseFailure_InvalidCharacter); }
+	return true;
+}
+
+// +--------------------------------------------------------------+
+// |                         Eisel-Lemire                         |
+// +--------------------------------------------------------------+
+//Rounds mantissa * 10^exponent to the nearest float (ties to even) and returns its bits without the sign. This is only exact when
+//mantissa holds all of the digits, see ParseDecimalToBits for what to do when it was truncated. Returns infinity's bits when it overflows
+u64 ParseEiselLemire(u64 mantissa, i64 exponent, const ParseFloatFormat_t* format)
+{
+	u32 numMantissaBits = format->numMantissaBits;
+	i32 infinitePower = (1 << format->numExponentBits) - 1;
+	if (mantissa == 0 || exponent < format->minPow10) { return 0; }
+	if (exponent > format->maxPow10) { return ((u64)infinitePower << numMantissaBits); }
+
+	//Multiply the normalized mantissa by 5^exponent, only reading the second half of the table entry when the first isn't enough to round with
+	u32 leadingZeros = CountLeadingZerosU64(mantissa);
+	mantissa <<= leadingZeros;
+	const u64* pow5 = ParsePow5Table[exponent - PARSE_MIN_POW10];
+	u64 productLow = 0;
+	u64 productHigh = MultiplyU64Full(mantissa, pow5[1], &productLow);
+	u64 precisionMask = (0xFFFFFFFFFFFFFFFFULL >> (numMantissaBits + 3));
+	if ((productHigh & precisionMask) == precisionMask)
+	{
+		u64 secondLow = 0;
+		u64 secondHigh = MultiplyU64Full(mantissa, pow5[0], &secondLow);
+		productLow += secondHigh;
+		if (secondHigh > productLow) { productHigh++; }
+	}
+
+	//Keep numMantissaBits+2 bits (the implicit 1, the mantissa, and one more to round with)
+	u32 upperBit = (u32)(productHigh >> 63);
+	u32 shift = upperBit + 64 - numMantissaBits - 3;
+	u64 result = (productHigh >> shift);
+	//floor(log2(10^exponent)) + 63 is ((217706 * exponent) >> 16) + 63
+	i32 power2 = (i32)((((152170 + 65536) * (i32)exponent) >> 16) + 63) + (i32)upperBit - (i32)leadingZeros + format->exponentBias;
+
+	if (power2 <= 0)
+	{
+		//Subnormal, shift the extra bits out and round
+		if (-power2 + 1 >= 64) { return 0; }
+		result >>= (-power2 + 1);
+		result += (result & 1);
+		result >>= 1;
+		//Rounding up can carry into the smallest normal exponent
+		power2 = (result < (1ULL << numMantissaBits)) ? 0 : 1;
+		return ((u64)power2 << numMantissaBits) | result;
+	}
+
+	//Exactly halfway between two floats is only possible for a few small exponents, and then it has to round to even instead of up
+	if (productLow <= 1 && exponent >= format->minRoundToEvenPow10 && exponent <= format->maxRoundToEvenPow10 && (result & 3) == 1)
+	{
+		if ((result << shift) == productHigh) { result &= ~1ULL; }
+	}
+	result += (result & 1);
+	result >>= 1;
+	if (result >= (2ULL << numMantissaBits))
+	{
+		result = (1ULL << numMantissaBits);
+		power2++;
+	}
+	result &= ~(1ULL << numMantissaBits);
+	if (power2 >= infinitePower) { return ((u64)infinitePower << numMantissaBits); }
+	return ((u64)power2 << numMantissaBits) | result;
+}
+
+// +--------------------------------------------------------------+
+// |                         Big Decimal                          |
+// +--------------------------------------------------------------+
+//NOTE: This is the simple decimal conversion from Go's strconv (decimal.go and atof.go). It's slow, but it only runs for inputs with more
+//than 19 significant digits that land too close to halfway between two floats for the first 19 digits to decide
+void ParseBigDecimalTrim(ParseBigDecimal_t* decimal)
+{
+	while (decimal->numDigits > 0 && decimal->digits[decimal->numDigits - 1] == 0) { decimal->numDigits--; }
+	if (decimal->numDigits == 0) { decimal->decimalPoint = 0; }
+}
+
+void ParseBigDecimalInit(ParseBigDecimal_t* decimalOut, MyStr_t str, const ParseDecimal_t* decimal)
+{
+	decimalOut->numDigits = 0;
+	decimalOut->decimalPoint = 0;
+	decimalOut->isTruncated = false;
+	bool sawPoint = false;
+	bool sawNonZero = false;
+	for (u64 cIndex = decimal->digitsStart; cIndex < decimal->digitsEnd; cIndex++)
+	{
+		if (str.chars[cIndex] == '.') { sawPoint = true; continue; }
+		u8 digit = (u8)(str.chars[cIndex] - '0');
+		if (!sawNonZero && digit == 0)
+		{
+			if (sawPoint) { decimalOut->decimalPoint--; }
+			continue;
+		}
+		sawNonZero = true;
+		if (!sawPoint) { decimalOut->decimalPoint++; }
+		if (decimalOut->numDigits < PARSE_BIG_DECIMAL_MAX_DIGITS) { decimalOut->digits[decimalOut->numDigits++] = digit; }
+		else if (digit != 0) { decimalOut->isTruncated = true; }
+	}
+	decimalOut->decimalPoint += decimal->explicitExponent;
+	ParseBigDecimalTrim(decimalOut);
+}
+
+//Divides by 2^amount, amount <= 60
+void ParseBigDecimalShiftRight(ParseBigDecimal_t* decimal, u32 amount)
+{
+	u32 readIndex = 0;
+	u32 writeIndex = 0;
+	u64 accumulator = 0;
+	for (; (accumulator >> amount) == 0; readIndex++)
+	{
+		if (readIndex >= decimal->numDigits)
+		{
+			if (accumulator == 0) { decimal->numDigits = 0; return; }
+			while ((accumulator >> amount) == 0) { accumulator *= 10; readIndex++; }
+			break;
+		}
+		accumulator = (accumulator * 10) + decimal->digits[readIndex];
+	}
+	decimal->decimalPoint -= (i64)readIndex - 1;
+	u64 mask = (1ULL << amount) - 1;
+	for (; readIndex < decimal->numDigits; readIndex++)
+	{
+		u8 nextDigit = decimal->digits[readIndex];
+		decimal->digits[writeIndex++] = (u8)(accumulator >> amount);
+		accumulator = ((accumulator & mask) * 10) + nextDigit;
+	}
+	while (accumulator > 0)
+	{
+		u8 digit = (u8)(accumulator >> amount);
+		accumulator &= mask;
+		if (writeIndex < PARSE_BIG_DECIMAL_MAX_DIGITS) { decimal->digits[writeIndex++] = digit; }
+		else if (digit > 0) { decimal->isTruncated = true; }
+		accumulator *= 10;
+	}
+	decimal->numDigits = writeIndex;
+	ParseBigDecimalTrim(decimal);
+}
+
+//Multiplies by 2^amount, amount <= 60. Digits come out lowest first so they are collected backwards and then flipped into place
+void ParseBigDecimalShiftLeft(ParseBigDecimal_t* decimal, u32 amount)
+{
+	u8 reversed[PARSE_BIG_DECIMAL_MAX_DIGITS + 20];
+	u32 numReversed = 0;
+	u64 accumulator = 0;
+	for (u32 dIndex = decimal->numDigits; dIndex > 0; dIndex--)
+	{
+		accumulator += ((u64)decimal->digits[dIndex - 1] << amount);
+		u64 quotient = accumulator / 10;
+		reversed[numReversed++] = (u8)(accumulator - (quotient * 10));
+		accumulator = quotient;
+	}
+	while (accumulator > 0)
+	{
+		u64 quotient = accumulator / 10;
+		reversed[numReversed++] = (u8)(accumulator - (quotient * 10));
+		accumulator = quotient;
+	}
+	decimal->decimalPoint += (i64)(numReversed - decimal->numDigits);
+	decimal->numDigits = 0;
+	for (u32 rIndex = numReversed; rIndex > 0; rIndex--)
+	{
+		u8 digit = reversed[rIndex - 1];
+		if (decimal->numDigits < PARSE_BIG_DECIMAL_MAX_DIGITS) { decimal->digits[decimal->numDigits++] = digit; }
+		else if (digit != 0) { decimal->isTruncated = true; }
+	}
+	ParseBigDecimalTrim(decimal);
+}
+
+void ParseBigDecimalShift(ParseBigDecimal_t* decimal, i32 amount)
+{
+	if (decimal->numDigits == 0) { return; }
+	while (amount > 60) { ParseBigDecimalShiftLeft(decimal, 60); amount -= 60; }
+	while (amount < -60) { ParseBigDecimalShiftRight(decimal, 60); amount += 60; }
+	if (amount > 0) { ParseBigDecimalShiftLeft(decimal, (u32)amount); }
+	else if (amount < 0) { ParseBigDecimalShiftRight(decimal, (u32)-amount); }
+}
+
+//The integer part, rounded to nearest (ties to even, unless digits past the end were dropped)
+u64 ParseBigDecimalRoundedInteger(const ParseBigDecimal_t* decimal)
+{
+	if (decimal->decimalPoint > 20) { return UINT64_MAX; }
+	u64 result = 0;
+	i64 dIndex = 0;
+	for (; dIndex < decimal->decimalPoint && dIndex < (i64)decimal->numDigits; dIndex++) { result = (result * 10) + decimal->digits[dIndex]; }
+	for (; dIndex < decimal->decimalPoint; dIndex++) { result *= 10; }
+	i64 roundIndex = decimal->decimalPoint;
+	if (roundIndex >= 0 && roundIndex < (i64)decimal->numDigits)
+	{
+		u8 roundDigit = decimal->digits[roundIndex];
+		if (roundDigit == 5 && roundIndex + 1 == (i64)decimal->numDigits)
+		{
+			if (decimal->isTruncated || (roundIndex > 0 && (decimal->digits[roundIndex - 1] % 2) != 0)) { result++; }
+		}
+		else if (roundDigit >= 5) { result++; }
+	}
+	return result;
+}
+
+//Scales by powers of 2 until the value is in [0.5, 1), then pulls out numMantissaBits+1 bits. Returns the bits without the sign
+u64 ParseBigDecimalToBits(ParseBigDecimal_t* decimal, const ParseFloatFormat_t* format)
+{
+	//How far we can shift to move the decimal point down by index digits without overshooting
+	static const i32 shiftForDigits[9] = { 1, 3, 6, 9, 13, 16, 19, 23, 26 };
+	u32 numMantissaBits = format->numMantissaBits;
+	i32 infinitePower = (1 << format->numExponentBits) - 1;
+	u64 infinityBits = ((u64)infinitePower << numMantissaBits);
+	if (decimal->numDigits == 0 || decimal->decimalPoint < -330) { return 0; }
+	if (decimal->decimalPoint > 310) { return infinityBits; }
+
+	i32 exponent = 0;
+	while (decimal->decimalPoint > 0)
+	{
+		i32 amount = (decimal->decimalPoint >= (i64)ArrayCount(shiftForDigits)) ? 27 : shiftForDigits[decimal->decimalPoint];
+		ParseBigDecimalShift(decimal, -amount);
+		exponent += amount;
+	}
+	while (decimal->decimalPoint < 0 || (decimal->decimalPoint == 0 && decimal->digits[0] < 5))
+	{
+		i32 amount = (-decimal->decimalPoint >= (i64)ArrayCount(shiftForDigits)) ? 27 : shiftForDigits[-decimal->decimalPoint];
+		ParseBigDecimalShift(decimal, amount);
+		exponent -= amount;
+	}
+	//[0.5, 1) to [1, 2)
+	exponent--;
+	i32 minExponent = 1 - format->exponentBias;
+	if (exponent < minExponent)
+	{
+		ParseBigDecimalShift(decimal, -(minExponent - exponent));
+		exponent = minExponent;
+	}
+	if (exponent + format->exponentBias >= infinitePower) { return infinityBits; }
+
+	ParseBigDecimalShift(decimal, (i32)numMantissaBits + 1);
+	u64 mantissa = ParseBigDecimalRoundedInteger(decimal);
+	if (mantissa == (2ULL << numMantissaBits))
+	{
+		mantissa >>= 1;
+		exponent++;
+		if (exponent + format->exponentBias >= infinitePower) { return infinityBits; }
+	}
+	//Subnormal
+	if ((mantissa & (1ULL << numMantissaBits)) == 0) { exponent = -format->exponentBias; }
+	return ((u64)(exponent + format->exponentBias) << numMantissaBits) | (mantissa & ((1ULL << numMantissaBits) - 1));
+}
+
+// +--------------------------------------------------------------+
+// |                            Floats                            |
+// +--------------------------------------------------------------+
+//Returns the bits (with the sign) of the nearest float to the decimal. Overflows come back as infinity
+u64 ParseDecimalToBits(MyStr_t str, const ParseDecimal_t* decimal, const ParseFloatFormat_t* format)
+{
+	u32 numMantissaBits = format->numMantissaBits;
+	u64 infinityBits = ((u64)((1 << format->numExponentBits) - 1) << numMantissaBits);
+	u64 signBit = (decimal->isNegative ? (1ULL << (numMantissaBits + format->numExponentBits)) : 0);
+	if (decimal->isNan) { return signBit | infinityBits | (1ULL << (numMantissaBits - 1)); }
+	if (decimal->isInfinity) { return signBit | infinityBits; }
+	u64 bits = ParseEiselLemire(decimal->mantissa, decimal->exponent, format);
+	if (decimal->isTruncated)
+	{
+		//The real value is between mantissa and mantissa+1, if both round the same way we're done
+		if (ParseEiselLemire(decimal->mantissa + 1, decimal->exponent, format) != bits)
+		{
+			ParseBigDecimal_t bigDecimal;
+			ParseBigDecimalInit(&bigDecimal, str, decimal);
+			bits = ParseBigDecimalToBits(&bigDecimal, format);
+		}
+	}
+	return signBit | bits;
+}
+
+//Exact (round to nearest, ties to even) for any number of digits. Values that round to infinity fail with ParseFailure_Overflow,
+//values too small for an r64 quietly become 0 (or a subnormal)
+bool TryParseR64(MyStr_t str, r64* valueOut, ParseFailure_t* failureOut = nullptr)
+{
+	NotNull(valueOut);
+	ParseDecimal_t decimal;
+	if (!ParseFloatText(str, &decimal, failureOut)) { return false; }
+	//When the mantissa and 10^exponent are both exact in an r64 a single multiply or divide rounds correctly (Clinger's fast path)
+	if (!decimal.isTruncated && !decimal.isInfinity && !decimal.isNan && decimal.mantissa <= (1ULL << 53) && decimal.exponent >= -22 && decimal.exponent <= 22)
+	{
+		r64 result = (r64)decimal.mantissa;
+		result = (decimal.exponent < 0) ? (result / ParsePowersOf10R64[-decimal.exponent]) : (result * ParsePowersOf10R64[decimal.exponent]);
+		*valueOut = (decimal.isNegative ? -result : result);
+		SetOptionalOutPntr(failureOut, ParseFailure_None);
+		return true;
+	}
+	u64 bits = ParseDecimalToBits(str, &decimal, &ParseFloatFormatR64);
+	if (!decimal.isInfinity && (bits & 0x7FFFFFFFFFFFFFFFULL) == 0x7FF0000000000000ULL) { return ParseFail(failureOut, ParseFailure_Overflow); }
+	*valueOut = BitsToR64(bits);
+	SetOptionalOutPntr(failureOut, ParseFailure_None);
+	return true;
+}
+//Rounds straight from the digits to an r32 (going through an r64 would round twice and be off by one ulp for some inputs)
+bool TryParseR32(MyStr_t str, r32* valueOut, ParseFailure_t* failureOut = nullptr)
+{
+	NotNull(valueOut);
+	ParseDecimal_t decimal;
+	if (!ParseFloatText(str, &decimal, failureOut)) { return false; }
+	if (!decimal.isTruncated && !decimal.isInfinity && !decimal.isNan && decimal.mantissa <= (1ULL << 24) && decimal.exponent >= -10 && decimal.exponent <= 10)
+	{
+		r32 result = (r32)decimal.mantissa;
+		result = (decimal.exponent < 0) ? (result / ParsePowersOf10R32[-decimal.exponent]) : (result * ParsePowersOf10R32[decimal.exponent]);
+		*valueOut = (decimal.isNegative ? -result : result);
+		SetOptionalOutPntr(failureOut, ParseFailure_None);
+		return true;
+	}
+	u32 bits = (u32)ParseDecimalToBits(str, &decimal, &ParseFloatFormatR32);
+	if (!decimal.isInfinity && (bits & 0x7FFFFFFF) == 0x7F800000) { return ParseFail(failureOut, ParseFailure_Overflow); }
+	*valueOut = BitsToR32(bits);
+	SetOptionalOutPntr(failureOut, ParseFailure_None);
+	return true;
+}
+
+#endif //  _ORCA_PARSE_H
+
+// +--------------------------------------------------------------+
+// |                   Autocomplete Dictionary                    |
+// +--------------------------------------------------------------+
+/*
+@Defines
+PARSE_MAX_MANTISSA_DIGITS
+PARSE_MIN_POW10
+PARSE_BIG_DECIMAL_MAX_DIGITS
+ParseFailure_None
+ParseFailure_Empty
+ParseFailure_InvalidCharacter
+ParseFailure_Overflow
+ParseFailure_NumFailures
+@Types
+ParseFailure_t
+ParseFloatFormat_t
+ParseDecimal_t
+ParseBigDecimal_t
+@Functions
+const char* GetParseFailureStr(ParseFailure_t failure)
+INLINE bool ParseFail(ParseFailure_t* failureOut, ParseFailure_t failure)
+INLINE u64 ParseLoadU64(const char* chars)
+INLINE bool ParseIsEightDigits(u64 block)
+INLINE u32 ParseEightDigits(u64 block)
+INLINE u64 ParseDigitRun(MyStr_t str, u64* indexPntr, u64* mantissaPntr, u64* numDroppedOut, bool* isTruncatedPntr)
+bool ParseDigitsU64(MyStr_t str, u64 index, u64* valueOut, ParseFailure_t* failureOut)
+bool TryParseU64(MyStr_t str, u64* valueOut, ParseFailure_t* failureOut = nullptr)
+bool TryParseI64(MyStr_t str, i64* valueOut, ParseFailure_t* failureOut = nullptr)
+bool TryParseI32(MyStr_t str, i32* valueOut, ParseFailure_t* failureOut = nullptr)
+INLINE bool ParseMatchWord(MyStr_t str, u64 index, const char* word)
+INLINE bool ParseFloatText(MyStr_t str, ParseDecimal_t* decimalOut, ParseFailure_t* failureOut)
+u64 ParseEiselLemire(u64 mantissa, i64 exponent, const ParseFloatFormat_t* format)
+void ParseBigDecimalTrim(ParseBigDecimal_t* decimal)
+void ParseBigDecimalInit(ParseBigDecimal_t* decimalOut, MyStr_t str, const ParseDecimal_t* decimal)
+void ParseBigDecimalShiftRight(ParseBigDecimal_t* decimal, u32 amount)
+void ParseBigDecimalShiftLeft(ParseBigDecimal_t* decimal, u32 amount)
+void ParseBigDecimalShift(ParseBigDecimal_t* decimal, i32 amount)
+u64 ParseBigDecimalRoundedInteger(const ParseBigDecimal_t* decimal)
+u64 ParseBigDecimalToBits(ParseBigDecimal_t* decimal, const ParseFloatFormat_t* format)
+u64 ParseDecimalToBits(MyStr_t str, const ParseDecimal_t* decimal, const ParseFloatFormat_t* format)
+bool TryParseR64(MyStr_t str, r64* valueOut, ParseFailure_t* failureOut = nullptr)
+bool TryParseR32(MyStr_t str, r32* valueOut, ParseFailure_t* failureOut = nullptr)
+*/
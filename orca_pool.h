@@ -0,0 +1,161 @@
+/*
+File:   orca_pool.h
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Holds Pool_t, a fixed-size object allocator for things that get created and
+	** destroyed constantly (UI items, particles, pending requests, etc.). Memory is
+	** carved out of an OC_Arena_t one slab at a time and freed slots are recycled
+	** through an intrusive free list (the first bytes of a free slot point to the
+	** next free slot), so PoolAlloc and PoolFree are both O(1)
+*/
+
+#ifndef _ORCA_POOL_H
+#define _ORCA_POOL_H
+
+#define POOL_CACHE_LINE_SIZE 64 //pass as the alignment to keep every slot on its own cache line(s)
+
+struct PoolSlab_t
+{
+	PoolSlab_t* next;
+	u8* items;
+};
+
+struct Pool_t
+{
+	OC_Arena_t* arena;
+	u64 itemSize; //what was asked for
+	u64 stride; //itemSize rounded up to fit the free list pointer and the alignment
+	u32 alignment;
+	u32 itemsPerSlab;
+
+	u32 numSlabs;
+	u32 capacity; //total slots in all slabs
+	u32 numLive; //slots that have been allocated and not freed yet
+	u32 peakLive;
+
+	PoolSlab_t* slabs;
+	void* freeList;
+};
+
+// +--------------------------------------------------------------+
+// |                       Create and Free                        |
+// +--------------------------------------------------------------+
+//NOTE: Arena memory can't be given back individually, so this just clears the structure
+void FreePool(Pool_t* pool)
+{
+	NotNull(pool);
+	ClearPointer(pool);
+}
+//alignment must be a power of two. Pass 0 to use pointer alignment. No memory is taken from the arena until the first PoolAlloc
+void CreatePool(Pool_t* poolOut, OC_Arena_t* arena, u64 itemSize, u32 itemsPerSlab, u32 alignment = 0)
+{
+	NotNull2(poolOut, arena);
+	Assert(itemSize > 0 && itemsPerSlab > 0);
+	if (alignment < sizeof(void*)) { alignment = sizeof(void*); }
+	Assert(IsPowerOfTwoU32(alignment));
+	ClearPointer(poolOut);
+	poolOut->arena = arena;
+	poolOut->itemSize = itemSize;
+	poolOut->stride = RoundUpToU64(Max<u64>(itemSize, sizeof(void*)), alignment);
+	poolOut->alignment = alignment;
+	poolOut->itemsPerSlab = itemsPerSlab;
+}
+#define CreatePoolType(poolOutPntr, arena, type, itemsPerSlab) CreatePool((poolOutPntr), (arena), sizeof(type), (itemsPerSlab), _Alignof(type))
+
+// +--------------------------------------------------------------+
+// |                       Alloc and Free                         |
+// +--------------------------------------------------------------+
+//Threads every slot of a slab onto the front of the free list, lowest address first
+INLINE void PoolThreadSlab(Pool_t* pool, PoolSlab_t* slab)
+{
+	for (u32 iIndex = pool->itemsPerSlab; iIndex > 0; iIndex--)
+	{
+		void* slot = &slab->items[(iIndex-1) * pool->stride];
+		*((void**)slot) = pool->freeList;
+		pool->freeList = slot;
+	}
+}
+void PoolAddSlab(Pool_t* pool)
+{
+	NotNull2(pool, pool->arena);
+	PoolSlab_t* newSlab = OC_ArenaPushType(pool->arena, PoolSlab_t);
+	NotNull(newSlab);
+	newSlab->items = (u8*)OC_ArenaPushAligned(pool->arena, pool->stride * pool->itemsPerSlab, pool->alignment);
+	NotNull(newSlab->items);
+	newSlab->next = pool->slabs;
+	pool->slabs = newSlab;
+	pool->numSlabs++;
+	pool->capacity += pool->itemsPerSlab;
+	PoolThreadSlab(pool, newSlab);
+}
+
+//NOTE: The returned memory is not cleared
+INLINE void* PoolAlloc(Pool_t* pool)
+{
+	if (pool->freeList == nullptr) { PoolAddSlab(pool); }
+	void* result = pool->freeList;
+	pool->freeList = *((void**)result);
+	pool->numLive++;
+	if (pool->numLive > pool->peakLive) { pool->peakLive = pool->numLive; }
+	return result;
+}
+#define PoolAllocType(poolPntr, type) ((type*)PoolAlloc(poolPntr))
+
+bool IsPointerInPool(const Pool_t* pool, const void* pntr)
+{
+	NotNull(pool);
+	for (const PoolSlab_t* slab = pool->slabs; slab != nullptr; slab = slab->next)
+	{
+		const u8* bytePntr = (const u8*)pntr;
+		if (bytePntr >= slab->items && bytePntr < slab->items + (pool->stride * pool->itemsPerSlab))
+		{
+			return (((u64)(bytePntr - slab->items) % pool->stride) == 0);
+		}
+	}
+	return false;
+}
+
+INLINE void PoolFree(Pool_t* pool, void* item)
+{
+	if (item == nullptr) { return; }
+	//NOTE: This check walks every slab so it only happens in debug builds
+	DebugAssert(IsPointerInPool(pool, item));
+	DebugAssert(pool->numLive > 0);
+	*((void**)item) = pool->freeList;
+	pool->freeList = item;
+	pool->numLive--;
+}
+
+//Puts every slot back on the free list without giving any slabs back to the arena. Any pointers into the pool become invalid
+void PoolFreeAll(Pool_t* pool)
+{
+	NotNull(pool);
+	pool->freeList = nullptr;
+	for (PoolSlab_t* slab = pool->slabs; slab != nullptr; slab = slab->next) { PoolThreadSlab(pool, slab); }
+	pool->numLive = 0;
+}
+
+#endif //  _ORCA_POOL_H
+
+// +--------------------------------------------------------------+
+// |                   Autocomplete Dictionary                    |
+// +--------------------------------------------------------------+
+/*
+@Defines
+POOL_CACHE_LINE_SIZE
+@Types
+PoolSlab_t
+Pool_t
+@Functions
+void FreePool(Pool_t* pool)
+void CreatePool(Pool_t* poolOut, OC_Arena_t* arena, u64 itemSize, u32 itemsPerSlab, u32 alignment = 0)
+#define CreatePoolType(poolOutPntr, arena, type, itemsPerSlab)
+INLINE void PoolThreadSlab(Pool_t* pool, PoolSlab_t* slab)
+void PoolAddSlab(Pool_t* pool)
+INLINE void* PoolAlloc(Pool_t* pool)
+#define PoolAllocType(poolPntr, type)
+bool IsPointerInPool(const Pool_t* pool, const void* pntr)
+INLINE void PoolFree(Pool_t* pool, void* item)
+void PoolFreeAll(Pool_t* pool)
+*/
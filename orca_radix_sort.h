@@ -0,0 +1,247 @@
+/*
+File:   orca_radix_sort.h
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Holds LSD radix sorts for u32, i32, r32 and u64 keys that carry an optional
+	** u32 payload along with each key (usually the index of the thing the key came
+	** from, a draw item or an event). Keys are sorted 8 bits at a time from the
+	** bottom up, with passes skipped when every key has the same byte there, and
+	** the ping-pong buffers come from OC_ScratchBegin. All of these are stable,
+	** equal keys keep their order, so sorting by a second key and then by the first
+	** gives a two-level sort
+*/
+
+#ifndef _ORCA_RADIX_SORT_H
+#define _ORCA_RADIX_SORT_H
+
+#define RADIX_SORT_SMALL_COUNT 64 //below this the insertion sort beats clearing and walking the histograms
+#define RADIX_SORT_NUM_BUCKETS 256
+
+// +--------------------------------------------------------------+
+// |                           Key Flips                          |
+// +--------------------------------------------------------------+
+//Maps i32 and r32 bit patterns to u32s that sort in the same order. For floats, negatives get all their bits flipped (bigger magnitude
+//is smaller) and positives just get the sign bit set, so -inf < ... < -0 < +0 < ... < +inf, with negative NaNs first and positive NaNs last
+INLINE u32 RadixSortFlipI32(u32 bits) { return (bits ^ 0x80000000); }
+INLINE u32 RadixSortFlipR32(u32 bits) { return bits ^ ((u32)(-(i32)(bits >> 31)) | 0x80000000); }
+INLINE u32 RadixSortUnflipR32(u32 bits) { return bits ^ (((bits >> 31) - 1) | 0x80000000); }
+
+// +--------------------------------------------------------------+
+// |                        Insertion Sort                        |
+// +--------------------------------------------------------------+
+void InsertionSortU32(u32* keys, u32* payloads, u64 count)
+{
+	for (u64 kIndex = 1; kIndex < count; kIndex++)
+	{
+		u32 key = keys[kIndex];
+		u32 payload = (payloads != nullptr) ? payloads[kIndex] : 0;
+		u64 insertIndex = kIndex;
+		while (insertIndex > 0 && keys[insertIndex-1] > key)
+		{
+			keys[insertIndex] = keys[insertIndex-1];
+			if (payloads != nullptr) { payloads[insertIndex] = payloads[insertIndex-1]; }
+			insertIndex--;
+		}
+		keys[insertIndex] = key;
+		if (payloads != nullptr) { payloads[insertIndex] = payload; }
+	}
+}
+void InsertionSortU64(u64* keys, u32* payloads, u64 count)
+{
+	for (u64 kIndex = 1; kIndex < count; kIndex++)
+	{
+		u64 key = keys[kIndex];
+		u32 payload = (payloads != nullptr) ? payloads[kIndex] : 0;
+		u64 insertIndex = kIndex;
+		while (insertIndex > 0 && keys[insertIndex-1] > key)
+		{
+			keys[insertIndex] = keys[insertIndex-1];
+			if (payloads != nullptr) { payloads[insertIndex] = payloads[insertIndex-1]; }
+			insertIndex--;
+		}
+		keys[insertIndex] = key;
+		if (payloads != nullptr) { payloads[insertIndex] = payload; }
+	}
+}
+
+// +--------------------------------------------------------------+
+// |                          Radix Sort                          |
+// +--------------------------------------------------------------+
+//Turns a histogram into the index each bucket starts at. Returns false if every key landed in one bucket (the pass would not move anything)
+INLINE bool RadixSortPrefixSum(u32* counts, u64 count)
+{
+	u32 offset = 0;
+	for (u32 bIndex = 0; bIndex < RADIX_SORT_NUM_BUCKETS; bIndex++)
+	{
+		u32 bucketCount = counts[bIndex];
+		if (bucketCount == count) { return false; }
+		counts[bIndex] = offset;
+		offset += bucketCount;
+	}
+	return true;
+}
+
+void RadixSortU32(u32* keys, u32* payloads, u64 count)
+{
+	Assert(keys != nullptr || count == 0);
+	Assert(count <= UINT32_MAX);
+	if (count < RADIX_SORT_SMALL_COUNT) { InsertionSortU32(keys, payloads, count); return; }
+
+	//All 4 histograms in one read
+	u32 counts[4][RADIX_SORT_NUM_BUCKETS];
+	memset(counts, 0x00, sizeof(counts));
+	for (u64 kIndex = 0; kIndex < count; kIndex++)
+	{
+		u32 key = keys[kIndex];
+		counts[0][key & 0xFF]++;
+		counts[1][(key >> 8) & 0xFF]++;
+		counts[2][(key >> 16) & 0xFF]++;
+		counts[3][key >> 24]++;
+	}
+
+	OC_ArenaScope_t scratch = OC_ScratchBegin();
+	u32* sourceKeys = keys;
+	u32* sourcePayloads = payloads;
+	u32* destKeys = OC_ArenaPushArray(scratch.arena, u32, count);
+	u32* destPayloads = (payloads != nullptr) ? OC_ArenaPushArray(scratch.arena, u32, count) : nullptr;
+	NotNull(destKeys);
+	for (u32 pass = 0; pass < 4; pass++)
+	{
+		u32* offsets = counts[pass];
+		if (!RadixSortPrefixSum(offsets, count)) { continue; }
+		u32 shift = pass * 8;
+		if (sourcePayloads != nullptr)
+		{
+			for (u64 kIndex = 0; kIndex < count; kIndex++)
+			{
+				u32 key = sourceKeys[kIndex];
+				u32 destIndex = offsets[(key >> shift) & 0xFF]++;
+				destKeys[destIndex] = key;
+				destPayloads[destIndex] = sourcePayloads[kIndex];
+			}
+		}
+		else
+		{
+			for (u64 kIndex = 0; kIndex < count; kIndex++)
+			{
+				u32 key = sourceKeys[kIndex];
+				destKeys[offsets[(key >> shift) & 0xFF]++] = key;
+			}
+		}
+		u32* tempKeys = sourceKeys; sourceKeys = destKeys; destKeys = tempKeys;
+		u32* tempPayloads = sourcePayloads; sourcePayloads = destPayloads; destPayloads = tempPayloads;
+	}
+	//An odd number of passes leaves the result in the scratch buffers
+	if (sourceKeys != keys)
+	{
+		memcpy(keys, sourceKeys, sizeof(u32) * count);
+		if (payloads != nullptr) { memcpy(payloads, sourcePayloads, sizeof(u32) * count); }
+	}
+	OC_ScratchEnd(scratch);
+}
+
+void RadixSortU64(u64* keys, u32* payloads, u64 count)
+{
+	Assert(keys != nullptr || count == 0);
+	Assert(count <= UINT32_MAX);
+	if (count < RADIX_SORT_SMALL_COUNT) { InsertionSortU64(keys, payloads, count); return; }
+
+	u32 counts[8][RADIX_SORT_NUM_BUCKETS];
+	memset(counts, 0x00, sizeof(counts));
+	for (u64 kIndex = 0; kIndex < count; kIndex++)
+	{
+		u64 key = keys[kIndex];
+		for (u32 pass = 0; pass < 8; pass++) { counts[pass][(key >> (pass * 8)) & 0xFF]++; }
+	}
+
+	OC_ArenaScope_t scratch = OC_ScratchBegin();
+	u64* sourceKeys = keys;
+	u32* sourcePayloads = payloads;
+	u64* destKeys = OC_ArenaPushArray(scratch.arena, u64, count);
+	u32* destPayloads = (payloads != nullptr) ? OC_ArenaPushArray(scratch.arena, u32, count) : nullptr;
+	NotNull(destKeys);
+	for (u32 pass = 0; pass < 8; pass++)
+	{
+		u32* offsets = counts[pass];
+		if (!RadixSortPrefixSum(offsets, count)) { continue; }
+		u32 shift = pass * 8;
+		if (sourcePayloads != nullptr)
+		{
+			for (u64 kIndex = 0; kIndex < count; kIndex++)
+			{
+				u64 key = sourceKeys[kIndex];
+				u32 destIndex = offsets[(key >> shift) & 0xFF]++;
+				destKeys[destIndex] = key;
+				destPayloads[destIndex] = sourcePayloads[kIndex];
+			}
+		}
+		else
+		{
+			for (u64 kIndex = 0; kIndex < count; kIndex++)
+			{
+				u64 key = sourceKeys[kIndex];
+				destKeys[offsets[(key >> shift) & 0xFF]++] = key;
+			}
+		}
+		u64* tempKeys = sourceKeys; sourceKeys = destKeys; destKeys = tempKeys;
+		u32* tempPayloads = sourcePayloads; sourcePayloads = destPayloads; destPayloads = tempPayloads;
+	}
+	if (sourceKeys != keys)
+	{
+		memcpy(keys, sourceKeys, sizeof(u64) * count);
+		if (payloads != nullptr) { memcpy(payloads, sourcePayloads, sizeof(u32) * count); }
+	}
+	OC_ScratchEnd(scratch);
+}
+
+//Flips the keys into unsigned order in place, sorts them as u32, and flips them back
+//NOTE: i32 and u32 are the signed and unsigned versions of the same type, so reading the keys through a u32* is allowed
+void RadixSortI32(i32* keys, u32* payloads, u64 count)
+{
+	u32* bits = (u32*)keys;
+	for (u64 kIndex = 0; kIndex < count; kIndex++) { bits[kIndex] = RadixSortFlipI32(bits[kIndex]); }
+	RadixSortU32(bits, payloads, count);
+	for (u64 kIndex = 0; kIndex < count; kIndex++) { bits[kIndex] = RadixSortFlipI32(bits[kIndex]); }
+}
+//NOTE: r32 and u32 can't alias, so the flipped bits go through memcpy into a scratch u32 array and come back the same way
+void RadixSortR32(r32* keys, u32* payloads, u64 count)
+{
+	OC_ArenaScope_t scratch = OC_ScratchBegin();
+	u32* bits = OC_ArenaPushArray(scratch.arena, u32, count);
+	for (u64 kIndex = 0; kIndex < count; kIndex++)
+	{
+		u32 keyBits;
+		memcpy(&keyBits, &keys[kIndex], sizeof(keyBits));
+		bits[kIndex] = RadixSortFlipR32(keyBits);
+	}
+	RadixSortU32(bits, payloads, count);
+	for (u64 kIndex = 0; kIndex < count; kIndex++)
+	{
+		u32 keyBits = RadixSortUnflipR32(bits[kIndex]);
+		memcpy(&keys[kIndex], &keyBits, sizeof(keyBits));
+	}
+	OC_ScratchEnd(scratch);
+}
+
+#endif //  _ORCA_RADIX_SORT_H
+
+// +--------------------------------------------------------------+
+// |                   Autocomplete Dictionary                    |
+// +--------------------------------------------------------------+
+/*
+@Defines
+RADIX_SORT_SMALL_COUNT
+RADIX_SORT_NUM_BUCKETS
+@Functions
+INLINE u32 RadixSortFlipI32(u32 bits)
+INLINE u32 RadixSortFlipR32(u32 bits)
+INLINE u32 RadixSortUnflipR32(u32 bits)
+void InsertionSortU32(u32* keys, u32* payloads, u64 count)
+void InsertionSortU64(u64* keys, u32* payloads, u64 count)
+INLINE bool RadixSortPrefixSum(u32* counts, u64 count)
+void RadixSortU32(u32* keys, u32* payloads, u64 count)
+void RadixSortU64(u64* keys, u32* payloads, u64 count)
+void RadixSortI32(i32* keys, u32* payloads, u64 count)
+void RadixSortR32(r32* keys, u32* payloads, u64 count)
+*/
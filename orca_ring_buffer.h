@@ -0,0 +1,220 @@
+/*
+File:   orca_ring_buffer.h
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Holds RingBuffer_t, a fixed-capacity FIFO queue of same-sized items for
+	** handing things (input events, audio blocks) from one producer to one consumer.
+	** The capacity is a power of two so wrapping is a mask, and head and tail are
+	** free-running u32s that only their owner writes. On native builds with threads
+	** the producer and consumer can be on different threads: head and tail sit on
+	** their own cache lines, are published with release stores and read with acquire
+	** loads, and each side keeps a cached copy of the other side's index so it only
+	** reads the shared one when the cached one says full (or empty). Batch push and
+	** pop move as many items as fit with at most two memcpys
+*/
+
+#ifndef _ORCA_RING_BUFFER_H
+#define _ORCA_RING_BUFFER_H
+
+// +--------------------------------------------------------------+
+// |                       Platform Select                        |
+// +--------------------------------------------------------------+
+//NOTE: Define ORCA_RING_BUFFER_SINGLE_THREADED before including my_orca.h to use plain loads and stores on native builds too.
+//WASM builds without the atomics feature can only ever have one thread, so nothing can run in the middle of a push or pop and
+//plain loads and stores are all the protection needed there (a lock could never be contended)
+#if defined(ORCA_RING_BUFFER_SINGLE_THREADED) || (defined(__wasm__) && !defined(__wasm_atomics__))
+#define RING_BUFFER_ATOMIC 0
+#else
+#define RING_BUFFER_ATOMIC 1
+#endif
+
+#define RING_BUFFER_CACHE_LINE_SIZE 64
+#define RING_BUFFER_MAX_CAPACITY    0x80000000UL //head - tail has to be able to tell full from empty
+
+struct RingBuffer_t
+{
+	//Set at creation, only read after that
+	OC_Arena_t* arena;
+	u8* items;
+	u64 itemSize;
+	u32 capacity; //power of two
+	u32 mask;
+	u8 padding1[RING_BUFFER_CACHE_LINE_SIZE];
+
+	//Only written by the producer
+	u32 head; //total items ever pushed, the next one goes at (head & mask)
+	u32 cachedTail;
+	u8 padding2[RING_BUFFER_CACHE_LINE_SIZE - 2*sizeof(u32)];
+
+	//Only written by the consumer
+	u32 tail; //total items ever popped
+	u32 cachedHead;
+	u8 padding3[RING_BUFFER_CACHE_LINE_SIZE - 2*sizeof(u32)];
+};
+
+// +--------------------------------------------------------------+
+// |                        Shared Indices                        |
+// +--------------------------------------------------------------+
+//Acquire pairs with the other side's release, so once an index is seen everything written before it was published is visible too
+INLINE u32 RingBufferLoadAcquire(const u32* indexPntr)
+{
+	#if RING_BUFFER_ATOMIC
+	return __atomic_load_n(indexPntr, __ATOMIC_ACQUIRE);
+	#else
+	return *indexPntr;
+	#endif
+}
+INLINE void RingBufferStoreRelease(u32* indexPntr, u32 value)
+{
+	#if RING_BUFFER_ATOMIC
+	__atomic_store_n(indexPntr, value, __ATOMIC_RELEASE);
+	#else
+	*indexPntr = value;
+	#endif
+}
+
+// +--------------------------------------------------------------+
+// |                       Create and Free                        |
+// +--------------------------------------------------------------+
+//NOTE: Arena memory can't be given back individually, so this just clears the structure
+void FreeRingBuffer(RingBuffer_t* buffer)
+{
+	NotNull(buffer);
+	ClearPointer(buffer);
+}
+//capacity is rounded up to a power of two. Create the buffer before either thread starts using it
+//NOTE: Slots are packed itemSize apart from a cache line aligned start, so any item whose size is a multiple of its
+//      alignment (which sizeof always is) stays aligned, up to RING_BUFFER_CACHE_LINE_SIZE
+void CreateRingBuffer(RingBuffer_t* bufferOut, OC_Arena_t* arena, u64 itemSize, u32 capacity)
+{
+	NotNull2(bufferOut, arena);
+	Assert(itemSize > 0 && capacity > 0 && capacity <= RING_BUFFER_MAX_CAPACITY);
+	ClearPointer(bufferOut);
+	bufferOut->arena = arena;
+	bufferOut->itemSize = itemSize;
+	bufferOut->capacity = NextPowerOfTwoU32(capacity);
+	bufferOut->mask = bufferOut->capacity - 1;
+	//Cache line aligned so the first items don't share a line with whatever the arena handed out before them
+	bufferOut->items = (u8*)OC_ArenaPushAligned(arena, itemSize * bufferOut->capacity, RING_BUFFER_CACHE_LINE_SIZE);
+	NotNull(bufferOut->items);
+}
+#define CreateRingBufferType(bufferOutPntr, arena, type, capacity) CreateRingBuffer((bufferOutPntr), (arena), sizeof(type), (capacity))
+
+// +--------------------------------------------------------------+
+// |                           Producer                           |
+// +--------------------------------------------------------------+
+//Pushes as many of the items as there is room for, in order. Returns how many were pushed. Producer only
+u32 RingBufferPushBatch(RingBuffer_t* buffer, const void* items, u32 count)
+{
+	NotNull(buffer);
+	Assert(items != nullptr || count == 0);
+	u32 head = buffer->head;
+	u32 space = buffer->capacity - (head - buffer->cachedTail);
+	if (space < count)
+	{
+		buffer->cachedTail = RingBufferLoadAcquire(&buffer->tail);
+		space = buffer->capacity - (head - buffer->cachedTail);
+	}
+	u32 numPushed = MinU32(count, space);
+	if (numPushed == 0) { return 0; }
+
+	u32 start = (head & buffer->mask);
+	u32 numBeforeWrap = MinU32(numPushed, buffer->capacity - start);
+	memcpy(buffer->items + (start * buffer->itemSize), items, numBeforeWrap * buffer->itemSize);
+	if (numPushed > numBeforeWrap)
+	{
+		memcpy(buffer->items, (const u8*)items + (numBeforeWrap * buffer->itemSize), (numPushed - numBeforeWrap) * buffer->itemSize);
+	}
+	RingBufferStoreRelease(&buffer->head, head + numPushed);
+	return numPushed;
+}
+//Returns false if the buffer is full. Producer only
+INLINE bool RingBufferPush(RingBuffer_t* buffer, const void* item) { return (RingBufferPushBatch(buffer, item, 1) == 1); }
+
+// +--------------------------------------------------------------+
+// |                           Consumer                           |
+// +--------------------------------------------------------------+
+//Pops up to maxCount items, oldest first. Returns how many were popped. Consumer only
+u32 RingBufferPopBatch(RingBuffer_t* buffer, void* itemsOut, u32 maxCount)
+{
+	NotNull(buffer);
+	Assert(itemsOut != nullptr || maxCount == 0);
+	u32 tail = buffer->tail;
+	u32 available = buffer->cachedHead - tail;
+	if (available < maxCount)
+	{
+		buffer->cachedHead = RingBufferLoadAcquire(&buffer->head);
+		available = buffer->cachedHead - tail;
+	}
+	u32 numPopped = MinU32(maxCount, available);
+	if (numPopped == 0) { return 0; }
+
+	u32 start = (tail & buffer->mask);
+	u32 numBeforeWrap = MinU32(numPopped, buffer->capacity - start);
+	memcpy(itemsOut, buffer->items + (start * buffer->itemSize), numBeforeWrap * buffer->itemSize);
+	if (numPopped > numBeforeWrap)
+	{
+		memcpy((u8*)itemsOut + (numBeforeWrap * buffer->itemSize), buffer->items, (numPopped - numBeforeWrap) * buffer->itemSize);
+	}
+	RingBufferStoreRelease(&buffer->tail, tail + numPopped);
+	return numPopped;
+}
+//Returns false if the buffer is empty. Consumer only
+INLINE bool RingBufferPop(RingBuffer_t* buffer, void* itemOut) { return (RingBufferPopBatch(buffer, itemOut, 1) == 1); }
+
+//The oldest item, left in the buffer until RingBufferPop/PopBatch/Skip, or nullptr if the buffer is empty. Consumer only
+INLINE void* RingBufferPeek(RingBuffer_t* buffer)
+{
+	if (buffer->cachedHead == buffer->tail)
+	{
+		buffer->cachedHead = RingBufferLoadAcquire(&buffer->head);
+		if (buffer->cachedHead == buffer->tail) { return nullptr; }
+	}
+	return buffer->items + ((buffer->tail & buffer->mask) * buffer->itemSize);
+}
+//Drops up to count items without copying them out (after looking at them with RingBufferPeek). Returns how many were dropped. Consumer only
+INLINE u32 RingBufferSkip(RingBuffer_t* buffer, u32 count)
+{
+	u32 tail = buffer->tail;
+	if (buffer->cachedHead - tail < count) { buffer->cachedHead = RingBufferLoadAcquire(&buffer->head); }
+	u32 numSkipped = MinU32(count, buffer->cachedHead - tail);
+	RingBufferStoreRelease(&buffer->tail, tail + numSkipped);
+	return numSkipped;
+}
+
+// +--------------------------------------------------------------+
+// |                            Count                             |
+// +--------------------------------------------------------------+
+//NOTE: While the other side is running this is only a snapshot, it can be out of date as soon as it returns
+INLINE u32 RingBufferCount(const RingBuffer_t* buffer) { return RingBufferLoadAcquire(&buffer->head) - RingBufferLoadAcquire(&buffer->tail); }
+INLINE bool RingBufferIsEmpty(const RingBuffer_t* buffer) { return (RingBufferCount(buffer) == 0); }
+
+#endif //  _ORCA_RING_BUFFER_H
+
+// +--------------------------------------------------------------+
+// |                   Autocomplete Dictionary                    |
+// +--------------------------------------------------------------+
+/*
+@Defines
+ORCA_RING_BUFFER_SINGLE_THREADED
+RING_BUFFER_ATOMIC
+RING_BUFFER_CACHE_LINE_SIZE
+RING_BUFFER_MAX_CAPACITY
+@Types
+RingBuffer_t
+@Functions
+INLINE u32 RingBufferLoadAcquire(const u32* indexPntr)
+INLINE void RingBufferStoreRelease(u32* indexPntr, u32 value)
+void FreeRingBuffer(RingBuffer_t* buffer)
+void CreateRingBuffer(RingBuffer_t* bufferOut, OC_Arena_t* arena, u64 itemSize, u32 capacity)
+#define CreateRingBufferType(bufferOutPntr, arena, type, capacity)
+u32 RingBufferPushBatch(RingBuffer_t* buffer, const void* items, u32 count)
+INLINE bool RingBufferPush(RingBuffer_t* buffer, const void* item)
+u32 RingBufferPopBatch(RingBuffer_t* buffer, void* itemsOut, u32 maxCount)
+INLINE bool RingBufferPop(RingBuffer_t* buffer, void* itemOut)
+INLINE void* RingBufferPeek(RingBuffer_t* buffer)
+INLINE u32 RingBufferSkip(RingBuffer_t* buffer, u32 count)
+INLINE u32 RingBufferCount(const RingBuffer_t* buffer)
+INLINE bool RingBufferIsEmpty(const RingBuffer_t* buffer)
+*/
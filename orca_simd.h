@@ -0,0 +1,1190 @@
+/*
+File:   orca_simd.h
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Holds a thin wrapper around whichever 128-bit SIMD instruction set we have
+	** access to. When Orca builds with -msimd128 this is WASM SIMD128, native
+	** builds (tests, benchmarks, tools) get SSE2 or NEON, and everything else
+	** falls back to plain scalar code that operates on 4 lanes at a time.
+	** Also holds the r32 array kernels that the batch vector functions in
+	** orca_addons.h are built on top of
+*/
+
+#ifndef _ORCA_SIMD_H
+#define _ORCA_SIMD_H
+
+// +--------------------------------------------------------------+
+// |                       Platform Select                        |
+// +--------------------------------------------------------------+
+//NOTE: Define ORCA_SIMD_DISABLED before including my_orca.h to force the scalar path (handy for comparing results)
+#if defined(ORCA_SIMD_DISABLED)
+#define ORCA_SIMD_WASM   0
+#define ORCA_SIMD_SSE    0
+#define ORCA_SIMD_NEON   0
+#define ORCA_SIMD_SCALAR 1
+#elif defined(__wasm_simd128__)
+#include <wasm_simd128.h>
+#define ORCA_SIMD_WASM   1
+#define ORCA_SIMD_SSE    0
+#define ORCA_SIMD_NEON   0
+#define ORCA_SIMD_SCALAR 0
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ORCA_SIMD_WASM   0
+#define ORCA_SIMD_SSE    1
+#define ORCA_SIMD_NEON   0
+#define ORCA_SIMD_SCALAR 0
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define ORCA_SIMD_WASM   0
+#define ORCA_SIMD_SSE    0
+#define ORCA_SIMD_NEON   1
+#define ORCA_SIMD_SCALAR 0
+#else
+#define ORCA_SIMD_WASM   0
+#define ORCA_SIMD_SSE    0
+#define ORCA_SIMD_NEON   0
+#define ORCA_SIMD_SCALAR 1
+#endif
+
+#define ORCA_SIMD_ENABLED (!ORCA_SIMD_SCALAR)
+
+// +--------------------------------------------------------------+
+// |                            Types                             |
+// +--------------------------------------------------------------+
+#if ORCA_SIMD_WASM
+typedef v128_t simd4f;
+#elif ORCA_SIMD_SSE
+typedef __m128 simd4f;
+#elif ORCA_SIMD_NEON
+typedef float32x4_t simd4f;
+#else
+union Simd4f_t
+{
+	r32 values[4];
+	struct { r32 x, y, z, w; };
+};
+typedef Simd4f_t simd4f;
+#endif
+
+//NOTE: simd4i holds 4 x 32-bit integers. It is also what comparisons return (all bits set in lanes where the comparison is true)
+#if ORCA_SIMD_WASM
+typedef v128_t simd4i;
+#elif ORCA_SIMD_SSE
+typedef __m128i simd4i;
+#elif ORCA_SIMD_NEON
+typedef int32x4_t simd4i;
+#else
+union Simd4i_t
+{
+	i32 values[4];
+	u32 valuesU32[4];
+	i16 valuesI16[8]; //packed/narrowed results view the register as smaller lanes
+	i8 valuesI8[16];
+	u8 valuesU8[16];
+	u64 valuesU64[2]; //lets the byte lane fallbacks work 8 lanes at a time
+};
+typedef Simd4i_t simd4i;
+#endif
+
+// +--------------------------------------------------------------+
+// |                     Simd4f Load / Store                      |
+// +--------------------------------------------------------------+
+//NOTE: Load and Store do not require 16-byte alignment
+INLINE simd4f Simd4fLoad(const r32* pntr)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_v128_load(pntr);
+	#elif ORCA_SIMD_SSE
+	return _mm_loadu_ps(pntr);
+	#elif ORCA_SIMD_NEON
+	return vld1q_f32(pntr);
+	#else
+	simd4f result;
+	result.x = pntr[0]; result.y = pntr[1]; result.z = pntr[2]; result.w = pntr[3];
+	return result;
+	#endif
+}
+INLINE void Simd4fStore(r32* pntr, simd4f value)
+{
+	#if ORCA_SIMD_WASM
+	wasm_v128_store(pntr, value);
+	#elif ORCA_SIMD_SSE
+	_mm_storeu_ps(pntr, value);
+	#elif ORCA_SIMD_NEON
+	vst1q_f32(pntr, value);
+	#else
+	pntr[0] = value.x; pntr[1] = value.y; pntr[2] = value.z; pntr[3] = value.w;
+	#endif
+}
+INLINE simd4f Simd4fFill(r32 value)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_f32x4_splat(value);
+	#elif ORCA_SIMD_SSE
+	return _mm_set1_ps(value);
+	#elif ORCA_SIMD_NEON
+	return vdupq_n_f32(value);
+	#else
+	simd4f result;
+	result.x = value; result.y = value; result.z = value; result.w = value;
+	return result;
+	#endif
+}
+INLINE simd4f NewSimd4f(r32 x, r32 y, r32 z, r32 w)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_f32x4_make(x, y, z, w);
+	#elif ORCA_SIMD_SSE
+	return _mm_setr_ps(x, y, z, w);
+	#elif ORCA_SIMD_NEON
+	r32 values[4] = { x, y, z, w };
+	return vld1q_f32(values);
+	#else
+	simd4f result;
+	result.x = x; result.y = y; result.z = z; result.w = w;
+	return result;
+	#endif
+}
+
+// +--------------------------------------------------------------+
+// |                      Simd4f Arithmetic                       |
+// +--------------------------------------------------------------+
+INLINE simd4f Simd4fAdd(simd4f left, simd4f right)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_f32x4_add(left, right);
+	#elif ORCA_SIMD_SSE
+	return _mm_add_ps(left, right);
+	#elif ORCA_SIMD_NEON
+	return vaddq_f32(left, right);
+	#else
+	simd4f result;
+	result.x = left.x + right.x; result.y = left.y + right.y; result.z = left.z + right.z; result.w = left.w + right.w;
+	return result;
+	#endif
+}
+INLINE simd4f Simd4fSubtract(simd4f left, simd4f right)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_f32x4_sub(left, right);
+	#elif ORCA_SIMD_SSE
+	return _mm_sub_ps(left, right);
+	#elif ORCA_SIMD_NEON
+	return vsubq_f32(left, right);
+	#else
+	simd4f result;
+	result.x = left.x - right.x; result.y = left.y - right.y; result.z = left.z - right.z; result.w = left.w - right.w;
+	return result;
+	#endif
+}
+INLINE simd4f Simd4fMultiply(simd4f left, simd4f right)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_f32x4_mul(left, right);
+	#elif ORCA_SIMD_SSE
+	return _mm_mul_ps(left, right);
+	#elif ORCA_SIMD_NEON
+	return vmulq_f32(left, right);
+	#else
+	simd4f result;
+	result.x = left.x * right.x; result.y = left.y * right.y; result.z = left.z * right.z; result.w = left.w * right.w;
+	return result;
+	#endif
+}
+INLINE simd4f Simd4fDivide(simd4f left, simd4f right)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_f32x4_div(left, right);
+	#elif ORCA_SIMD_SSE
+	return _mm_div_ps(left, right);
+	#elif ORCA_SIMD_NEON
+	return vdivq_f32(left, right);
+	#else
+	simd4f result;
+	result.x = left.x / right.x; result.y = left.y / right.y; result.z = left.z / right.z; result.w = left.w / right.w;
+	return result;
+	#endif
+}
+//Returns (left * right) + addend. Not guaranteed to be a single rounding (WASM SIMD128 and SSE2 have no fma instruction)
+INLINE simd4f Simd4fMulAdd(simd4f left, simd4f right, simd4f addend)
+{
+	#if ORCA_SIMD_NEON
+	return vmlaq_f32(addend, left, right);
+	#else
+	return Simd4fAdd(Simd4fMultiply(left, right), addend);
+	#endif
+}
+//NOTE: Min and Max work like (left < right) ? left : right on every backend (what minps/maxps do), so when either lane is NaN the result is right.
+//      NEON's vminq/vmaxq would give NaN and WASM's pmin/pmax take their arguments the other way around
+INLINE simd4f Simd4fMin(simd4f left, simd4f right)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_f32x4_pmin(right, left);
+	#elif ORCA_SIMD_SSE
+	return _mm_min_ps(left, right);
+	#elif ORCA_SIMD_NEON
+	return vbslq_f32(vcltq_f32(left, right), left, right);
+	#else
+	simd4f result;
+	result.x = (left.x < right.x) ? left.x : right.x;
+	result.y = (left.y < right.y) ? left.y : right.y;
+	result.z = (left.z < right.z) ? left.z : right.z;
+	result.w = (left.w < right.w) ? left.w : right.w;
+	return result;
+	#endif
+}
+INLINE simd4f Simd4fMax(simd4f left, simd4f right)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_f32x4_pmax(right, left);
+	#elif ORCA_SIMD_SSE
+	return _mm_max_ps(left, right);
+	#elif ORCA_SIMD_NEON
+	return vbslq_f32(vcgtq_f32(left, right), left, right);
+	#else
+	simd4f result;
+	result.x = (left.x > right.x) ? left.x : right.x;
+	result.y = (left.y > right.y) ? left.y : right.y;
+	result.z = (left.z > right.z) ? left.z : right.z;
+	result.w = (left.w > right.w) ? left.w : right.w;
+	return result;
+	#endif
+}
+INLINE simd4f Simd4fSqrt(simd4f value)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_f32x4_sqrt(value);
+	#elif ORCA_SIMD_SSE
+	return _mm_sqrt_ps(value);
+	#elif ORCA_SIMD_NEON
+	return vsqrtq_f32(value);
+	#else
+	simd4f result;
+	result.x = sqrtf(value.x); result.y = sqrtf(value.y); result.z = sqrtf(value.z); result.w = sqrtf(value.w);
+	return result;
+	#endif
+}
+
+// +==============================+
+// |       Simd4f Shuffles        |
+// +==============================+
+//(x, y, z, w) -> (x, x, z, z)
+INLINE simd4f Simd4fDuplicateEven(simd4f value)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_i32x4_shuffle(value, value, 0, 0, 2, 2);
+	#elif ORCA_SIMD_SSE
+	return _mm_shuffle_ps(value, value, _MM_SHUFFLE(2, 2, 0, 0));
+	#elif ORCA_SIMD_NEON
+	return vtrn1q_f32(value, value);
+	#else
+	return NewSimd4f(value.x, value.x, value.z, value.z);
+	#endif
+}
+//(x, y, z, w) -> (y, y, w, w)
+INLINE simd4f Simd4fDuplicateOdd(simd4f value)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_i32x4_shuffle(value, value, 1, 1, 3, 3);
+	#elif ORCA_SIMD_SSE
+	return _mm_shuffle_ps(value, value, _MM_SHUFFLE(3, 3, 1, 1));
+	#elif ORCA_SIMD_NEON
+	return vtrn2q_f32(value, value);
+	#else
+	return NewSimd4f(value.y, value.y, value.w, value.w);
+	#endif
+}
+//(left.x, right.x, left.y, right.y)
+INLINE simd4f Simd4fInterleaveLow(simd4f left, simd4f right)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_i32x4_shuffle(left, right, 0, 4, 1, 5);
+	#elif ORCA_SIMD_SSE
+	return _mm_unpacklo_ps(left, right);
+	#elif ORCA_SIMD_NEON
+	return vzip1q_f32(left, right);
+	#else
+	return NewSimd4f(left.x, right.x, left.y, right.y);
+	#endif
+}
+//(left.z, right.z, left.w, right.w)
+INLINE simd4f Simd4fInterleaveHigh(simd4f left, simd4f right)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_i32x4_shuffle(left, right, 2, 6, 3, 7);
+	#elif ORCA_SIMD_SSE
+	return _mm_unpackhi_ps(left, right);
+	#elif ORCA_SIMD_NEON
+	return vzip2q_f32(left, right);
+	#else
+	return NewSimd4f(left.z, right.z, left.w, right.w);
+	#endif
+}
+//(left.x, left.y, right.x, right.y)
+INLINE simd4f Simd4fCombineLow(simd4f left, simd4f right)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_i32x4_shuffle(left, right, 0, 1, 4, 5);
+	#elif ORCA_SIMD_SSE
+	return _mm_movelh_ps(left, right);
+	#elif ORCA_SIMD_NEON
+	return vcombine_f32(vget_low_f32(left), vget_low_f32(right));
+	#else
+	return NewSimd4f(left.x, left.y, right.x, right.y);
+	#endif
+}
+//(left.z, left.w, right.z, right.w)
+INLINE simd4f Simd4fCombineHigh(simd4f left, simd4f right)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_i32x4_shuffle(left, right, 2, 3, 6, 7);
+	#elif ORCA_SIMD_SSE
+	return _mm_movehl_ps(right, left);
+	#elif ORCA_SIMD_NEON
+	return vcombine_f32(vget_high_f32(left), vget_high_f32(right));
+	#else
+	return NewSimd4f(left.z, left.w, right.z, right.w);
+	#endif
+}
+//(left.x, left.z, right.x, right.z)
+INLINE simd4f Simd4fGatherEven(simd4f left, simd4f right)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_i32x4_shuffle(left, right, 0, 2, 4, 6);
+	#elif ORCA_SIMD_SSE
+	return _mm_shuffle_ps(left, right, _MM_SHUFFLE(2, 0, 2, 0));
+	#elif ORCA_SIMD_NEON
+	return vuzp1q_f32(left, right);
+	#else
+	return NewSimd4f(left.x, left.z, right.x, right.z);
+	#endif
+}
+//(left.y, left.w, right.y, right.w)
+INLINE simd4f Simd4fGatherOdd(simd4f left, simd4f right)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_i32x4_shuffle(left, right, 1, 3, 5, 7);
+	#elif ORCA_SIMD_SSE
+	return _mm_shuffle_ps(left, right, _MM_SHUFFLE(3, 1, 3, 1));
+	#elif ORCA_SIMD_NEON
+	return vuzp2q_f32(left, right);
+	#else
+	return NewSimd4f(left.y, left.w, right.y, right.w);
+	#endif
+}
+//Treats the 4 registers as rows (or columns) of a 4x4 matrix and transposes them in place
+INLINE void Simd4fTranspose(simd4f* row0, simd4f* row1, simd4f* row2, simd4f* row3)
+{
+	simd4f low01  = Simd4fInterleaveLow(*row0, *row1);
+	simd4f low23  = Simd4fInterleaveLow(*row2, *row3);
+	simd4f high01 = Simd4fInterleaveHigh(*row0, *row1);
+	simd4f high23 = Simd4fInterleaveHigh(*row2, *row3);
+	*row0 = Simd4fCombineLow(low01, low23);
+	*row1 = Simd4fCombineHigh(low01, low23);
+	*row2 = Simd4fCombineLow(high01, high23);
+	*row3 = Simd4fCombineHigh(high01, high23);
+}
+
+// +--------------------------------------------------------------+
+// |                   Simd4i and Bit Functions                   |
+// +--------------------------------------------------------------+
+//NOTE: Load and Store are unaligned and work on any 16 bytes of memory (u32 words, packed i16 samples, chars, etc.)
+INLINE simd4i Simd4iLoad(const void* pntr)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_v128_load(pntr);
+	#elif ORCA_SIMD_SSE
+	return _mm_loadu_si128((const __m128i*)pntr);
+	#elif ORCA_SIMD_NEON
+	return vreinterpretq_s32_u8(vld1q_u8((const u8*)pntr));
+	#else
+	simd4i result;
+	memcpy(&result, pntr, sizeof(result));
+	return result;
+	#endif
+}
+INLINE void Simd4iStore(void* pntr, simd4i value)
+{
+	#if ORCA_SIMD_WASM
+	wasm_v128_store(pntr, value);
+	#elif ORCA_SIMD_SSE
+	_mm_storeu_si128((__m128i*)pntr, value);
+	#elif ORCA_SIMD_NEON
+	vst1q_u8((u8*)pntr, vreinterpretq_u8_s32(value));
+	#else
+	memcpy(pntr, &value, sizeof(value));
+	#endif
+}
+//Loads the first numBytes (0-16) and zeroes the rest. Never touches memory past pntr + numBytes, so it's safe for the tail of a buffer
+INLINE simd4i Simd4iLoadPartial(const void* pntr, u32 numBytes)
+{
+	DebugAssert(numBytes <= sizeof(simd4i));
+	u8 padded[sizeof(simd4i)] = {};
+	if (numBytes > 0) { memcpy(&padded[0], pntr, numBytes); }
+	return Simd4iLoad(&padded[0]);
+}
+INLINE simd4i Simd4iFill(i32 value)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_i32x4_splat(value);
+	#elif ORCA_SIMD_SSE
+	return _mm_set1_epi32(value);
+	#elif ORCA_SIMD_NEON
+	return vdupq_n_s32(value);
+	#else
+	simd4i result;
+	result.values[0] = value; result.values[1] = value; result.values[2] = value; result.values[3] = value;
+	return result;
+	#endif
+}
+INLINE simd4i Simd4iAdd(simd4i left, simd4i right)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_i32x4_add(left, right);
+	#elif ORCA_SIMD_SSE
+	return _mm_add_epi32(left, right);
+	#elif ORCA_SIMD_NEON
+	return vaddq_s32(left, right);
+	#else
+	simd4i result;
+	for (u32 lIndex = 0; lIndex < 4; lIndex++) { result.valuesU32[lIndex] = left.valuesU32[lIndex] + right.valuesU32[lIndex]; }
+	return result;
+	#endif
+}
+INLINE simd4i Simd4iSubtract(simd4i left, simd4i right)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_i32x4_sub(left, right);
+	#elif ORCA_SIMD_SSE
+	return _mm_sub_epi32(left, right);
+	#elif ORCA_SIMD_NEON
+	return vsubq_s32(left, right);
+	#else
+	simd4i result;
+	for (u32 lIndex = 0; lIndex < 4; lIndex++) { result.valuesU32[lIndex] = left.valuesU32[lIndex] - right.valuesU32[lIndex]; }
+	return result;
+	#endif
+}
+INLINE simd4i Simd4iAnd(simd4i left, simd4i right)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_v128_and(left, right);
+	#elif ORCA_SIMD_SSE
+	return _mm_and_si128(left, right);
+	#elif ORCA_SIMD_NEON
+	return vandq_s32(left, right);
+	#else
+	simd4i result;
+	for (u32 lIndex = 0; lIndex < 4; lIndex++) { result.valuesU32[lIndex] = left.valuesU32[lIndex] & right.valuesU32[lIndex]; }
+	return result;
+	#endif
+}
+//left & ~right
+INLINE simd4i Simd4iAndNot(simd4i left, simd4i right)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_v128_andnot(left, right);
+	#elif ORCA_SIMD_SSE
+	return _mm_andnot_si128(right, left);
+	#elif ORCA_SIMD_NEON
+	return vbicq_s32(left, right);
+	#else
+	simd4i result;
+	for (u32 lIndex = 0; lIndex < 4; lIndex++) { result.valuesU32[lIndex] = left.valuesU32[lIndex] & ~right.valuesU32[lIndex]; }
+	return result;
+	#endif
+}
+INLINE simd4i Simd4iOr(simd4i left, simd4i right)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_v128_or(left, right);
+	#elif ORCA_SIMD_SSE
+	return _mm_or_si128(left, right);
+	#elif ORCA_SIMD_NEON
+	return vorrq_s32(left, right);
+	#else
+	simd4i result;
+	for (u32 lIndex = 0; lIndex < 4; lIndex++) { result.valuesU32[lIndex] = left.valuesU32[lIndex] | right.valuesU32[lIndex]; }
+	return result;
+	#endif
+}
+INLINE simd4i Simd4iXor(simd4i left, simd4i right)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_v128_xor(left, right);
+	#elif ORCA_SIMD_SSE
+	return _mm_xor_si128(left, right);
+	#elif ORCA_SIMD_NEON
+	return veorq_s32(left, right);
+	#else
+	simd4i result;
+	for (u32 lIndex = 0; lIndex < 4; lIndex++) { result.valuesU32[lIndex] = left.valuesU32[lIndex] ^ right.valuesU32[lIndex]; }
+	return result;
+	#endif
+}
+INLINE simd4i Simd4iShiftLeft(simd4i value, u32 amount)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_i32x4_shl(value, amount);
+	#elif ORCA_SIMD_SSE
+	return _mm_sll_epi32(value, _mm_cvtsi32_si128((int)amount));
+	#elif ORCA_SIMD_NEON
+	return vshlq_s32(value, vdupq_n_s32((i32)amount));
+	#else
+	simd4i result;
+	for (u32 lIndex = 0; lIndex < 4; lIndex++) { result.valuesU32[lIndex] = value.valuesU32[lIndex] << amount; }
+	return result;
+	#endif
+}
+//Logical shift (zeroes shifted in from the top)
+INLINE simd4i Simd4iShiftRight(simd4i value, u32 amount)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_u32x4_shr(value, amount);
+	#elif ORCA_SIMD_SSE
+	return _mm_srl_epi32(value, _mm_cvtsi32_si128((int)amount));
+	#elif ORCA_SIMD_NEON
+	return vreinterpretq_s32_u32(vshlq_u32(vreinterpretq_u32_s32(value), vdupq_n_s32(-(i32)amount)));
+	#else
+	simd4i result;
+	for (u32 lIndex = 0; lIndex < 4; lIndex++) { result.valuesU32[lIndex] = value.valuesU32[lIndex] >> amount; }
+	return result;
+	#endif
+}
+//Arithmetic shift (sign bit shifted in from the top)
+INLINE simd4i Simd4iShiftRightSigned(simd4i value, u32 amount)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_i32x4_shr(value, amount);
+	#elif ORCA_SIMD_SSE
+	return _mm_sra_epi32(value, _mm_cvtsi32_si128((int)amount));
+	#elif ORCA_SIMD_NEON
+	return vshlq_s32(value, vdupq_n_s32(-(i32)amount));
+	#else
+	simd4i result;
+	for (u32 lIndex = 0; lIndex < 4; lIndex++) { result.values[lIndex] = value.values[lIndex] >> amount; }
+	return result;
+	#endif
+}
+INLINE simd4i Simd4iEqual(simd4i left, simd4i right)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_i32x4_eq(left, right);
+	#elif ORCA_SIMD_SSE
+	return _mm_cmpeq_epi32(left, right);
+	#elif ORCA_SIMD_NEON
+	return vreinterpretq_s32_u32(vceqq_s32(left, right));
+	#else
+	simd4i result;
+	for (u32 lIndex = 0; lIndex < 4; lIndex++) { result.valuesU32[lIndex] = (left.values[lIndex] == right.values[lIndex]) ? 0xFFFFFFFF : 0x00000000; }
+	return result;
+	#endif
+}
+//Packs the top bit of each lane into the low 4 bits of the result (lane 0 -> bit 0). Useful for turning comparison masks into branches or indices
+INLINE u32 Simd4iMoveMask(simd4i mask)
+{
+	#if ORCA_SIMD_WASM
+	return (u32)wasm_i32x4_bitmask(mask);
+	#elif ORCA_SIMD_SSE
+	return (u32)_mm_movemask_ps(_mm_castsi128_ps(mask));
+	#elif ORCA_SIMD_NEON
+	static const i32 laneBits[4] = { 0, 1, 2, 3 };
+	uint32x4_t topBits = vshrq_n_u32(vreinterpretq_u32_s32(mask), 31);
+	return vaddvq_u32(vshlq_u32(topBits, vld1q_s32(laneBits)));
+	#else
+	return ((mask.valuesU32[0] >> 31) << 0) | ((mask.valuesU32[1] >> 31) << 1) | ((mask.valuesU32[2] >> 31) << 2) | ((mask.valuesU32[3] >> 31) << 3);
+	#endif
+}
+
+// +==============================+
+// |         Byte Lanes           |
+// +==============================+
+//These treat the register as 16 x u8 lanes (hash map control bytes, string scanning, etc.)
+INLINE simd4i Simd4iFillU8(u8 value)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_i8x16_splat((i8)value);
+	#elif ORCA_SIMD_SSE
+	return _mm_set1_epi8((char)value);
+	#elif ORCA_SIMD_NEON
+	return vreinterpretq_s32_u8(vdupq_n_u8(value));
+	#else
+	simd4i result;
+	memset(&result.valuesU8[0], value, sizeof(result.valuesU8));
+	return result;
+	#endif
+}
+//Each byte lane becomes 0xFF where left == right, 0x00 otherwise
+INLINE simd4i Simd4iEqualU8(simd4i left, simd4i right)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_i8x16_eq(left, right);
+	#elif ORCA_SIMD_SSE
+	return _mm_cmpeq_epi8(left, right);
+	#elif ORCA_SIMD_NEON
+	return vreinterpretq_s32_u8(vceqq_u8(vreinterpretq_u8_s32(left), vreinterpretq_u8_s32(right)));
+	#else
+	//Exact zero-byte test on the xor (no false positives from borrows), then spread the top bit to the whole byte
+	simd4i result;
+	for (u32 wIndex = 0; wIndex < 2; wIndex++)
+	{
+		u64 diff = left.valuesU64[wIndex] ^ right.valuesU64[wIndex];
+		u64 zeroBytes = ~(((diff & 0x7F7F7F7F7F7F7F7FULL) + 0x7F7F7F7F7F7F7F7FULL) | diff) & 0x8080808080808080ULL;
+		result.valuesU64[wIndex] = (zeroBytes >> 7) * 0xFF;
+	}
+	return result;
+	#endif
+}
+//Packs the top bit of each byte lane into the low 16 bits of the result (lane 0 -> bit 0)
+INLINE u32 Simd4iMoveMaskU8(simd4i mask)
+{
+	#if ORCA_SIMD_WASM
+	return (u32)wasm_i8x16_bitmask(mask);
+	#elif ORCA_SIMD_SSE
+	return (u32)_mm_movemask_epi8(mask);
+	#elif ORCA_SIMD_NEON
+	static const u8 laneBits[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+	uint8x16_t topBits = vreinterpretq_u8_s8(vshrq_n_s8(vreinterpretq_s8_s32(mask), 7));
+	uint8x16_t weighted = vandq_u8(topBits, vld1q_u8(laneBits));
+	return (u32)vaddv_u8(vget_low_u8(weighted)) | ((u32)vaddv_u8(vget_high_u8(weighted)) << 8);
+	#else
+	//The multiply gathers the 8 top bits of each word into its highest byte (assumes little-endian, like everything Orca runs on)
+	u64 lowBits = ((mask.valuesU64[0] & 0x8080808080808080ULL) >> 7) * 0x0102040810204080ULL;
+	u64 highBits = ((mask.valuesU64[1] & 0x8080808080808080ULL) >> 7) * 0x0102040810204080ULL;
+	return (u32)(lowBits >> 56) | ((u32)(highBits >> 56) << 8);
+	#endif
+}
+
+//Wrapping subtract in each byte lane. Subtracting an EqualU8 mask adds 1 to each lane that matched
+INLINE simd4i Simd4iSubtractU8(simd4i left, simd4i right)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_i8x16_sub(left, right);
+	#elif ORCA_SIMD_SSE
+	return _mm_sub_epi8(left, right);
+	#elif ORCA_SIMD_NEON
+	return vreinterpretq_s32_u8(vsubq_u8(vreinterpretq_u8_s32(left), vreinterpretq_u8_s32(right)));
+	#else
+	simd4i result;
+	for (u32 wIndex = 0; wIndex < 2; wIndex++)
+	{
+		//Borrows are kept from crossing into the next byte by doing the top bit separately
+		u64 leftWord = left.valuesU64[wIndex];
+		u64 rightWord = right.valuesU64[wIndex];
+		result.valuesU64[wIndex] = ((leftWord | 0x8080808080808080ULL) - (rightWord & 0x7F7F7F7F7F7F7F7FULL)) ^ ((leftWord ^ ~rightWord) & 0x8080808080808080ULL);
+	}
+	return result;
+	#endif
+}
+//Adds up all 16 byte lanes as unsigned values
+INLINE u32 Simd4iSumU8(simd4i value)
+{
+	#if ORCA_SIMD_WASM
+	v128_t sums = wasm_u32x4_extadd_pairwise_u16x8(wasm_u16x8_extadd_pairwise_u8x16(value));
+	return wasm_u32x4_extract_lane(sums, 0) + wasm_u32x4_extract_lane(sums, 1) + wasm_u32x4_extract_lane(sums, 2) + wasm_u32x4_extract_lane(sums, 3);
+	#elif ORCA_SIMD_SSE
+	__m128i sums = _mm_sad_epu8(value, _mm_setzero_si128());
+	return (u32)_mm_cvtsi128_si32(sums) + (u32)_mm_extract_epi16(sums, 4);
+	#elif ORCA_SIMD_NEON
+	return (u32)vaddlvq_u8(vreinterpretq_u8_s32(value));
+	#else
+	u32 result = 0;
+	for (u32 wIndex = 0; wIndex < 2; wIndex++)
+	{
+		u64 word = value.valuesU64[wIndex];
+		u64 pairs = (word & 0x00FF00FF00FF00FFULL) + ((word >> 8) & 0x00FF00FF00FF00FFULL);
+		result += (u32)((pairs * 0x0001000100010001ULL) >> 48);
+	}
+	return result;
+	#endif
+}
+
+// +==============================+
+// |   Conversion and Bit Casts   |
+// +==============================+
+//Converts each lane to i32, truncating towards zero
+INLINE simd4i Simd4fToI32(simd4f value)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_i32x4_trunc_sat_f32x4(value);
+	#elif ORCA_SIMD_SSE
+	return _mm_cvttps_epi32(value);
+	#elif ORCA_SIMD_NEON
+	return vcvtq_s32_f32(value);
+	#else
+	simd4i result;
+	for (u32 lIndex = 0; lIndex < 4; lIndex++) { result.values[lIndex] = (i32)value.values[lIndex]; }
+	return result;
+	#endif
+}
+//Converts each lane to i32, rounding to the nearest integer (ties to even). Lanes must already be within i32 range
+INLINE simd4i Simd4fRoundToI32(simd4f value)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_i32x4_trunc_sat_f32x4(wasm_f32x4_nearest(value));
+	#elif ORCA_SIMD_SSE
+	return _mm_cvtps_epi32(value);
+	#elif ORCA_SIMD_NEON
+	return vcvtnq_s32_f32(value);
+	#else
+	simd4i result;
+	for (u32 lIndex = 0; lIndex < 4; lIndex++) { result.values[lIndex] = (i32)rintf(value.values[lIndex]); }
+	return result;
+	#endif
+}
+INLINE simd4f Simd4iToR32(simd4i value)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_f32x4_convert_i32x4(value);
+	#elif ORCA_SIMD_SSE
+	return _mm_cvtepi32_ps(value);
+	#elif ORCA_SIMD_NEON
+	return vcvtq_f32_s32(value);
+	#else
+	simd4f result;
+	for (u32 lIndex = 0; lIndex < 4; lIndex++) { result.values[lIndex] = (r32)value.values[lIndex]; }
+	return result;
+	#endif
+}
+//Reinterprets the bits without any conversion
+INLINE simd4i Simd4fAsI32(simd4f value)
+{
+	#if ORCA_SIMD_WASM
+	return value;
+	#elif ORCA_SIMD_SSE
+	return _mm_castps_si128(value);
+	#elif ORCA_SIMD_NEON
+	return vreinterpretq_s32_f32(value);
+	#else
+	simd4i result;
+	memcpy(&result, &value, sizeof(result));
+	return result;
+	#endif
+}
+INLINE simd4f Simd4iAsR32(simd4i value)
+{
+	#if ORCA_SIMD_WASM
+	return value;
+	#elif ORCA_SIMD_SSE
+	return _mm_castsi128_ps(value);
+	#elif ORCA_SIMD_NEON
+	return vreinterpretq_f32_s32(value);
+	#else
+	simd4f result;
+	memcpy(&result, &value, sizeof(result));
+	return result;
+	#endif
+}
+
+// +==============================+
+// |        Narrow / Widen        |
+// +==============================+
+//Packs 8 x i32 into 8 x i16 (low lanes first), saturating anything outside the i16 range
+INLINE simd4i Simd4iPackI32ToI16(simd4i low, simd4i high)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_i16x8_narrow_i32x4(low, high);
+	#elif ORCA_SIMD_SSE
+	return _mm_packs_epi32(low, high);
+	#elif ORCA_SIMD_NEON
+	return vreinterpretq_s32_s16(vcombine_s16(vqmovn_s32(low), vqmovn_s32(high)));
+	#else
+	simd4i result;
+	for (u32 lIndex = 0; lIndex < 4; lIndex++)
+	{
+		i32 lowValue = low.values[lIndex];
+		i32 highValue = high.values[lIndex];
+		result.valuesI16[lIndex + 0] = (i16)((lowValue < -32768) ? -32768 : ((lowValue > 32767) ? 32767 : lowValue));
+		result.valuesI16[lIndex + 4] = (i16)((highValue < -32768) ? -32768 : ((highValue > 32767) ? 32767 : highValue));
+	}
+	return result;
+	#endif
+}
+//Packs 16 x i16 into 16 x i8 (low lanes first), saturating anything outside the i8 range
+INLINE simd4i Simd4iPackI16ToI8(simd4i low, simd4i high)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_i8x16_narrow_i16x8(low, high);
+	#elif ORCA_SIMD_SSE
+	return _mm_packs_epi16(low, high);
+	#elif ORCA_SIMD_NEON
+	return vreinterpretq_s32_s8(vcombine_s8(vqmovn_s16(vreinterpretq_s16_s32(low)), vqmovn_s16(vreinterpretq_s16_s32(high))));
+	#else
+	simd4i result;
+	for (u32 lIndex = 0; lIndex < 8; lIndex++)
+	{
+		i16 lowValue = low.valuesI16[lIndex];
+		i16 highValue = high.valuesI16[lIndex];
+		result.valuesI8[lIndex + 0] = (i8)((lowValue < -128) ? -128 : ((lowValue > 127) ? 127 : lowValue));
+		result.valuesI8[lIndex + 8] = (i8)((highValue < -128) ? -128 : ((highValue > 127) ? 127 : highValue));
+	}
+	return result;
+	#endif
+}
+//Sign extends the low 4 (or high 4) of 8 x i16 lanes to 4 x i32
+INLINE simd4i Simd4iExtendLowI16(simd4i value)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_i32x4_extend_low_i16x8(value);
+	#elif ORCA_SIMD_SSE
+	return _mm_srai_epi32(_mm_unpacklo_epi16(value, value), 16);
+	#elif ORCA_SIMD_NEON
+	return vmovl_s16(vget_low_s16(vreinterpretq_s16_s32(value)));
+	#else
+	simd4i result;
+	for (u32 lIndex = 0; lIndex < 4; lIndex++) { result.values[lIndex] = value.valuesI16[lIndex]; }
+	return result;
+	#endif
+}
+INLINE simd4i Simd4iExtendHighI16(simd4i value)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_i32x4_extend_high_i16x8(value);
+	#elif ORCA_SIMD_SSE
+	return _mm_srai_epi32(_mm_unpackhi_epi16(value, value), 16);
+	#elif ORCA_SIMD_NEON
+	return vmovl_s16(vget_high_s16(vreinterpretq_s16_s32(value)));
+	#else
+	simd4i result;
+	for (u32 lIndex = 0; lIndex < 4; lIndex++) { result.values[lIndex] = value.valuesI16[lIndex + 4]; }
+	return result;
+	#endif
+}
+//Sign extends the low 8 (or high 8) of 16 x i8 lanes to 8 x i16
+INLINE simd4i Simd4iExtendLowI8(simd4i value)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_i16x8_extend_low_i8x16(value);
+	#elif ORCA_SIMD_SSE
+	return _mm_srai_epi16(_mm_unpacklo_epi8(value, value), 8);
+	#elif ORCA_SIMD_NEON
+	return vreinterpretq_s32_s16(vmovl_s8(vget_low_s8(vreinterpretq_s8_s32(value))));
+	#else
+	simd4i result;
+	for (u32 lIndex = 0; lIndex < 8; lIndex++) { result.valuesI16[lIndex] = value.valuesI8[lIndex]; }
+	return result;
+	#endif
+}
+INLINE simd4i Simd4iExtendHighI8(simd4i value)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_i16x8_extend_high_i8x16(value);
+	#elif ORCA_SIMD_SSE
+	return _mm_srai_epi16(_mm_unpackhi_epi8(value, value), 8);
+	#elif ORCA_SIMD_NEON
+	return vreinterpretq_s32_s16(vmovl_s8(vget_high_s8(vreinterpretq_s8_s32(value))));
+	#else
+	simd4i result;
+	for (u32 lIndex = 0; lIndex < 8; lIndex++) { result.valuesI16[lIndex] = value.valuesI8[lIndex + 8]; }
+	return result;
+	#endif
+}
+
+// +==============================+
+// |    Comparison and Select     |
+// +==============================+
+INLINE simd4i Simd4fLessThan(simd4f left, simd4f right)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_f32x4_lt(left, right);
+	#elif ORCA_SIMD_SSE
+	return _mm_castps_si128(_mm_cmplt_ps(left, right));
+	#elif ORCA_SIMD_NEON
+	return vreinterpretq_s32_u32(vcltq_f32(left, right));
+	#else
+	simd4i result;
+	for (u32 lIndex = 0; lIndex < 4; lIndex++) { result.valuesU32[lIndex] = (left.values[lIndex] < right.values[lIndex]) ? 0xFFFFFFFF : 0x00000000; }
+	return result;
+	#endif
+}
+INLINE simd4i Simd4fGreaterThan(simd4f left, simd4f right)
+{
+	return Simd4fLessThan(right, left);
+}
+//NaN lanes are never equal, so Simd4fEqual(value, value) masks out NaNs
+INLINE simd4i Simd4fEqual(simd4f left, simd4f right)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_f32x4_eq(left, right);
+	#elif ORCA_SIMD_SSE
+	return _mm_castps_si128(_mm_cmpeq_ps(left, right));
+	#elif ORCA_SIMD_NEON
+	return vreinterpretq_s32_u32(vceqq_f32(left, right));
+	#else
+	simd4i result;
+	for (u32 lIndex = 0; lIndex < 4; lIndex++) { result.valuesU32[lIndex] = (left.values[lIndex] == right.values[lIndex]) ? 0xFFFFFFFF : 0x00000000; }
+	return result;
+	#endif
+}
+//Picks whenTrue in lanes where mask is all 1s and whenFalse where it is all 0s
+INLINE simd4f Simd4fSelect(simd4i mask, simd4f whenTrue, simd4f whenFalse)
+{
+	#if ORCA_SIMD_WASM
+	return wasm_v128_bitselect(whenTrue, whenFalse, mask);
+	#elif ORCA_SIMD_SSE
+	__m128 maskPs = _mm_castsi128_ps(mask);
+	return _mm_or_ps(_mm_and_ps(maskPs, whenTrue), _mm_andnot_ps(maskPs, whenFalse));
+	#elif ORCA_SIMD_NEON
+	return vbslq_f32(vreinterpretq_u32_s32(mask), whenTrue, whenFalse);
+	#else
+	simd4f result;
+	for (u32 lIndex = 0; lIndex < 4; lIndex++) { result.values[lIndex] = (mask.valuesU32[lIndex] != 0) ? whenTrue.values[lIndex] : whenFalse.values[lIndex]; }
+	return result;
+	#endif
+}
+//Same compare order as ClampR32: lanes below min give min, then lanes above max give max, NaN lanes pass through
+INLINE simd4f Simd4fClamp(simd4f value, simd4f min, simd4f max)
+{
+	simd4f upper = Simd4fSelect(Simd4fGreaterThan(value, max), max, value);
+	return Simd4fSelect(Simd4fLessThan(value, min), min, upper);
+}
+INLINE simd4f Simd4fAbs(simd4f value)
+{
+	return Simd4iAsR32(Simd4iAnd(Simd4fAsI32(value), Simd4iFill(0x7FFFFFFF)));
+}
+//Flips the sign of each lane where signBits has the top bit set
+INLINE simd4f Simd4fXorSign(simd4f value, simd4i signBits)
+{
+	return Simd4iAsR32(Simd4iXor(Simd4fAsI32(value), Simd4iAnd(signBits, Simd4iFill((i32)0x80000000))));
+}
+
+// +--------------------------------------------------------------+
+// |                     R32 Array Functions                      |
+// +--------------------------------------------------------------+
+//NOTE: All of these allow resultsOut to be the same pointer as one of the inputs (in-place operation)
+//      but the arrays must not partially overlap. No alignment is required, the tail is handled with scalar code.
+//      The main loop does 4 registers per iteration so all the loads are issued before any of the stores
+void AddArrayR32(u32 count, const r32* left, const r32* right, r32* resultsOut)
+{
+	u32 index = 0;
+	for (; index + 16 <= count; index += 16)
+	{
+		simd4f result0 = Simd4fAdd(Simd4fLoad(&left[index + 0]), Simd4fLoad(&right[index + 0]));
+		simd4f result1 = Simd4fAdd(Simd4fLoad(&left[index + 4]), Simd4fLoad(&right[index + 4]));
+		simd4f result2 = Simd4fAdd(Simd4fLoad(&left[index + 8]), Simd4fLoad(&right[index + 8]));
+		simd4f result3 = Simd4fAdd(Simd4fLoad(&left[index + 12]), Simd4fLoad(&right[index + 12]));
+		Simd4fStore(&resultsOut[index + 0], result0);
+		Simd4fStore(&resultsOut[index + 4], result1);
+		Simd4fStore(&resultsOut[index + 8], result2);
+		Simd4fStore(&resultsOut[index + 12], result3);
+	}
+	for (; index + 4 <= count; index += 4)
+	{
+		Simd4fStore(&resultsOut[index], Simd4fAdd(Simd4fLoad(&left[index]), Simd4fLoad(&right[index])));
+	}
+	for (; index < count; index++) { resultsOut[index] = left[index] + right[index]; }
+}
+void SubtractArrayR32(u32 count, const r32* left, const r32* right, r32* resultsOut)
+{
+	u32 index = 0;
+	for (; index + 16 <= count; index += 16)
+	{
+		simd4f result0 = Simd4fSubtract(Simd4fLoad(&left[index + 0]), Simd4fLoad(&right[index + 0]));
+		simd4f result1 = Simd4fSubtract(Simd4fLoad(&left[index + 4]), Simd4fLoad(&right[index + 4]));
+		simd4f result2 = Simd4fSubtract(Simd4fLoad(&left[index + 8]), Simd4fLoad(&right[index + 8]));
+		simd4f result3 = Simd4fSubtract(Simd4fLoad(&left[index + 12]), Simd4fLoad(&right[index + 12]));
+		Simd4fStore(&resultsOut[index + 0], result0);
+		Simd4fStore(&resultsOut[index + 4], result1);
+		Simd4fStore(&resultsOut[index + 8], result2);
+		Simd4fStore(&resultsOut[index + 12], result3);
+	}
+	for (; index + 4 <= count; index += 4)
+	{
+		Simd4fStore(&resultsOut[index], Simd4fSubtract(Simd4fLoad(&left[index]), Simd4fLoad(&right[index])));
+	}
+	for (; index < count; index++) { resultsOut[index] = left[index] - right[index]; }
+}
+void MultiplyArrayR32(u32 count, const r32* left, const r32* right, r32* resultsOut)
+{
+	u32 index = 0;
+	for (; index + 16 <= count; index += 16)
+	{
+		simd4f result0 = Simd4fMultiply(Simd4fLoad(&left[index + 0]), Simd4fLoad(&right[index + 0]));
+		simd4f result1 = Simd4fMultiply(Simd4fLoad(&left[index + 4]), Simd4fLoad(&right[index + 4]));
+		simd4f result2 = Simd4fMultiply(Simd4fLoad(&left[index + 8]), Simd4fLoad(&right[index + 8]));
+		simd4f result3 = Simd4fMultiply(Simd4fLoad(&left[index + 12]), Simd4fLoad(&right[index + 12]));
+		Simd4fStore(&resultsOut[index + 0], result0);
+		Simd4fStore(&resultsOut[index + 4], result1);
+		Simd4fStore(&resultsOut[index + 8], result2);
+		Simd4fStore(&resultsOut[index + 12], result3);
+	}
+	for (; index + 4 <= count; index += 4)
+	{
+		Simd4fStore(&resultsOut[index], Simd4fMultiply(Simd4fLoad(&left[index]), Simd4fLoad(&right[index])));
+	}
+	for (; index < count; index++) { resultsOut[index] = left[index] * right[index]; }
+}
+void ScaleArrayR32(u32 count, const r32* values, r32 scalar, r32* resultsOut)
+{
+	simd4f scalarVec = Simd4fFill(scalar);
+	u32 index = 0;
+	for (; index + 16 <= count; index += 16)
+	{
+		simd4f result0 = Simd4fMultiply(Simd4fLoad(&values[index + 0]), scalarVec);
+		simd4f result1 = Simd4fMultiply(Simd4fLoad(&values[index + 4]), scalarVec);
+		simd4f result2 = Simd4fMultiply(Simd4fLoad(&values[index + 8]), scalarVec);
+		simd4f result3 = Simd4fMultiply(Simd4fLoad(&values[index + 12]), scalarVec);
+		Simd4fStore(&resultsOut[index + 0], result0);
+		Simd4fStore(&resultsOut[index + 4], result1);
+		Simd4fStore(&resultsOut[index + 8], result2);
+		Simd4fStore(&resultsOut[index + 12], result3);
+	}
+	for (; index + 4 <= count; index += 4)
+	{
+		Simd4fStore(&resultsOut[index], Simd4fMultiply(Simd4fLoad(&values[index]), scalarVec));
+	}
+	for (; index < count; index++) { resultsOut[index] = values[index] * scalar; }
+}
+//resultsOut[i] = base[i] + (values[i] * scalar)
+void AddScaledArrayR32(u32 count, const r32* base, const r32* values, r32 scalar, r32* resultsOut)
+{
+	simd4f scalarVec = Simd4fFill(scalar);
+	u32 index = 0;
+	for (; index + 16 <= count; index += 16)
+	{
+		simd4f result0 = Simd4fMulAdd(Simd4fLoad(&values[index + 0]), scalarVec, Simd4fLoad(&base[index + 0]));
+		simd4f result1 = Simd4fMulAdd(Simd4fLoad(&values[index + 4]), scalarVec, Simd4fLoad(&base[index + 4]));
+		simd4f result2 = Simd4fMulAdd(Simd4fLoad(&values[index + 8]), scalarVec, Simd4fLoad(&base[index + 8]));
+		simd4f result3 = Simd4fMulAdd(Simd4fLoad(&values[index + 12]), scalarVec, Simd4fLoad(&base[index + 12]));
+		Simd4fStore(&resultsOut[index + 0], result0);
+		Simd4fStore(&resultsOut[index + 4], result1);
+		Simd4fStore(&resultsOut[index + 8], result2);
+		Simd4fStore(&resultsOut[index + 12], result3);
+	}
+	for (; index + 4 <= count; index += 4)
+	{
+		Simd4fStore(&resultsOut[index], Simd4fMulAdd(Simd4fLoad(&values[index]), scalarVec, Simd4fLoad(&base[index])));
+	}
+	for (; index < count; index++) { resultsOut[index] = base[index] + (values[index] * scalar); }
+}
+//resultsOut[i] = (left[i] * right[i]) + addend[i]
+void MulAddArrayR32(u32 count, const r32* left, const r32* right, const r32* addend, r32* resultsOut)
+{
+	u32 index = 0;
+	for (; index + 16 <= count; index += 16)
+	{
+		simd4f result0 = Simd4fMulAdd(Simd4fLoad(&left[index + 0]), Simd4fLoad(&right[index + 0]), Simd4fLoad(&addend[index + 0]));
+		simd4f result1 = Simd4fMulAdd(Simd4fLoad(&left[index + 4]), Simd4fLoad(&right[index + 4]), Simd4fLoad(&addend[index + 4]));
+		simd4f result2 = Simd4fMulAdd(Simd4fLoad(&left[index + 8]), Simd4fLoad(&right[index + 8]), Simd4fLoad(&addend[index + 8]));
+		simd4f result3 = Simd4fMulAdd(Simd4fLoad(&left[index + 12]), Simd4fLoad(&right[index + 12]), Simd4fLoad(&addend[index + 12]));
+		Simd4fStore(&resultsOut[index + 0], result0);
+		Simd4fStore(&resultsOut[index + 4], result1);
+		Simd4fStore(&resultsOut[index + 8], result2);
+		Simd4fStore(&resultsOut[index + 12], result3);
+	}
+	for (; index + 4 <= count; index += 4)
+	{
+		Simd4fStore(&resultsOut[index], Simd4fMulAdd(Simd4fLoad(&left[index]), Simd4fLoad(&right[index]), Simd4fLoad(&addend[index])));
+	}
+	for (; index < count; index++) { resultsOut[index] = (left[index] * right[index]) + addend[index]; }
+}
+//Adds a repeating pattern of 4 values (like a v2 offset written twice or a v4 offset) to every group of 4 values
+//NOTE: count does not need to be a multiple of 4, the tail uses the first (count%4) values of the pattern
+void AddPatternArrayR32(u32 count, const r32* values, const r32 pattern[4], r32* resultsOut)
+{
+	simd4f patternVec = Simd4fLoad(pattern);
+	u32 index = 0;
+	for (; index + 16 <= count; index += 16)
+	{
+		simd4f result0 = Simd4fAdd(Simd4fLoad(&values[index + 0]), patternVec);
+		simd4f result1 = Simd4fAdd(Simd4fLoad(&values[index + 4]), patternVec);
+		simd4f result2 = Simd4fAdd(Simd4fLoad(&values[index + 8]), patternVec);
+		simd4f result3 = Simd4fAdd(Simd4fLoad(&values[index + 12]), patternVec);
+		Simd4fStore(&resultsOut[index + 0], result0);
+		Simd4fStore(&resultsOut[index + 4], result1);
+		Simd4fStore(&resultsOut[index + 8], result2);
+		Simd4fStore(&resultsOut[index + 12], result3);
+	}
+	for (; index + 4 <= count; index += 4)
+	{
+		Simd4fStore(&resultsOut[index], Simd4fAdd(Simd4fLoad(&values[index]), patternVec));
+	}
+	for (; index < count; index++) { resultsOut[index] = values[index] + pattern[index % 4]; }
+}
+
+#endif //  _ORCA_SIMD_H
+
+// +--------------------------------------------------------------+
+// |                   Autocomplete Dictionary                    |
+// +--------------------------------------------------------------+
+/*
+@Defines
+ORCA_SIMD_DISABLED
+ORCA_SIMD_WASM
+ORCA_SIMD_SSE
+ORCA_SIMD_NEON
+ORCA_SIMD_SCALAR
+ORCA_SIMD_ENABLED
+@Types
+simd4f
+simd4i
+@Functions
+INLINE simd4f Simd4fLoad(const r32* pntr)
+INLINE void Simd4fStore(r32* pntr, simd4f value)
+INLINE simd4f Simd4fFill(r32 value)
+INLINE simd4f NewSimd4f(r32 x, r32 y, r32 z, r32 w)
+INLINE simd4f Simd4fAdd(simd4f left, simd4f right)
+INLINE simd4f Simd4fSubtract(simd4f left, simd4f right)
+INLINE simd4f Simd4fMultiply(simd4f left, simd4f right)
+INLINE simd4f Simd4fDivide(simd4f left, simd4f right)
+INLINE simd4f Simd4fMulAdd(simd4f left, simd4f right, simd4f addend)
+INLINE simd4f Simd4fMin(simd4f left, simd4f right)
+INLINE simd4f Simd4fMax(simd4f left, simd4f right)
+INLINE simd4f Simd4fSqrt(simd4f value)
+INLINE simd4f Simd4fDuplicateEven(simd4f value)
+INLINE simd4f Simd4fDuplicateOdd(simd4f value)
+INLINE simd4f Simd4fInterleaveLow(simd4f left, simd4f right)
+INLINE simd4f Simd4fInterleaveHigh(simd4f left, simd4f right)
+INLINE simd4f Simd4fCombineLow(simd4f left, simd4f right)
+INLINE simd4f Simd4fCombineHigh(simd4f left, simd4f right)
+INLINE simd4f Simd4fGatherEven(simd4f left, simd4f right)
+INLINE simd4f Simd4fGatherOdd(simd4f left, simd4f right)
+INLINE void Simd4fTranspose(simd4f* row0, simd4f* row1, simd4f* row2, simd4f* row3)
+INLINE simd4i Simd4iLoad(const void* pntr)
+INLINE void Simd4iStore(void* pntr, simd4i value)
+INLINE simd4i Simd4iLoadPartial(const void* pntr, u32 numBytes)
+INLINE simd4i Simd4iFill(i32 value)
+INLINE simd4i Simd4iAdd(simd4i left, simd4i right)
+INLINE simd4i Simd4iSubtract(simd4i left, simd4i right)
+INLINE simd4i Simd4iAnd(simd4i left, simd4i right)
+INLINE simd4i Simd4iAndNot(simd4i left, simd4i right)
+INLINE simd4i Simd4iOr(simd4i left, simd4i right)
+INLINE simd4i Simd4iXor(simd4i left, simd4i right)
+INLINE simd4i Simd4iShiftLeft(simd4i value, u32 amount)
+INLINE simd4i Simd4iShiftRight(simd4i value, u32 amount)
+INLINE simd4i Simd4iShiftRightSigned(simd4i value, u32 amount)
+INLINE simd4i Simd4iEqual(simd4i left, simd4i right)
+INLINE u32 Simd4iMoveMask(simd4i mask)
+INLINE simd4i Simd4iFillU8(u8 value)
+INLINE simd4i Simd4iEqualU8(simd4i left, simd4i right)
+INLINE u32 Simd4iMoveMaskU8(simd4i mask)
+INLINE simd4i Simd4iSubtractU8(simd4i left, simd4i right)
+INLINE u32 Simd4iSumU8(simd4i value)
+INLINE simd4i Simd4fToI32(simd4f value)
+INLINE simd4i Simd4fRoundToI32(simd4f value)
+INLINE simd4f Simd4iToR32(simd4i value)
+INLINE simd4i Simd4fAsI32(simd4f value)
+INLINE simd4f Simd4iAsR32(simd4i value)
+INLINE simd4i Simd4iPackI32ToI16(simd4i low, simd4i high)
+INLINE simd4i Simd4iPackI16ToI8(simd4i low, simd4i high)
+INLINE simd4i Simd4iExtendLowI16(simd4i value)
+INLINE simd4i Simd4iExtendHighI16(simd4i value)
+INLINE simd4i Simd4iExtendLowI8(simd4i value)
+INLINE simd4i Simd4iExtendHighI8(simd4i value)
+INLINE simd4i Simd4fLessThan(simd4f left, simd4f right)
+INLINE simd4i Simd4fGreaterThan(simd4f left, simd4f right)
+INLINE simd4i Simd4fEqual(simd4f left, simd4f right)
+INLINE simd4f Simd4fSelect(simd4i mask, simd4f whenTrue, simd4f whenFalse)
+INLINE simd4f Simd4fClamp(simd4f value, simd4f min, simd4f max)
+INLINE simd4f Simd4fAbs(simd4f value)
+INLINE simd4f Simd4fXorSign(simd4f value, simd4i signBits)
+void AddArrayR32(u32 count, const r32* left, const r32* right, r32* resultsOut)
+void SubtractArrayR32(u32 count, const r32* left, const r32* right, r32* resultsOut)
+void MultiplyArrayR32(u32 count, const r32* left, const r32* right, r32* resultsOut)
+void ScaleArrayR32(u32 count, const r32* values, r32 scalar, r32* resultsOut)
+void AddScaledArrayR32(u32 count, const r32* base, const r32* values, r32 scalar, r32* resultsOut)
+void MulAddArrayR32(u32 count, const r32* left, const r32* right, const r32* addend, r32* resultsOut)
+void AddPatternArrayR32(u32 count, const r32* values, const r32 pattern[4], r32* resultsOut)
+*/
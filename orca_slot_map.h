@@ -0,0 +1,223 @@
+/*
+File:   orca_slot_map.h
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Holds SlotMap_t, a container for objects that need a stable reference
+	** (entities, widgets) but are mostly walked all at once. The items themselves
+	** are packed with no holes in a VarArray_t so looping over them is a straight
+	** walk through memory, and each one is referred to by a u32 handle that goes
+	** through a sparse slot array. Removing an item moves the last one into its
+	** place and bumps the generation of its slot, so old handles to it stop
+	** resolving instead of pointing at whatever moved in
+*/
+
+#ifndef _ORCA_SLOT_MAP_H
+#define _ORCA_SLOT_MAP_H
+
+//Handles are (generation << SLOT_MAP_INDEX_BITS) | slotIndex
+#define SLOT_MAP_INDEX_BITS       20
+#define SLOT_MAP_GENERATION_BITS  (32 - SLOT_MAP_INDEX_BITS)
+#define SLOT_MAP_MAX_SLOTS        (1UL << SLOT_MAP_INDEX_BITS)
+#define SLOT_MAP_MAX_GENERATION   ((1UL << SLOT_MAP_GENERATION_BITS) - 1)
+#define SLOT_MAP_INVALID_HANDLE   0 //generations start at 1 so this never resolves, a zeroed handle means "nothing"
+#define SLOT_MAP_FREE_LIST_END    UINT32_MAX
+
+struct SlotMapSlot_t
+{
+	u32 denseIndex; //where the item is in items while the slot is in use, the next free slot while it isn't
+	u32 generation; //bumped when the item is removed, handles only resolve if theirs matches
+};
+
+struct SlotMap_t
+{
+	OC_Arena_t* arena;
+	VarArray_t items; //packed, in no particular order
+	VarArray_t itemSlots; //u32 slot index for each item, so a removal can fix up the slot of the item that moves into the hole
+	VarArray_t slots; //SlotMapSlot_t
+	u32 freeSlotsHead;
+	u32 numRetiredSlots; //slots that ran out of generations and are never handed out again
+};
+
+// +--------------------------------------------------------------+
+// |                           Handles                            |
+// +--------------------------------------------------------------+
+INLINE u32 MakeSlotMapHandle(u32 slotIndex, u32 generation) { return (generation << SLOT_MAP_INDEX_BITS) | slotIndex; }
+INLINE u32 GetSlotMapHandleIndex(u32 handle) { return (handle & (SLOT_MAP_MAX_SLOTS - 1)); }
+INLINE u32 GetSlotMapHandleGeneration(u32 handle) { return (handle >> SLOT_MAP_INDEX_BITS); }
+
+// +--------------------------------------------------------------+
+// |                       Create and Free                        |
+// +--------------------------------------------------------------+
+//NOTE: Arena memory can't be given back individually, so this just clears the structure
+void FreeSlotMap(SlotMap_t* map)
+{
+	NotNull(map);
+	FreeVarArray(&map->items);
+	FreeVarArray(&map->itemSlots);
+	FreeVarArray(&map->slots);
+	ClearPointer(map);
+}
+void CreateSlotMap(SlotMap_t* mapOut, OC_Arena_t* arena, u64 itemSize, u64 initialCapacity = 0, u32 itemAlignment = 0)
+{
+	NotNull2(mapOut, arena);
+	Assert(initialCapacity <= SLOT_MAP_MAX_SLOTS);
+	ClearPointer(mapOut);
+	mapOut->arena = arena;
+	CreateVarArray(&mapOut->items, arena, itemSize, initialCapacity, itemAlignment);
+	CreateVarArrayType(&mapOut->itemSlots, arena, u32, initialCapacity);
+	CreateVarArrayType(&mapOut->slots, arena, SlotMapSlot_t, initialCapacity);
+	mapOut->freeSlotsHead = SLOT_MAP_FREE_LIST_END;
+}
+#define CreateSlotMapType(mapOutPntr, arena, type, initialCapacity) CreateSlotMap((mapOutPntr), (arena), sizeof(type), (initialCapacity), _Alignof(type))
+
+// +--------------------------------------------------------------+
+// |                            Access                            |
+// +--------------------------------------------------------------+
+INLINE u32 SlotMapCount(const SlotMap_t* map) { return (u32)map->items.length; }
+
+//Returns nullptr if the handle's item has been removed (or the handle is SLOT_MAP_INVALID_HANDLE)
+INLINE void* SlotMapGet(const SlotMap_t* map, u32 handle)
+{
+	u32 slotIndex = GetSlotMapHandleIndex(handle);
+	if (slotIndex >= map->slots.length) { return nullptr; }
+	const SlotMapSlot_t* slot = VarArrayGet(&map->slots, slotIndex, SlotMapSlot_t);
+	if (slot->generation != GetSlotMapHandleGeneration(handle)) { return nullptr; }
+	return VarArrayGetItem(&map->items, slot->denseIndex);
+}
+#define SlotMapGetType(mapPntr, handle, type) ((type*)SlotMapGet((mapPntr), (handle)))
+INLINE bool SlotMapContains(const SlotMap_t* map, u32 handle) { return (SlotMapGet(map, handle) != nullptr); }
+
+//For walking the items directly. Removing items while looping moves the last item into the removed one's place, so loop backwards if you need to remove
+INLINE void* SlotMapGetItem(const SlotMap_t* map, u32 itemIndex) { return VarArrayGetItem(&map->items, itemIndex); }
+#define SlotMapGetItemType(mapPntr, itemIndex, type) ((type*)SlotMapGetItem((mapPntr), (itemIndex)))
+#define SlotMapLoop(mapPntr, indexName)        for (u32 indexName = 0; indexName < (u32)(mapPntr)->items.length; indexName++)
+#define SlotMapLoopReverse(mapPntr, indexName) for (u32 indexName = (u32)(mapPntr)->items.length; indexName-- > 0; )
+
+//The handle for the item at itemIndex while looping
+INLINE u32 SlotMapGetHandleAt(const SlotMap_t* map, u32 itemIndex)
+{
+	u32 slotIndex = *VarArrayGet(&map->itemSlots, itemIndex, u32);
+	return MakeSlotMapHandle(slotIndex, VarArrayGet(&map->slots, slotIndex, SlotMapSlot_t)->generation);
+}
+
+// +--------------------------------------------------------------+
+// |                        Add and Remove                        |
+// +--------------------------------------------------------------+
+//NOTE: The new item is not cleared
+void* SlotMapAdd(SlotMap_t* map, u32* handleOut)
+{
+	NotNull2(map, handleOut);
+	u32 slotIndex = map->freeSlotsHead;
+	SlotMapSlot_t* slot = nullptr;
+	if (slotIndex != SLOT_MAP_FREE_LIST_END)
+	{
+		slot = &((SlotMapSlot_t*)map->slots.items)[slotIndex];
+		map->freeSlotsHead = slot->denseIndex;
+	}
+	else
+	{
+		AssertMsg(map->slots.length < SLOT_MAP_MAX_SLOTS, "SlotMap_t ran out of handle bits");
+		slotIndex = (u32)map->slots.length;
+		slot = VarArrayPush(&map->slots, SlotMapSlot_t);
+		slot->generation = 1;
+	}
+	slot->denseIndex = (u32)map->items.length;
+	*handleOut = MakeSlotMapHandle(slotIndex, slot->generation);
+	*VarArrayPush(&map->itemSlots, u32) = slotIndex;
+	return VarArrayPushItem(&map->items);
+}
+#define SlotMapAddType(mapPntr, type, handleOutPntr) ((type*)SlotMapAdd((mapPntr), (handleOutPntr)))
+
+//Frees the slot (or retires it if its generation has run out) so every handle to it stops resolving
+INLINE void SlotMapReleaseSlot(SlotMap_t* map, u32 slotIndex, SlotMapSlot_t* slot)
+{
+	if (slot->generation >= SLOT_MAP_MAX_GENERATION)
+	{
+		slot->generation = SLOT_MAP_MAX_GENERATION + 1; //doesn't fit in a handle, so nothing matches it again
+		map->numRetiredSlots++;
+		return;
+	}
+	slot->generation++;
+	slot->denseIndex = map->freeSlotsHead;
+	map->freeSlotsHead = slotIndex;
+}
+
+//O(1), the last item moves into the removed item's place. Returns false if the handle was already stale
+bool SlotMapRemove(SlotMap_t* map, u32 handle)
+{
+	NotNull(map);
+	u32 slotIndex = GetSlotMapHandleIndex(handle);
+	if (slotIndex >= map->slots.length) { return false; }
+	SlotMapSlot_t* slots = (SlotMapSlot_t*)map->slots.items;
+	SlotMapSlot_t* slot = &slots[slotIndex];
+	if (slot->generation != GetSlotMapHandleGeneration(handle)) { return false; }
+
+	u32* itemSlots = (u32*)map->itemSlots.items;
+	u32 itemIndex = slot->denseIndex;
+	u32 lastIndex = (u32)map->items.length - 1;
+	if (itemIndex != lastIndex)
+	{
+		u64 itemSize = map->items.itemSize;
+		memcpy((u8*)map->items.items + (itemIndex * itemSize), (u8*)map->items.items + (lastIndex * itemSize), itemSize);
+		u32 movedSlotIndex = itemSlots[lastIndex];
+		slots[movedSlotIndex].denseIndex = itemIndex;
+		itemSlots[itemIndex] = movedSlotIndex;
+	}
+	map->items.length--;
+	map->itemSlots.length--;
+	SlotMapReleaseSlot(map, slotIndex, slot);
+	return true;
+}
+
+//Removes every item, all outstanding handles stop resolving. O(number of slots)
+void SlotMapClear(SlotMap_t* map)
+{
+	NotNull(map);
+	VarArrayLoop(&map->itemSlots, iIndex)
+	{
+		u32 slotIndex = *VarArrayGet(&map->itemSlots, iIndex, u32);
+		SlotMapReleaseSlot(map, slotIndex, VarArrayGet(&map->slots, slotIndex, SlotMapSlot_t));
+	}
+	VarArrayClear(&map->items);
+	VarArrayClear(&map->itemSlots);
+}
+
+#endif //  _ORCA_SLOT_MAP_H
+
+// +--------------------------------------------------------------+
+// |                   Autocomplete Dictionary                    |
+// +--------------------------------------------------------------+
+/*
+@Defines
+SLOT_MAP_INDEX_BITS
+SLOT_MAP_GENERATION_BITS
+SLOT_MAP_MAX_SLOTS
+SLOT_MAP_MAX_GENERATION
+SLOT_MAP_INVALID_HANDLE
+SLOT_MAP_FREE_LIST_END
+@Types
+SlotMapSlot_t
+SlotMap_t
+@Functions
+INLINE u32 MakeSlotMapHandle(u32 slotIndex, u32 generation)
+INLINE u32 GetSlotMapHandleIndex(u32 handle)
+INLINE u32 GetSlotMapHandleGeneration(u32 handle)
+void FreeSlotMap(SlotMap_t* map)
+void CreateSlotMap(SlotMap_t* mapOut, OC_Arena_t* arena, u64 itemSize, u64 initialCapacity = 0, u32 itemAlignment = 0)
+#define CreateSlotMapType(mapOutPntr, arena, type, initialCapacity)
+INLINE u32 SlotMapCount(const SlotMap_t* map)
+INLINE void* SlotMapGet(const SlotMap_t* map, u32 handle)
+#define SlotMapGetType(mapPntr, handle, type)
+INLINE bool SlotMapContains(const SlotMap_t* map, u32 handle)
+INLINE void* SlotMapGetItem(const SlotMap_t* map, u32 itemIndex)
+#define SlotMapGetItemType(mapPntr, itemIndex, type)
+#define SlotMapLoop(mapPntr, indexName)
+#define SlotMapLoopReverse(mapPntr, indexName)
+INLINE u32 SlotMapGetHandleAt(const SlotMap_t* map, u32 itemIndex)
+void* SlotMapAdd(SlotMap_t* map, u32* handleOut)
+#define SlotMapAddType(mapPntr, type, handleOutPntr)
+INLINE void SlotMapReleaseSlot(SlotMap_t* map, u32 slotIndex, SlotMapSlot_t* slot)
+bool SlotMapRemove(SlotMap_t* map, u32 handle)
+void SlotMapClear(SlotMap_t* map)
+*/
@@ -0,0 +1,414 @@
+/*
+File:   orca_spatial_grid.h
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Holds SpatialGrid_t, a uniform grid over world space that answers "what is
+	** near here" without looking at every item. Cells are hashed into buckets so
+	** the grid has no bounds and only costs memory for cells that have something
+	** in them. Items live in a SlotMap_t and can be inserted, removed and moved
+	** freely, then the next query rebuilds the buckets with one counting sort into
+	** a single contiguous array (every item is listed once per cell it touches).
+	** For things that all move every frame (particles) it's fine to clear and
+	** re-insert everything each frame. Pick a cell size around the size of a
+	** typical item or query
+*/
+
+#ifndef _ORCA_SPATIAL_GRID_H
+#define _ORCA_SPATIAL_GRID_H
+
+#define SPATIAL_GRID_MIN_BUCKETS 16
+
+struct SpatialGridItem_t
+{
+	rec bounds;
+	u32 value;
+};
+
+//One per cell an item touches, grouped by bucket after a rebuild
+struct SpatialGridEntry_t
+{
+	rec bounds;
+	i32 cellX;
+	i32 cellY;
+	u32 value;
+	u32 handle;
+};
+
+struct SpatialGrid_t
+{
+	OC_Arena_t* arena;
+	r32 cellSize;
+	r32 invCellSize;
+	SlotMap_t items; //SpatialGridItem_t
+	bool isDirty; //items changed since the last rebuild
+
+	//Built by SpatialGridRebuild
+	u32 numBuckets; //power of two
+	VarArray_t bucketStarts; //u32, numBuckets+1 so bucket b is entries [bucketStarts[b], bucketStarts[b+1])
+	VarArray_t entries; //SpatialGridEntry_t
+	v2i minCell; //every entry's cell is within [minCell, maxCell], queries don't look outside of it
+	v2i maxCell;
+};
+
+// +--------------------------------------------------------------+
+// |                       Create and Free                        |
+// +--------------------------------------------------------------+
+//NOTE: Arena memory can't be given back individually, so this just clears the structure
+void FreeSpatialGrid(SpatialGrid_t* grid)
+{
+	NotNull(grid);
+	FreeSlotMap(&grid->items);
+	FreeVarArray(&grid->bucketStarts);
+	FreeVarArray(&grid->entries);
+	ClearPointer(grid);
+}
+void CreateSpatialGrid(SpatialGrid_t* gridOut, OC_Arena_t* arena, r32 cellSize, u32 initialCapacity = 0)
+{
+	NotNull2(gridOut, arena);
+	Assert(cellSize > 0.0f);
+	ClearPointer(gridOut);
+	gridOut->arena = arena;
+	gridOut->cellSize = cellSize;
+	gridOut->invCellSize = 1.0f / cellSize;
+	CreateSlotMapType(&gridOut->items, arena, SpatialGridItem_t, initialCapacity);
+	CreateVarArrayType(&gridOut->bucketStarts, arena, u32, 0);
+	CreateVarArrayType(&gridOut->entries, arena, SpatialGridEntry_t, initialCapacity);
+	gridOut->isDirty = true;
+}
+
+// +--------------------------------------------------------------+
+// |                            Cells                             |
+// +--------------------------------------------------------------+
+//NOTE: World positions divided by the cell size have to fit in an i32
+INLINE i32 SpatialGridGetCell(const SpatialGrid_t* grid, r32 position) { return FloorR32i(position * grid->invCellSize); }
+INLINE u32 SpatialGridHashCell(i32 cellX, i32 cellY, u32 numBuckets)
+{
+	u32 hash = ((u32)cellX * 0x9E3779B1) ^ ((u32)cellY * 0x85EBCA77);
+	return (hash ^ (hash >> 16)) & (numBuckets - 1);
+}
+//The range of cells a rectangle touches, inclusive on both ends
+INLINE void SpatialGridGetCellRange(const SpatialGrid_t* grid, rec bounds, v2i* minOut, v2i* maxOut)
+{
+	*minOut = NewVec2i(SpatialGridGetCell(grid, bounds.x), SpatialGridGetCell(grid, bounds.y));
+	*maxOut = NewVec2i(SpatialGridGetCell(grid, bounds.x + bounds.width), SpatialGridGetCell(grid, bounds.y + bounds.height));
+}
+//Half-open like RecIntersects, except zero size items (points) overlap any query that contains them
+INLINE bool SpatialGridOverlaps(rec bounds, rec query)
+{
+	bool overlapX = (bounds.width > 0.0f) ? (bounds.x < query.x + query.width && query.x < bounds.x + bounds.width) : (bounds.x >= query.x && bounds.x < query.x + query.width);
+	bool overlapY = (bounds.height > 0.0f) ? (bounds.y < query.y + query.height && query.y < bounds.y + bounds.height) : (bounds.y >= query.y && bounds.y < query.y + query.height);
+	return (overlapX && overlapY);
+}
+
+// +--------------------------------------------------------------+
+// |                    Insert, Remove, Move                      |
+// +--------------------------------------------------------------+
+//value is what queries hand back for this item (an entity handle, a particle index, etc.). Returns a handle for SpatialGridRemove/Move
+u32 SpatialGridInsert(SpatialGrid_t* grid, rec bounds, u32 value)
+{
+	NotNull(grid);
+	Assert(bounds.width >= 0.0f && bounds.height >= 0.0f);
+	u32 handle = SLOT_MAP_INVALID_HANDLE;
+	SpatialGridItem_t* item = SlotMapAddType(&grid->items, SpatialGridItem_t, &handle);
+	item->bounds = bounds;
+	item->value = value;
+	grid->isDirty = true;
+	return handle;
+}
+INLINE u32 SpatialGridInsertPoint(SpatialGrid_t* grid, v2 position, u32 value) { return SpatialGridInsert(grid, NewRec(position, 0.0f, 0.0f), value); }
+
+//Returns false if the handle was already removed
+bool SpatialGridRemove(SpatialGrid_t* grid, u32 handle)
+{
+	NotNull(grid);
+	if (!SlotMapRemove(&grid->items, handle)) { return false; }
+	grid->isDirty = true;
+	return true;
+}
+//Returns false if the handle was already removed
+bool SpatialGridMove(SpatialGrid_t* grid, u32 handle, rec newBounds)
+{
+	NotNull(grid);
+	Assert(newBounds.width >= 0.0f && newBounds.height >= 0.0f);
+	SpatialGridItem_t* item = SlotMapGetType(&grid->items, handle, SpatialGridItem_t);
+	if (item == nullptr) { return false; }
+	item->bounds = newBounds;
+	grid->isDirty = true;
+	return true;
+}
+INLINE bool SpatialGridMovePoint(SpatialGrid_t* grid, u32 handle, v2 newPosition) { return SpatialGridMove(grid, handle, NewRec(newPosition, 0.0f, 0.0f)); }
+
+//Removes every item, all handles stop resolving. The memory is kept for the next round of inserts
+void SpatialGridClear(SpatialGrid_t* grid)
+{
+	NotNull(grid);
+	SlotMapClear(&grid->items);
+	grid->isDirty = true;
+}
+
+// +--------------------------------------------------------------+
+// |                           Rebuild                            |
+// +--------------------------------------------------------------+
+//Sizes the bucket table for numBuckets and counts how many entries land in each one, while finding which cells are in use at all. Returns the number of entries
+u64 SpatialGridCountBuckets(SpatialGrid_t* grid, u32 numBuckets)
+{
+	grid->numBuckets = numBuckets;
+	VarArrayExpand(&grid->bucketStarts, numBuckets + 1);
+	grid->bucketStarts.length = numBuckets + 1;
+	u32* bucketCounts = (u32*)grid->bucketStarts.items;
+	memset(bucketCounts, 0x00, sizeof(u32) * (numBuckets + 1));
+
+	const SpatialGridItem_t* items = (const SpatialGridItem_t*)grid->items.items.items;
+	u32 numItems = SlotMapCount(&grid->items);
+	u64 numEntries = 0;
+	v2i usedMin = NewVec2i(INT32_MAX, INT32_MAX);
+	v2i usedMax = NewVec2i(INT32_MIN, INT32_MIN);
+	for (u32 iIndex = 0; iIndex < numItems; iIndex++)
+	{
+		v2i minCell, maxCell;
+		SpatialGridGetCellRange(grid, items[iIndex].bounds, &minCell, &maxCell);
+		usedMin = NewVec2i(MinI32(usedMin.x, minCell.x), MinI32(usedMin.y, minCell.y));
+		usedMax = NewVec2i(MaxI32(usedMax.x, maxCell.x), MaxI32(usedMax.y, maxCell.y));
+		for (i32 cellY = minCell.y; cellY <= maxCell.y; cellY++)
+		{
+			for (i32 cellX = minCell.x; cellX <= maxCell.x; cellX++) { bucketCounts[SpatialGridHashCell(cellX, cellY, numBuckets)]++; }
+		}
+		numEntries += (u64)(maxCell.x - minCell.x + 1) * (u64)(maxCell.y - minCell.y + 1);
+	}
+	grid->minCell = usedMin;
+	grid->maxCell = usedMax;
+	return numEntries;
+}
+
+//Counting sort of (item, cell) pairs into buckets. Queries call this when anything has changed, so it only needs calling directly to control when the cost is paid
+void SpatialGridRebuild(SpatialGrid_t* grid)
+{
+	NotNull(grid);
+	u32 numItems = SlotMapCount(&grid->items);
+
+	//Most items only touch a cell or two, so guess the table size from the item count and count with that. Items that turn out
+	//to cover a lot more cells than that would crowd the buckets, so then the table is sized off the real count and counted again
+	u64 numEntries = SpatialGridCountBuckets(grid, Max<u32>(NextPowerOfTwoU32(numItems), SPATIAL_GRID_MIN_BUCKETS));
+	AssertMsg(numEntries <= UINT32_MAX / 2, "SpatialGrid_t items cover too many cells, the cell size is probably too small");
+	if (numEntries > (u64)grid->numBuckets * 2) { SpatialGridCountBuckets(grid, NextPowerOfTwoU32((u32)numEntries)); }
+
+	//Turn the counts into end offsets, then fill every bucket from its end down so the offsets finish on the starts
+	u32* bucketStarts = (u32*)grid->bucketStarts.items;
+	u32 offset = 0;
+	for (u32 bIndex = 0; bIndex <= grid->numBuckets; bIndex++)
+	{
+		offset += bucketStarts[bIndex];
+		bucketStarts[bIndex] = offset;
+	}
+	VarArrayExpand(&grid->entries, numEntries);
+	grid->entries.length = numEntries;
+	SpatialGridEntry_t* entries = (SpatialGridEntry_t*)grid->entries.items;
+	const SpatialGridItem_t* items = (const SpatialGridItem_t*)grid->items.items.items;
+	const u32* itemSlots = (const u32*)grid->items.itemSlots.items;
+	const SlotMapSlot_t* slots = (const SlotMapSlot_t*)grid->items.slots.items;
+	for (u32 iIndex = 0; iIndex < numItems; iIndex++)
+	{
+		const SpatialGridItem_t* item = &items[iIndex];
+		u32 handle = MakeSlotMapHandle(itemSlots[iIndex], slots[itemSlots[iIndex]].generation);
+		v2i minCell, maxCell;
+		SpatialGridGetCellRange(grid, item->bounds, &minCell, &maxCell);
+		for (i32 cellY = minCell.y; cellY <= maxCell.y; cellY++)
+		{
+			for (i32 cellX = minCell.x; cellX <= maxCell.x; cellX++)
+			{
+				SpatialGridEntry_t* entry = &entries[--bucketStarts[SpatialGridHashCell(cellX, cellY, grid->numBuckets)]];
+				entry->bounds = item->bounds;
+				entry->cellX = cellX;
+				entry->cellY = cellY;
+				entry->value = item->value;
+				entry->handle = handle;
+			}
+		}
+	}
+	grid->isDirty = false;
+}
+
+// +--------------------------------------------------------------+
+// |                           Queries                            |
+// +--------------------------------------------------------------+
+INLINE void SpatialGridGetBucket(const SpatialGrid_t* grid, i32 cellX, i32 cellY, const SpatialGridEntry_t** entriesOut, const SpatialGridEntry_t** entriesEndOut)
+{
+	const u32* bucketStarts = (const u32*)grid->bucketStarts.items;
+	u32 bucket = SpatialGridHashCell(cellX, cellY, grid->numBuckets);
+	*entriesOut = (const SpatialGridEntry_t*)grid->entries.items + bucketStarts[bucket];
+	*entriesEndOut = (const SpatialGridEntry_t*)grid->entries.items + bucketStarts[bucket + 1];
+}
+
+//Finds every item that overlaps query (see SpatialGridOverlaps), each one once. Returns how many there are, but only writes the first maxValues
+u32 SpatialGridQueryRec(SpatialGrid_t* grid, rec query, u32* valuesOut, u32 maxValues)
+{
+	NotNull(grid);
+	Assert(valuesOut != nullptr || maxValues == 0);
+	if (grid->isDirty) { SpatialGridRebuild(grid); }
+	v2i queryMin, queryMax;
+	SpatialGridGetCellRange(grid, query, &queryMin, &queryMax);
+	i32 minX = MaxI32(queryMin.x, grid->minCell.x), maxX = MinI32(queryMax.x, grid->maxCell.x);
+	i32 minY = MaxI32(queryMin.y, grid->minCell.y), maxY = MinI32(queryMax.y, grid->maxCell.y);
+	u32 numFound = 0;
+	for (i32 cellY = minY; cellY <= maxY; cellY++)
+	{
+		for (i32 cellX = minX; cellX <= maxX; cellX++)
+		{
+			const SpatialGridEntry_t* entry;
+			const SpatialGridEntry_t* entriesEnd;
+			SpatialGridGetBucket(grid, cellX, cellY, &entry, &entriesEnd);
+			for (; entry < entriesEnd; entry++)
+			{
+				//Skip other cells that hashed to this bucket, and only report an item from the first cell that both it and the query cover
+				if (entry->cellX != cellX || entry->cellY != cellY) { continue; }
+				if (cellX != MaxI32(SpatialGridGetCell(grid, entry->bounds.x), queryMin.x) || cellY != MaxI32(SpatialGridGetCell(grid, entry->bounds.y), queryMin.y)) { continue; }
+				if (!SpatialGridOverlaps(entry->bounds, query)) { continue; }
+				if (numFound < maxValues) { valuesOut[numFound] = entry->value; }
+				numFound++;
+			}
+		}
+	}
+	return numFound;
+}
+
+//Finds every item whose bounds contain the point (see RecContains). Returns how many there are, but only writes the first maxValues
+u32 SpatialGridQueryPoint(SpatialGrid_t* grid, v2 point, u32* valuesOut, u32 maxValues)
+{
+	NotNull(grid);
+	Assert(valuesOut != nullptr || maxValues == 0);
+	if (grid->isDirty) { SpatialGridRebuild(grid); }
+	i32 cellX = SpatialGridGetCell(grid, point.x);
+	i32 cellY = SpatialGridGetCell(grid, point.y);
+	u32 numFound = 0;
+	const SpatialGridEntry_t* entry;
+	const SpatialGridEntry_t* entriesEnd;
+	SpatialGridGetBucket(grid, cellX, cellY, &entry, &entriesEnd);
+	for (; entry < entriesEnd; entry++)
+	{
+		if (entry->cellX != cellX || entry->cellY != cellY || !RecContains(entry->bounds, point)) { continue; }
+		if (numFound < maxValues) { valuesOut[numFound] = entry->value; }
+		numFound++;
+	}
+	return numFound;
+}
+
+//Checks one cell's items against the k best so far (kept sorted nearest first), used by SpatialGridFindNearest
+INLINE void SpatialGridNearestVisitCell(const SpatialGrid_t* grid, v2 point, i32 cellX, i32 cellY, u32 k, u32* values, r32* distSquareds, u32* numFoundPntr, r32 maxDistSquared)
+{
+	const SpatialGridEntry_t* entry;
+	const SpatialGridEntry_t* entriesEnd;
+	SpatialGridGetBucket(grid, cellX, cellY, &entry, &entriesEnd);
+	for (; entry < entriesEnd; entry++)
+	{
+		if (entry->cellX != cellX || entry->cellY != cellY) { continue; }
+		//Only consider an item from the cell that holds its closest point, so items covering many cells are only counted once
+		v2 closest = NewVec2(ClampR32(point.x, entry->bounds.x, entry->bounds.x + entry->bounds.width), ClampR32(point.y, entry->bounds.y, entry->bounds.y + entry->bounds.height));
+		if (SpatialGridGetCell(grid, closest.x) != cellX || SpatialGridGetCell(grid, closest.y) != cellY) { continue; }
+		r32 distSquared = ((closest.x - point.x) * (closest.x - point.x)) + ((closest.y - point.y) * (closest.y - point.y));
+		if ((maxDistSquared >= 0.0f && distSquared > maxDistSquared) || (*numFoundPntr == k && distSquared >= distSquareds[k-1])) { continue; }
+		//Insert in sorted order, pushing the furthest one off the end when full
+		u32 insertIndex = (*numFoundPntr < k) ? (*numFoundPntr)++ : k-1;
+		while (insertIndex > 0 && distSquareds[insertIndex-1] > distSquared)
+		{
+			distSquareds[insertIndex] = distSquareds[insertIndex-1];
+			values[insertIndex] = values[insertIndex-1];
+			insertIndex--;
+		}
+		distSquareds[insertIndex] = distSquared;
+		values[insertIndex] = entry->value;
+	}
+}
+
+//Finds up to k items closest to point (distance to the nearest point of their bounds, 0 if inside), nearest first. A negative maxDistance means no limit.
+//Searches outwards one ring of cells at a time, starting at the first ring that reaches a used cell, and stops once no unvisited cell could hold anything closer. Returns how many were found
+u32 SpatialGridFindNearest(SpatialGrid_t* grid, v2 point, u32 k, u32* valuesOut, r32* distancesOut = nullptr, r32 maxDistance = -1.0f)
+{
+	NotNull(grid);
+	Assert(k == 0 || valuesOut != nullptr);
+	if (grid->isDirty) { SpatialGridRebuild(grid); }
+	if (k == 0 || SlotMapCount(&grid->items) == 0) { return 0; }
+
+	OC_ArenaScope_t scratch = OC_ScratchBegin();
+	r32* distSquareds = OC_ArenaPushArray(scratch.arena, r32, k);
+	NotNull(distSquareds);
+	r32 maxDistSquared = (maxDistance >= 0.0f) ? (maxDistance * maxDistance) : -1.0f; //negative means no limit
+	u32 numFound = 0;
+	i32 centerX = SpatialGridGetCell(grid, point.x);
+	i32 centerY = SpatialGridGetCell(grid, point.y);
+	//Rings closer than the nearest used cell are empty and rings past the furthest one can't hold anything,
+	//so only walk the rings that cross [minCell, maxCell]. A query far outside the grid starts right at its edge
+	//NOTE: Done in i64 since the distance between two i32 cells doesn't always fit in an i32
+	i64 nearX = Max<i64>(Max<i64>((i64)grid->minCell.x - centerX, (i64)centerX - grid->maxCell.x), 0);
+	i64 nearY = Max<i64>(Max<i64>((i64)grid->minCell.y - centerY, (i64)centerY - grid->maxCell.y), 0);
+	i64 farX = Max<i64>(AbsI64((i64)grid->minCell.x - centerX), AbsI64((i64)grid->maxCell.x - centerX));
+	i64 farY = Max<i64>(AbsI64((i64)grid->minCell.y - centerY), AbsI64((i64)grid->maxCell.y - centerY));
+	i64 firstRing = Max<i64>(nearX, nearY);
+	i64 lastRing = Max<i64>(farX, farY);
+	for (i64 ring = firstRing; ring <= lastRing; ring++)
+	{
+		if (ring > 0)
+		{
+			//Anything not found yet has its closest point in this ring or further out, so it's at least (ring-1) cells away
+			r32 ringDistance = (r32)(ring - 1) * grid->cellSize;
+			if (maxDistSquared >= 0.0f && ringDistance * ringDistance > maxDistSquared) { break; }
+			if (numFound == k && distSquareds[k-1] <= ringDistance * ringDistance) { break; }
+		}
+
+		i32 minX = (i32)Max<i64>(centerX - ring, grid->minCell.x), maxX = (i32)Min<i64>(centerX + ring, grid->maxCell.x);
+		i32 minY = (i32)Max<i64>(centerY - ring, grid->minCell.y), maxY = (i32)Min<i64>(centerY + ring, grid->maxCell.y);
+		for (i32 cellY = minY; cellY <= maxY; cellY++)
+		{
+			if (cellY == centerY - ring || cellY == centerY + ring)
+			{
+				for (i32 cellX = minX; cellX <= maxX; cellX++) { SpatialGridNearestVisitCell(grid, point, cellX, cellY, k, valuesOut, distSquareds, &numFound, maxDistSquared); }
+			}
+			else
+			{
+				//Rows in the middle of the ring only have their two end cells on it
+				if (centerX - ring >= minX) { SpatialGridNearestVisitCell(grid, point, (i32)(centerX - ring), cellY, k, valuesOut, distSquareds, &numFound, maxDistSquared); }
+				if (centerX + ring <= maxX) { SpatialGridNearestVisitCell(grid, point, (i32)(centerX + ring), cellY, k, valuesOut, distSquareds, &numFound, maxDistSquared); }
+			}
+		}
+	}
+	if (distancesOut != nullptr)
+	{
+		for (u32 rIndex = 0; rIndex < numFound; rIndex++) { distancesOut[rIndex] = SqrtR32(distSquareds[rIndex]); }
+	}
+	OC_ScratchEnd(scratch);
+	return numFound;
+}
+
+#endif //  _ORCA_SPATIAL_GRID_H
+
+// +--------------------------------------------------------------+
+// |                   Autocomplete Dictionary                    |
+// +--------------------------------------------------------------+
+/*
+@Defines
+SPATIAL_GRID_MIN_BUCKETS
+@Types
+SpatialGridItem_t
+SpatialGridEntry_t
+SpatialGrid_t
+@Functions
+void FreeSpatialGrid(SpatialGrid_t* grid)
+void CreateSpatialGrid(SpatialGrid_t* gridOut, OC_Arena_t* arena, r32 cellSize, u32 initialCapacity = 0)
+INLINE i32 SpatialGridGetCell(const SpatialGrid_t* grid, r32 position)
+INLINE u32 SpatialGridHashCell(i32 cellX, i32 cellY, u32 numBuckets)
+INLINE void SpatialGridGetCellRange(const SpatialGrid_t* grid, rec bounds, v2i* minOut, v2i* maxOut)
+INLINE bool SpatialGridOverlaps(rec bounds, rec query)
+u32 SpatialGridInsert(SpatialGrid_t* grid, rec bounds, u32 value)
+INLINE u32 SpatialGridInsertPoint(SpatialGrid_t* grid, v2 position, u32 value)
+bool SpatialGridRemove(SpatialGrid_t* grid, u32 handle)
+bool SpatialGridMove(SpatialGrid_t* grid, u32 handle, rec newBounds)
+INLINE bool SpatialGridMovePoint(SpatialGrid_t* grid, u32 handle, v2 newPosition)
+void SpatialGridClear(SpatialGrid_t* grid)
+u64 SpatialGridCountBuckets(SpatialGrid_t* grid, u32 numBuckets)
+void SpatialGridRebuild(SpatialGrid_t* grid)
+INLINE void SpatialGridGetBucket(const SpatialGrid_t* grid, i32 cellX, i32 cellY, const SpatialGridEntry_t** entriesOut, const SpatialGridEntry_t** entriesEndOut)
+u32 SpatialGridQueryRec(SpatialGrid_t* grid, rec query, u32* valuesOut, u32 maxValues)
+u32 SpatialGridQueryPoint(SpatialGrid_t* grid, v2 point, u32* valuesOut, u32 maxValues)
+INLINE void SpatialGridNearestVisitCell(const SpatialGrid_t* grid, v2 point, i32 cellX, i32 cellY, u32 k, u32* values, r32* distSquareds, u32* numFoundPntr, r32 maxDistSquared)
+u32 SpatialGridFindNearest(SpatialGrid_t* grid, v2 point, u32 k, u32* valuesOut, r32* distancesOut = nullptr, r32 maxDistance = -1.0f)
+*/
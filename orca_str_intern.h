@@ -0,0 +1,104 @@
+/*
+File:   orca_str_intern.h
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Holds StrInternPool_t, which hands out a dense u32 id for every distinct
+	** MyStr_t it is given. The bytes of each string are stored exactly once in the
+	** pool's arena and can be looked up again by id, so names that get compared
+	** over and over (asset paths, style classes, event names) can be interned once
+	** and then compared as integers or used as u32 keys in a HashMap_t
+*/
+
+#ifndef _ORCA_STR_INTERN_H
+#define _ORCA_STR_INTERN_H
+
+#define STR_INTERN_INVALID_ID 0 //never handed out, so a zeroed id means "no string"
+
+struct StrInternPool_t
+{
+	OC_Arena_t* arena;
+	HashMap_t lookup; //MyStr_t -> u32 id
+	VarArray_t strs; //MyStr_t for each id, pointing at the copy the lookup made in the arena
+	u64 numBytes; //total length of all interned strings
+};
+
+// +--------------------------------------------------------------+
+// |                       Create and Free                        |
+// +--------------------------------------------------------------+
+//NOTE: Arena memory can't be given back individually, so this just clears the structure
+void FreeStrInternPool(StrInternPool_t* pool)
+{
+	NotNull(pool);
+	FreeHashMap(&pool->lookup);
+	FreeVarArray(&pool->strs);
+	ClearPointer(pool);
+}
+void CreateStrInternPool(StrInternPool_t* poolOut, OC_Arena_t* arena, u32 initialCapacity = 0)
+{
+	NotNull2(poolOut, arena);
+	ClearPointer(poolOut);
+	poolOut->arena = arena;
+	CreateHashMapType(&poolOut->lookup, arena, HashMapKeyType_Str, u32, initialCapacity);
+	CreateVarArrayType(&poolOut->strs, arena, MyStr_t, initialCapacity + 1);
+	//Slot 0 is STR_INTERN_INVALID_ID, looking it up gives back an empty string
+	*VarArrayPush(&poolOut->strs, MyStr_t) = NewStr(0, nullptr);
+}
+
+// +--------------------------------------------------------------+
+// |                       Intern and Lookup                      |
+// +--------------------------------------------------------------+
+//Returns the id for str, adding it to the pool if it hasn't been seen before. The caller's string doesn't need to stay alive
+//The empty string is always STR_INTERN_INVALID_ID, so StrInternGet of that id and interning "" agree with each other
+u32 StrIntern(StrInternPool_t* pool, MyStr_t str)
+{
+	NotNull(pool);
+	if (str.length == 0) { return STR_INTERN_INVALID_ID; }
+	bool isNew = false;
+	u32* idPntr = (u32*)HashMapAddStr(&pool->lookup, str, &isNew);
+	if (isNew)
+	{
+		Assert(pool->strs.length < UINT32_MAX);
+		*idPntr = (u32)pool->strs.length;
+		*VarArrayPush(&pool->strs, MyStr_t) = HashMapGetEntryForValue(&pool->lookup, idPntr)->strKey;
+		pool->numBytes += str.length;
+	}
+	return *idPntr;
+}
+//Returns STR_INTERN_INVALID_ID if str was never interned. Never adds anything
+INLINE u32 StrInternFind(const StrInternPool_t* pool, MyStr_t str)
+{
+	if (str.length == 0) { return STR_INTERN_INVALID_ID; }
+	const u32* idPntr = (const u32*)HashMapGetStr(&pool->lookup, str);
+	return (idPntr != nullptr) ? *idPntr : STR_INTERN_INVALID_ID;
+}
+//The returned string stays valid as long as the arena does
+INLINE MyStr_t StrInternGet(const StrInternPool_t* pool, u32 id)
+{
+	DebugAssert(id < pool->strs.length);
+	return *VarArrayGet(&pool->strs, id, MyStr_t);
+}
+//Number of distinct strings that have been interned (the highest valid id)
+INLINE u32 StrInternCount(const StrInternPool_t* pool)
+{
+	return (u32)(pool->strs.length - 1);
+}
+
+#endif //  _ORCA_STR_INTERN_H
+
+// +--------------------------------------------------------------+
+// |                   Autocomplete Dictionary                    |
+// +--------------------------------------------------------------+
+/*
+@Defines
+STR_INTERN_INVALID_ID
+@Types
+StrInternPool_t
+@Functions
+void FreeStrInternPool(StrInternPool_t* pool)
+void CreateStrInternPool(StrInternPool_t* poolOut, OC_Arena_t* arena, u32 initialCapacity = 0)
+u32 StrIntern(StrInternPool_t* pool, MyStr_t str)
+INLINE u32 StrInternFind(const StrInternPool_t* pool, MyStr_t str)
+INLINE MyStr_t StrInternGet(const StrInternPool_t* pool, u32 id)
+INLINE u32 StrInternCount(const StrInternPool_t* pool)
+*/
@@ -0,0 +1,335 @@
+/*
+File:   orca_unicode.h
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Holds functions that convert between UTF-8 (MyStr_t) and UTF-32 (oc_str32)
+	** so text can be handed to OC_FontTextMetricsUtr32, OC_CodepointsOutlines,
+	** OC_FontPushGlyphIndices, etc. Both directions validate their input and stop
+	** at the first invalid sequence, reporting where it was. When SIMD is available
+	** runs of ASCII characters are converted 16 at a time without decoding each one
+*/
+
+#ifndef _ORCA_UNICODE_H
+#define _ORCA_UNICODE_H
+
+#define UTF8_MAX_CHAR_SIZE    4
+#define UNICODE_MAX_CODEPOINT 0x10FFFF
+
+// +--------------------------------------------------------------+
+// |                      Single Codepoints                       |
+// +--------------------------------------------------------------+
+INLINE bool IsUtf8ContinuationByte(u8 byte)
+{
+	return ((byte & 0xC0) == 0x80);
+}
+INLINE bool IsValidCodepoint(u32 codepoint)
+{
+	return (codepoint <= UNICODE_MAX_CODEPOINT && (codepoint < 0xD800 || codepoint > 0xDFFF));
+}
+
+//Returns how many bytes the codepoint took (1-4), or 0 if the bytes don't start with a valid UTF-8 sequence
+//(stray continuation byte, overlong encoding, surrogate, past U+10FFFF, or cut off by maxNumBytes)
+u8 GetCodepointForUtf8(u32 maxNumBytes, const u8* bytes, u32* codepointOut)
+{
+	if (maxNumBytes == 0) { return 0; }
+	u8 byte0 = bytes[0];
+	if (byte0 < 0x80)
+	{
+		*codepointOut = byte0;
+		return 1;
+	}
+	else if (byte0 < 0xC2) { return 0; } //continuation byte, or 0xC0/0xC1 which can only start an overlong encoding
+	else if (byte0 < 0xE0)
+	{
+		if (maxNumBytes < 2 || !IsUtf8ContinuationByte(bytes[1])) { return 0; }
+		*codepointOut = ((u32)(byte0 & 0x1F) << 6) | (u32)(bytes[1] & 0x3F);
+		return 2;
+	}
+	else if (byte0 < 0xF0)
+	{
+		if (maxNumBytes < 3 || !IsUtf8ContinuationByte(bytes[1]) || !IsUtf8ContinuationByte(bytes[2])) { return 0; }
+		u32 codepoint = ((u32)(byte0 & 0x0F) << 12) | ((u32)(bytes[1] & 0x3F) << 6) | (u32)(bytes[2] & 0x3F);
+		if (codepoint < 0x800 || !IsValidCodepoint(codepoint)) { return 0; }
+		*codepointOut = codepoint;
+		return 3;
+	}
+	else if (byte0 < 0xF5)
+	{
+		if (maxNumBytes < 4 || !IsUtf8ContinuationByte(bytes[1]) || !IsUtf8ContinuationByte(bytes[2]) || !IsUtf8ContinuationByte(bytes[3])) { return 0; }
+		u32 codepoint = ((u32)(byte0 & 0x07) << 18) | ((u32)(bytes[1] & 0x3F) << 12) | ((u32)(bytes[2] & 0x3F) << 6) | (u32)(bytes[3] & 0x3F);
+		if (codepoint < 0x10000 || codepoint > UNICODE_MAX_CODEPOINT) { return 0; }
+		*codepointOut = codepoint;
+		return 4;
+	}
+	return 0;
+}
+
+//Returns how many bytes the UTF-8 encoding takes (1-4), or 0 if the codepoint is a surrogate or past U+10FFFF
+INLINE u8 GetUtf8SizeForCodepoint(u32 codepoint)
+{
+	if (codepoint < 0x80) { return 1; }
+	if (codepoint < 0x800) { return 2; }
+	if (!IsValidCodepoint(codepoint)) { return 0; }
+	return (codepoint < 0x10000) ? 3 : 4;
+}
+//bytesOut needs room for UTF8_MAX_CHAR_SIZE. Returns the number of bytes written, 0 if the codepoint can't be encoded
+u8 GetUtf8BytesForCodepoint(u32 codepoint, u8* bytesOut)
+{
+	u8 size = GetUtf8SizeForCodepoint(codepoint);
+	switch (size)
+	{
+		case 1: bytesOut[0] = (u8)codepoint; break;
+		case 2:
+		{
+			bytesOut[0] = (u8)(0xC0 | (codepoint >> 6));
+			bytesOut[1] = (u8)(0x80 | (codepoint & 0x3F));
+		} break;
+		case 3:
+		{
+			bytesOut[0] = (u8)(0xE0 | (codepoint >> 12));
+			bytesOut[1] = (u8)(0x80 | ((codepoint >> 6) & 0x3F));
+			bytesOut[2] = (u8)(0x80 | (codepoint & 0x3F));
+		} break;
+		case 4:
+		{
+			bytesOut[0] = (u8)(0xF0 | (codepoint >> 18));
+			bytesOut[1] = (u8)(0x80 | ((codepoint >> 12) & 0x3F));
+			bytesOut[2] = (u8)(0x80 | ((codepoint >> 6) & 0x3F));
+			bytesOut[3] = (u8)(0x80 | (codepoint & 0x3F));
+		} break;
+	}
+	return size;
+}
+
+// +--------------------------------------------------------------+
+// |                        UTF-8 to UTF-32                       |
+// +--------------------------------------------------------------+
+//Decodes str into codepointsOut, which can be nullptr to just count. str.length codepoints is always enough room.
+//Returns false at the first invalid sequence with its byte index in errorIndexOut (numCodepointsOut is how many came before it).
+//Also returns false, with ranOutOfRoomOut set, if codepointsOut fills up: numCodepointsOut codepoints were written and
+//errorIndexOut is the byte index of the first one that didn't fit. Nothing is ever written past maxNumCodepoints
+bool ConvertUtf8ToUtf32(MyStr_t str, u32* codepointsOut, u32 maxNumCodepoints, u32* numCodepointsOut, u32* errorIndexOut = nullptr, bool* ranOutOfRoomOut = nullptr)
+{
+	Assert(str.bytes != nullptr || str.length == 0);
+	SetOptionalOutPntr(ranOutOfRoomOut, false);
+	u32 numCodepoints = 0;
+	u32 bIndex = 0;
+	while (bIndex < str.length)
+	{
+		#if ORCA_SIMD_ENABLED
+		//Take whatever ASCII run starts here 16 bytes at a time. A partial run still gets all 16 lanes widened and stored
+		//(when there's room) but only the ASCII ones are counted, the rest get overwritten below
+		if (bIndex + sizeof(simd4i) <= str.length)
+		{
+			simd4i block = Simd4iLoad(&str.bytes[bIndex]);
+			u32 nonAsciiBits = Simd4iMoveMaskU8(block);
+			u32 numAscii = (nonAsciiBits != 0) ? CountTrailingZerosU32(nonAsciiBits) : (u32)sizeof(simd4i);
+			if (numAscii > 0)
+			{
+				if (codepointsOut != nullptr)
+				{
+					if (numCodepoints + sizeof(simd4i) <= maxNumCodepoints)
+					{
+						//Sign extension is fine for the lanes we keep since they all have their top bit clear
+						simd4i lowHalf = Simd4iExtendLowI8(block);
+						simd4i highHalf = Simd4iExtendHighI8(block);
+						Simd4iStore(&codepointsOut[numCodepoints + 0],  Simd4iExtendLowI16(lowHalf));
+						Simd4iStore(&codepointsOut[numCodepoints + 4],  Simd4iExtendHighI16(lowHalf));
+						Simd4iStore(&codepointsOut[numCodepoints + 8],  Simd4iExtendLowI16(highHalf));
+						Simd4iStore(&codepointsOut[numCodepoints + 12], Simd4iExtendHighI16(highHalf));
+					}
+					else
+					{
+						u32 numFit = MinU32(numAscii, maxNumCodepoints - numCodepoints);
+						for (u32 aIndex = 0; aIndex < numFit; aIndex++) { codepointsOut[numCodepoints + aIndex] = str.bytes[bIndex + aIndex]; }
+						if (numFit < numAscii)
+						{
+							SetOptionalOutPntr(numCodepointsOut, numCodepoints + numFit);
+							SetOptionalOutPntr(errorIndexOut, bIndex + numFit);
+							SetOptionalOutPntr(ranOutOfRoomOut, true);
+							return false;
+						}
+					}
+				}
+				numCodepoints += numAscii;
+				bIndex += numAscii;
+				if (numAscii == sizeof(simd4i)) { continue; }
+			}
+		}
+		#endif
+
+		//Decode one at a time until we get back to an ASCII byte, so text with no ASCII in it doesn't retry the fast path on every character
+		do
+		{
+			u32 codepoint = 0;
+			u8 charSize = GetCodepointForUtf8(str.length - bIndex, &str.bytes[bIndex], &codepoint);
+			if (charSize == 0)
+			{
+				SetOptionalOutPntr(numCodepointsOut, numCodepoints);
+				SetOptionalOutPntr(errorIndexOut, bIndex);
+				return false;
+			}
+			if (codepointsOut != nullptr)
+			{
+				if (numCodepoints >= maxNumCodepoints)
+				{
+					SetOptionalOutPntr(numCodepointsOut, numCodepoints);
+					SetOptionalOutPntr(errorIndexOut, bIndex);
+					SetOptionalOutPntr(ranOutOfRoomOut, true);
+					return false;
+				}
+				codepointsOut[numCodepoints] = codepoint;
+			}
+			numCodepoints++;
+			bIndex += charSize;
+		} while (bIndex < str.length && str.bytes[bIndex] >= 0x80);
+	}
+	SetOptionalOutPntr(numCodepointsOut, numCodepoints);
+	return true;
+}
+
+//Validates and counts before pushing anything, so invalid UTF-8 leaves the arena untouched and valid text gets exactly
+//as many codepoints as it needs. Returns an empty oc_str32 (with errorIndexOut set) if str isn't valid UTF-8
+oc_str32 PushUtf8ToUtf32(OC_Arena_t* arena, MyStr_t str, u32* errorIndexOut = nullptr)
+{
+	NotNull(arena);
+	oc_str32 result = {};
+	if (str.length == 0) { return result; }
+	u32 numCodepoints = 0;
+	if (!ConvertUtf8ToUtf32(str, nullptr, 0, &numCodepoints, errorIndexOut)) { return result; }
+	u32* codepoints = OC_ArenaPushArray(arena, u32, numCodepoints);
+	NotNull(codepoints);
+	bool converted = ConvertUtf8ToUtf32(str, codepoints, numCodepoints, &numCodepoints);
+	DebugAssertAndUnused(converted, converted);
+	result.ptr = codepoints;
+	result.len = numCodepoints;
+	return result;
+}
+
+// +--------------------------------------------------------------+
+// |                        UTF-32 to UTF-8                       |
+// +--------------------------------------------------------------+
+//Encodes codepoints into bytesOut, which can be nullptr to just measure. numCodepoints * UTF8_MAX_CHAR_SIZE is always enough room.
+//Returns false at the first codepoint that can't be encoded with its index in errorIndexOut (numBytesOut is how many bytes came before it).
+//Also returns false, with ranOutOfRoomOut set, if bytesOut fills up: numBytesOut bytes (whole characters only) were written and
+//errorIndexOut is the index of the first codepoint that didn't fit. Nothing is ever written past maxNumBytes
+bool ConvertUtf32ToUtf8(const u32* codepoints, u32 numCodepoints, char* bytesOut, u32 maxNumBytes, u32* numBytesOut, u32* errorIndexOut = nullptr, bool* ranOutOfRoomOut = nullptr)
+{
+	Assert(codepoints != nullptr || numCodepoints == 0);
+	SetOptionalOutPntr(ranOutOfRoomOut, false);
+	#if ORCA_SIMD_ENABLED
+	simd4i zeroBlock = Simd4iFill(0);
+	#endif
+	u32 numBytes = 0;
+	u32 cIndex = 0;
+	while (cIndex < numCodepoints)
+	{
+		#if ORCA_SIMD_ENABLED
+		//Same idea as ConvertUtf8ToUtf32, take the ASCII run that starts here 16 codepoints at a time
+		if (cIndex + sizeof(simd4i) <= numCodepoints)
+		{
+			simd4i block0 = Simd4iLoad(&codepoints[cIndex + 0]);
+			simd4i block1 = Simd4iLoad(&codepoints[cIndex + 4]);
+			simd4i block2 = Simd4iLoad(&codepoints[cIndex + 8]);
+			simd4i block3 = Simd4iLoad(&codepoints[cIndex + 12]);
+			u32 asciiBits = Simd4iMoveMask(Simd4iEqual(Simd4iShiftRight(block0, 7), zeroBlock))
+				| (Simd4iMoveMask(Simd4iEqual(Simd4iShiftRight(block1, 7), zeroBlock)) << 4)
+				| (Simd4iMoveMask(Simd4iEqual(Simd4iShiftRight(block2, 7), zeroBlock)) << 8)
+				| (Simd4iMoveMask(Simd4iEqual(Simd4iShiftRight(block3, 7), zeroBlock)) << 12);
+			u32 numAscii = (asciiBits != 0xFFFF) ? CountTrailingZerosU32(~asciiBits) : (u32)sizeof(simd4i);
+			if (numAscii > 0)
+			{
+				if (bytesOut != nullptr)
+				{
+					if (numBytes + sizeof(simd4i) <= maxNumBytes)
+					{
+						//The packs saturate as signed values, which only changes lanes past the ASCII run (and those get overwritten)
+						Simd4iStore(&bytesOut[numBytes], Simd4iPackI16ToI8(Simd4iPackI32ToI16(block0, block1), Simd4iPackI32ToI16(block2, block3)));
+					}
+					else
+					{
+						u32 numFit = MinU32(numAscii, maxNumBytes - numBytes);
+						for (u32 aIndex = 0; aIndex < numFit; aIndex++) { bytesOut[numBytes + aIndex] = (char)codepoints[cIndex + aIndex]; }
+						if (numFit < numAscii)
+						{
+							SetOptionalOutPntr(numBytesOut, numBytes + numFit);
+							SetOptionalOutPntr(errorIndexOut, cIndex + numFit);
+							SetOptionalOutPntr(ranOutOfRoomOut, true);
+							return false;
+						}
+					}
+				}
+				numBytes += numAscii;
+				cIndex += numAscii;
+				if (numAscii == sizeof(simd4i)) { continue; }
+			}
+		}
+		#endif
+
+		do
+		{
+			//Encode straight into bytesOut while there's room for any size of character, only the last few bytes go through encoded
+			u8 encoded[UTF8_MAX_CHAR_SIZE];
+			bool direct = (bytesOut != nullptr && maxNumBytes - numBytes >= UTF8_MAX_CHAR_SIZE);
+			u8 charSize = GetUtf8BytesForCodepoint(codepoints[cIndex], direct ? (u8*)&bytesOut[numBytes] : &encoded[0]);
+			if (charSize == 0)
+			{
+				SetOptionalOutPntr(numBytesOut, numBytes);
+				SetOptionalOutPntr(errorIndexOut, cIndex);
+				return false;
+			}
+			if (bytesOut != nullptr && !direct)
+			{
+				if (numBytes + charSize > maxNumBytes)
+				{
+					SetOptionalOutPntr(numBytesOut, numBytes);
+					SetOptionalOutPntr(errorIndexOut, cIndex);
+					SetOptionalOutPntr(ranOutOfRoomOut, true);
+					return false;
+				}
+				memcpy(&bytesOut[numBytes], &encoded[0], charSize);
+			}
+			numBytes += charSize;
+			cIndex++;
+		} while (cIndex < numCodepoints && codepoints[cIndex] >= 0x80);
+	}
+	SetOptionalOutPntr(numBytesOut, numBytes);
+	return true;
+}
+
+//Measures first so the result is exactly the right size. The result is null-terminated (not counted in length).
+//Returns an empty string (and pushes nothing) if any codepoint can't be encoded
+MyStr_t PushUtf32ToUtf8(OC_Arena_t* arena, oc_str32 codepoints, u32* errorIndexOut = nullptr)
+{
+	NotNull(arena);
+	Assert(codepoints.len <= UINT32_MAX);
+	u32 numBytes = 0;
+	if (!ConvertUtf32ToUtf8(codepoints.ptr, (u32)codepoints.len, nullptr, 0, &numBytes, errorIndexOut)) { return NewStr(0, nullptr); }
+	char* bytes = (char*)OC_ArenaPush(arena, numBytes + 1);
+	NotNull(bytes);
+	ConvertUtf32ToUtf8(codepoints.ptr, (u32)codepoints.len, bytes, numBytes, nullptr);
+	bytes[numBytes] = '\0';
+	return NewStr(numBytes, bytes);
+}
+
+#endif //  _ORCA_UNICODE_H
+
+// +--------------------------------------------------------------+
+// |                   Autocomplete Dictionary                    |
+// +--------------------------------------------------------------+
+/*
+@Defines
+UTF8_MAX_CHAR_SIZE
+UNICODE_MAX_CODEPOINT
+@Functions
+INLINE bool IsUtf8ContinuationByte(u8 byte)
+INLINE bool IsValidCodepoint(u32 codepoint)
+u8 GetCodepointForUtf8(u32 maxNumBytes, const u8* bytes, u32* codepointOut)
+INLINE u8 GetUtf8SizeForCodepoint(u32 codepoint)
+u8 GetUtf8BytesForCodepoint(u32 codepoint, u8* bytesOut)
+bool ConvertUtf8ToUtf32(MyStr_t str, u32* codepointsOut, u32 maxNumCodepoints, u32* numCodepointsOut, u32* errorIndexOut = nullptr, bool* ranOutOfRoomOut = nullptr)
+oc_str32 PushUtf8ToUtf32(OC_Arena_t* arena, MyStr_t str, u32* errorIndexOut = nullptr)
+bool ConvertUtf32ToUtf8(const u32* codepoints, u32 numCodepoints, char* bytesOut, u32 maxNumBytes, u32* numBytesOut, u32* errorIndexOut = nullptr, bool* ranOutOfRoomOut = nullptr)
+MyStr_t PushUtf32ToUtf8(OC_Arena_t* arena, oc_str32 codepoints, u32* errorIndexOut = nullptr)
+*/
@@ -0,0 +1,227 @@
+/*
+File:   orca_var_array.h
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Holds VarArray_t, a growable array of fixed-size items that lives in an
+	** OC_Arena_t. Capacity doubles when it runs out, and when the items are the
+	** last thing that was pushed to the arena the array just extends into the
+	** free space after it instead of moving. Arena memory is never given back so
+	** a moved array leaves its old items behind until the arena is cleared
+*/
+
+#ifndef _ORCA_VAR_ARRAY_H
+#define _ORCA_VAR_ARRAY_H
+
+#define VAR_ARRAY_MIN_CAPACITY 8
+
+struct VarArray_t
+{
+	OC_Arena_t* arena;
+	u64 itemSize;
+	u32 itemAlignment;
+	u64 length;
+	u64 capacity;
+	void* items;
+
+	u32 numGrowsInPlace; //how many times we grew without copying
+	u32 numGrowsMoved; //how many times the items had to be copied to a new spot in the arena
+};
+
+// +--------------------------------------------------------------+
+// |                       Arena Extension                        |
+// +--------------------------------------------------------------+
+//If allocEnd is the very end of the most recent push on this arena and the current chunk has room, pushes extraSize more bytes
+//directly after it and returns true. Otherwise nothing is pushed and it returns false
+//NOTE: This reaches into oc_arena_chunk (ptr, offset and cap, with offset being the end of the last push in the current chunk)
+//      and it relies on OC_ArenaPush using an alignment of 1, so the extension starts exactly at offset with no padding.
+//      If either stops being true in Orca the Asserts below catch it
+bool ArenaTryGrowInPlace(OC_Arena_t* arena, const void* allocEnd, u64 extraSize)
+{
+	NotNull(arena);
+	OC_ArenaChunk_t* chunk = arena->currentChunk;
+	if (chunk == nullptr || allocEnd != chunk->ptr + chunk->offset) { return false; }
+	if (chunk->offset + extraSize > chunk->cap) { return false; }
+	u64 allocEndOffset = (u64)((const char*)allocEnd - chunk->ptr);
+	Assert(chunk->offset == allocEndOffset);
+	void* extension = OC_ArenaPush(arena, extraSize);
+	Assert(extension == allocEnd);
+	Assert(arena->currentChunk == chunk && chunk->offset == allocEndOffset + extraSize);
+	return true;
+}
+
+// +--------------------------------------------------------------+
+// |                       Create and Free                        |
+// +--------------------------------------------------------------+
+//NOTE: Arena memory can't be given back individually, so this just clears the structure
+void FreeVarArray(VarArray_t* array)
+{
+	NotNull(array);
+	ClearPointer(array);
+}
+void CreateVarArray(VarArray_t* arrayOut, OC_Arena_t* arena, u64 itemSize, u64 initialCapacity = 0, u32 itemAlignment = 0)
+{
+	NotNull2(arrayOut, arena);
+	Assert(itemSize > 0);
+	ClearPointer(arrayOut);
+	arrayOut->arena = arena;
+	arrayOut->itemSize = itemSize;
+	arrayOut->itemAlignment = (itemAlignment > 0) ? itemAlignment : 1;
+	Assert(IsPowerOfTwoU32(arrayOut->itemAlignment));
+	if (initialCapacity > 0)
+	{
+		arrayOut->items = OC_ArenaPushAligned(arena, itemSize * initialCapacity, arrayOut->itemAlignment);
+		NotNull(arrayOut->items);
+		arrayOut->capacity = initialCapacity;
+	}
+}
+#define CreateVarArrayType(arrayOutPntr, arena, type, initialCapacity) CreateVarArray((arrayOutPntr), (arena), sizeof(type), (initialCapacity), _Alignof(type))
+
+// +--------------------------------------------------------------+
+// |                           Capacity                           |
+// +--------------------------------------------------------------+
+//Makes sure there is room for at least capacityRequired items. Capacity at least doubles each time so pushing is amortized O(1)
+void VarArrayExpand(VarArray_t* array, u64 capacityRequired)
+{
+	NotNull(array);
+	if (capacityRequired <= array->capacity) { return; }
+	u64 newCapacity = Max<u64>(array->capacity * 2, VAR_ARRAY_MIN_CAPACITY);
+	if (newCapacity < capacityRequired) { newCapacity = capacityRequired; }
+
+	if (array->items != nullptr)
+	{
+		u8* itemsEnd = (u8*)array->items + (array->itemSize * array->capacity);
+		if (ArenaTryGrowInPlace(array->arena, itemsEnd, array->itemSize * (newCapacity - array->capacity)))
+		{
+			array->capacity = newCapacity;
+			array->numGrowsInPlace++;
+			return;
+		}
+	}
+
+	void* newItems = OC_ArenaPushAligned(array->arena, array->itemSize * newCapacity, array->itemAlignment);
+	NotNull(newItems);
+	if (array->length > 0)
+	{
+		memcpy(newItems, array->items, array->itemSize * array->length);
+		array->numGrowsMoved++;
+	}
+	array->items = newItems;
+	array->capacity = newCapacity;
+}
+
+INLINE void VarArrayClear(VarArray_t* array)
+{
+	array->length = 0;
+}
+
+// +--------------------------------------------------------------+
+// |                            Access                            |
+// +--------------------------------------------------------------+
+INLINE void* VarArrayGetItem(const VarArray_t* array, u64 index)
+{
+	DebugAssert(index < array->length);
+	return (u8*)array->items + (index * array->itemSize);
+}
+#define VarArrayGet(arrayPntr, index, type) ((type*)VarArrayGetItem((arrayPntr), (index)))
+#define VarArrayLast(arrayPntr, type)       ((type*)VarArrayGetItem((arrayPntr), (arrayPntr)->length - 1))
+#define VarArrayLoop(arrayPntr, indexName)  for (u64 indexName = 0; indexName < (arrayPntr)->length; indexName++)
+
+// +--------------------------------------------------------------+
+// |                        Add and Remove                        |
+// +--------------------------------------------------------------+
+//NOTE: The new item is not cleared
+INLINE void* VarArrayPushItem(VarArray_t* array)
+{
+	if (array->length >= array->capacity) { VarArrayExpand(array, array->length + 1); }
+	void* result = (u8*)array->items + (array->length * array->itemSize);
+	array->length++;
+	return result;
+}
+#define VarArrayPush(arrayPntr, type) ((type*)VarArrayPushItem(arrayPntr))
+
+//Copies numItems items onto the end, growing at most once. Returns a pointer to the first appended item
+void* VarArrayAppend(VarArray_t* array, const void* items, u64 numItems)
+{
+	NotNull(array);
+	Assert(items != nullptr || numItems == 0);
+	VarArrayExpand(array, array->length + numItems);
+	void* result = (u8*)array->items + (array->length * array->itemSize);
+	if (numItems > 0) { memcpy(result, items, array->itemSize * numItems); }
+	array->length += numItems;
+	return result;
+}
+
+//Opens a gap at index by shifting everything after it up by one. Returns a pointer to the (uncleared) gap
+void* VarArrayInsertItem(VarArray_t* array, u64 index)
+{
+	NotNull(array);
+	Assert(index <= array->length);
+	VarArrayExpand(array, array->length + 1);
+	u8* result = (u8*)array->items + (index * array->itemSize);
+	if (index < array->length) { memmove(result + array->itemSize, result, array->itemSize * (array->length - index)); }
+	array->length++;
+	return result;
+}
+#define VarArrayInsert(arrayPntr, index, type) ((type*)VarArrayInsertItem((arrayPntr), (index)))
+
+//Copies the last item into itemOut (optional) and removes it. Returns false if the array is empty
+bool VarArrayPop(VarArray_t* array, void* itemOut = nullptr)
+{
+	NotNull(array);
+	if (array->length == 0) { return false; }
+	array->length--;
+	if (itemOut != nullptr) { memcpy(itemOut, (u8*)array->items + (array->length * array->itemSize), array->itemSize); }
+	return true;
+}
+//O(1), moves the last item into the hole so the order is not kept
+void VarArraySwapRemove(VarArray_t* array, u64 index)
+{
+	NotNull(array);
+	Assert(index < array->length);
+	array->length--;
+	if (index != array->length)
+	{
+		memcpy((u8*)array->items + (index * array->itemSize), (u8*)array->items + (array->length * array->itemSize), array->itemSize);
+	}
+}
+//O(n), shifts everything after index down to keep the order
+void VarArrayRemove(VarArray_t* array, u64 index)
+{
+	NotNull(array);
+	Assert(index < array->length);
+	u8* removed = (u8*)array->items + (index * array->itemSize);
+	array->length--;
+	if (index < array->length) { memmove(removed, removed + array->itemSize, array->itemSize * (array->length - index)); }
+}
+
+#endif //  _ORCA_VAR_ARRAY_H
+
+// +--------------------------------------------------------------+
+// |                   Autocomplete Dictionary                    |
+// +--------------------------------------------------------------+
+/*
+@Defines
+VAR_ARRAY_MIN_CAPACITY
+@Types
+VarArray_t
+@Functions
+bool ArenaTryGrowInPlace(OC_Arena_t* arena, const void* allocEnd, u64 extraSize)
+void FreeVarArray(VarArray_t* array)
+void CreateVarArray(VarArray_t* arrayOut, OC_Arena_t* arena, u64 itemSize, u64 initialCapacity = 0, u32 itemAlignment = 0)
+#define CreateVarArrayType(arrayOutPntr, arena, type, initialCapacity)
+void VarArrayExpand(VarArray_t* array, u64 capacityRequired)
+INLINE void VarArrayClear(VarArray_t* array)
+INLINE void* VarArrayGetItem(const VarArray_t* array, u64 index)
+#define VarArrayGet(arrayPntr, index, type)
+#define VarArrayLast(arrayPntr, type)
+#define VarArrayLoop(arrayPntr, indexName)
+INLINE void* VarArrayPushItem(VarArray_t* array)
+#define VarArrayPush(arrayPntr, type)
+void* VarArrayAppend(VarArray_t* array, const void* items, u64 numItems)
+void* VarArrayInsertItem(VarArray_t* array, u64 index)
+#define VarArrayInsert(arrayPntr, index, type)
+bool VarArrayPop(VarArray_t* array, void* itemOut = nullptr)
+void VarArraySwapRemove(VarArray_t* array, u64 index)
+void VarArrayRemove(VarArray_t* array, u64 index)
+*/
@@ -0,0 +1,45 @@
+#!/bin/sh
+# Disassembles the extern "C" functions in test_min_max.cpp and checks that
+#   Scalar*  compile to straight-line code (no jumps) at -O2
+#   Kernel*  loops are auto-vectorized (use packed SSE instructions) at -O3
+# Only meaningful on x86-64, other hosts just report that it was skipped.
+# Usage: ./check_codegen.sh [compiler]   (run from this folder, make codegen does that)
+
+CXX="${1:-g++}"
+BUILD=build_codegen
+mkdir -p "$BUILD"
+
+case "$($CXX -dumpmachine)" in
+	x86_64*) ;;
+	*) echo "check_codegen: skipped, $($CXX -dumpmachine) is not x86-64"; exit 0 ;;
+esac
+
+$CXX -std=c++17 -I. -DDEBUG_BUILD=0 -O2 -S test_min_max.cpp -o "$BUILD/min_max_O2.s" || exit 1
+$CXX -std=c++17 -I. -DDEBUG_BUILD=0 -O3 -S test_min_max.cpp -o "$BUILD/min_max_O3.s" || exit 1
+
+# Prints the instruction lines of one function from an assembly listing
+function_body()
+{
+	awk -v label="$2:" '$1 == label { inside = 1; next } inside && /^\t\.cfi_endproc/ { exit } inside && /^\t[a-z]/ { print }' "$1"
+}
+
+failed=0
+echo "check_codegen: $($CXX --version | head -n 1)"
+for name in $(grep -o '^[A-Za-z0-9_]*:' "$BUILD/min_max_O2.s" | grep '^Scalar' | tr -d ':'); do
+	body="$(function_body "$BUILD/min_max_O2.s" "$name")"
+	if echo "$body" | grep -q '^[[:space:]]*j'; then
+		echo "  FAILED $name branches at -O2:"; echo "$body"; failed=1
+	else
+		echo "  $name: branchless at -O2 ($(echo "$body" | awk '{print $1}' | tr '\n' ' '))"
+	fi
+done
+for name in $(grep -o '^[A-Za-z0-9_]*:' "$BUILD/min_max_O3.s" | grep '^Kernel' | tr -d ':'); do
+	body="$(function_body "$BUILD/min_max_O3.s" "$name")"
+	packed="$(echo "$body" | awk '$1 ~ /^(p[a-z]+|[a-z]+ps)$/ && $1 !~ /^(push|pop|prefetch)/ { print $1 }' | sort -u | tr '\n' ' ')"
+	if [ -z "$packed" ]; then
+		echo "  FAILED $name is not vectorized at -O3"; failed=1
+	else
+		echo "  $name: vectorized at -O3 ($packed)"
+	fi
+done
+exit $failed
@@ -0,0 +1,304 @@
+/*
+File:   orca.h
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** A native stand-in for the real orca.h so the headers in the parent folder
+	** can be compiled with a regular C++ compiler for the tests and benchmarks in
+	** this folder. Only the types and functions my_orca.h actually touches are
+	** provided. Arenas are a single malloc'd chunk, lists are real doubly linked lists
+	** (same behavior as Orca's list.h), logging goes to printf, and
+	** everything we never call natively (canvas, ui, files, fonts) is a template
+	** that accepts anything and returns a value convertible to anything
+*/
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdarg.h>
+typedef uint8_t u8; typedef uint16_t u16; typedef uint32_t u32; typedef uint64_t u64;
+typedef int8_t i8; typedef int16_t i16; typedef int32_t i32; typedef int64_t i64; typedef float f32; typedef double f64;
+#define ORCA_EXPORT
+#define _Alignof alignof
+struct OcAny { template<class T> operator T() const { return T(); } };
+typedef struct oc_str8 { char* ptr; size_t len; } oc_str8;
+typedef u32 oc_utf32;
+typedef struct oc_str32 { oc_utf32* ptr; size_t len; } oc_str32;
+typedef struct oc_vec2 { f32 x, y; } oc_vec2;
+typedef struct oc_vec3 { f32 x, y, z; } oc_vec3;
+typedef struct oc_vec4 { f32 x, y, z, w; } oc_vec4;
+typedef struct oc_vec2i { i32 x, y; } oc_vec2i;
+typedef struct oc_mat2x3 { f32 m[6]; } oc_mat2x3;
+typedef struct oc_rect { f32 x, y, w, h; } oc_rect;
+typedef struct oc_color { f32 r, g, b, a; } oc_color;
+typedef struct oc_list_elt { struct oc_list_elt* prev; struct oc_list_elt* next; } oc_list_elt;
+typedef struct oc_list { oc_list_elt* first; oc_list_elt* last; } oc_list;
+typedef struct oc_str8_list { oc_list list; u64 eltCount; u64 len; } oc_str8_list;
+typedef struct oc_arena_chunk { oc_list_elt listElt; char* ptr; u64 offset; u64 committed; u64 cap; } oc_arena_chunk;
+typedef struct oc_arena { void* base; oc_list chunks; oc_arena_chunk* currentChunk; } oc_arena;
+typedef struct oc_arena_scope { oc_arena* arena; oc_arena_chunk* chunk; u64 offset; } oc_arena_scope;
+typedef struct oc_arena_options { void* base; u64 reserve; } oc_arena_options;
+typedef struct oc_canvas_context { int dummy; } oc_canvas_context;
+typedef struct oc_canvas_renderer { int dummy; } oc_canvas_renderer;
+typedef struct oc_cap_type { int dummy; } oc_cap_type;
+typedef struct oc_color_space { int dummy; } oc_color_space;
+typedef struct oc_event { int dummy; } oc_event;
+typedef struct oc_file { int dummy; } oc_file;
+typedef struct oc_file_access { int dummy; } oc_file_access;
+typedef struct oc_file_dialog_desc { int dummy; } oc_file_dialog_desc;
+typedef struct oc_file_open_flags { int dummy; } oc_file_open_flags;
+typedef struct oc_file_open_with_dialog_result { int dummy; } oc_file_open_with_dialog_result;
+typedef struct oc_file_status { int dummy; } oc_file_status;
+typedef struct oc_file_whence { int dummy; } oc_file_whence;
+typedef struct oc_font { int dummy; } oc_font;
+typedef struct oc_font_metrics { int dummy; } oc_font_metrics;
+typedef struct oc_gradient_blend_space { int dummy; } oc_gradient_blend_space;
+typedef struct oc_image { int dummy; } oc_image;
+typedef struct oc_image_region { int dummy; } oc_image_region;
+typedef struct oc_io_cmp { int dummy; } oc_io_cmp;
+typedef struct oc_io_error { int dummy; } oc_io_error;
+typedef struct oc_io_req { int dummy; } oc_io_req;
+typedef struct oc_joint_type { int dummy; } oc_joint_type;
+typedef struct oc_key_code { int dummy; } oc_key_code;
+typedef struct oc_mouse_button { int dummy; } oc_mouse_button;
+typedef struct oc_rect_atlas { int dummy; } oc_rect_atlas;
+typedef struct oc_scan_code { int dummy; } oc_scan_code;
+typedef struct oc_surface { int dummy; } oc_surface;
+typedef struct oc_text_metrics { int dummy; } oc_text_metrics;
+typedef struct oc_ui_box { int dummy; } oc_ui_box;
+typedef struct oc_ui_context { int dummy; } oc_ui_context;
+typedef struct oc_ui_flags { int dummy; } oc_ui_flags;
+typedef struct oc_ui_pattern { int dummy; } oc_ui_pattern;
+typedef struct oc_ui_radio_group_info { int dummy; } oc_ui_radio_group_info;
+typedef struct oc_ui_select_popup_info { int dummy; } oc_ui_select_popup_info;
+typedef struct oc_ui_selector { int dummy; } oc_ui_selector;
+typedef struct oc_ui_sig { int dummy; } oc_ui_sig;
+typedef struct oc_ui_style { int dummy; } oc_ui_style;
+typedef struct oc_ui_style_mask { int dummy; } oc_ui_style_mask;
+typedef struct oc_ui_text_box_result { int dummy; } oc_ui_text_box_result;
+typedef struct oc_unicode_range { int dummy; } oc_unicode_range;
+#define oc_container_of(ptr, type, member) ((type*)((char*)(ptr) - offsetof(type, member)))
+#define oc_list_checked_entry(elt, type, member) ((elt) ? oc_container_of(elt, type, member) : 0)
+#define oc_defer_loop(begin, end) for (int __i = ((begin), 0); __i != 1; __i += 1, (end))
+#define oc_log_info(msg, ...) printf(msg, ##__VA_ARGS__)
+#define oc_log_warning(msg, ...) printf(msg, ##__VA_ARGS__)
+#define oc_log_error(msg, ...) printf(msg, ##__VA_ARGS__)
+#define OC_ASSERT(test, msg, ...) do { if (!(test)) { printf("ASSERT %s:%d " msg "\n", __FILE__, __LINE__, ##__VA_ARGS__); abort(); } } while(0)
+#define OC_ABORT(msg, ...) do { printf(msg, ##__VA_ARGS__); abort(); } while(0)
+#define STUB_ARENA_CAP (1ull<<31)
+inline void oc_arena_init_with_options(oc_arena* a, oc_arena_options* o) { memset(a,0,sizeof(*a)); a->currentChunk=(oc_arena_chunk*)calloc(1,sizeof(oc_arena_chunk)); u64 cap=(o&&o->reserve)?o->reserve:STUB_ARENA_CAP; a->currentChunk->ptr=(char*)malloc(cap); a->currentChunk->cap=cap; }
+inline void oc_arena_init(oc_arena* a) { oc_arena_init_with_options(a, 0); }
+inline void oc_arena_cleanup(oc_arena* a) { free(a->currentChunk->ptr); free(a->currentChunk); a->currentChunk=0; }
+inline void* oc_arena_push_aligned(oc_arena* a, u64 size, u32 align) { oc_arena_chunk* c=a->currentChunk; u64 base=(u64)(uintptr_t)c->ptr; u64 off=((base+c->offset+align-1)&~(u64)(align-1))-base; if (off+size>c->cap) abort(); c->offset=off+size; return c->ptr+off; }
+inline void* oc_arena_push(oc_arena* a, u64 size) { return oc_arena_push_aligned(a, size, 1); }
+inline void oc_arena_clear(oc_arena* a) { a->currentChunk->offset=0; }
+inline oc_arena_scope oc_arena_scope_begin(oc_arena* a) { oc_arena_scope s={a,a->currentChunk,a->currentChunk->offset}; return s; }
+inline void oc_arena_scope_end(oc_arena_scope s) { s.arena->currentChunk=s.chunk; s.chunk->offset=s.offset; }
+inline oc_arena* stub_scratch() { static oc_arena a; static bool init=false; if(!init){oc_arena_init(&a);init=true;} return &a; }
+inline oc_arena* stub_scratch2() { static oc_arena a; static bool init=false; if(!init){oc_arena_init(&a);init=true;} return &a; }
+inline oc_arena_scope oc_scratch_begin() { return oc_arena_scope_begin(stub_scratch()); }
+inline oc_arena_scope oc_scratch_begin_next(oc_arena* used) { return oc_arena_scope_begin(used==stub_scratch()?stub_scratch2():stub_scratch()); }
+inline oc_str8 oc_str8_push_buffer(oc_arena* a, u64 len, char* b) { char* p=(char*)oc_arena_push(a,len+1); memcpy(p,b,len); p[len]=0; oc_str8 r={p,(size_t)len}; return r; }
+inline int oc_str8_cmp(oc_str8 a, oc_str8 b) { size_t n=a.len<b.len?a.len:b.len; int r=memcmp(a.ptr,b.ptr,n); if(r) return r; return (a.len<b.len)?-1:(a.len>b.len)?1:0; }
+inline oc_str8 oc_str8_pushf(oc_arena* a, const char* fmt, ...) { char buf[1024]; va_list args; va_start(args, fmt); int n=vsnprintf(buf,sizeof(buf),fmt,args); va_end(args); return oc_str8_push_buffer(a,(u64)n,buf); }
+template<class... A> inline OcAny oc_arc(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_canvas_context_create(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_canvas_context_destroy(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_canvas_context_is_nil(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_canvas_context_nil(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_canvas_context_select(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_canvas_context_set_msaa_sample_count(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_canvas_present(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_canvas_render(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_canvas_renderer_create(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_canvas_renderer_destroy(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_canvas_renderer_is_nil(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_canvas_renderer_nil(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_canvas_surface_create(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_canvas_surface_swap_interval(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_circle_fill(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_circle_stroke(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_clear(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_clip_pop(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_clip_push(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_clip_top(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_close_path(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_codepoints_outlines(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_color_convert(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_color_rgba(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_color_srgba(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_cubic_to(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_ellipse_fill(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_ellipse_stroke(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_file_close(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_file_get_status(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_file_is_nil(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_file_last_error(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_file_nil(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_file_open(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_file_open_at(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_file_open_with_dialog(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_file_open_with_request(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_file_pos(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_file_read(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_file_seek(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_file_size(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_file_write(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_fill(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_font_create_from_file(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_font_create_from_memory(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_font_create_from_path(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_font_destroy(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_font_get_glyph_index(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_font_get_glyph_indices(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_font_get_metrics(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_font_get_metrics_unscaled(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_font_get_scale_for_em_pixels(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_font_is_nil(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_font_nil(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_font_push_glyph_indices(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_font_text_metrics(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_font_text_metrics_utf32(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_get_cap(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_get_color(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_get_font(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_get_font_size(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_get_image(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_get_image_source_region(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_get_joint(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_get_max_joint_excursion(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_get_position(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_get_text_flip(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_get_tolerance(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_get_width(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_gles_surface_create(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_gles_surface_make_current(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_gles_surface_swap_buffers(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_gles_surface_swap_interval(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_glyph_outlines(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_image_atlas_alloc_from_file(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_image_atlas_alloc_from_memory(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_image_atlas_alloc_from_path(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_image_atlas_alloc_from_rgba8(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_image_atlas_recycle(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_image_create(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_image_create_from_file(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_image_create_from_memory(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_image_create_from_path(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_image_create_from_rgba8(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_image_destroy(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_image_draw(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_image_draw_region(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_image_is_nil(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_image_nil(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_image_size(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_image_upload_region_rgba8(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_io_wait_single_req(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_line_to(A&&...) { return OcAny(); }
+inline oc_list_elt* oc_list_begin(oc_list list) { return list.first; }
+inline bool oc_list_empty(oc_list list) { return (list.first == 0); }
+inline oc_list_elt* oc_list_end(oc_list* list) { (void)list; return 0; }
+inline void oc_list_init(oc_list* list) { list->first = list->last = 0; }
+inline void oc_list_insert(oc_list* list, oc_list_elt* afterElt, oc_list_elt* elt) { elt->prev = afterElt; elt->next = afterElt->next; if (afterElt->next) { afterElt->next->prev = elt; } else { list->last = elt; } afterElt->next = elt; }
+inline void oc_list_insert_before(oc_list* list, oc_list_elt* beforeElt, oc_list_elt* elt) { elt->next = beforeElt; elt->prev = beforeElt->prev; if (beforeElt->prev) { beforeElt->prev->next = elt; } else { list->first = elt; } beforeElt->prev = elt; }
+inline oc_list_elt* oc_list_last(oc_list list) { return list.last; }
+inline void oc_list_remove(oc_list* list, oc_list_elt* elt) { if (elt->prev) { elt->prev->next = elt->next; } else { list->first = elt->next; } if (elt->next) { elt->next->prev = elt->prev; } else { list->last = elt->prev; } elt->prev = elt->next = 0; }
+inline oc_list_elt* oc_list_pop_back(oc_list* list) { oc_list_elt* elt = list->last; if (elt) { oc_list_remove(list, elt); } return elt; }
+inline oc_list_elt* oc_list_pop_front(oc_list* list) { oc_list_elt* elt = list->first; if (elt) { oc_list_remove(list, elt); } return elt; }
+inline void oc_list_push_back(oc_list* list, oc_list_elt* elt) { elt->next = 0; elt->prev = list->last; if (list->last) { list->last->next = elt; } else { list->first = elt; } list->last = elt; }
+inline void oc_list_push_front(oc_list* list, oc_list_elt* elt) { elt->prev = 0; elt->next = list->first; if (list->first) { list->first->prev = elt; } else { list->last = elt; } list->first = elt; }
+template<class... A> inline OcAny oc_matrix_multiply_push(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_matrix_pop(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_matrix_push(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_matrix_top(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_move_to(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_path_append(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_path_is_absolute(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_path_join(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_path_slice_directory(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_path_slice_filename(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_path_split(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_quadratic_to(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_rect_atlas_alloc(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_rect_atlas_create(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_rect_atlas_recycle(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_rectangle_fill(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_rectangle_stroke(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_request_quit(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_rounded_rectangle_fill(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_rounded_rectangle_stroke(A&&...) { return OcAny(); }
+inline void oc_scratch_end(oc_arena_scope s) { oc_arena_scope_end(s); }
+template<class... A> inline OcAny oc_set_cap(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_set_color(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_set_color_rgba(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_set_color_srgba(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_set_font(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_set_font_size(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_set_gradient(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_set_image(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_set_image_source_region(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_set_joint(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_set_max_joint_excursion(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_set_text_flip(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_set_tolerance(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_set_width(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_str8_from_buffer(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_str8_list_collate(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_str8_list_join(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_str8_list_push(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_str8_list_pushf(A&&...) { return OcAny(); }
+inline oc_str8 oc_str8_push_copy(oc_arena* a, oc_str8 s) { return oc_str8_push_buffer(a, s.len, s.ptr); }
+inline oc_str8 oc_str8_push_cstring(oc_arena* a, const char* str) { return oc_str8_push_buffer(a, strlen(str), (char*)str); }
+inline oc_str8 oc_str8_push_slice(oc_arena* a, oc_str8 s, u64 start, u64 end) { return oc_str8_push_buffer(a, end-start, s.ptr+start); }
+inline oc_str8 oc_str8_pushfv(oc_arena* a, const char* fmt, va_list args) { char buf[1024]; int n=vsnprintf(buf,sizeof(buf),fmt,args); return oc_str8_push_buffer(a,(u64)n,buf); }
+inline oc_str8 oc_str8_slice(oc_str8 s, u64 start, u64 end) { oc_str8 r={s.ptr+start,(size_t)(end-start)}; return r; }
+template<class... A> inline OcAny oc_str8_split(A&&...) { return OcAny(); }
+inline char* oc_str8_to_cstring(oc_arena* a, oc_str8 s) { return oc_str8_push_copy(a, s).ptr; }
+template<class... A> inline OcAny oc_stroke(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_surface_bring_to_front(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_surface_contents_scaling(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_surface_destroy(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_surface_get_hidden(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_surface_get_size(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_surface_is_nil(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_surface_nil(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_surface_send_to_back(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_surface_set_hidden(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_text_fill(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_text_outlines(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_ui_begin_frame(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_ui_button(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_ui_checkbox(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_ui_draw(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_ui_end_frame(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_ui_get_context(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_ui_init(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_ui_label(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_ui_label_str8(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_ui_menu_bar_begin(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_ui_menu_bar_end(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_ui_menu_begin(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_ui_menu_button(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_ui_menu_end(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_ui_panel_begin(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_ui_panel_end(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_ui_pattern_all(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_ui_pattern_owner(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_ui_pattern_push(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_ui_process_event(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_ui_radio_group(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_ui_scrollbar(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_ui_select_popup(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_ui_set_context(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_ui_slider(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_ui_style_match_after(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_ui_style_match_before(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_ui_style_next(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_ui_text_box(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_ui_tooltip(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_window_set_size(A&&...) { return OcAny(); }
+template<class... A> inline OcAny oc_window_set_title(A&&...) { return OcAny(); }
@@ -0,0 +1,316 @@
+/*
+File:   test_aabb_tree.cpp
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Runs random insert/remove/move sequences on AabbTree_t from orca_aabb_tree.h
+	** and checks rec, point, raycast and find-pairs results against brute force over a
+	** plain std::vector, along with the tree invariants (parents, heights, every
+	** internal node is exactly the union of its children, fat bounds contain the item).
+	** Also inserts sorted, identical and grid patterns to check rotations keep the
+	** height sane.
+	** With --bench it times 100k mixed size objects in an 8192x8192 world against
+	** RecCullArray and brute force loops
+*/
+
+#include "orca.h"
+#include "../my_orca.h"
+#include "test_common.h"
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+struct ReferenceItem_t
+{
+	u32 handle;
+	rec bounds;
+	u32 value;
+};
+
+rec RandomBounds(r32 worldSize)
+{
+	v2 position = NewVec2(TestRandR32(-worldSize, worldSize), TestRandR32(-worldSize, worldSize));
+	switch (TestRandU32(0, 4))
+	{
+		case 0: return NewRec(position, TestRandR32(0.5f, 2), TestRandR32(0.5f, 2));
+		case 1: return NewRec(position, TestRandR32(0, 10), TestRandR32(0, 10));
+		case 2: return NewRec(position, TestRandR32(0, 200), TestRandR32(0, 40));
+		default: return NewRec(position, TestRandR32(0, 1000), TestRandR32(0, 1000));
+	}
+}
+
+//Returns the height of the subtree, clears *isValidPntr if anything about it is wrong
+i32 ValidateSubtree(const AabbTree_t* tree, u32 nodeIndex, u32 parentIndex, u32* numLeavesPntr, bool* isValidPntr)
+{
+	const AabbTreeNode_t* nodes = (const AabbTreeNode_t*)tree->nodes.items;
+	const AabbTreeNode_t* node = &nodes[nodeIndex];
+	if (node->parent != parentIndex) { *isValidPntr = false; }
+	if (node->height == 0)
+	{
+		(*numLeavesPntr)++;
+		if (!RecContains(node->bounds, node->itemBounds)) { *isValidPntr = false; }
+		return 0;
+	}
+	i32 height1 = ValidateSubtree(tree, node->child1, nodeIndex, numLeavesPntr, isValidPntr);
+	i32 height2 = ValidateSubtree(tree, node->child2, nodeIndex, numLeavesPntr, isValidPntr);
+	if (node->height != 1 + MaxI32(height1, height2)) { *isValidPntr = false; }
+	rec childUnion = RecUnion(nodes[node->child1].bounds, nodes[node->child2].bounds);
+	if (memcmp(&childUnion, &node->bounds, sizeof(rec)) != 0) { *isValidPntr = false; }
+	return node->height;
+}
+
+void TestAgainstBruteForce()
+{
+	TestSection("Random operations vs brute force");
+	OC_Arena_t arena;
+	OC_ArenaInit(&arena);
+	AabbTree_t tree;
+	CreateAabbTree(&tree, &arena, 2.0f);
+	std::vector<ReferenceItem_t> reference;
+	std::vector<u32> values(100000), found, expected;
+	std::vector<AabbTreePair_t> pairs(1000000);
+	std::vector<std::pair<u32, u32>> foundPairs, expectedPairs;
+	u32 nextValue = 1;
+	i32 maxHeight = 0;
+	bool allValid = true, allCounts = true, allValues = true, allPairs = true, allRecQueries = true, allPointQueries = true, allRaycasts = true;
+	for (u32 sIndex = 0; sIndex < 6000; sIndex++)
+	{
+		u32 operation = TestRandU32(0, 10);
+		if (operation < 4 || reference.empty())
+		{
+			rec bounds = RandomBounds(2000);
+			u32 value = nextValue++;
+			reference.push_back({ AabbTreeInsert(&tree, bounds, value), bounds, value });
+		}
+		else if (operation < 5)
+		{
+			u32 rIndex = TestRandU32(0, (u32)reference.size());
+			AabbTreeRemove(&tree, reference[rIndex].handle);
+			reference[rIndex] = reference.back();
+			reference.pop_back();
+		}
+		else if (operation < 8)
+		{
+			//Half are small nudges that stay inside the fat bounds, half jump somewhere else
+			u32 rIndex = TestRandU32(0, (u32)reference.size());
+			rec bounds = reference[rIndex].bounds;
+			if (TestRandU32(0, 2) == 0) { bounds.x += TestRandR32(-3, 3); bounds.y += TestRandR32(-3, 3); }
+			else { bounds = RandomBounds(2000); }
+			AabbTreeMove(&tree, reference[rIndex].handle, bounds);
+			reference[rIndex].bounds = bounds;
+		}
+
+		if ((sIndex % 50) == 0)
+		{
+			u32 numLeaves = 0;
+			if (tree.root != AABB_TREE_NULL_NODE) { ValidateSubtree(&tree, tree.root, AABB_TREE_NULL_NODE, &numLeaves, &allValid); }
+			if (numLeaves != reference.size() || AabbTreeCount(&tree) != reference.size()) { allCounts = false; }
+			maxHeight = MaxI32(maxHeight, AabbTreeGetHeight(&tree));
+			for (const ReferenceItem_t& item : reference)
+			{
+				rec bounds = AabbTreeGetBounds(&tree, item.handle);
+				if (AabbTreeGetValue(&tree, item.handle) != item.value || memcmp(&bounds, &item.bounds, sizeof(rec)) != 0) { allValues = false; }
+			}
+			u32 numPairs = AabbTreeFindPairs(&tree, pairs.data(), (u32)pairs.size());
+			foundPairs.clear();
+			expectedPairs.clear();
+			for (u32 pIndex = 0; pIndex < numPairs; pIndex++) { foundPairs.push_back({ MinU32(pairs[pIndex].value1, pairs[pIndex].value2), MaxU32(pairs[pIndex].value1, pairs[pIndex].value2) }); }
+			for (size_t rIndex1 = 0; rIndex1 < reference.size(); rIndex1++)
+			{
+				for (size_t rIndex2 = rIndex1 + 1; rIndex2 < reference.size(); rIndex2++)
+				{
+					if (RecIntersects(reference[rIndex1].bounds, reference[rIndex2].bounds)) { expectedPairs.push_back({ MinU32(reference[rIndex1].value, reference[rIndex2].value), MaxU32(reference[rIndex1].value, reference[rIndex2].value) }); }
+				}
+			}
+			std::sort(foundPairs.begin(), foundPairs.end());
+			std::sort(expectedPairs.begin(), expectedPairs.end());
+			if (foundPairs != expectedPairs) { allPairs = false; }
+		}
+
+		rec query = NewRec(NewVec2(TestRandR32(-2100, 2100), TestRandR32(-2100, 2100)), TestRandR32(0, 300), TestRandR32(0, 300));
+		u32 numFound = AabbTreeQueryRec(&tree, query, values.data(), (u32)values.size());
+		found.assign(values.begin(), values.begin() + numFound);
+		expected.clear();
+		for (const ReferenceItem_t& item : reference) { if (RecIntersects(item.bounds, query)) { expected.push_back(item.value); } }
+		std::sort(found.begin(), found.end());
+		std::sort(expected.begin(), expected.end());
+		if (found != expected) { allRecQueries = false; }
+
+		v2 point = NewVec2(TestRandR32(-2100, 2100), TestRandR32(-2100, 2100));
+		numFound = AabbTreeQueryPoint(&tree, point, values.data(), (u32)values.size());
+		found.assign(values.begin(), values.begin() + numFound);
+		expected.clear();
+		for (const ReferenceItem_t& item : reference) { if (RecContains(item.bounds, point)) { expected.push_back(item.value); } }
+		std::sort(found.begin(), found.end());
+		std::sort(expected.begin(), expected.end());
+		if (found != expected) { allPointQueries = false; }
+
+		//The tree has to find the same closest t as testing every item, and the value it returns has to be hit at that t
+		v2 origin = NewVec2(TestRandR32(-2500, 2500), TestRandR32(-2500, 2500));
+		r32 angle = TestRandR32(0, TwoPi32);
+		v2 direction = (TestRandU32(0, 5) == 0) ? NewVec2((TestRandU32(0, 2) == 0) ? 1.0f : -1.0f, 0) : NewVec2(cosf(angle), sinf(angle));
+		r32 maxT = TestRandR32(0, 3000);
+		u32 hitValue = 0;
+		r32 hitT = 0;
+		bool didHit = AabbTreeRaycast(&tree, origin, direction, maxT, &hitValue, &hitT);
+		bool expectedHit = false;
+		r32 expectedT = 0;
+		for (const ReferenceItem_t& item : reference)
+		{
+			r32 itemT;
+			if (AabbTreeRayHitsRec(origin, direction, item.bounds, maxT, &itemT) && (!expectedHit || itemT < expectedT)) { expectedHit = true; expectedT = itemT; }
+		}
+		if (didHit != expectedHit || (didHit && hitT != expectedT)) { allRaycasts = false; }
+		if (didHit)
+		{
+			auto item = std::find_if(reference.begin(), reference.end(), [&](const ReferenceItem_t& other) { return other.value == hitValue; });
+			r32 itemT;
+			if (item == reference.end() || !AabbTreeRayHitsRec(origin, direction, item->bounds, maxT, &itemT) || itemT != hitT) { allRaycasts = false; }
+		}
+	}
+	TestCheck(allValid);
+	TestCheck(allCounts);
+	TestCheck(allValues);
+	TestCheck(allPairs);
+	TestCheck(allRecQueries);
+	TestCheck(allPointQueries);
+	TestCheck(allRaycasts);
+	printf("  %zu items at the end, max height %d\n", reference.size(), maxHeight);
+	FreeAabbTree(&tree);
+	OC_ArenaCleanup(&arena);
+}
+
+void TestDegenerateInserts()
+{
+	TestSection("Heights for sorted, identical and grid inserts");
+	OC_Arena_t arena;
+	OC_ArenaInit(&arena);
+	const u32 numItems = 50000;
+	const char* patternNames[] = { "sorted line", "identical", "grid", "diagonal, growing" };
+	bool allReasonable = true;
+	for (u32 pattern = 0; pattern < ArrayCount(patternNames); pattern++)
+	{
+		AabbTree_t tree;
+		CreateAabbTree(&tree, &arena, 0.1f);
+		for (u32 iIndex = 0; iIndex < numItems; iIndex++)
+		{
+			rec bounds;
+			if (pattern == 0) { bounds = NewRec((r32)iIndex, 0, 1, 1); }
+			else if (pattern == 1) { bounds = NewRec(5, 5, 1, 1); }
+			else if (pattern == 2) { bounds = NewRec((r32)(iIndex % 224) * 2, (r32)(iIndex / 224) * 2, 1, 1); }
+			else { bounds = NewRec((r32)iIndex, (r32)iIndex, (r32)iIndex * 0.01f, 1); }
+			AabbTreeInsert(&tree, bounds, iIndex);
+		}
+		//Without rotations a sorted line is a linked list 50k deep, anything near log2 is fine and has to stay far from AABB_TREE_STACK_SIZE
+		i32 height = AabbTreeGetHeight(&tree);
+		printf("  %-18s height %d\n", patternNames[pattern], height);
+		if (height > 64) { allReasonable = false; }
+		u32 values[8];
+		AabbTreeQueryRec(&tree, NewRec(0, 0, 10, 10), values, ArrayCount(values));
+		FreeAabbTree(&tree);
+	}
+	TestCheck(allReasonable);
+	OC_ArenaCleanup(&arena);
+}
+
+void BenchAabbTree()
+{
+	TestSection("Benchmarks (100k objects 2-900 units in an 8192x8192 world, margin 2)");
+	const u32 numObjects = 100000;
+	const u32 numQueries = 2000;
+	const r32 worldSize = 8192;
+	OC_Arena_t arena;
+	OC_ArenaInit(&arena);
+	std::vector<rec> objects(numObjects);
+	for (u32 oIndex = 0; oIndex < numObjects; oIndex++)
+	{
+		u32 sizeClass = TestRandU32(0, 100);
+		r32 size = (sizeClass < 80) ? TestRandR32(2, 12) : ((sizeClass < 98) ? TestRandR32(12, 80) : TestRandR32(80, 600));
+		objects[oIndex] = NewRec(TestRandR32(0, worldSize), TestRandR32(0, worldSize), size * TestRandR32(0.5f, 1.5f), size * TestRandR32(0.5f, 1.5f));
+	}
+	std::vector<v2> queryPoints(numQueries);
+	std::vector<v2> rayDirections(numQueries);
+	for (u32 qIndex = 0; qIndex < numQueries; qIndex++)
+	{
+		queryPoints[qIndex] = NewVec2(TestRandR32(0, worldSize), TestRandR32(0, worldSize));
+		r32 angle = TestRandR32(0, TwoPi32);
+		rayDirections[qIndex] = NewVec2(cosf(angle), sinf(angle));
+	}
+	std::vector<u32> values(numObjects), handles(numObjects);
+	std::vector<AabbTreePair_t> pairs(4000000);
+	u64 sum = 0;
+
+	AabbTree_t tree;
+	TestBench("build", "AabbTreeInsert", 3, numObjects, [&]()
+	{
+		OC_ArenaClear(&arena);
+		CreateAabbTree(&tree, &arena, 2.0f, numObjects);
+		for (u32 oIndex = 0; oIndex < numObjects; oIndex++) { handles[oIndex] = AabbTreeInsert(&tree, objects[oIndex], oIndex); }
+	});
+	printf("  height %d\n", AabbTreeGetHeight(&tree));
+
+	TestBench("query", "64x64 rec", 5, numQueries, [&]() { for (v2 queryPoint : queryPoints) { sum += AabbTreeQueryRec(&tree, NewRec(queryPoint.x, queryPoint.y, 64, 64), values.data(), numObjects); } });
+	TestBench("query", "64x64 rec, RecCullArray", 3, numQueries / 10, [&]()
+	{
+		for (u32 qIndex = 0; qIndex < numQueries / 10; qIndex++) { sum += RecCullArray(numObjects, objects.data(), NewRec(queryPoints[qIndex].x, queryPoints[qIndex].y, 64, 64), values.data()); }
+	});
+	TestBench("query", "point", 5, numQueries, [&]() { for (v2 queryPoint : queryPoints) { sum += AabbTreeQueryPoint(&tree, queryPoint, values.data(), numObjects); } });
+	TestBench("query", "raycast, length 2000", 5, numQueries, [&]()
+	{
+		for (u32 qIndex = 0; qIndex < numQueries; qIndex++) { sum += AabbTreeRaycast(&tree, queryPoints[qIndex], rayDirections[qIndex], 2000); }
+	});
+	TestBench("query", "raycast, brute force", 3, numQueries / 10, [&]()
+	{
+		for (u32 qIndex = 0; qIndex < numQueries / 10; qIndex++)
+		{
+			r32 bestT = 2000;
+			for (const rec& object : objects) { r32 objectT; if (AabbTreeRayHitsRec(queryPoints[qIndex], rayDirections[qIndex], object, bestT, &objectT)) { bestT = objectT; } }
+			sum += (u64)bestT;
+		}
+	});
+
+	u32 numPairs = 0;
+	TestBench("pairs 100k", "AabbTreeFindPairs", 3, 1, [&]() { numPairs = AabbTreeFindPairs(&tree, pairs.data(), (u32)pairs.size()); });
+	TestBench("pairs 100k", "AabbTreeQueryRec per object", 1, 1, [&]()
+	{
+		for (const rec& object : objects) { sum += AabbTreeQueryRec(&tree, object, values.data(), numObjects); }
+	});
+	printf("  %u pairs\n", numPairs);
+	const u32 numSmall = 10000;
+	AabbTree_t smallTree;
+	CreateAabbTree(&smallTree, &arena, 2.0f, numSmall);
+	for (u32 oIndex = 0; oIndex < numSmall; oIndex++) { AabbTreeInsert(&smallTree, objects[oIndex], oIndex); }
+	TestBench("pairs 10k", "AabbTreeFindPairs", 5, 1, [&]() { numPairs = AabbTreeFindPairs(&smallTree, pairs.data(), (u32)pairs.size()); });
+	TestBench("pairs 10k", "brute force n^2", 1, 1, [&]()
+	{
+		for (u32 oIndex1 = 0; oIndex1 < numSmall; oIndex1++) { for (u32 oIndex2 = oIndex1 + 1; oIndex2 < numSmall; oIndex2++) { sum += RecIntersects(objects[oIndex1], objects[oIndex2]); } }
+	});
+
+	//Every object drifts up to half a unit a frame, most stay inside their fat bounds
+	std::vector<v2> velocities(numObjects);
+	for (v2& velocity : velocities) { velocity = NewVec2(TestRandR32(-0.5f, 0.5f), TestRandR32(-0.5f, 0.5f)); }
+	u64 numReinserted = 0, numMoves = 0;
+	TestBench("frame", "AabbTreeMove all, slow drift", 10, numObjects, [&]()
+	{
+		for (u32 oIndex = 0; oIndex < numObjects; oIndex++)
+		{
+			objects[oIndex].x += velocities[oIndex].x;
+			objects[oIndex].y += velocities[oIndex].y;
+			numReinserted += AabbTreeMove(&tree, handles[oIndex], objects[oIndex]);
+		}
+		numMoves += numObjects;
+	});
+	printf("  %.1f%% reinserted, height %d\n", 100.0 * (r64)numReinserted / (r64)numMoves, AabbTreeGetHeight(&tree));
+	TestDoNotOptimize(sum);
+	OC_ArenaCleanup(&arena);
+}
+
+int main(int argc, char** argv)
+{
+	TestBegin("AABB tree", argc, argv);
+	TestAgainstBruteForce();
+	TestDegenerateInserts();
+	if (testBenchEnabled) { BenchAabbTree(); }
+	return TestEnd();
+}
@@ -0,0 +1,339 @@
+/*
+File:   test_arena_track.cpp
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Checks the arena tracking layer in orca_arena_track.h. Tracking only exists in
+	** debug builds so this test turns on DEBUG_BUILD and ORCA_ARENA_TRACKING itself,
+	** whatever the rest of the tests are built with. Checks the bytes recorded per
+	** call site (including alignment padding), per tag totals with nested tags, peak
+	** usage and scope depth, that OC_ArenaScopeEnd and OC_ScratchEnd roll the used
+	** bytes back, that OC_ArenaCleanup forgets the arena, every OC_Str8Push* wrapper,
+	** and that ArenaTrackPrintReport lists sites largest first and warns about scopes
+	** that were never ended
+*/
+
+#undef DEBUG_BUILD
+#define DEBUG_BUILD 1
+#define ORCA_ARENA_TRACKING 1
+
+#include "orca.h"
+
+#include <string>
+#include <cstdarg>
+
+//The report goes through OC_Log_I/OC_Log_W, so we point those at a string we can look through
+std::string capturedLog;
+void CaptureLog(const char* format, ...)
+{
+	char buffer[1024];
+	va_list args;
+	va_start(args, format);
+	vsnprintf(buffer, sizeof(buffer), format, args);
+	va_end(args);
+	capturedLog += buffer;
+	capturedLog += "\n";
+}
+#undef oc_log_info
+#undef oc_log_warning
+#define oc_log_info(msg, ...) CaptureLog(msg, ##__VA_ARGS__)
+#define oc_log_warning(msg, ...) CaptureLog("WARNING " msg, ##__VA_ARGS__)
+
+#include "../my_orca.h"
+#include "test_common.h"
+
+#include <vector>
+
+const ArenaTrackSite_t* FindSite(u32 lineNum, const char* tag = nullptr)
+{
+	for (u32 sIndex = 0; sIndex < arenaTrack.numSites; sIndex++)
+	{
+		const ArenaTrackSite_t* site = &arenaTrack.sites[sIndex];
+		if (site->lineNum == lineNum && strcmp(site->filePath, __FILE__) == 0 && site->tag == tag) { return site; }
+	}
+	return nullptr;
+}
+u64 SiteBytes(u32 lineNum, const char* tag = nullptr)
+{
+	const ArenaTrackSite_t* site = FindSite(lineNum, tag);
+	return (site != nullptr) ? site->numBytes : 0;
+}
+u64 TagBytes(const char* tag)
+{
+	u64 result = 0;
+	for (u32 sIndex = 0; sIndex < arenaTrack.numSites; sIndex++) { if (arenaTrack.sites[sIndex].tag == tag) { result += arenaTrack.sites[sIndex].numBytes; } }
+	return result;
+}
+const ArenaTrackArena_t* FindArena(const OC_Arena_t* arena)
+{
+	for (u32 aIndex = 0; aIndex < arenaTrack.numArenas; aIndex++) { if (arenaTrack.arenas[aIndex].arena == arena) { return &arenaTrack.arenas[aIndex]; } }
+	return nullptr;
+}
+u64 ArenaOffset(const OC_Arena_t* arena) { return arena->currentChunk->offset; }
+//NOTE: MyStr_t::length only covers the low half of oc_str8::len on a 64-bit host, so zero the whole thing rather than using NewStr
+MyStr_t HostStr(const char* str)
+{
+	MyStr_t result = {};
+	result.chars = (char*)str;
+	result.length = (u32)strlen(str);
+	return result;
+}
+
+void TestSites()
+{
+	TestSection("Bytes per call site");
+	OC_Arena_t arena;
+	OC_ArenaInit(&arena);
+	ArenaTrackReset();
+	ArenaTrackSetName(&arena, "sites");
+
+	//The same line pushed from a loop is one site
+	u32 loopLine = 0;
+	for (u32 pIndex = 0; pIndex < 5; pIndex++) { OC_ArenaPush(&arena, 100); loopLine = __LINE__; }
+	const ArenaTrackSite_t* loopSite = FindSite(loopLine);
+	TestCheck(loopSite != nullptr && loopSite->numBytes == 500 && loopSite->numPushes == 5);
+
+	OC_ArenaPush(&arena, 7); u32 smallLine = __LINE__;
+	TestCheck(SiteBytes(smallLine) == 7);
+
+	//Alignment padding is part of what the push cost
+	OC_ArenaPush(&arena, 1);
+	u64 offsetBefore = ArenaOffset(&arena);
+	void* aligned = OC_ArenaPushAligned(&arena, 16, 64); u32 alignedLine = __LINE__;
+	TestCheck(((uintptr_t)aligned % 64) == 0);
+	TestCheck(SiteBytes(alignedLine) == ArenaOffset(&arena) - offsetBefore && SiteBytes(alignedLine) > 16);
+
+	OC_ArenaPushType(&arena, mat4); u32 typeLine = __LINE__;
+	TestCheck(SiteBytes(typeLine) >= sizeof(mat4));
+
+	const ArenaTrackArena_t* arenaInfo = FindArena(&arena);
+	TestCheck(arenaInfo != nullptr && arenaInfo->name != nullptr && strcmp(arenaInfo->name, "sites") == 0);
+	TestCheck(arenaInfo->numBytesUsed == ArenaOffset(&arena));
+	TestCheck(arenaInfo->totalBytesPushed == ArenaOffset(&arena) && arenaInfo->numPushes == 9);
+
+	//Clear drops the used bytes but nothing that was already recorded
+	OC_ArenaClear(&arena);
+	TestCheck(arenaInfo->numBytesUsed == 0 && arenaInfo->peakBytesUsed == arenaInfo->totalBytesPushed);
+	TestCheck(SiteBytes(loopLine) == 500);
+
+	//Reset forgets the sites and totals but keeps the name
+	ArenaTrackReset();
+	TestCheck(arenaTrack.numSites == 0 && FindSite(loopLine) == nullptr);
+	TestCheck(arenaInfo->totalBytesPushed == 0 && arenaInfo->peakBytesUsed == 0 && strcmp(arenaInfo->name, "sites") == 0);
+
+	//Cleanup forgets the arena entirely, so a new arena at the same address doesn't inherit its numbers
+	u32 numArenasBefore = arenaTrack.numArenas;
+	OC_ArenaCleanup(&arena);
+	TestCheck(FindArena(&arena) == nullptr && arenaTrack.numArenas == numArenasBefore - 1);
+}
+
+void TestTags()
+{
+	TestSection("Per tag totals");
+	OC_Arena_t arena;
+	OC_ArenaInit(&arena);
+	ArenaTrackReset();
+
+	static const char* meshTag = "meshes";
+	static const char* textureTag = "textures";
+	u32 sharedLine = 0;
+	auto PushShared = [&](u64 size) { OC_ArenaPush(&arena, size); sharedLine = __LINE__; };
+
+	PushShared(10);
+	ArenaTrackPushTag(meshTag);
+	PushShared(40);
+	PushShared(60);
+	ArenaTrackTagBlock(textureTag)
+	{
+		//The innermost tag wins
+		PushShared(24);
+	}
+	PushShared(5);
+	ArenaTrackPopTag();
+	PushShared(3);
+
+	//One line under three tags is three sites
+	TestCheck(SiteBytes(sharedLine, nullptr) == 13);
+	TestCheck(SiteBytes(sharedLine, meshTag) == 105 && FindSite(sharedLine, meshTag)->numPushes == 3);
+	TestCheck(SiteBytes(sharedLine, textureTag) == 24);
+	TestCheck(TagBytes(meshTag) == 105 && TagBytes(textureTag) == 24 && TagBytes(nullptr) == 13);
+	TestCheck(arenaTrack.numTags == 0);
+
+	capturedLog.clear();
+	ArenaTrackPrintReport();
+	TestCheck(capturedLog.find("tag meshes: 105 bytes") != std::string::npos);
+	TestCheck(capturedLog.find("tag textures: 24 bytes") != std::string::npos);
+	TestCheck(capturedLog.find("tag (none): 13 bytes") != std::string::npos);
+	OC_ArenaCleanup(&arena);
+}
+
+void TestScopes()
+{
+	TestSection("Peak usage and scope rollback");
+	OC_Arena_t arena;
+	OC_ArenaInit(&arena);
+	ArenaTrackReset();
+
+	OC_ArenaPush(&arena, 100);
+	const ArenaTrackArena_t* arenaInfo = FindArena(&arena);
+	TestCheck(arenaInfo != nullptr && arenaInfo->numBytesUsed == 100 && arenaInfo->peakBytesUsed == 100);
+
+	OC_ArenaScope_t outerScope = OC_ArenaScopeBegin(&arena);
+	OC_ArenaPush(&arena, 1000);
+	OC_ArenaScope_t innerScope = OC_ArenaScopeBegin(&arena);
+	TestCheck(arenaInfo->scopeDepth == 2 && arenaTrack.numScopes == 2);
+	OC_ArenaPush(&arena, 4000);
+	TestCheck(arenaInfo->numBytesUsed == 5100 && arenaInfo->peakBytesUsed == 5100);
+	OC_ArenaScopeEnd(innerScope);
+	TestCheck(arenaInfo->numBytesUsed == 1100 && ArenaOffset(&arena) == 1100);
+	OC_ArenaPush(&arena, 50);
+	OC_ArenaScopeEnd(outerScope);
+	TestCheck(arenaInfo->numBytesUsed == 100 && ArenaOffset(&arena) == 100);
+	TestCheck(arenaInfo->peakBytesUsed == 5100 && arenaInfo->totalBytesPushed == 5150);
+	TestCheck(arenaInfo->scopeDepth == 0 && arenaInfo->maxScopeDepth == 2 && arenaTrack.numScopes == 0);
+
+	//Scopes on different arenas can end out of order
+	OC_Arena_t otherArena;
+	OC_ArenaInit(&otherArena);
+	OC_ArenaScope_t scopeA = OC_ArenaScopeBegin(&arena);
+	OC_ArenaPush(&arena, 30);
+	OC_ArenaScope_t scopeB = OC_ArenaScopeBegin(&otherArena);
+	OC_ArenaPush(&otherArena, 70);
+	OC_ArenaScopeEnd(scopeA);
+	TestCheck(arenaInfo->numBytesUsed == 100 && FindArena(&otherArena)->numBytesUsed == 70);
+	OC_ArenaScopeEnd(scopeB);
+	TestCheck(FindArena(&otherArena)->numBytesUsed == 0 && arenaTrack.numScopes == 0);
+
+	TestSection("Scratch rollback");
+	OC_ArenaScope_t scratch = OC_ScratchBegin();
+	const ArenaTrackArena_t* scratchInfo = FindArena(scratch.arena);
+	u64 scratchUsedBefore = scratchInfo->numBytesUsed;
+	OC_ArenaPush(scratch.arena, 256);
+	OC_ArenaScope_t scratchNext = OC_ScratchBeginNext(scratch.arena);
+	TestCheck(scratchNext.arena != scratch.arena);
+	OC_ArenaPush(scratchNext.arena, 512);
+	const ArenaTrackArena_t* scratchNextInfo = FindArena(scratchNext.arena);
+	u64 scratchNextPeak = scratchNextInfo->peakBytesUsed;
+	TestCheck(scratchInfo->numBytesUsed == scratchUsedBefore + 256 && scratchInfo->scopeDepth == 1 && scratchNextInfo->scopeDepth == 1);
+	OC_ScratchEnd(scratchNext);
+	OC_ScratchEnd(scratch);
+	TestCheck(scratchInfo->numBytesUsed == scratchUsedBefore && scratchInfo->scopeDepth == 0);
+	TestCheck(scratchNextInfo->numBytesUsed == 0 && scratchNextInfo->peakBytesUsed == scratchNextPeak && scratchNextPeak >= 512);
+	TestCheck(ArenaOffset(scratch.arena) == scratch.offset && arenaTrack.numScopes == 0);
+
+	//Cleaning up an arena with a scope still open drops the scope too
+	OC_ArenaScopeBegin(&otherArena);
+	TestCheck(arenaTrack.numScopes == 1);
+	OC_ArenaCleanup(&otherArena);
+	TestCheck(arenaTrack.numScopes == 0 && FindArena(&otherArena) == nullptr);
+	OC_ArenaCleanup(&arena);
+}
+
+void TestStr8Wrappers()
+{
+	TestSection("OC_Str8Push wrappers");
+	OC_Arena_t arena;
+	OC_ArenaInit(&arena);
+	ArenaTrackReset();
+
+	//Every push copies the string plus a null terminator
+	char buffer[] = "buffer contents";
+	MyStr_t fromBuffer = OC_Str8PushBuffer(&arena, 6, buffer); u32 bufferLine = __LINE__;
+	MyStr_t fromCstring = OC_Str8PushCstring(&arena, "hello"); u32 cstringLine = __LINE__;
+	MyStr_t fromCopy = OC_Str8PushCopy(&arena, HostStr("copy me")); u32 copyLine = __LINE__;
+	MyStr_t fromSlice = OC_Str8PushSlice(&arena, HostStr("0123456789"), 2, 5); u32 sliceLine = __LINE__;
+	MyStr_t fromFormat = OC_Str8Pushf(&arena, "%d-%s", 42, "abc"); u32 formatLine = __LINE__;
+	char* cstring = OC_Str8ToCstring(&arena, HostStr("to cstr")); u32 toCstringLine = __LINE__;
+
+	TestCheck(StrEquals(fromBuffer, NewStr("buffer")) && SiteBytes(bufferLine) == 7);
+	TestCheck(StrEquals(fromCstring, NewStr("hello")) && SiteBytes(cstringLine) == 6);
+	TestCheck(StrEquals(fromCopy, NewStr("copy me")) && SiteBytes(copyLine) == 8);
+	TestCheck(StrEquals(fromSlice, NewStr("234")) && SiteBytes(sliceLine) == 4);
+	TestCheck(StrEquals(fromFormat, NewStr("42-abc")) && SiteBytes(formatLine) == 7);
+	TestCheck(strcmp(cstring, "to cstr") == 0 && SiteBytes(toCstringLine) == 8);
+	TestCheck(FindArena(&arena)->numBytesUsed == ArenaOffset(&arena) && ArenaOffset(&arena) == 7+6+8+4+7+8);
+
+	//Inside a scope they roll back like any other push
+	OC_ArenaScope_t scope = OC_ArenaScopeBegin(&arena);
+	OC_Str8Pushf(&arena, "%s", "temporary string");
+	OC_ArenaScopeEnd(scope);
+	TestCheck(FindArena(&arena)->numBytesUsed == 7+6+8+4+7+8);
+	OC_ArenaCleanup(&arena);
+}
+
+//Pulls the byte count off the front of each site line in the report, in the order they were printed
+std::vector<u64> ReportSiteBytes(const std::string& log)
+{
+	std::vector<u64> result;
+	size_t lineStart = 0;
+	while (lineStart < log.size())
+	{
+		size_t lineEnd = log.find('\n', lineStart);
+		if (lineEnd == std::string::npos) { lineEnd = log.size(); }
+		std::string line = log.substr(lineStart, lineEnd - lineStart);
+		unsigned long long numBytes = 0;
+		char word[16] = {};
+		if (sscanf(line.c_str(), " %llu %15s", &numBytes, word) == 2 && strcmp(word, "bytes") == 0) { result.push_back(numBytes); }
+		lineStart = lineEnd + 1;
+	}
+	return result;
+}
+
+void TestReport()
+{
+	TestSection("Report order and open scopes");
+	OC_Arena_t arena;
+	OC_ArenaInit(&arena);
+	ArenaTrackReset();
+	ArenaTrackSetName(&arena, "report");
+
+	//Pushed smallest first so the report has to reorder them
+	const u64 sizes[] = { 3, 900, 40, 7000, 1, 250 };
+	std::vector<u32> lines;
+	lines.push_back(__LINE__); OC_ArenaPush(&arena, sizes[0]);
+	lines.push_back(__LINE__); OC_ArenaPush(&arena, sizes[1]);
+	lines.push_back(__LINE__); OC_ArenaPush(&arena, sizes[2]);
+	lines.push_back(__LINE__); OC_ArenaPush(&arena, sizes[3]);
+	lines.push_back(__LINE__); OC_ArenaPush(&arena, sizes[4]);
+	lines.push_back(__LINE__); OC_ArenaPush(&arena, sizes[5]);
+	OC_ArenaScope_t leakedScope = OC_ArenaScopeBegin(&arena); u32 leakedLine = __LINE__;
+	OC_ArenaPush(&arena, 500);
+
+	capturedLog.clear();
+	ArenaTrackPrintReport();
+	std::vector<u64> reportBytes = ReportSiteBytes(capturedLog);
+	TestCheck(reportBytes.size() == arenaTrack.numSites && reportBytes.size() == ArrayCount(sizes) + 1);
+	bool sorted = true;
+	for (size_t rIndex = 1; rIndex < reportBytes.size(); rIndex++) { if (reportBytes[rIndex-1] < reportBytes[rIndex]) { sorted = false; } }
+	TestCheck(sorted && reportBytes.front() == 7000 && reportBytes.back() == 1);
+	TestCheck(capturedLog.find("arena report (") != std::string::npos);
+
+	char leakedLineStr[512];
+	snprintf(leakedLineStr, sizeof(leakedLineStr), "WARNING   scope still open from %s:%u", __FILE__, leakedLine);
+	TestCheck(capturedLog.find(leakedLineStr) != std::string::npos);
+	for (u32 lIndex = 0; lIndex < lines.size(); lIndex++)
+	{
+		char siteStr[512];
+		snprintf(siteStr, sizeof(siteStr), "%s:%u", __FILE__, lines[lIndex]);
+		TestCheck(capturedLog.find(siteStr) != std::string::npos);
+	}
+
+	//Once it's ended the warning goes away
+	OC_ArenaScopeEnd(leakedScope);
+	capturedLog.clear();
+	ArenaTrackPrintReport();
+	TestCheck(capturedLog.find("scope still open") == std::string::npos);
+	TestCheck(capturedLog.find("WARNING") == std::string::npos);
+	OC_ArenaCleanup(&arena);
+}
+
+int main(int argc, char** argv)
+{
+	TestBegin("Arena Tracking", argc, argv);
+	TestSites();
+	TestTags();
+	TestScopes();
+	TestStr8Wrappers();
+	TestReport();
+	return TestEnd();
+}
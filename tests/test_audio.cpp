@@ -0,0 +1,197 @@
+/*
+File:   test_audio.cpp
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Checks the buffer converters in orca_audio.h against the per-sample
+	** ConvertSampleR32ToX/XToR32 functions in orca_intrinsics.h (they are meant to
+	** be bit identical), including clipping, NaN, i16 round trips, planar/interleaved
+	** layouts for 1-3 channels, and the mean and range of TPDF dithered output.
+	** With --bench it reports throughput against per-sample loops
+*/
+
+#include "orca.h"
+#include "../my_orca.h"
+#include "test_common.h"
+
+#define TEST_NUM_SAMPLES 1037 //odd so every converter runs its scalar tail
+
+void TestConversions()
+{
+	TestSection("Buffer converters vs per-sample conversion");
+	static r32 samples[TEST_NUM_SAMPLES];
+	static i16 results16[TEST_NUM_SAMPLES];
+	static i8 results8[TEST_NUM_SAMPLES];
+	static i32 results32[TEST_NUM_SAMPLES];
+	for (u32 sIndex = 0; sIndex < TEST_NUM_SAMPLES; sIndex++) { samples[sIndex] = TestRandR32(-1.5f, 1.5f); }
+	//Rounding ties, full scale, clipping and huge values
+	samples[0] = 0.5f/32767.0f; samples[1] = 1.5f/32767.0f; samples[2] = -2.5f/32767.0f;
+	samples[3] = 1.0f; samples[4] = -1.0f; samples[5] = 100.0f; samples[6] = -100.0f; samples[7] = 1e30f; samples[8] = -1e30f;
+	//NaN has to give the minimum like ClampCast does, both in the SIMD body and in the tail
+	samples[9] = NAN; samples[TEST_NUM_SAMPLES-1] = NAN;
+
+	ConvertSamplesR32ToI16(TEST_NUM_SAMPLES, samples, results16);
+	ConvertSamplesR32ToI8(TEST_NUM_SAMPLES, samples, results8);
+	ConvertSamplesR32ToI32(TEST_NUM_SAMPLES, samples, results32);
+	bool all16 = true, all8 = true, all32 = true;
+	for (u32 sIndex = 0; sIndex < TEST_NUM_SAMPLES; sIndex++)
+	{
+		if (results16[sIndex] != ConvertSampleR32ToI16(samples[sIndex])) { all16 = false; }
+		if (results8[sIndex] != ConvertSampleR32ToI8(samples[sIndex])) { all8 = false; }
+		if (results32[sIndex] != ConvertSampleR32ToI32(samples[sIndex])) { all32 = false; }
+	}
+	TestCheck(all16);
+	TestCheck(all8);
+	TestCheck(all32);
+	TestCheck(results16[5] == 32767 && results16[6] == -32768);
+	TestCheck(results8[5] == 127 && results8[6] == -128);
+	TestCheck(results32[7] == 2147483520 && results32[8] == INT32_MIN);
+	TestCheck(results16[9] == INT16_MIN && results8[9] == INT8_MIN && results32[9] == INT32_MIN);
+	TestCheck(results16[TEST_NUM_SAMPLES-1] == INT16_MIN && results8[TEST_NUM_SAMPLES-1] == INT8_MIN && results32[TEST_NUM_SAMPLES-1] == INT32_MIN);
+	TestCheck(ConvertSampleR64ToI16(2.0) == 32767 && ConvertSampleR64ToI16(-2.0) == -32768);
+	TestCheck(ConvertSampleR64ToI8(5.0) == 127 && ConvertSampleR64ToI32(3.0) == INT32_MAX && ConvertSampleR64ToI32(-3.0) == INT32_MIN);
+	TestCheck(ClampCastI32ToI8(300) == 127 && ClampCastI32ToU8(-5) == 0 && ClampCastU32ToI32(0xFFFFFFFF) == INT32_MAX && ClampI32toI16(-70000) == -32768);
+
+	static i16 ints16[TEST_NUM_SAMPLES];
+	static i8 ints8[TEST_NUM_SAMPLES];
+	static i32 ints32[TEST_NUM_SAMPLES];
+	for (u32 sIndex = 0; sIndex < TEST_NUM_SAMPLES; sIndex++)
+	{
+		ints16[sIndex] = (i16)TestRandU32();
+		ints8[sIndex] = (i8)TestRandU32();
+		ints32[sIndex] = (i32)TestRandU32();
+	}
+	ints16[0] = INT16_MIN; ints8[0] = INT8_MIN; ints32[0] = INT32_MIN; ints32[1] = INT32_MAX;
+	ConvertSamplesI16ToR32(TEST_NUM_SAMPLES, ints16, samples);
+	all16 = true;
+	for (u32 sIndex = 0; sIndex < TEST_NUM_SAMPLES; sIndex++) { if (samples[sIndex] != ConvertSampleI16ToR32(ints16[sIndex])) { all16 = false; } }
+	TestCheck(all16);
+	//Round trip, everything except -32768 (which maps below -1.0 and clips back to -32767)
+	ConvertSamplesR32ToI16(TEST_NUM_SAMPLES, samples, results16);
+	TestCheck(memcmp(&results16[1], &ints16[1], (TEST_NUM_SAMPLES-1) * sizeof(i16)) == 0);
+	ConvertSamplesI8ToR32(TEST_NUM_SAMPLES, ints8, samples);
+	all8 = true;
+	for (u32 sIndex = 0; sIndex < TEST_NUM_SAMPLES; sIndex++) { if (samples[sIndex] != ConvertSampleI8ToR32(ints8[sIndex])) { all8 = false; } }
+	TestCheck(all8);
+	ConvertSamplesI32ToR32(TEST_NUM_SAMPLES, ints32, samples);
+	all32 = true;
+	for (u32 sIndex = 0; sIndex < TEST_NUM_SAMPLES; sIndex++) { if (samples[sIndex] != ConvertSampleI32ToR32(ints32[sIndex])) { all32 = false; } }
+	TestCheck(all32);
+}
+
+void TestLayouts()
+{
+	TestSection("Planar and interleaved layouts, 1-3 channels");
+	const u32 numFrames = 203;
+	static r32 planes[numFrames*3], interleaved[numFrames*3], back[numFrames*3];
+	static i16 interleaved16[numFrames*3];
+	for (u32 numChannels = 1; numChannels <= 3; numChannels++)
+	{
+		r32* planePntrs[3];
+		r32* backPntrs[3];
+		for (u32 cIndex = 0; cIndex < numChannels; cIndex++) { planePntrs[cIndex] = &planes[cIndex * numFrames]; backPntrs[cIndex] = &back[cIndex * numFrames]; }
+		for (u32 sIndex = 0; sIndex < numFrames * numChannels; sIndex++) { planes[sIndex] = TestRandR32(-1.0f, 1.0f); }
+
+		bool allInterleave = true, allToI16 = true, allFromI16 = true;
+		InterleaveSamplesR32(numFrames, numChannels, planePntrs, interleaved);
+		for (u32 fIndex = 0; fIndex < numFrames; fIndex++)
+		{
+			for (u32 cIndex = 0; cIndex < numChannels; cIndex++) { if (interleaved[fIndex*numChannels + cIndex] != planePntrs[cIndex][fIndex]) { allInterleave = false; } }
+		}
+		DeinterleaveSamplesR32(numFrames, numChannels, interleaved, backPntrs);
+		TestCheckMsg(allInterleave, "%u channels", numChannels);
+		TestCheckMsg(memcmp(back, planes, numFrames * numChannels * sizeof(r32)) == 0, "%u channels", numChannels);
+
+		ConvertPlanarR32ToInterleavedI16(numFrames, numChannels, planePntrs, interleaved16);
+		ConvertInterleavedI16ToPlanarR32(numFrames, numChannels, interleaved16, backPntrs);
+		for (u32 fIndex = 0; fIndex < numFrames; fIndex++)
+		{
+			for (u32 cIndex = 0; cIndex < numChannels; cIndex++)
+			{
+				i16 sample = interleaved16[fIndex*numChannels + cIndex];
+				if (sample != ConvertSampleR32ToI16(planePntrs[cIndex][fIndex])) { allToI16 = false; }
+				if (backPntrs[cIndex][fIndex] != ConvertSampleI16ToR32(sample)) { allFromI16 = false; }
+			}
+		}
+		TestCheckMsg(allToI16, "%u channels", numChannels);
+		TestCheckMsg(allFromI16, "%u channels", numChannels);
+	}
+}
+
+void TestDither()
+{
+	TestSection("TPDF dither");
+	const u32 numSamples = (1 << 20) - 3;
+	r32* samples = (r32*)malloc(numSamples * sizeof(r32));
+	i16* results16 = (i16*)malloc(numSamples * sizeof(i16));
+	i8* results8 = (i8*)malloc(numSamples * sizeof(i8));
+	for (u32 sIndex = 0; sIndex < numSamples; sIndex++) { samples[sIndex] = 0.25f / 32767.0f; } //a quarter of an LSB
+
+	AudioDither_t dither;
+	InitAudioDither(&dither, 1234);
+	ConvertSamplesR32ToI16(numSamples, samples, results16, &dither);
+	r64 sum = 0.0;
+	i16 minValue = 0, maxValue = 0;
+	for (u32 sIndex = 0; sIndex < numSamples; sIndex++)
+	{
+		sum += results16[sIndex];
+		minValue = (i16)MinI32(minValue, results16[sIndex]);
+		maxValue = (i16)MaxI32(maxValue, results16[sIndex]);
+	}
+	r64 mean = sum / numSamples;
+	printf("  i16 dithered mean %.4f LSB (input 0.25), range [%d, %d]\n", mean, minValue, maxValue);
+	TestCheck(AbsR64(mean - 0.25) < 0.01);
+	TestCheck(minValue >= -1 && maxValue <= 1);
+
+	for (u32 sIndex = 0; sIndex < numSamples; sIndex++) { samples[sIndex] = 0.25f / 127.0f; }
+	ConvertSamplesR32ToI8(numSamples, samples, results8, &dither);
+	sum = 0.0;
+	for (u32 sIndex = 0; sIndex < numSamples; sIndex++) { sum += results8[sIndex]; }
+	printf("  i8 dithered mean %.4f LSB (input 0.25)\n", sum / numSamples);
+	TestCheck(AbsR64((sum / numSamples) - 0.25) < 0.01);
+
+	free(samples);
+	free(results16);
+	free(results8);
+}
+
+void BenchAudio()
+{
+	TestSection("Benchmarks (4096 samples, per pass)");
+	const u32 numSamples = 4096;
+	static r32 samples[numSamples], floats[numSamples];
+	static i16 results16[numSamples];
+	static i8 results8[numSamples];
+	for (u32 sIndex = 0; sIndex < numSamples; sIndex++) { samples[sIndex] = TestRandR32(-1.1f, 1.1f); }
+	AudioDither_t dither;
+	InitAudioDither(&dither, 7);
+	const r32* planes[2] = { &samples[0], &samples[numSamples/2] };
+	r32* planesOut[2] = { &floats[0], &floats[numSamples/2] };
+
+	TestBench("r32 -> i16", "ConvertSampleR64ToI16 loop", 200, numSamples, [&]() { for (u32 i = 0; i < numSamples; i++) { results16[i] = ConvertSampleR64ToI16(samples[i]); } });
+	TestBench("r32 -> i16", "ConvertSamplesR32ToI16", 200, numSamples, [&]() { ConvertSamplesR32ToI16(numSamples, samples, results16); });
+	TestBench("r32 -> i16", "ConvertSamplesR32ToI16 + dither", 200, numSamples, [&]() { ConvertSamplesR32ToI16(numSamples, samples, results16, &dither); });
+	TestBench("r32 -> i8", "ConvertSampleR64ToI8 loop", 200, numSamples, [&]() { for (u32 i = 0; i < numSamples; i++) { results8[i] = ConvertSampleR64ToI8(samples[i]); } });
+	TestBench("r32 -> i8", "ConvertSamplesR32ToI8", 200, numSamples, [&]() { ConvertSamplesR32ToI8(numSamples, samples, results8); });
+	TestBench("i16 -> r32", "ConvertSampleI16ToR64 loop", 200, numSamples, [&]() { for (u32 i = 0; i < numSamples; i++) { floats[i] = (r32)ConvertSampleI16ToR64(results16[i]); } });
+	TestBench("i16 -> r32", "ConvertSamplesI16ToR32", 200, numSamples, [&]() { ConvertSamplesI16ToR32(numSamples, results16, floats); });
+	TestBench("stereo r32 -> i16", "per-sample loop", 200, numSamples, [&]()
+	{
+		for (u32 i = 0; i < numSamples/2; i++) { results16[2*i] = ConvertSampleR32ToI16(planes[0][i]); results16[2*i+1] = ConvertSampleR32ToI16(planes[1][i]); }
+	});
+	TestBench("stereo r32 -> i16", "ConvertPlanarR32ToInterleavedI16", 200, numSamples, [&]() { ConvertPlanarR32ToInterleavedI16(numSamples/2, 2, planes, results16); });
+	TestBench("stereo i16 -> r32", "ConvertInterleavedI16ToPlanarR32", 200, numSamples, [&]() { ConvertInterleavedI16ToPlanarR32(numSamples/2, 2, results16, planesOut); });
+	TestDoNotOptimize(results16[numSamples/2]);
+	TestDoNotOptimize(results8[numSamples/2]);
+	TestDoNotOptimize(floats[numSamples/2]);
+}
+
+int main(int argc, char** argv)
+{
+	TestBegin("Audio sample conversion", argc, argv);
+	TestConversions();
+	TestLayouts();
+	TestDither();
+	if (testBenchEnabled) { BenchAudio(); }
+	return TestEnd();
+}
@@ -0,0 +1,234 @@
+/*
+File:   test_bit_set.cpp
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Checks the bit manipulation functions in orca_intrinsics.h (PopCount,
+	** CountLeading/TrailingZeros, IsPowerOfTwo/NextPowerOfTwo, Rotate and
+	** MultiplyU64Full) against the compiler builtins and naive loops, and BitSet_t
+	** from orca_bit_set.h against std::vector<bool>. Sizes around every word and
+	** block boundary are covered (including ones that are not a multiple of 64)
+	** so the padding bits past numBits are checked to stay 0.
+	** With --bench it times BitSetLoop on a sparse set against std::vector<bool>
+*/
+
+#include "orca.h"
+#include "../my_orca.h"
+#include "test_common.h"
+
+#include <vector>
+
+u64 TestRandU64() { return ((u64)TestRandU32() << 32) | (u64)TestRandU32(); }
+
+void TestBitIntrinsics()
+{
+	TestSection("PopCount, CountLeading/TrailingZeros, PowerOfTwo and Rotate");
+	//Every single bit, every low mask, and random values with 1-64 bits kept
+	std::vector<u64> values = { 0, 1, 2, 3, 0xFFFFFFFFULL, 0x80000000ULL, 0x100000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0x8000000000000000ULL };
+	for (u32 bIndex = 0; bIndex < 64; bIndex++) { values.push_back(1ULL << bIndex); values.push_back((1ULL << bIndex) - 1); values.push_back((1ULL << bIndex) + 1); }
+	for (u32 vIndex = 0; vIndex < 100000; vIndex++) { values.push_back(TestRandU64() >> TestRandU32(0, 64)); }
+
+	bool allPopCount = true, allLeading = true, allTrailing = true, allPowerOfTwo = true, allNextPower = true, allRotate = true, allMultiply = true;
+	for (u64 value64 : values)
+	{
+		u32 value32 = (u32)value64;
+		if (PopCountU32(value32) != __builtin_popcount(value32) || PopCountU64(value64) != __builtin_popcountll(value64)) { allPopCount = false; }
+		if (CountLeadingZerosU32(value32) != ((value32 != 0) ? __builtin_clz(value32) : 32)) { allLeading = false; }
+		if (CountLeadingZerosU64(value64) != ((value64 != 0) ? __builtin_clzll(value64) : 64)) { allLeading = false; }
+		if (CountTrailingZerosU32(value32) != ((value32 != 0) ? __builtin_ctz(value32) : 32)) { allTrailing = false; }
+		if (CountTrailingZerosU64(value64) != ((value64 != 0) ? __builtin_ctzll(value64) : 64)) { allTrailing = false; }
+		if (IsPowerOfTwoU32(value32) != (__builtin_popcount(value32) == 1) || IsPowerOfTwoU64(value64) != (__builtin_popcountll(value64) == 1)) { allPowerOfTwo = false; }
+
+		//Naive NextPowerOfTwo: double until we reach the value, 0 if we run out of bits
+		u64 expected32 = 1;
+		while (expected32 < value32 && expected32 <= 0x80000000ULL) { expected32 <<= 1; }
+		if (NextPowerOfTwoU32(value32) != ((expected32 > 0x80000000ULL) ? 0 : (u32)expected32)) { allNextPower = false; }
+		u64 expected64 = 1;
+		while (expected64 < value64 && expected64 != 0) { expected64 <<= 1; }
+		if (NextPowerOfTwoU64(value64) != expected64) { allNextPower = false; }
+
+		for (u32 amount = 0; amount < 70; amount += 3)
+		{
+			u32 left32 = value32, right32 = value32;
+			u64 left64 = value64, right64 = value64;
+			//One bit at a time so the reference never shifts by the full width
+			for (u32 step = 0; step < (amount & 31); step++) { left32 = (left32 << 1) | (left32 >> 31); right32 = (right32 >> 1) | (right32 << 31); }
+			for (u32 step = 0; step < (amount & 63); step++) { left64 = (left64 << 1) | (left64 >> 63); right64 = (right64 >> 1) | (right64 << 63); }
+			if (RotateLeftU32(value32, (u8)amount) != left32 || RotateRightU32(value32, (u8)amount) != right32) { allRotate = false; }
+			if (RotateLeftU64(value64, (u8)amount) != left64 || RotateRightU64(value64, (u8)amount) != right64) { allRotate = false; }
+		}
+
+		u64 other = TestRandU64();
+		u64 low = 0;
+		u64 high = MultiplyU64Full(value64, other, &low);
+		unsigned __int128 product = (unsigned __int128)value64 * other;
+		if (high != (u64)(product >> 64) || low != (u64)product) { allMultiply = false; }
+	}
+	TestCheck(allPopCount);
+	TestCheck(allLeading);
+	TestCheck(allTrailing);
+	TestCheck(allPowerOfTwo);
+	TestCheck(allNextPower);
+	TestCheck(allRotate);
+	TestCheck(allMultiply);
+	TestCheck(NextPowerOfTwoU32(0) == 1 && NextPowerOfTwoU32(0x80000000U) == 0x80000000U && NextPowerOfTwoU32(0x80000001U) == 0);
+	TestCheck(NextPowerOfTwoU64(0) == 1 && NextPowerOfTwoU64(0x8000000000000001ULL) == 0);
+}
+
+//Checks every observable part of bitSet against reference: each bit, the count, FindNext from every start and BitSetLoop
+bool BitSetMatches(const BitSet_t* bitSet, const std::vector<bool>& reference)
+{
+	if (bitSet->numBits != reference.size()) { return false; }
+	u32 expectedCount = 0;
+	for (u32 bIndex = 0; bIndex < bitSet->numBits; bIndex++)
+	{
+		if (BitSetTest(bitSet, bIndex) != reference[bIndex]) { return false; }
+		if (reference[bIndex]) { expectedCount++; }
+	}
+	if (BitSetCount(bitSet) != expectedCount) { return false; } //also catches stray bits in the padding, Count reads every word
+	for (u32 wIndex = 0; wIndex < bitSet->numWords; wIndex++)
+	{
+		for (u32 bIndex = 0; bIndex < BIT_SET_WORD_NUM_BITS; bIndex++)
+		{
+			u32 index = wIndex * BIT_SET_WORD_NUM_BITS + bIndex;
+			if (index >= bitSet->numBits && (bitSet->words[wIndex] & (1U << bIndex)) != 0) { return false; }
+		}
+	}
+
+	//FindNext from every start (and a few past the end) against a linear scan
+	u32 nextSet = bitSet->numBits;
+	for (u32 startIndex = bitSet->numBits + 3; startIndex-- > 0; )
+	{
+		if (startIndex < bitSet->numBits && reference[startIndex]) { nextSet = startIndex; }
+		u32 foundIndex = 0xFFFFFFFF;
+		bool found = BitSetFindNext(bitSet, startIndex, &foundIndex);
+		bool expectFound = (startIndex < bitSet->numBits && nextSet < bitSet->numBits);
+		if (found != expectFound) { return false; }
+		if (found && foundIndex != nextSet) { return false; }
+	}
+
+	std::vector<u32> looped;
+	BitSetLoop(bitSet, bIndex) { looped.push_back(bIndex); }
+	if (looped.size() != expectedCount) { return false; }
+	for (u32 lIndex = 0; lIndex < looped.size(); lIndex++)
+	{
+		if (!reference[looped[lIndex]]) { return false; }
+		if (lIndex > 0 && looped[lIndex] <= looped[lIndex-1]) { return false; }
+	}
+	return true;
+}
+
+void TestBitSet()
+{
+	TestSection("BitSet_t vs std::vector<bool>");
+	OC_Arena_t arena;
+	OC_ArenaInit(&arena);
+	const u32 sizes[] = { 0, 1, 5, 31, 32, 33, 63, 64, 65, 100, 127, 128, 129, 200, 255, 256, 257, 1000, 4095, 4097 };
+	TestSeedRand(7);
+	for (u32 sIndex = 0; sIndex < ArrayCount(sizes); sIndex++)
+	{
+		u32 numBits = sizes[sIndex];
+		BitSet_t left, right, result;
+		CreateBitSet(&left, &arena, numBits);
+		CreateBitSet(&right, &arena, numBits);
+		CreateBitSet(&result, &arena, numBits);
+		std::vector<bool> leftRef(numBits, false), rightRef(numBits, false);
+		bool allMatch = (left.numWords % BIT_SET_BLOCK_NUM_WORDS) == 0 && left.numWords * BIT_SET_WORD_NUM_BITS >= numBits;
+		allMatch = allMatch && (numBits == 0 || ((uintptr_t)left.words % (sizeof(u32) * BIT_SET_BLOCK_NUM_WORDS)) == 0);
+		allMatch = allMatch && BitSetMatches(&left, leftRef);
+
+		//Sparse, dense and then cleared again, so long empty runs and blocks are both covered
+		const u32 densities[] = { 2, 50, 95, 0 };
+		for (u32 dIndex = 0; dIndex < ArrayCount(densities) && numBits > 0; dIndex++)
+		{
+			for (u32 oIndex = 0; oIndex < numBits * 2; oIndex++)
+			{
+				u32 index = TestRandU32(0, numBits);
+				bool value = (TestRandU32(0, 100) < densities[dIndex]);
+				switch (TestRandU32(0, 3))
+				{
+					case 0: BitSetSetTo(&left, index, value); leftRef[index] = value; break;
+					case 1: if (value) { BitSetSet(&left, index); leftRef[index] = true; } else { BitSetClear(&left, index); leftRef[index] = false; } break;
+					case 2: BitSetSetTo(&right, index, value); rightRef[index] = value; break;
+				}
+			}
+			if (!BitSetMatches(&left, leftRef) || !BitSetMatches(&right, rightRef)) { allMatch = false; }
+
+			std::vector<bool> andRef(numBits), orRef(numBits), andNotRef(numBits);
+			for (u32 bIndex = 0; bIndex < numBits; bIndex++)
+			{
+				andRef[bIndex] = (leftRef[bIndex] && rightRef[bIndex]);
+				orRef[bIndex] = (leftRef[bIndex] || rightRef[bIndex]);
+				andNotRef[bIndex] = (leftRef[bIndex] && !rightRef[bIndex]);
+			}
+			BitSetAnd(&left, &right, &result);
+			if (!BitSetMatches(&result, andRef)) { allMatch = false; }
+			BitSetOr(&left, &right, &result);
+			if (!BitSetMatches(&result, orRef)) { allMatch = false; }
+			BitSetAndNot(&left, &right, &result);
+			if (!BitSetMatches(&result, andNotRef)) { allMatch = false; }
+		}
+
+		//resultOut may alias either input
+		BitSetOr(&left, &right, &left);
+		for (u32 bIndex = 0; bIndex < numBits; bIndex++) { leftRef[bIndex] = (leftRef[bIndex] || rightRef[bIndex]); }
+		if (!BitSetMatches(&left, leftRef)) { allMatch = false; }
+		BitSetAndNot(&left, &right, &right);
+		for (u32 bIndex = 0; bIndex < numBits; bIndex++) { rightRef[bIndex] = (leftRef[bIndex] && !rightRef[bIndex]); }
+		if (!BitSetMatches(&right, rightRef)) { allMatch = false; }
+
+		//SetAll must leave the padding past numBits clear
+		BitSetSetAll(&left);
+		leftRef.assign(numBits, true);
+		if (!BitSetMatches(&left, leftRef) || BitSetCount(&left) != numBits) { allMatch = false; }
+		BitSetAnd(&left, &left, &result);
+		if (!BitSetMatches(&result, leftRef)) { allMatch = false; }
+		BitSetClearAll(&left);
+		leftRef.assign(numBits, false);
+		if (!BitSetMatches(&left, leftRef)) { allMatch = false; }
+
+		TestCheckMsg(allMatch, "numBits %u", numBits);
+		FreeBitSet(&left);
+		FreeBitSet(&right);
+		FreeBitSet(&result);
+	}
+
+	//Only the very last bit set, so FindNext has to skip every empty block before it
+	BitSet_t lastOnly;
+	CreateBitSet(&lastOnly, &arena, 1000);
+	BitSetSet(&lastOnly, 999);
+	u32 foundIndex = 0;
+	TestCheck(BitSetFindNext(&lastOnly, 0, &foundIndex) && foundIndex == 999);
+	TestCheck(BitSetFindNext(&lastOnly, 999, nullptr) && !BitSetFindNext(&lastOnly, 1000, &foundIndex));
+	FreeBitSet(&lastOnly);
+	OC_ArenaCleanup(&arena);
+}
+
+void BenchBitSet()
+{
+	TestSection("Benchmarks (64k bits, 1% set)");
+	const u32 numBits = 64*1024;
+	OC_Arena_t arena;
+	OC_ArenaInit(&arena);
+	BitSet_t bitSet;
+	CreateBitSet(&bitSet, &arena, numBits);
+	std::vector<bool> reference(numBits, false);
+	for (u32 sIndex = 0; sIndex < numBits / 100; sIndex++) { u32 index = TestRandU32(0, numBits); BitSetSet(&bitSet, index); reference[index] = true; }
+	u64 sum = 0;
+	TestBench("iterate", "std::vector<bool> scan", 50, numBits, [&]() { for (u32 bIndex = 0; bIndex < numBits; bIndex++) { if (reference[bIndex]) { sum += bIndex; } } });
+	TestBench("iterate", "BitSetLoop", 50, numBits, [&]() { BitSetLoop(&bitSet, bIndex) { sum += bIndex; } });
+	TestBench("count", "std::vector<bool> count", 50, numBits, [&]() { for (u32 bIndex = 0; bIndex < numBits; bIndex++) { sum += reference[bIndex]; } });
+	TestBench("count", "BitSetCount", 50, numBits, [&]() { sum += BitSetCount(&bitSet); });
+	TestDoNotOptimize(sum);
+	FreeBitSet(&bitSet);
+	OC_ArenaCleanup(&arena);
+}
+
+int main(int argc, char** argv)
+{
+	TestBegin("Bit manipulation and BitSet_t", argc, argv);
+	TestBitIntrinsics();
+	TestBitSet();
+	if (testBenchEnabled) { BenchBitSet(); }
+	return TestEnd();
+}
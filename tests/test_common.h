@@ -0,0 +1,159 @@
+/*
+File:   test_common.h
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Shared pieces for the native test programs in this folder: the AssertFailure
+	** implementation my_orca.h expects, a TestCheck macro that counts failures
+	** instead of stopping, a small deterministic random number generator, and a
+	** timing helper that prints benchmark results and can collect them into a
+	** JSON file. Each test program includes this after orca.h and my_orca.h.
+	** Benchmarks only run when the program is started with --bench, and
+	** --json <path> writes every reported result to that path
+*/
+
+#ifndef _TEST_COMMON_H
+#define _TEST_COMMON_H
+
+#include <chrono>
+
+// +--------------------------------------------------------------+
+// |                          Assertions                          |
+// +--------------------------------------------------------------+
+void AssertFailure(const char* filePath, int lineNumber, const char* funcName, const char* expressionStr, const char* messageStr)
+{
+	printf("Assertion failed in %s (%s:%d): %s %s\n", funcName, filePath, lineNumber, expressionStr, (messageStr != nullptr) ? messageStr : "");
+	fflush(stdout);
+	abort();
+}
+
+static u32 testNumChecks = 0;
+static u32 testNumFailures = 0;
+
+#define TestCheck(Expression) do { testNumChecks++; if (!(Expression)) { testNumFailures++; printf("  FAILED %s:%d: %s\n", __FILE__, __LINE__, #Expression); } } while(0)
+#define TestCheckMsg(Expression, formatStr, ...) do { testNumChecks++; if (!(Expression)) { testNumFailures++; printf("  FAILED %s:%d: %s (" formatStr ")\n", __FILE__, __LINE__, #Expression, ##__VA_ARGS__); } } while(0)
+
+// +--------------------------------------------------------------+
+// |                            Random                            |
+// +--------------------------------------------------------------+
+//xorshift32, seeded the same every run so failures are reproducible
+static u32 testRandState = 0x2545F491;
+INLINE void TestSeedRand(u32 seed) { testRandState = (seed != 0) ? seed : 0x2545F491; }
+INLINE u32 TestRandU32()
+{
+	testRandState ^= (testRandState << 13);
+	testRandState ^= (testRandState >> 17);
+	testRandState ^= (testRandState << 5);
+	return testRandState;
+}
+INLINE u32 TestRandU32(u32 min, u32 max) { return min + (TestRandU32() % (max - min)); } //max is exclusive
+INLINE r32 TestRandR32() { return (r32)(TestRandU32() >> 8) / (r32)(1 << 24); } //[0, 1)
+INLINE r32 TestRandR32(r32 min, r32 max) { return min + (TestRandR32() * (max - min)); }
+INLINE r64 TestRandR64() { return (r64)(((u64)TestRandU32() << 21) ^ (u64)TestRandU32()) / (r64)(1ULL << 53); }
+
+// +--------------------------------------------------------------+
+// |                          Benchmarks                          |
+// +--------------------------------------------------------------+
+static bool testBenchEnabled = false;
+static const char* testJsonPath = nullptr;
+static char testJsonBuffer[64*1024];
+static u64 testJsonLength = 0;
+
+INLINE r64 TestGetTimeMs()
+{
+	return std::chrono::duration<r64, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+//Keeps the compiler from optimizing away a benchmark loop whose results are never read
+#define TestDoNotOptimize(value) __asm__ volatile("" : : "g"(value) : "memory")
+#define TestClobberMemory()      __asm__ volatile("" : : : "memory")
+
+//Runs func once to warm up, then numRuns times, and returns the fastest run in milliseconds
+template<typename Func>
+r64 TestTimeBestMs(u32 numRuns, Func func)
+{
+	func();
+	r64 bestMs = 1e30;
+	for (u32 rIndex = 0; rIndex < numRuns; rIndex++)
+	{
+		r64 startMs = TestGetTimeMs();
+		func();
+		TestClobberMemory();
+		r64 elapsedMs = TestGetTimeMs() - startMs;
+		if (elapsedMs < bestMs) { bestMs = elapsedMs; }
+	}
+	return bestMs;
+}
+
+//numOps is how many operations one call to func performs, the result is reported as ns per operation and millions of operations per second
+void TestReportBench(const char* group, const char* name, r64 bestMs, u64 numOps)
+{
+	r64 nsPerOp = (bestMs * 1000000.0) / (r64)numOps;
+	r64 mopsPerSec = (nsPerOp > 0.0) ? (1000.0 / nsPerOp) : 0.0;
+	printf("  %-14s %-34s %10.3f ms %10.3f ns/op %9.1f Mop/s\n", group, name, bestMs, nsPerOp, mopsPerSec);
+	if (testJsonPath != nullptr)
+	{
+		u64 spaceLeft = sizeof(testJsonBuffer) - testJsonLength;
+		int numChars = snprintf(&testJsonBuffer[testJsonLength], spaceLeft,
+			"%s\n\t{\"group\": \"%s\", \"name\": \"%s\", \"ms\": %.4f, \"ops\": %llu, \"ns_per_op\": %.4f, \"mops_per_sec\": %.2f}",
+			(testJsonLength > 0) ? "," : "", group, name, bestMs, (unsigned long long)numOps, nsPerOp, mopsPerSec
+		);
+		Assert(numChars > 0 && (u64)numChars < spaceLeft);
+		testJsonLength += (u64)numChars;
+	}
+}
+template<typename Func>
+void TestBench(const char* group, const char* name, u32 numRuns, u64 numOps, Func func)
+{
+	TestReportBench(group, name, TestTimeBestMs(numRuns, func), numOps);
+}
+
+// +--------------------------------------------------------------+
+// |                        Begin and End                         |
+// +--------------------------------------------------------------+
+#if DEBUG_BUILD
+#define TEST_BUILD_TYPE_STR ", debug"
+#else
+#define TEST_BUILD_TYPE_STR ""
+#endif
+
+void TestBegin(const char* testName, int argc, char** argv)
+{
+	setvbuf(stdout, nullptr, _IONBF, 0);
+	for (int aIndex = 1; aIndex < argc; aIndex++)
+	{
+		if (strcmp(argv[aIndex], "--bench") == 0) { testBenchEnabled = true; }
+		else if (strcmp(argv[aIndex], "--json") == 0 && aIndex+1 < argc) { testJsonPath = argv[++aIndex]; testBenchEnabled = true; }
+		else { printf("Unknown argument \"%s\" (expected --bench or --json <path>)\n", argv[aIndex]); exit(2); }
+	}
+	printf("%s (%s%s)\n", testName,
+		ORCA_SIMD_SSE ? "SSE" : (ORCA_SIMD_NEON ? "NEON" : (ORCA_SIMD_WASM ? "WASM SIMD128" : "scalar")),
+		TEST_BUILD_TYPE_STR
+	);
+}
+void TestSection(const char* sectionName)
+{
+	printf(" %s\n", sectionName);
+}
+
+//Returns the process exit code
+int TestEnd()
+{
+	if (testJsonPath != nullptr)
+	{
+		FILE* jsonFile = fopen(testJsonPath, "w");
+		if (jsonFile == nullptr) { printf("Couldn't open \"%s\" for writing\n", testJsonPath); return 2; }
+		fprintf(jsonFile, "[%.*s\n]\n", (int)testJsonLength, testJsonBuffer);
+		fclose(jsonFile);
+		printf(" Wrote benchmark results to %s\n", testJsonPath);
+	}
+	if (testNumFailures > 0)
+	{
+		printf(" %u/%u checks FAILED\n", testNumFailures, testNumChecks);
+		return 1;
+	}
+	printf(" All %u checks passed\n", testNumChecks);
+	return 0;
+}
+
+#endif //  _TEST_COMMON_H
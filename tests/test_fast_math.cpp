@@ -0,0 +1,259 @@
+/*
+File:   test_fast_math.cpp
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Sweeps the Fast Math Approximations in orca_intrinsics.h against the r64
+	** libm result over the domains stated in their comments, prints the measured
+	** max error, and checks it stays inside the documented bound. The Array
+	** versions are swept too since on SIMD builds they run different code.
+	** With --bench it times each approximation against the libm call it replaces
+*/
+
+#include "orca.h"
+#include "../my_orca.h"
+#include "test_common.h"
+
+#define SWEEP_COUNT (1 << 22)
+
+static r32 inputs[SWEEP_COUNT];
+static r32 inputs2[SWEEP_COUNT];
+static r32 outputs[SWEEP_COUNT];
+static r32 outputs2[SWEEP_COUNT];
+
+#define R32_EPSILON 1.1920928955078125e-7 //2^-23, the ULP of 1.0f
+
+//Size of one ULP at the r32 nearest to reference (the gap to the next larger r32)
+r64 UlpAt(r64 reference)
+{
+	r32 rounded = (r32)AbsR64(reference);
+	return (r64)(nextafterf(rounded, INFINITY) - rounded);
+}
+
+struct SweepError_t
+{
+	r64 maxAbs;
+	r64 maxRel;
+	r64 maxUlp;
+	r32 worstInput;
+};
+void AddError(SweepError_t* error, r32 input, r32 approx, r64 reference)
+{
+	r64 absError = AbsR64((r64)approx - reference);
+	if (absError > error->maxAbs) { error->maxAbs = absError; error->worstInput = input; }
+	if (reference != 0.0)
+	{
+		error->maxRel = MaxR64(error->maxRel, absError / AbsR64(reference));
+		error->maxUlp = MaxR64(error->maxUlp, absError / UlpAt(reference));
+	}
+}
+
+void TestSinCos()
+{
+	TestSection("SinCosFastR32, |angle| <= 8192");
+	SweepError_t sinError = {}, cosError = {}, arrayError = {};
+	for (u32 i = 0; i < SWEEP_COUNT; i++)
+	{
+		r32 angle = -8192.0f + (16384.0f * (r32)i / (r32)(SWEEP_COUNT-1));
+		inputs[i] = angle;
+		r32 sinValue, cosValue;
+		SinCosFastR32(angle, &sinValue, &cosValue);
+		AddError(&sinError, angle, sinValue, sin((r64)angle));
+		AddError(&cosError, angle, cosValue, cos((r64)angle));
+	}
+	SinCosFastArrayR32(SWEEP_COUNT, inputs, outputs, outputs2);
+	for (u32 i = 0; i < SWEEP_COUNT; i++)
+	{
+		AddError(&arrayError, inputs[i], outputs[i], sin((r64)inputs[i]));
+		AddError(&arrayError, inputs[i], outputs2[i], cos((r64)inputs[i]));
+	}
+	printf("  sin max abs %.4g (at %.9g), cos max abs %.4g (at %.9g), array max abs %.4g\n", sinError.maxAbs, sinError.worstInput, cosError.maxAbs, cosError.worstInput, arrayError.maxAbs);
+	TestCheck(sinError.maxAbs <= 7.85e-8);
+	TestCheck(cosError.maxAbs <= 7.85e-8);
+	TestCheck(arrayError.maxAbs <= 7.85e-8);
+}
+
+void TestAtan()
+{
+	TestSection("AtanFastR32, y and x over [-5e5, 5e5] at random scales");
+	SweepError_t atanError = {}, arrayError = {};
+	TestSeedRand(1);
+	for (u32 i = 0; i < SWEEP_COUNT; i++)
+	{
+		r32 y = (TestRandR32() - 0.5f) * PowR32(10.0f, (r32)TestRandU32(0, 12) - 6.0f);
+		r32 x = (TestRandR32() - 0.5f) * PowR32(10.0f, (r32)TestRandU32(0, 12) - 6.0f);
+		inputs[i] = y; inputs2[i] = x;
+		AddError(&atanError, y, AtanFastR32(y, x), atan2((r64)y, (r64)x));
+	}
+	AtanFastArrayR32(SWEEP_COUNT, inputs, inputs2, outputs);
+	for (u32 i = 0; i < SWEEP_COUNT; i++) { AddError(&arrayError, inputs[i], outputs[i], atan2((r64)inputs[i], (r64)inputs2[i])); }
+	printf("  atan max abs %.4g (at y=%.9g), array max abs %.4g\n", atanError.maxAbs, atanError.worstInput, arrayError.maxAbs);
+	TestCheck(atanError.maxAbs <= 2.75e-7);
+	TestCheck(arrayError.maxAbs <= 2.75e-7);
+
+	TestCheck(AtanFastR32(0.0f, -1.0f) == Pi32);
+	TestCheck(AtanFastR32(-0.0f, -1.0f) == -Pi32);
+	//Signed zeros follow atan2f, including x = -0 which (x < 0) would miss
+	const r32 zeroYs[] = { 0.0f, -0.0f, 0.0f, -0.0f, 1.0f, -1.0f };
+	const r32 zeroXs[] = { 0.0f, 0.0f, -0.0f, -0.0f, -0.0f, -0.0f };
+	r32 zeroResults[ArrayCount(zeroYs)];
+	AtanFastArrayR32(ArrayCount(zeroYs), zeroYs, zeroXs, zeroResults);
+	bool allSignedZeros = true;
+	for (u32 zIndex = 0; zIndex < ArrayCount(zeroYs); zIndex++)
+	{
+		r32 expected = atan2f(zeroYs[zIndex], zeroXs[zIndex]);
+		r32 scalarResult = AtanFastR32(zeroYs[zIndex], zeroXs[zIndex]);
+		if (R32ToBits(scalarResult) != R32ToBits(expected) || R32ToBits(zeroResults[zIndex]) != R32ToBits(expected))
+		{
+			allSignedZeros = false;
+			printf("  AtanFastR32(%g, %g) = %g (array %g), expected %g\n", zeroYs[zIndex], zeroXs[zIndex], scalarResult, zeroResults[zIndex], expected);
+		}
+	}
+	TestCheck(allSignedZeros);
+	TestCheck(AtanFastR32(1.0f, 0.0f) == HalfPi32);
+	TestCheck(AtanFastR32(-1.0f, 0.0f) == -HalfPi32);
+}
+
+void TestExp2()
+{
+	TestSection("Exp2FastR32, value in [-126, 127]");
+	SweepError_t expError = {}, arrayError = {};
+	for (u32 i = 0; i < SWEEP_COUNT; i++)
+	{
+		r32 value = -126.0f + (253.0f * (r32)i / (r32)(SWEEP_COUNT-1));
+		inputs[i] = value;
+		AddError(&expError, value, Exp2FastR32(value), exp2((r64)value));
+	}
+	Exp2FastArrayR32(SWEEP_COUNT, inputs, outputs);
+	for (u32 i = 0; i < SWEEP_COUNT; i++) { AddError(&arrayError, inputs[i], outputs[i], exp2((r64)inputs[i])); }
+	printf("  exp2 max relative %.3g (%.3f * epsilon), %.3f ULP; array max relative %.3g\n", expError.maxRel, expError.maxRel / R32_EPSILON, expError.maxUlp, arrayError.maxRel);
+	TestCheck(expError.maxRel <= 0.81 * R32_EPSILON);
+	TestCheck(expError.maxUlp <= 1.15);
+	TestCheck(arrayError.maxRel <= 0.81 * R32_EPSILON);
+	TestCheck(arrayError.maxUlp <= 1.15);
+	TestCheck(Exp2FastR32(-1000.0f) == exp2f(-126.0f));
+	TestCheck(Exp2FastR32(1000.0f) == exp2f(127.0f));
+	TestCheck(Exp2FastR32(INFINITY) == exp2f(127.0f) && Exp2FastR32(-INFINITY) == exp2f(-126.0f));
+	
+	//NaN goes through in every lane position, and doesn't disturb its neighbours
+	r32 nanInputs[7] = { 1.0f, NAN, -3.0f, -NAN, NAN, 2.5f, NAN };
+	r32 nanOutputs[7];
+	Exp2FastArrayR32(ArrayCount(nanInputs), nanInputs, nanOutputs);
+	bool allNans = (Exp2FastR32(NAN) != Exp2FastR32(NAN) && ExpFastR32(NAN) != ExpFastR32(NAN));
+	for (u32 nIndex = 0; nIndex < ArrayCount(nanInputs); nIndex++)
+	{
+		bool inputIsNan = (nanInputs[nIndex] != nanInputs[nIndex]);
+		if (inputIsNan ? (nanOutputs[nIndex] == nanOutputs[nIndex]) : (nanOutputs[nIndex] != Exp2FastR32(nanInputs[nIndex]))) { allNans = false; }
+	}
+	TestCheck(allNans);
+	
+	TestSection("ExpFastR32, value in [-87.3, 88.0]");
+	SweepError_t eError = {}, eArrayError = {};
+	for (u32 i = 0; i < SWEEP_COUNT; i++)
+	{
+		r32 value = -87.3f + (175.3f * (r32)i / (r32)(SWEEP_COUNT-1));
+		inputs[i] = value;
+		AddError(&eError, value, ExpFastR32(value), exp((r64)value));
+	}
+	ExpFastArrayR32(SWEEP_COUNT, inputs, outputs);
+	for (u32 i = 0; i < SWEEP_COUNT; i++) { AddError(&eArrayError, inputs[i], outputs[i], exp((r64)inputs[i])); }
+	printf("  exp max relative %.3g, %.3f ULP; array %.3f ULP\n", eError.maxRel, eError.maxUlp, eArrayError.maxUlp);
+	TestCheck(eError.maxUlp <= 64.0);
+	TestCheck(eArrayError.maxUlp <= 64.0);
+}
+
+void TestLog()
+{
+	TestSection("Log2FastR32 and LnFastR32, value in [2^-126, 2^128)");
+	SweepError_t log2Error = {}, lnError = {}, arrayError = {};
+	r64 log2SmallAbs = 0.0, lnSmallAbs = 0.0;
+	for (u32 i = 0; i < SWEEP_COUNT; i++)
+	{
+		//Every 64th input is spread exponentially over the whole range, the rest are dense around 1 where the absolute bound applies
+		r32 value = ((i % 64) == 0)
+			? exp2f(-126.0f + (253.99f * (r32)i / (r32)(SWEEP_COUNT-1)))
+			: 0.25f + (3.75f * (r32)i / (r32)(SWEEP_COUNT-1));
+		inputs[i] = value;
+		r64 log2Ref = log2((r64)value);
+		r64 lnRef = log((r64)value);
+		r32 log2Value = Log2FastR32(value);
+		r32 lnValue = LnFastR32(value);
+		if (AbsR64(log2Ref) > 0.5) { AddError(&log2Error, value, log2Value, log2Ref); }
+		else { log2SmallAbs = MaxR64(log2SmallAbs, AbsR64((r64)log2Value - log2Ref)); }
+		if (AbsR64(lnRef) > 0.5) { AddError(&lnError, value, lnValue, lnRef); }
+		else { lnSmallAbs = MaxR64(lnSmallAbs, AbsR64((r64)lnValue - lnRef)); }
+	}
+	LnFastArrayR32(SWEEP_COUNT, inputs, outputs2);
+	Log2FastArrayR32(SWEEP_COUNT, inputs, outputs);
+	r64 arraySmallAbs = 0.0;
+	SweepError_t lnArrayError = {};
+	r64 lnArraySmallAbs = 0.0;
+	for (u32 i = 0; i < SWEEP_COUNT; i++)
+	{
+		r64 log2Ref = log2((r64)inputs[i]);
+		if (AbsR64(log2Ref) > 0.5) { AddError(&arrayError, inputs[i], outputs[i], log2Ref); }
+		else { arraySmallAbs = MaxR64(arraySmallAbs, AbsR64((r64)outputs[i] - log2Ref)); }
+		r64 lnRef = log((r64)inputs[i]);
+		if (AbsR64(lnRef) > 0.5) { AddError(&lnArrayError, inputs[i], outputs2[i], lnRef); }
+		else { lnArraySmallAbs = MaxR64(lnArraySmallAbs, AbsR64((r64)outputs2[i] - lnRef)); }
+	}
+	printf("  log2 max %.3f ULP (|result| > 0.5), max abs %.3g otherwise; array %.3f ULP, %.3g abs\n", log2Error.maxUlp, log2SmallAbs, arrayError.maxUlp, arraySmallAbs);
+	printf("  ln   max %.3f ULP (|result| > 0.5), max abs %.3g otherwise; array %.3f ULP, %.3g abs\n", lnError.maxUlp, lnSmallAbs, lnArrayError.maxUlp, lnArraySmallAbs);
+	TestCheck(log2Error.maxUlp <= 1.4);
+	TestCheck(log2SmallAbs <= 5.4e-8);
+	TestCheck(arrayError.maxUlp <= 1.4);
+	TestCheck(arraySmallAbs <= 5.4e-8);
+	TestCheck(lnError.maxUlp <= 0.81);
+	TestCheck(lnSmallAbs <= 2.6e-8);
+	TestCheck(lnArrayError.maxUlp <= 0.81);
+	TestCheck(lnArraySmallAbs <= 2.6e-8);
+}
+
+void TestPow()
+{
+	TestSection("PowFastR32, value in [1e-3, 1e3], power in [-4, 4]");
+	SweepError_t powError = {};
+	TestSeedRand(2);
+	for (u32 i = 0; i < SWEEP_COUNT; i++)
+	{
+		r32 value = PowR32(10.0f, TestRandR32(-3.0f, 3.0f));
+		r32 power = TestRandR32(-4.0f, 4.0f);
+		AddError(&powError, value, PowFastR32(value, power), pow((r64)value, (r64)power));
+	}
+	printf("  pow max relative %.3g\n", powError.maxRel);
+	TestCheck(powError.maxRel <= 2.8e-6);
+}
+
+void BenchFastMath()
+{
+	TestSection("Benchmarks (64k values, per pass)");
+	const u32 numValues = 64*1024;
+	for (u32 i = 0; i < numValues; i++) { inputs[i] = TestRandR32(-100.0f, 100.0f); inputs2[i] = TestRandR32(0.001f, 100.0f); }
+	TestBench("sin", "sinf", 30, numValues, [&]() { for (u32 i = 0; i < numValues; i++) { outputs[i] = sinf(inputs[i]); } });
+	TestBench("sin", "SinFastR32", 30, numValues, [&]() { for (u32 i = 0; i < numValues; i++) { outputs[i] = SinFastR32(inputs[i]); } });
+	TestBench("sin", "SinFastArrayR32", 30, numValues, [&]() { SinFastArrayR32(numValues, inputs, outputs); });
+	TestBench("atan2", "atan2f", 30, numValues, [&]() { for (u32 i = 0; i < numValues; i++) { outputs[i] = atan2f(inputs[i], inputs2[i]); } });
+	TestBench("atan2", "AtanFastR32", 30, numValues, [&]() { for (u32 i = 0; i < numValues; i++) { outputs[i] = AtanFastR32(inputs[i], inputs2[i]); } });
+	TestBench("atan2", "AtanFastArrayR32", 30, numValues, [&]() { AtanFastArrayR32(numValues, inputs, inputs2, outputs); });
+	TestBench("exp2", "exp2f", 30, numValues, [&]() { for (u32 i = 0; i < numValues; i++) { outputs[i] = exp2f(inputs[i]); } });
+	TestBench("exp2", "Exp2FastR32", 30, numValues, [&]() { for (u32 i = 0; i < numValues; i++) { outputs[i] = Exp2FastR32(inputs[i]); } });
+	TestBench("exp2", "Exp2FastArrayR32", 30, numValues, [&]() { Exp2FastArrayR32(numValues, inputs, outputs); });
+	TestBench("log2", "log2f", 30, numValues, [&]() { for (u32 i = 0; i < numValues; i++) { outputs[i] = log2f(inputs2[i]); } });
+	TestBench("log2", "Log2FastR32", 30, numValues, [&]() { for (u32 i = 0; i < numValues; i++) { outputs[i] = Log2FastR32(inputs2[i]); } });
+	TestBench("log2", "Log2FastArrayR32", 30, numValues, [&]() { Log2FastArrayR32(numValues, inputs2, outputs); });
+	TestBench("pow", "powf", 30, numValues, [&]() { for (u32 i = 0; i < numValues; i++) { outputs[i] = powf(inputs2[i], 2.2f); } });
+	TestBench("pow", "PowFastR32", 30, numValues, [&]() { for (u32 i = 0; i < numValues; i++) { outputs[i] = PowFastR32(inputs2[i], 2.2f); } });
+	TestDoNotOptimize(outputs[numValues/2]);
+}
+
+int main(int argc, char** argv)
+{
+	TestBegin("Fast math approximations", argc, argv);
+	TestSinCos();
+	TestAtan();
+	TestExp2();
+	TestLog();
+	TestPow();
+	if (testBenchEnabled) { BenchFastMath(); }
+	return TestEnd();
+}
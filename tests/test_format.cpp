@@ -0,0 +1,232 @@
+/*
+File:   test_format.cpp
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Checks the functions in orca_format.h against the C library: integers and hex
+	** against snprintf, FormatR64/FormatR32 against std::to_chars (same shortest digits,
+	** and strtod/strtof reads them back as the exact same value), and FormatR64Fixed
+	** against snprintf "%.*f" on random bit patterns over every exponent, so the exact
+	** slow path for huge values (up to DBL_MAX with 15 decimals) is covered too.
+	** With --bench it times each one against the snprintf call it replaces
+*/
+
+#include "orca.h"
+#include "../my_orca.h"
+#include "test_common.h"
+
+#include <vector>
+#include <string>
+#include <charconv>
+#include <cmath>
+#include <cfloat>
+
+INLINE u64 TestRandU64() { return ((u64)TestRandU32() << 32) | TestRandU32(); }
+
+std::string ToStdStr(MyStr_t str) { return std::string(str.chars, str.length); }
+
+void TestIntegers()
+{
+	TestSection("Integers and hex vs snprintf");
+	char buffer[FORMAT_U64_MAX_LENGTH];
+	char reference[32];
+	bool allU64 = true, allI64 = true, allHex = true;
+	for (u32 iIndex = 0; iIndex < 500000; iIndex++)
+	{
+		u64 value = TestRandU64() >> TestRandU32(0, 64); //every digit count shows up
+		snprintf(reference, sizeof(reference), "%llu", (unsigned long long)value);
+		if (ToStdStr(FormatU64(value, buffer, sizeof(buffer))) != reference) { allU64 = false; }
+		i64 signedValue = (i64)TestRandU64() >> TestRandU32(0, 64);
+		snprintf(reference, sizeof(reference), "%lld", (long long)signedValue);
+		if (ToStdStr(FormatI64(signedValue, buffer, sizeof(buffer))) != reference) { allI64 = false; }
+		u32 minNumDigits = TestRandU32(1, 17);
+		snprintf(reference, sizeof(reference), "0x%0*llX", (int)minNumDigits, (unsigned long long)value);
+		if (ToStdStr(FormatHex(value, buffer, FORMAT_HEX_MAX_LENGTH, minNumDigits, true)) != reference) { allHex = false; }
+	}
+	TestCheck(allU64);
+	TestCheck(allI64);
+	TestCheck(allHex);
+	TestCheck(ToStdStr(FormatU64(UINT64_MAX, buffer, sizeof(buffer))) == "18446744073709551615");
+	TestCheck(ToStdStr(FormatI64(INT64_MIN, buffer, sizeof(buffer))) == "-9223372036854775808");
+	TestCheck(ToStdStr(FormatU64(0, buffer, sizeof(buffer))) == "0" && ToStdStr(FormatHex(0, buffer, sizeof(buffer))) == "0");
+}
+
+//Formats value with FormatR64/FormatR32 and checks it reads back as exactly value and has the same digits as std::to_chars
+template<typename T>
+bool CheckShortest(T value)
+{
+	char buffer[FORMAT_R64_MAX_LENGTH];
+	MyStr_t str = (sizeof(T) == 8) ? FormatR64((r64)value, buffer, sizeof(buffer)) : FormatR32((r32)value, buffer, sizeof(buffer));
+	std::string ours = ToStdStr(str);
+	if (std::isnan(value)) { return (ours == "nan"); }
+	T readBack = (sizeof(T) == 8) ? (T)strtod(ours.c_str(), nullptr) : (T)strtof(ours.c_str(), nullptr);
+	if (memcmp(&readBack, &value, sizeof(T)) != 0) { printf("  %s reads back as %.17g, not %.17g\n", ours.c_str(), (r64)readBack, (r64)value); return false; }
+	if (value == 0 || std::isinf(value)) { return true; }
+	//The layout differs from to_chars (we switch to scientific at other points), so only compare the digits and the exponent
+	char reference[64];
+	char* referenceEnd = std::to_chars(reference, reference + sizeof(reference) - 1, value, std::chars_format::scientific).ptr;
+	*referenceEnd = '\0';
+	std::string referenceDigits, ourDigits;
+	const char* exponentPntr = reference;
+	for (; exponentPntr < referenceEnd && *exponentPntr != 'e'; exponentPntr++) { if (*exponentPntr >= '0' && *exponentPntr <= '9') { referenceDigits += *exponentPntr; } }
+	int referenceExponent = atoi(exponentPntr + 1);
+	u64 bits = 0;
+	memcpy(&bits, &value, sizeof(T));
+	FormatDecimal_t decimal = (sizeof(T) == 8)
+		? FormatGetShortestDecimal(bits & ((1ULL << 52) - 1), (u32)((bits >> 52) & 0x7FF), 52, 1023)
+		: FormatGetShortestDecimal(bits & ((1ULL << 23) - 1), (u32)((bits >> 23) & 0xFF), 23, 127);
+	ourDigits = std::to_string(decimal.digits);
+	if (ourDigits != referenceDigits || decimal.exponent + (int)ourDigits.size() - 1 != referenceExponent)
+	{
+		printf("  %s has digits %s, to_chars gives %.*s\n", ours.c_str(), ourDigits.c_str(), (int)(referenceEnd - reference), reference);
+		return false;
+	}
+	return true;
+}
+
+void TestShortest()
+{
+	TestSection("FormatR64/FormatR32 vs std::to_chars");
+	bool allRandom64 = true, allNice64 = true, allPowers = true, allRandom32 = true, allExponents32 = true;
+	for (u32 iIndex = 0; iIndex < 1000000; iIndex++)
+	{
+		u64 bits = TestRandU64();
+		r64 value;
+		memcpy(&value, &bits, sizeof(value));
+		if (!CheckShortest(value)) { allRandom64 = false; }
+	}
+	for (u32 iIndex = 0; iIndex < 500000; iIndex++)
+	{
+		r64 value = (r64)TestRandU32(0, 1000000) / (r64)FormatPowersOf10[TestRandU32(0, 8)];
+		if (!CheckShortest(value) || !CheckShortest(-value * 1e-10)) { allNice64 = false; }
+	}
+	for (i32 exponent = -1074; exponent < 1024; exponent++)
+	{
+		r64 power = ldexp(1.0, exponent);
+		if (!CheckShortest(power) || !CheckShortest(nextafter(power, 0.0)) || !CheckShortest(nextafter(power, INFINITY))) { allPowers = false; }
+	}
+	for (u32 iIndex = 0; iIndex < 1000000; iIndex++)
+	{
+		u32 bits = TestRandU32();
+		r32 value;
+		memcpy(&value, &bits, sizeof(value));
+		if (!CheckShortest(value)) { allRandom32 = false; }
+	}
+	for (u32 exponent = 0; exponent < 255; exponent++)
+	{
+		for (u32 iIndex = 0; iIndex < 2000; iIndex++)
+		{
+			u32 bits = (exponent << 23) | ((iIndex < 16) ? iIndex : (TestRandU32() & 0x7FFFFF));
+			r32 value;
+			memcpy(&value, &bits, sizeof(value));
+			if (!CheckShortest(value)) { allExponents32 = false; }
+		}
+	}
+	TestCheck(allRandom64);
+	TestCheck(allNice64);
+	TestCheck(allPowers);
+	TestCheck(allRandom32);
+	TestCheck(allExponents32);
+	char buffer[FORMAT_R64_MAX_LENGTH];
+	TestCheck(ToStdStr(FormatR32(0.1f, buffer, sizeof(buffer))) == "0.1");
+	TestCheck(ToStdStr(FormatR64(-2.2250738585072014e-308, buffer, sizeof(buffer))).length() <= FORMAT_R64_MAX_LENGTH);
+	TestCheck(ToStdStr(FormatR64(-INFINITY, buffer, sizeof(buffer))) == "-inf" && ToStdStr(FormatR64(-0.0, buffer, sizeof(buffer))) == "-0");
+}
+
+bool CheckFixed(r64 value, u32 numDecimals)
+{
+	char buffer[FORMAT_R64_FIXED_MAX_LENGTH];
+	char reference[FORMAT_R64_FIXED_MAX_LENGTH + 1];
+	std::string ours = ToStdStr(FormatR64Fixed(value, numDecimals, buffer, sizeof(buffer)));
+	snprintf(reference, sizeof(reference), "%.*f", (int)numDecimals, value);
+	if (ours != reference) { printf("  %%.%uf of %.17g: %s, snprintf gives %s\n", numDecimals, value, ours.c_str(), reference); return false; }
+	return true;
+}
+
+void TestFixed()
+{
+	TestSection("FormatR64Fixed vs snprintf %.*f");
+	bool allNice = true, allRandom = true, allLarge = true, allTies = true;
+	for (u32 iIndex = 0; iIndex < 500000; iIndex++)
+	{
+		r64 value = (r64)((i32)TestRandU32(0, 20000000) - 10000000) / (r64)FormatPowersOf10[TestRandU32(0, 5)];
+		if (TestRandU32(0, 2) == 0) { value += 0.0001234; }
+		if (!CheckFixed(value, TestRandU32(0, 8))) { allNice = false; }
+	}
+	//Random bit patterns hit every exponent, anything at or above about 4.5 * 10^(15 - numDecimals) goes through FormatR64FixedExact
+	for (u32 iIndex = 0; iIndex < 300000; iIndex++)
+	{
+		u64 bits = TestRandU64();
+		r64 value;
+		memcpy(&value, &bits, sizeof(value));
+		if (std::isnan(value)) { continue; }
+		if (!CheckFixed(value, TestRandU32(0, FORMAT_MAX_FIXED_DECIMALS + 1))) { allRandom = false; }
+	}
+	for (u32 iIndex = 0; iIndex < 300000; iIndex++)
+	{
+		r64 value = TestRandR64() * pow(10.0, (r64)TestRandU32(0, 25)) * ((TestRandU32(0, 2) == 0) ? -1.0 : 1.0);
+		if (!CheckFixed(value, TestRandU32(0, FORMAT_MAX_FIXED_DECIMALS + 1))) { allLarge = false; }
+	}
+	//Exact ties in binary round to even, on both paths
+	for (u32 iIndex = 0; iIndex < 100000; iIndex++)
+	{
+		u32 numDecimals = TestRandU32(0, 4);
+		r64 value = ((r64)TestRandU32(0, 1u << 30) + 0.5) / (r64)FormatPowersOf10[numDecimals];
+		if (!CheckFixed(value, numDecimals)) { allTies = false; }
+	}
+	TestCheck(allNice);
+	TestCheck(allRandom);
+	TestCheck(allLarge);
+	TestCheck(allTies);
+	TestCheck(CheckFixed(13040213.364725117, 14));
+	TestCheck(CheckFixed(1e300, 2));
+	TestCheck(CheckFixed(4503599627370495.5, 0) && CheckFixed(4503599627370496.5, 0) && CheckFixed(0.49999999999999994, 0));
+	TestCheck(CheckFixed(DBL_MIN, 15) && CheckFixed(-5e-324, 3));
+	char buffer[FORMAT_R64_FIXED_MAX_LENGTH];
+	MyStr_t longest = FormatR64Fixed(-DBL_MAX, FORMAT_MAX_FIXED_DECIMALS, buffer, sizeof(buffer));
+	TestCheck(longest.length == FORMAT_R64_FIXED_MAX_LENGTH && CheckFixed(-DBL_MAX, FORMAT_MAX_FIXED_DECIMALS));
+	TestCheck(ToStdStr(FormatR64Fixed(INFINITY, 2, buffer, sizeof(buffer))) == "inf" && ToStdStr(FormatR64Fixed(-INFINITY, 0, buffer, sizeof(buffer))) == "-inf");
+	TestCheck(ToStdStr(FormatR64Fixed(NAN, 2, buffer, sizeof(buffer))) == "nan");
+	TestCheck(ToStdStr(FormatR32Fixed(0.1f, 10, buffer, sizeof(buffer))) == "0.1000000015");
+}
+
+void BenchFormat()
+{
+	TestSection("Benchmarks (per call)");
+	const u32 numValues = 200000;
+	std::vector<u64> integers(numValues);
+	std::vector<r64> floats(numValues), frameTimes(numValues), largeFloats(numValues);
+	for (u32 vIndex = 0; vIndex < numValues; vIndex++)
+	{
+		integers[vIndex] = TestRandU64() >> TestRandU32(0, 64);
+		u64 bits = TestRandU64() & ~(0x7FFULL << 52);
+		bits |= (u64)TestRandU32(1023 - 30, 1023 + 30) << 52; //1e-9 to 1e9 or so
+		memcpy(&floats[vIndex], &bits, sizeof(r64));
+		frameTimes[vIndex] = 16.6 + TestRandR64() * 10.0;
+		largeFloats[vIndex] = TestRandR64() * 1e22;
+	}
+	char buffer[FORMAT_R64_FIXED_MAX_LENGTH];
+	u64 sum = 0;
+	TestBench("u64", "snprintf %llu", 10, numValues, [&]() { for (u64 value : integers) { sum += snprintf(buffer, sizeof(buffer), "%llu", (unsigned long long)value); } });
+	TestBench("u64", "FormatU64", 10, numValues, [&]() { for (u64 value : integers) { sum += FormatU64(value, buffer, sizeof(buffer)).length; } });
+	TestBench("hex", "snprintf 0x%08llX", 10, numValues, [&]() { for (u64 value : integers) { sum += snprintf(buffer, sizeof(buffer), "0x%08llX", (unsigned long long)value); } });
+	TestBench("hex", "FormatHex", 10, numValues, [&]() { for (u64 value : integers) { sum += FormatHex(value, buffer, sizeof(buffer), 8, true).length; } });
+	TestBench("r64 shortest", "snprintf %.17g", 10, numValues, [&]() { for (r64 value : floats) { sum += snprintf(buffer, sizeof(buffer), "%.17g", value); } });
+	TestBench("r64 shortest", "std::to_chars", 10, numValues, [&]() { for (r64 value : floats) { sum += (u64)(std::to_chars(buffer, buffer + sizeof(buffer), value).ptr - buffer); } });
+	TestBench("r64 shortest", "FormatR64", 10, numValues, [&]() { for (r64 value : floats) { sum += FormatR64(value, buffer, sizeof(buffer)).length; } });
+	TestBench("r64 fixed", "snprintf %.2f", 10, numValues, [&]() { for (r64 value : frameTimes) { sum += snprintf(buffer, sizeof(buffer), "%.2f", value); } });
+	TestBench("r64 fixed", "FormatR64Fixed 2", 10, numValues, [&]() { for (r64 value : frameTimes) { sum += FormatR64Fixed(value, 2, buffer, sizeof(buffer)).length; } });
+	TestBench("r64 fixed big", "snprintf %.6f", 10, numValues, [&]() { for (r64 value : largeFloats) { sum += snprintf(buffer, sizeof(buffer), "%.6f", value); } });
+	TestBench("r64 fixed big", "FormatR64Fixed 6 (exact path)", 10, numValues, [&]() { for (r64 value : largeFloats) { sum += FormatR64Fixed(value, 6, buffer, sizeof(buffer)).length; } });
+	TestDoNotOptimize(sum);
+}
+
+int main(int argc, char** argv)
+{
+	TestBegin("Number formatting", argc, argv);
+	TestIntegers();
+	TestShortest();
+	TestFixed();
+	if (testBenchEnabled) { BenchFormat(); }
+	return TestEnd();
+}
@@ -0,0 +1,132 @@
+/*
+File:   test_frame_arena.cpp
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Checks the lifetime rules of FrameArena_t in orca_frame_arena.h: anything
+	** pushed in a frame survives the next FrameArenaSwap and its memory gets reused
+	** after the second one. Also checks the push helpers (alignment, copies, strings)
+	** and which arena FrameArenaGet/GetPrev hand out.
+	** With --bench it times a frame of mixed size allocations against malloc/free
+*/
+
+#include "orca.h"
+#include "../my_orca.h"
+#include "test_common.h"
+
+#include <vector>
+
+void TestLifetime()
+{
+	TestSection("Lifetime across swaps");
+	FrameArena_t frameArena;
+	CreateFrameArena(&frameArena);
+	TestCheck(frameArena.frameIndex == 0);
+
+	FrameArenaSwap(&frameArena);
+	OC_Arena_t* firstArena = FrameArenaGet(&frameArena);
+	u32* first = FrameArenaPushType(&frameArena, u32);
+	*first = 111;
+	//NOTE: MyStr_t::length only covers the low half of oc_str8::len on a 64-bit host, so zero the whole thing rather than using NewStr
+	MyStr_t hello = {};
+	hello.chars = (char*)"hello";
+	hello.length = 5;
+	MyStr_t str = FrameArenaPushStr(&frameArena, hello);
+	u64 copySource[3] = { 1, 2, 3 };
+	u64* copy = (u64*)FrameArenaPushCopy(&frameArena, copySource, sizeof(copySource), alignof(u64));
+	TestCheck(str.length == 5 && memcmp(str.chars, "hello", 5) == 0);
+	TestCheck(copy != copySource && memcmp(copy, copySource, sizeof(copySource)) == 0);
+
+	//Next frame: last frame's data is still there and lives in the previous arena
+	FrameArenaSwap(&frameArena);
+	TestCheck(FrameArenaGetPrev(&frameArena) == firstArena && FrameArenaGet(&frameArena) != firstArena);
+	u32* second = FrameArenaPushArray(&frameArena, u32, 16);
+	for (u32 i = 0; i < 16; i++) { second[i] = 222; }
+	TestCheck(*first == 111 && memcmp(str.chars, "hello", 5) == 0 && copy[2] == 3);
+
+	//Two swaps later the first frame's memory is handed out again
+	FrameArenaSwap(&frameArena);
+	u32* third = FrameArenaPushType(&frameArena, u32);
+	TestCheck(third == first);
+	TestCheck(FrameArenaGet(&frameArena) == firstArena);
+	TestCheck(second[15] == 222);
+	TestCheck(frameArena.frameIndex == 3);
+
+	FreeFrameArena(&frameArena);
+	TestCheck(frameArena.frameIndex == 0);
+}
+
+void TestAlignment()
+{
+	TestSection("Alignment");
+	FrameArena_t frameArena;
+	CreateFrameArena(&frameArena);
+	FrameArenaSwap(&frameArena);
+	bool allAligned = true;
+	for (u32 aIndex = 0; aIndex < 200; aIndex++)
+	{
+		FrameArenaPush(&frameArena, TestRandU32(1, 40)); //knock the offset off any alignment
+		u32 alignment = 1u << TestRandU32(0, 7);
+		void* pntr = FrameArenaPushAligned(&frameArena, TestRandU32(1, 100), alignment);
+		if (((uintptr_t)pntr % alignment) != 0) { allAligned = false; }
+	}
+	TestCheck(allAligned);
+	FreeFrameArena(&frameArena);
+}
+
+void BenchFrameArena()
+{
+	TestSection("Benchmarks (200 frames of 2000 allocations, 16-4300 bytes, per allocation)");
+	const u32 numFrames = 200;
+	const u32 numAllocsPerFrame = 2000;
+	std::vector<u32> sizes(numAllocsPerFrame);
+	for (u32 aIndex = 0; aIndex < numAllocsPerFrame; aIndex++)
+	{
+		sizes[aIndex] = 16 + TestRandU32(0, 8) * 32 + ((TestRandU32(0, 20) == 0) ? 4096 : 0);
+	}
+	std::vector<void*> allocs(numAllocsPerFrame, nullptr);
+	std::vector<void*> prevAllocs(numAllocsPerFrame, nullptr);
+	u64 sum = 0;
+	const u64 numOps = (u64)numFrames * numAllocsPerFrame;
+
+	TestBench("frame allocs", "malloc, free same frame", 5, numOps, [&]()
+	{
+		for (u32 fIndex = 0; fIndex < numFrames; fIndex++)
+		{
+			for (u32 aIndex = 0; aIndex < numAllocsPerFrame; aIndex++) { allocs[aIndex] = malloc(sizes[aIndex]); memset(allocs[aIndex], (int)aIndex, 16); }
+			for (u32 aIndex = 0; aIndex < numAllocsPerFrame; aIndex++) { sum += ((u8*)allocs[aIndex])[3]; free(allocs[aIndex]); allocs[aIndex] = nullptr; }
+		}
+	});
+	//The pattern a frame arena replaces: keep everything for one more frame, then free it
+	TestBench("frame allocs", "malloc, free next frame", 5, numOps, [&]()
+	{
+		for (u32 fIndex = 0; fIndex < numFrames; fIndex++)
+		{
+			for (u32 aIndex = 0; aIndex < numAllocsPerFrame; aIndex++) { free(prevAllocs[aIndex]); prevAllocs[aIndex] = allocs[aIndex]; }
+			for (u32 aIndex = 0; aIndex < numAllocsPerFrame; aIndex++) { allocs[aIndex] = malloc(sizes[aIndex]); memset(allocs[aIndex], (int)aIndex, 16); sum += ((u8*)allocs[aIndex])[3]; }
+		}
+		for (u32 aIndex = 0; aIndex < numAllocsPerFrame; aIndex++) { free(prevAllocs[aIndex]); prevAllocs[aIndex] = nullptr; free(allocs[aIndex]); allocs[aIndex] = nullptr; }
+	});
+	FrameArena_t frameArena;
+	CreateFrameArena(&frameArena);
+	TestBench("frame allocs", "FrameArenaPushAligned + swap", 5, numOps, [&]()
+	{
+		for (u32 fIndex = 0; fIndex < numFrames; fIndex++)
+		{
+			FrameArenaSwap(&frameArena);
+			for (u32 aIndex = 0; aIndex < numAllocsPerFrame; aIndex++) { allocs[aIndex] = FrameArenaPushAligned(&frameArena, sizes[aIndex], 8); memset(allocs[aIndex], (int)aIndex, 16); }
+			for (u32 aIndex = 0; aIndex < numAllocsPerFrame; aIndex++) { sum += ((u8*)allocs[aIndex])[3]; }
+		}
+	});
+	FreeFrameArena(&frameArena);
+	TestDoNotOptimize(sum);
+}
+
+int main(int argc, char** argv)
+{
+	TestBegin("Frame arena", argc, argv);
+	TestLifetime();
+	TestAlignment();
+	if (testBenchEnabled) { BenchFrameArena(); }
+	return TestEnd();
+}
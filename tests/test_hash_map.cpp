@@ -0,0 +1,217 @@
+/*
+File:   test_hash_map.cpp
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Runs long random add/remove/get sequences on HashMap_t from orca_hash_map.h
+	** with u64, u32 and string keys next to a std::unordered_map and checks they
+	** always agree (including isNew, counts, HashMapLoop and tombstones from removes).
+	** Run it with SIMD=0 too, that covers the SWAR group matching.
+	** With --bench it times insert, hit and miss against std::unordered_map for
+	** 1k, 100k and 1M keys (hits are looked up in shuffled order)
+*/
+
+#include "orca.h"
+#include "../my_orca.h"
+#include "test_common.h"
+
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <unordered_map>
+
+void TestIntKeys()
+{
+	TestSection("u64 and u32 keys vs std::unordered_map");
+	OC_Arena_t arena;
+	OC_ArenaInit(&arena);
+	HashMap_t map;
+	CreateHashMapType(&map, &arena, HashMapKeyType_U64, u32, 0);
+	std::unordered_map<u64, u32> reference;
+	bool allIsNew = true, allZeroed = true, allRemoves = true, allGets = true, allCounts = true;
+	for (u32 oIndex = 0; oIndex < 400000; oIndex++)
+	{
+		//Keys spread over the whole u64 range but only 5000 distinct ones, so removes and re-adds keep happening
+		u64 key = HashU64(TestRandU32(0, 5000));
+		u32 operation = TestRandU32(0, 10);
+		if (operation < 5)
+		{
+			bool isNew = false;
+			u32* value = (u32*)HashMapAddU64(&map, key, &isNew);
+			if (isNew != (reference.count(key) == 0)) { allIsNew = false; }
+			if (isNew && *value != 0) { allZeroed = false; }
+			*value = oIndex;
+			reference[key] = oIndex;
+		}
+		else if (operation < 8)
+		{
+			if (HashMapRemoveU64(&map, key) != (reference.erase(key) > 0)) { allRemoves = false; }
+		}
+		else
+		{
+			u32* value = (u32*)HashMapGetU64(&map, key);
+			auto found = reference.find(key);
+			if ((value != nullptr) != (found != reference.end()) || (value != nullptr && *value != found->second)) { allGets = false; }
+		}
+		if (map.count != reference.size()) { allCounts = false; }
+	}
+	TestCheck(allIsNew);
+	TestCheck(allZeroed);
+	TestCheck(allRemoves);
+	TestCheck(allGets);
+	TestCheck(allCounts);
+	u32 numLooped = 0;
+	bool allLooped = true;
+	HashMapLoop(&map, slotIndex)
+	{
+		numLooped++;
+		auto found = reference.find(HashMapGetEntry(&map, slotIndex)->intKey);
+		if (found == reference.end() || found->second != *(u32*)HashMapGetValue(&map, slotIndex)) { allLooped = false; }
+	}
+	TestCheck(allLooped && numLooped == reference.size());
+	printf("  count %u, capacity %u, %u deleted slots\n", map.count, map.capacity, map.numDeleted);
+
+	HashMap_t smallMap;
+	CreateHashMapType(&smallMap, &arena, HashMapKeyType_U64, u16, 0); //u32 keys share the U64 key type
+	for (u32 kIndex = 0; kIndex < 1000; kIndex++) { *(u16*)HashMapAddU32(&smallMap, kIndex * 7919, nullptr) = (u16)kIndex; }
+	bool allSmall = (smallMap.count == 1000);
+	for (u32 kIndex = 0; kIndex < 1000; kIndex++)
+	{
+		u16* value = (u16*)HashMapGetU32(&smallMap, kIndex * 7919);
+		if (value == nullptr || *value != kIndex) { allSmall = false; }
+	}
+	TestCheck(allSmall);
+	TestCheck(HashMapGetU32(&smallMap, 1) == nullptr && !HashMapRemoveU32(&smallMap, 1));
+	FreeHashMap(&map);
+	FreeHashMap(&smallMap);
+	OC_ArenaCleanup(&arena);
+}
+
+void TestStrKeys()
+{
+	TestSection("String keys vs std::unordered_map");
+	OC_Arena_t arena;
+	OC_ArenaInit(&arena);
+	HashMap_t map;
+	CreateHashMapType(&map, &arena, HashMapKeyType_Str, u64, 4);
+	std::unordered_map<std::string, u64> reference;
+	char keyBuffer[64];
+	bool allRemoves = true, allGets = true, allCounts = true;
+	for (u32 oIndex = 0; oIndex < 200000; oIndex++)
+	{
+		int keyLength = snprintf(keyBuffer, sizeof(keyBuffer), "%s/%u", (TestRandU32(0, 2) == 0) ? "assets/textures/some_long_folder_name" : "ui", TestRandU32(0, 3000));
+		if (TestRandU32(0, 50) == 0) { keyLength = 0; } //the empty string is a valid key
+		std::string key(keyBuffer, keyLength);
+		MyStr_t keyStr = NewStr((u32)keyLength, keyBuffer);
+		u32 operation = TestRandU32(0, 10);
+		if (operation < 5)
+		{
+			*(u64*)HashMapAddStr(&map, keyStr) = oIndex;
+			reference[key] = oIndex;
+			keyBuffer[0] = 'X'; //the map has to have copied the key
+		}
+		else if (operation < 7)
+		{
+			if (HashMapRemoveStr(&map, keyStr) != (reference.erase(key) > 0)) { allRemoves = false; }
+		}
+		else
+		{
+			u64* value = (u64*)HashMapGetStr(&map, keyStr);
+			auto found = reference.find(key);
+			if ((value != nullptr) != (found != reference.end()) || (value != nullptr && *value != found->second)) { allGets = false; }
+		}
+		if (map.count != reference.size()) { allCounts = false; }
+	}
+	TestCheck(allRemoves);
+	TestCheck(allGets);
+	TestCheck(allCounts);
+	HashMapClear(&map);
+	TestCheck(map.count == 0 && HashMapGetStr(&map, NewStr("ui/1")) == nullptr);
+	FreeHashMap(&map);
+	OC_ArenaCleanup(&arena);
+}
+
+void BenchHashMap()
+{
+	TestSection("Benchmarks (per operation)");
+	OC_Arena_t arena;
+	OC_ArenaInit(&arena);
+	char groupName[32];
+	for (u32 numKeys : { 1000u, 100000u, 1000000u })
+	{
+		u32 numRuns = (numKeys >= 1000000) ? 3 : 10;
+		std::vector<u64> keys(numKeys), missKeys(numKeys), shuffled;
+		for (u32 kIndex = 0; kIndex < numKeys; kIndex++)
+		{
+			keys[kIndex] = ((u64)TestRandU32() << 32) | TestRandU32();
+			missKeys[kIndex] = ((u64)TestRandU32() << 32) | TestRandU32();
+		}
+		shuffled = keys;
+		for (u32 kIndex = numKeys - 1; kIndex > 0; kIndex--) { std::swap(shuffled[kIndex], shuffled[TestRandU32(0, kIndex + 1)]); }
+		snprintf(groupName, sizeof(groupName), "u64 %uk", numKeys / 1000);
+		u64 sum = 0;
+
+		HashMap_t map;
+		TestBench(groupName, "HashMapAddU64", numRuns, numKeys, [&]()
+		{
+			OC_ArenaClear(&arena);
+			CreateHashMapType(&map, &arena, HashMapKeyType_U64, u64, 0);
+			for (u32 kIndex = 0; kIndex < numKeys; kIndex++) { *(u64*)HashMapAddU64(&map, keys[kIndex]) = kIndex; }
+		});
+		TestBench(groupName, "HashMapGetU64 hit", numRuns, numKeys, [&]() { for (u64 key : shuffled) { sum += *(u64*)HashMapGetU64(&map, key); } });
+		TestBench(groupName, "HashMapGetU64 miss", numRuns, numKeys, [&]() { for (u64 key : missKeys) { sum += (HashMapGetU64(&map, key) != nullptr); } });
+		std::unordered_map<u64, u64> reference;
+		TestBench(groupName, "unordered_map insert", numRuns, numKeys, [&]()
+		{
+			reference = std::unordered_map<u64, u64>();
+			for (u32 kIndex = 0; kIndex < numKeys; kIndex++) { reference[keys[kIndex]] = kIndex; }
+		});
+		TestBench(groupName, "unordered_map hit", numRuns, numKeys, [&]() { for (u64 key : shuffled) { sum += reference.find(key)->second; } });
+		TestBench(groupName, "unordered_map miss", numRuns, numKeys, [&]() { for (u64 key : missKeys) { sum += (reference.find(key) != reference.end()); } });
+		TestDoNotOptimize(sum);
+	}
+	for (u32 numKeys : { 1000u, 100000u, 1000000u })
+	{
+		u32 numRuns = (numKeys >= 1000000) ? 3 : 10;
+		std::vector<std::string> keys(numKeys), missKeys(numKeys), shuffled;
+		char keyBuffer[64];
+		for (u32 kIndex = 0; kIndex < numKeys; kIndex++)
+		{
+			snprintf(keyBuffer, sizeof(keyBuffer), "assets/sprites/item_%08x%08x.png", TestRandU32(), TestRandU32()); keys[kIndex] = keyBuffer;
+			snprintf(keyBuffer, sizeof(keyBuffer), "assets/sprites/item_%08x%08x.png", TestRandU32(), TestRandU32()); missKeys[kIndex] = keyBuffer;
+		}
+		shuffled = keys;
+		for (u32 kIndex = numKeys - 1; kIndex > 0; kIndex--) { std::swap(shuffled[kIndex], shuffled[TestRandU32(0, kIndex + 1)]); }
+		snprintf(groupName, sizeof(groupName), "str %uk", numKeys / 1000);
+		u64 sum = 0;
+
+		HashMap_t map;
+		TestBench(groupName, "HashMapAddStr", numRuns, numKeys, [&]()
+		{
+			OC_ArenaClear(&arena);
+			CreateHashMapType(&map, &arena, HashMapKeyType_Str, u64, 0);
+			for (u32 kIndex = 0; kIndex < numKeys; kIndex++) { *(u64*)HashMapAddStr(&map, NewStr((u32)keys[kIndex].size(), keys[kIndex].data())) = kIndex; }
+		});
+		TestBench(groupName, "HashMapGetStr hit", numRuns, numKeys, [&]() { for (const std::string& key : shuffled) { sum += *(u64*)HashMapGetStr(&map, NewStr((u32)key.size(), key.data())); } });
+		TestBench(groupName, "HashMapGetStr miss", numRuns, numKeys, [&]() { for (const std::string& key : missKeys) { sum += (HashMapGetStr(&map, NewStr((u32)key.size(), key.data())) != nullptr); } });
+		std::unordered_map<std::string, u64> reference;
+		TestBench(groupName, "unordered_map insert", numRuns, numKeys, [&]()
+		{
+			reference = std::unordered_map<std::string, u64>();
+			for (u32 kIndex = 0; kIndex < numKeys; kIndex++) { reference[keys[kIndex]] = kIndex; }
+		});
+		TestBench(groupName, "unordered_map hit", numRuns, numKeys, [&]() { for (const std::string& key : shuffled) { sum += reference.find(key)->second; } });
+		TestBench(groupName, "unordered_map miss", numRuns, numKeys, [&]() { for (const std::string& key : missKeys) { sum += (reference.find(key) != reference.end()); } });
+		TestDoNotOptimize(sum);
+	}
+	OC_ArenaCleanup(&arena);
+}
+
+int main(int argc, char** argv)
+{
+	TestBegin("Hash map", argc, argv);
+	TestIntKeys();
+	TestStrKeys();
+	if (testBenchEnabled) { BenchHashMap(); }
+	return TestEnd();
+}
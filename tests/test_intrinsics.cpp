@@ -0,0 +1,163 @@
+/*
+File:   test_intrinsics.cpp
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Spot checks the scalar intrinsic families in orca_intrinsics.h (min/max/clamp,
+	** trig, round/floor/ceil, pow/sqrt, AngleFix) against libm and std:: on random
+	** inputs, and with --bench (or make bench, which also writes build/intrinsics.json)
+	** times every family and the v2/v3 operators from orca_addons.h next to the
+	** libm/std:: version they replace, so regressions can be tracked between versions
+*/
+
+#include "orca.h"
+#include "../my_orca.h"
+#include "test_common.h"
+
+#include <algorithm>
+
+#define TEST_NUM_VALUES 4096
+
+static r32 valuesA[TEST_NUM_VALUES]; //[-100, 100]
+static r32 valuesB[TEST_NUM_VALUES]; //[-100, 100]
+static r32 valuesC[TEST_NUM_VALUES]; //[0, 1]
+
+void FillValues()
+{
+	for (u32 vIndex = 0; vIndex < TEST_NUM_VALUES; vIndex++)
+	{
+		valuesA[vIndex] = TestRandR32(-100.0f, 100.0f);
+		valuesB[vIndex] = TestRandR32(-100.0f, 100.0f);
+		valuesC[vIndex] = TestRandR32();
+	}
+}
+
+void TestAgainstLibm()
+{
+	TestSection("Against libm and std::");
+	bool allMinMax = true, allClamp = true, allFloorCeil = true, allRound = true, allPow = true, allAngleFix = true;
+	r32 maxTrigError = 0.0f;
+	u32 numNegative = 0, numRoundMismatches = 0, numExpectedMismatches = 0;
+	for (u32 vIndex = 0; vIndex < TEST_NUM_VALUES; vIndex++)
+	{
+		r32 a = valuesA[vIndex], b = valuesB[vIndex], c = valuesC[vIndex];
+		if (MinR32(a, b) != std::min(a, b) || MaxR32(a, b) != std::max(a, b)) { allMinMax = false; }
+		if (ClampR32(a, -10.0f, 10.0f) != std::clamp(a, -10.0f, 10.0f)) { allClamp = false; }
+		if (FloorR32(a) != floorf(a) || CeilR32(a) != ceilf(a) || FloorR32i(a) != (i32)floorf(a) || CeilR32i(a) != (i32)ceilf(a)) { allFloorCeil = false; }
+		//NOTE: RoundR32/RoundR32i truncate value + 0.5, so negative values round towards zero (-1.7 => -1) instead of to the nearest.
+		//That bug is deliberately left in for now (fixing it changes results for every caller), so we check the exact current behavior:
+		//the result matches libm everywhere except where value + 0.5 is negative and not a whole number, and there it is one higher
+		r32 libmRound = floorf(a + 0.5f);
+		bool expectMismatch = (a + 0.5f < 0.0f && libmRound != a + 0.5f);
+		r32 expectedRound = expectMismatch ? (libmRound + 1.0f) : libmRound;
+		if (RoundR32(a) != expectedRound || RoundR32i(a) != (i32)expectedRound) { allRound = false; }
+		if (a < 0.0f) { numNegative++; }
+		if (RoundR32(a) != libmRound) { numRoundMismatches++; }
+		if (expectMismatch) { numExpectedMismatches++; }
+		if (AbsR32(PowR32(c, 2.2f) - powf(c, 2.2f)) > 1e-6f) { allPow = false; }
+		maxTrigError = MaxR32(maxTrigError, AbsR32(SinR32(a) - sinf(a)), AbsR32(CosR32(a) - cosf(a)));
+		maxTrigError = MaxR32(maxTrigError, AbsR32(AcosR32(c) - acosf(c)), AbsR32(AtanR32(a, b) - atan2f(a, b)));
+		r32 fixed = AngleFixR32(a);
+		r32 libmFixed = fmodf(a, TwoPi32);
+		if (libmFixed < 0.0f) { libmFixed += TwoPi32; }
+		if (!(fixed >= 0.0f && fixed <= TwoPi32) || AbsR32(fixed - libmFixed) > 1e-5f) { allAngleFix = false; }
+	}
+	printf("  max trig difference from libm %.3g\n", maxTrigError);
+	TestCheck(allMinMax);
+	TestCheck(allClamp);
+	TestCheck(allFloorCeil);
+	TestCheck(allRound);
+	printf("  RoundR32 differs from floorf(x + 0.5) on %u of %u negative values (known, see the NOTE above)\n", numRoundMismatches, numNegative);
+	TestCheck(numRoundMismatches == numExpectedMismatches && numNegative > 0);
+	TestCheck(RoundR32(1.7f) == 2.0f && RoundR32(-1.7f) == -1.0f && RoundR32i(-1.2f) == 0 && RoundR32(-1.5f) == -1.0f && RoundR64(-1.7) == -1.0 && RoundR64i(-2.7) == -2);
+	TestCheck(allPow);
+	TestCheck(maxTrigError <= 1e-6f);
+	TestCheck(allAngleFix);
+	//NOTE: AngleFix can also return exactly TwoPi for negative angles whose magnitude rounds to a multiple of TwoPi. Also left in, and pinned down here
+	TestCheck(AngleFixR32(-TwoPi32) == TwoPi32 && AngleFixR32(-1e-8f) == TwoPi32 && AngleFixR32(-Pi32) == Pi32 && AngleFixR32(TwoPi32) == 0.0f);
+}
+
+static r32 results[TEST_NUM_VALUES];
+static i32 intResults[TEST_NUM_VALUES];
+static v2 vec2s[TEST_NUM_VALUES], vec2s2[TEST_NUM_VALUES], vec2Results[TEST_NUM_VALUES];
+static v3 vec3s[TEST_NUM_VALUES], vec3s2[TEST_NUM_VALUES], vec3Results[TEST_NUM_VALUES];
+
+//Times Expression evaluated for every index i, storing into Array[i]
+#define BenchLoop(group, name, Array, Expression) TestBench(group, name, 400, TEST_NUM_VALUES, [&]() { for (u32 i = 0; i < TEST_NUM_VALUES; i++) { Array[i] = (Expression); } })
+
+void BenchIntrinsics()
+{
+	TestSection("Benchmarks (4096 values, per value)");
+	const r32* a = valuesA;
+	const r32* b = valuesB;
+	const r32* c = valuesC;
+	for (u32 i = 0; i < TEST_NUM_VALUES; i++)
+	{
+		vec2s[i] = NewVec2(a[i], b[i]); vec2s2[i] = NewVec2(b[i], c[i]);
+		vec3s[i] = NewVec3(a[i], b[i], c[i]); vec3s2[i] = NewVec3(c[i], a[i], b[i]);
+	}
+
+	BenchLoop("min/max", "MinR32", results, MinR32(a[i], b[i]));
+	BenchLoop("min/max", "std::min", results, std::min(a[i], b[i]));
+	BenchLoop("min/max", "fminf", results, fminf(a[i], b[i]));
+	BenchLoop("min/max", "MaxR32", results, MaxR32(a[i], b[i]));
+	BenchLoop("min/max", "std::max", results, std::max(a[i], b[i]));
+	BenchLoop("clamp", "ClampR32", results, ClampR32(a[i], -10.0f, 10.0f));
+	BenchLoop("clamp", "std::clamp", results, std::clamp(a[i], -10.0f, 10.0f));
+	TestBench("clamp", "ClampArrayR32", 400, TEST_NUM_VALUES, [&]() { ClampArrayR32(TEST_NUM_VALUES, a, -10.0f, 10.0f, results); });
+
+	BenchLoop("trig", "SinR32", results, SinR32(a[i]));
+	BenchLoop("trig", "sinf", results, sinf(a[i]));
+	BenchLoop("trig", "CosR32", results, CosR32(a[i]));
+	BenchLoop("trig", "cosf", results, cosf(a[i]));
+	BenchLoop("trig", "TanR32", results, TanR32(a[i]));
+	BenchLoop("trig", "tanf", results, tanf(a[i]));
+	BenchLoop("trig", "AcosR32", results, AcosR32(c[i]));
+	BenchLoop("trig", "acosf", results, acosf(c[i]));
+	BenchLoop("trig", "AtanR32", results, AtanR32(a[i], b[i]));
+	BenchLoop("trig", "atan2f", results, atan2f(a[i], b[i]));
+
+	BenchLoop("round", "RoundR32", results, RoundR32(a[i]));
+	BenchLoop("round", "roundf", results, roundf(a[i]));
+	BenchLoop("round", "RoundR32i", intResults, RoundR32i(a[i]));
+	BenchLoop("round", "lroundf", intResults, (i32)lroundf(a[i]));
+	BenchLoop("round", "FloorR32", results, FloorR32(a[i]));
+	BenchLoop("round", "floorf", results, floorf(a[i]));
+	BenchLoop("round", "FloorR32i", intResults, FloorR32i(a[i]));
+	BenchLoop("round", "(i32)floorf", intResults, (i32)floorf(a[i]));
+	BenchLoop("round", "CeilR32", results, CeilR32(a[i]));
+	BenchLoop("round", "ceilf", results, ceilf(a[i]));
+
+	BenchLoop("angle", "AngleFixR32", results, AngleFixR32(a[i]));
+	BenchLoop("angle", "fmodf + add", results, [](r32 angle) { r32 result = fmodf(angle, TwoPi32); return (result < 0) ? result + TwoPi32 : result; }(a[i]));
+	BenchLoop("angle", "AngleDiffR32", results, AngleDiffR32(a[i], b[i]));
+	BenchLoop("angle", "AngleLerpR32", results, AngleLerpR32(a[i], b[i], c[i]));
+
+	BenchLoop("misc", "SqrtR32", results, SqrtR32(c[i]));
+	BenchLoop("misc", "sqrtf", results, sqrtf(c[i]));
+	BenchLoop("misc", "PowR32", results, PowR32(c[i], 2.2f));
+	BenchLoop("misc", "powf", results, powf(c[i], 2.2f));
+
+	BenchLoop("vector", "v2 + v2", vec2Results, vec2s[i] + vec2s2[i]);
+	BenchLoop("vector", "v2 * r32", vec2Results, vec2s[i] * c[i]);
+	BenchLoop("vector", "Vec2Length", results, Vec2Length(vec2s[i]));
+	BenchLoop("vector", "Vec2Normalize", vec2Results, Vec2Normalize(vec2s[i]));
+	BenchLoop("vector", "v3 + v3", vec3Results, vec3s[i] + vec3s2[i]);
+	BenchLoop("vector", "Vec3Dot", results, Vec3Dot(vec3s[i], vec3s2[i]));
+	BenchLoop("vector", "Vec3Cross", vec3Results, Vec3Cross(vec3s[i], vec3s2[i]));
+	BenchLoop("vector", "Vec3Normalize", vec3Results, Vec3Normalize(vec3s[i]));
+
+	TestDoNotOptimize(results[TEST_NUM_VALUES/2]);
+	TestDoNotOptimize(intResults[TEST_NUM_VALUES/2]);
+	TestDoNotOptimize(vec2Results[TEST_NUM_VALUES/2].x);
+	TestDoNotOptimize(vec3Results[TEST_NUM_VALUES/2].x);
+}
+
+int main(int argc, char** argv)
+{
+	TestBegin("Scalar intrinsics", argc, argv);
+	FillValues();
+	TestAgainstLibm();
+	if (testBenchEnabled) { BenchIntrinsics(); }
+	return TestEnd();
+}
@@ -0,0 +1,321 @@
+/*
+File:   test_matrix.cpp
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Checks mat23, mat3, mat4 and quat from orca_addons.h against naive loops on
+	** random well-conditioned matrices: multiply, transpose, inverse, determinant,
+	** vector transforms and the quaternion forms against the matrix forms. mat23
+	** is checked as the top two rows of a 3x3 with (0, 0, 1) as the last row. Also
+	** spot checks LookAt/Perspective/Orthographic and singular inverses.
+	** With --bench it times Mat4Multiply against a naive triple loop
+*/
+
+#include "orca.h"
+#include "../my_orca.h"
+#include "test_common.h"
+
+static_assert(sizeof(mat3) == 48 && alignof(mat3) == 16, "mat3 should be 3 padded columns");
+static_assert(sizeof(mat4) == 64 && alignof(mat4) == 16, "mat4 should be 4 aligned columns");
+static_assert(sizeof(quat) == 16, "quat should be 4 floats");
+static_assert(sizeof(mat23) == 24 && offsetof(mat23, r0c2) == 8 && offsetof(mat23, r1c0) == 12, "mat23 should be 2 rows of 3, same as oc_mat2x3");
+
+#define MATRIX_TOLERANCE 1e-4f
+
+static r32 maxError = 0.0f;
+bool Near(r32 actual, r32 expected)
+{
+	r32 error = AbsR32(actual - expected);
+	maxError = MaxR32(maxError, error);
+	return (error <= MATRIX_TOLERANCE);
+}
+
+//values[column][row], same layout as mat4
+__attribute__((noinline)) mat4 NaiveMultiply(const mat4& left, const mat4& right)
+{
+	mat4 result;
+	for (u32 col = 0; col < 4; col++)
+	{
+		for (u32 row = 0; row < 4; row++)
+		{
+			r32 sum = 0.0f;
+			for (u32 k = 0; k < 4; k++) { sum += left.values[k][row] * right.values[col][k]; }
+			result.values[col][row] = sum;
+		}
+	}
+	return result;
+}
+
+mat4 RandomMat4()
+{
+	mat4 result;
+	for (u32 vIndex = 0; vIndex < 16; vIndex++) { (&result.r0c0)[vIndex] = TestRandR32(-1.0f, 1.0f); }
+	for (u32 dIndex = 0; dIndex < 4; dIndex++) { result.values[dIndex][dIndex] += 3.0f; } //diagonally dominant so it's comfortably invertible
+	return result;
+}
+//mat23 as a full 3x3 with (0, 0, 1) as the bottom row, [row][col]
+struct Mat33_t { r32 m[3][3]; };
+Mat33_t Mat23ToMat33(mat23 matrix)
+{
+	Mat33_t result = {{
+		{ matrix.r0c0, matrix.r0c1, matrix.r0c2 },
+		{ matrix.r1c0, matrix.r1c1, matrix.r1c2 },
+		{ 0.0f,        0.0f,        1.0f        },
+	}};
+	return result;
+}
+Mat33_t NaiveMultiply33(const Mat33_t& left, const Mat33_t& right)
+{
+	Mat33_t result;
+	for (u32 row = 0; row < 3; row++)
+	{
+		for (u32 col = 0; col < 3; col++)
+		{
+			r32 sum = 0.0f;
+			for (u32 k = 0; k < 3; k++) { sum += left.m[row][k] * right.m[k][col]; }
+			result.m[row][col] = sum;
+		}
+	}
+	return result;
+}
+mat23 RandomMat23()
+{
+	mat23 result = NewMat23(
+		TestRandR32(2.0f, 4.0f),   TestRandR32(-1.0f, 1.0f), TestRandR32(-100.0f, 100.0f),
+		TestRandR32(-1.0f, 1.0f), TestRandR32(2.0f, 4.0f),   TestRandR32(-100.0f, 100.0f)
+	);
+	if (TestRandU32(0, 2) == 0) { result.r0c0 = -result.r0c0; } //include reflections
+	return result;
+}
+
+v3 RandomVec3() { return NewVec3(TestRandR32(-1.0f, 1.0f), TestRandR32(-1.0f, 1.0f), TestRandR32(-1.0f, 1.0f)); }
+
+void TestMat4()
+{
+	TestSection("mat4");
+	bool allMultiply = true, allTranspose = true, allInverse = true, allDeterminant = true, allVector = true;
+	for (u32 tIndex = 0; tIndex < 1000; tIndex++)
+	{
+		mat4 m = RandomMat4();
+		mat4 n = RandomMat4();
+		mat4 product = m * n;
+		mat4 naive = NaiveMultiply(m, n);
+		mat4 transposed = Mat4Transpose(m);
+		bool invertible = false;
+		mat4 inverse = Mat4Inverse(m, &invertible);
+		mat4 identity = m * inverse;
+		for (u32 col = 0; col < 4; col++)
+		{
+			for (u32 row = 0; row < 4; row++)
+			{
+				if (!Near(product.values[col][row], naive.values[col][row])) { allMultiply = false; }
+				if (transposed.values[col][row] != m.values[row][col]) { allTranspose = false; }
+				if (!Near(identity.values[col][row], (row == col) ? 1.0f : 0.0f)) { allInverse = false; }
+			}
+		}
+		if (!invertible || !Near(Mat4Determinant(m) * Mat4Determinant(inverse), 1.0f)) { allDeterminant = false; }
+
+		v4 vector = NewVec4(TestRandR32(-1.0f, 1.0f), TestRandR32(-1.0f, 1.0f), TestRandR32(-1.0f, 1.0f), TestRandR32(-1.0f, 1.0f));
+		v4 transformed = m * vector;
+		v4 arrayResult;
+		Mat4MultiplyVec4Array(1, &vector, m, &arrayResult);
+		for (u32 row = 0; row < 4; row++)
+		{
+			r32 sum = 0.0f;
+			for (u32 k = 0; k < 4; k++) { sum += m.values[k][row] * (&vector.x)[k]; }
+			if (!Near((&transformed.x)[row], sum) || !Near((&arrayResult.x)[row], sum)) { allVector = false; }
+		}
+	}
+	TestCheck(allMultiply);
+	TestCheck(allTranspose);
+	TestCheck(allInverse);
+	TestCheck(allDeterminant);
+	TestCheck(allVector);
+
+	bool invertible = true;
+	mat4 singularInverse = Mat4Inverse(Mat4Scale(NewVec3(0.0f, 1.0f, 1.0f)), &invertible);
+	TestCheck(!invertible);
+	mat4 identity = Mat4_Identity;
+	TestCheck(memcmp(&singularInverse, &identity, sizeof(mat4)) == 0);
+
+	mat4 view = Mat4LookAt(NewVec3(1, 2, 3), NewVec3(1, 2, -7), NewVec3(0, 1, 0));
+	v3 eye = Mat4TransformPoint(view, NewVec3(1, 2, 3));
+	v3 target = Mat4TransformPoint(view, NewVec3(1, 2, -7));
+	TestCheck(Near(eye.x, 0.0f) && Near(eye.y, 0.0f) && Near(eye.z, 0.0f));
+	TestCheck(Near(target.x, 0.0f) && Near(target.y, 0.0f) && Near(target.z, -10.0f));
+
+	mat4 projection = Mat4Perspective(1.0f, 1.5f, 0.1f, 100.0f);
+	TestCheck(Near(Mat4ProjectPoint(projection, NewVec3(0, 0, -0.1f)).z, -1.0f));
+	TestCheck(Near(Mat4ProjectPoint(projection, NewVec3(0, 0, -100.0f)).z, 1.0f));
+	mat4 ortho = Mat4Orthographic(0, 800, 600, 0, -1, 1);
+	v3 corner = Mat4TransformPoint(ortho, NewVec3(800, 600, 0));
+	TestCheck(Near(corner.x, 1.0f) && Near(corner.y, -1.0f));
+}
+
+void TestMat3()
+{
+	TestSection("mat3");
+	bool allMultiply = true, allInverse = true, allPadding = true;
+	for (u32 tIndex = 0; tIndex < 1000; tIndex++)
+	{
+		mat3 a = Mat3FromMat4(RandomMat4());
+		mat3 b = Mat3FromMat4(RandomMat4());
+		mat3 product = a * b;
+		mat3 identity = a * Mat3Inverse(a);
+		for (u32 col = 0; col < 3; col++)
+		{
+			for (u32 row = 0; row < 3; row++)
+			{
+				r32 sum = 0.0f;
+				for (u32 k = 0; k < 3; k++) { sum += a.values[k][row] * b.values[col][k]; }
+				if (!Near(product.values[col][row], sum)) { allMultiply = false; }
+				if (!Near(identity.values[col][row], (row == col) ? 1.0f : 0.0f)) { allInverse = false; }
+			}
+		}
+		if (product.pad0 != 0.0f || product.pad1 != 0.0f || product.pad2 != 0.0f) { allPadding = false; }
+	}
+	TestCheck(allMultiply);
+	TestCheck(allInverse);
+	TestCheck(allPadding);
+}
+
+void TestMat23()
+{
+	TestSection("mat23");
+	const u32 numPoints = 67; //not a multiple of 4 so the scalar tail of the batched transforms runs
+	v2 points[numPoints], transformedPoints[numPoints], transformedVectors[numPoints];
+	bool allMultiply = true, allInverse = true, allDeterminant = true, allPoints = true, allVectors = true, allOperators = true;
+	for (u32 tIndex = 0; tIndex < 1000; tIndex++)
+	{
+		mat23 a = RandomMat23();
+		mat23 b = RandomMat23();
+		Mat33_t a33 = Mat23ToMat33(a);
+		Mat33_t naive = NaiveMultiply33(a33, Mat23ToMat33(b));
+		Mat33_t product = Mat23ToMat33(Mat23Multiply(a, b));
+		bool invertible = false;
+		mat23 inverse = Mat23Inverse(a, &invertible);
+		Mat33_t identity = NaiveMultiply33(a33, Mat23ToMat33(inverse));
+		for (u32 row = 0; row < 3; row++)
+		{
+			for (u32 col = 0; col < 3; col++)
+			{
+				//Products of the +-100 translations grow past the absolute tolerance, so compare relative to the size of the value
+				if (!Near(product.m[row][col] / MaxR32(1.0f, AbsR32(naive.m[row][col])), naive.m[row][col] / MaxR32(1.0f, AbsR32(naive.m[row][col])))) { allMultiply = false; }
+				if (!Near(identity.m[row][col], (row == col) ? 1.0f : 0.0f)) { allInverse = false; }
+			}
+		}
+		if (!invertible) { allInverse = false; }
+		r32 naiveDeterminant = a33.m[0][0]*a33.m[1][1] - a33.m[0][1]*a33.m[1][0];
+		if (!Near(Mat23Determinant(a), naiveDeterminant) || !Near(Mat23Determinant(a) * Mat23Determinant(inverse), 1.0f)) { allDeterminant = false; }
+		
+		mat23 opProduct = a * b;
+		mat23 opAssign = a;
+		opAssign *= b;
+		mat23 functionProduct = Mat23Multiply(a, b);
+		if (memcmp(&opProduct, &functionProduct, sizeof(mat23)) != 0 || memcmp(&opAssign, &functionProduct, sizeof(mat23)) != 0) { allOperators = false; }
+		
+		for (u32 pIndex = 0; pIndex < numPoints; pIndex++) { points[pIndex] = NewVec2(TestRandR32(-50.0f, 50.0f), TestRandR32(-50.0f, 50.0f)); }
+		Mat23TransformPoints(numPoints, points, a, transformedPoints);
+		Mat23TransformVectors(numPoints, points, a, transformedVectors);
+		for (u32 pIndex = 0; pIndex < numPoints; pIndex++)
+		{
+			r32 input[3] = { points[pIndex].x, points[pIndex].y, 1.0f };
+			r32 expected[2] = { 0.0f, 0.0f };
+			for (u32 row = 0; row < 2; row++) { for (u32 k = 0; k < 3; k++) { expected[row] += a33.m[row][k] * input[k]; } }
+			v2 single = a * points[pIndex];
+			if (!Near(transformedPoints[pIndex].x * 0.01f, expected[0] * 0.01f) || !Near(transformedPoints[pIndex].y * 0.01f, expected[1] * 0.01f)) { allPoints = false; }
+			if (!Near(single.x * 0.01f, expected[0] * 0.01f) || !Near(single.y * 0.01f, expected[1] * 0.01f)) { allPoints = false; }
+			if (!Near(transformedVectors[pIndex].x * 0.01f, (expected[0] - a.r0c2) * 0.01f) || !Near(transformedVectors[pIndex].y * 0.01f, (expected[1] - a.r1c2) * 0.01f)) { allVectors = false; }
+		}
+	}
+	TestCheck(allMultiply);
+	TestCheck(allInverse);
+	TestCheck(allDeterminant);
+	TestCheck(allOperators);
+	TestCheck(allPoints);
+	TestCheck(allVectors);
+	
+	//Right is applied first, same as the matrix stack
+	v2 moved = Mat23Multiply(Mat23Translate(10.0f, 0.0f), Mat23Scale(2.0f)) * NewVec2(1.0f, 1.0f);
+	TestCheck(moved.x == 12.0f && moved.y == 2.0f);
+	
+	//Singular and non-finite matrices give the identity and report false
+	const mat23 singulars[] = {
+		Mat23Scale(NewVec2(0.0f, 1.0f)),
+		NewMat23(1.0f, 2.0f, 5.0f,   2.0f, 4.0f, -3.0f), //rows are parallel
+		NewMat23(0.0f, 0.0f, 0.0f,   0.0f, 0.0f, 0.0f),
+		NewMat23(1e30f, 0.0f, 0.0f,   0.0f, 1e30f, 0.0f), //determinant overflows to infinity
+	};
+	mat23 identityMatrix = Mat23_Identity;
+	bool allSingular = true;
+	for (u32 sIndex = 0; sIndex < ArrayCount(singulars); sIndex++)
+	{
+		bool invertible = true;
+		mat23 singularInverse = Mat23Inverse(singulars[sIndex], &invertible);
+		if (invertible || memcmp(&singularInverse, &identityMatrix, sizeof(mat23)) != 0) { allSingular = false; }
+	}
+	TestCheck(allSingular);
+	TestCheck(Mat23Determinant(singulars[1]) == 0.0f);
+}
+
+void TestQuat()
+{
+	TestSection("quat");
+	bool allRotate = true, allCompose = true, allInverse = true, allSlerp = true;
+	for (u32 tIndex = 0; tIndex < 1000; tIndex++)
+	{
+		v3 axis = Vec3Normalize(RandomVec3());
+		r32 angle = TestRandR32(-3.0f, 3.0f);
+		quat q = QuatFromAxisAngle(axis, angle);
+		quat q2 = QuatFromAxisAngle(Vec3Normalize(RandomVec3()), TestRandR32(-3.0f, 3.0f));
+		v3 point = RandomVec3();
+
+		v3 byQuat = q * point;
+		v3 byMat3 = Mat3FromQuat(q) * point;
+		v3 byMat4 = Mat4TransformPoint(Mat4Rotate(axis, angle), point);
+		if (!Near(byQuat.x, byMat3.x) || !Near(byQuat.y, byMat3.y) || !Near(byQuat.z, byMat3.z)) { allRotate = false; }
+		if (!Near(byQuat.x, byMat4.x) || !Near(byQuat.y, byMat4.y) || !Near(byQuat.z, byMat4.z)) { allRotate = false; }
+
+		v3 composed = (q * q2) * point;
+		v3 sequential = q * (q2 * point);
+		if (!Near(composed.x, sequential.x) || !Near(composed.y, sequential.y) || !Near(composed.z, sequential.z)) { allCompose = false; }
+
+		v3 back = QuatInverse(q) * byQuat;
+		if (!Near(back.x, point.x) || !Near(back.y, point.y) || !Near(back.z, point.z)) { allInverse = false; }
+
+		quat start = QuatSlerp(q, q2, 0.0f);
+		quat end = QuatSlerp(q, q2, 1.0f);
+		quat middle = QuatSlerp(q, q2, 0.5f);
+		if (!Near(AbsR32(QuatDot(start, q)), 1.0f) || !Near(AbsR32(QuatDot(end, q2)), 1.0f)) { allSlerp = false; }
+		if (!Near(QuatLength(middle), 1.0f) || !Near(AbsR32(QuatDot(middle, q)), AbsR32(QuatDot(middle, q2)))) { allSlerp = false; }
+	}
+	TestCheck(allRotate);
+	TestCheck(allCompose);
+	TestCheck(allInverse);
+	TestCheck(allSlerp);
+	printf("  max error over all checks %.3g\n", maxError);
+}
+
+__attribute__((noinline)) mat4 SimdMultiply(const mat4& left, const mat4& right) { return Mat4Multiply(left, right); }
+
+void BenchMatrix()
+{
+	TestSection("Benchmarks (1M chained multiplies)");
+	const u32 numMultiplies = 1000000;
+	mat4 step = Mat4Rotate(NewVec3(1, 2, 3), 0.001f);
+	mat4 accumulated = Mat4_Identity;
+	TestBench("mat4 * mat4", "naive loop", 5, numMultiplies, [&]() { for (u32 i = 0; i < numMultiplies; i++) { accumulated = NaiveMultiply(accumulated, step); } });
+	TestBench("mat4 * mat4", "Mat4Multiply", 5, numMultiplies, [&]() { for (u32 i = 0; i < numMultiplies; i++) { accumulated = SimdMultiply(accumulated, step); } });
+	TestDoNotOptimize(accumulated.r0c0);
+}
+
+int main(int argc, char** argv)
+{
+	TestBegin("mat23, mat3, mat4 and quat", argc, argv);
+	TestMat4();
+	TestMat3();
+	TestMat23();
+	TestQuat();
+	if (testBenchEnabled) { BenchMatrix(); }
+	return TestEnd();
+}
@@ -0,0 +1,160 @@
+/*
+File:   test_min_max.cpp
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Checks the constexpr Min/Max/Clamp/Abs/SignOf/AbsDiff/Lerp templates at the
+	** top of orca_intrinsics.h and the typed wrappers built on them, both at
+	** compile time and on the edge cases (NaN, signed zero, unsigned differences).
+	** The extern "C" Scalar* and Kernel* functions below are what check_codegen.sh
+	** disassembles (make codegen): the Scalar ones must compile without branches at
+	** -O2 and the Kernel loops must auto-vectorize at -O3.
+	** With --bench it times a ClampR32 loop against the compare-and-branch clamp it replaced
+*/
+
+#include "orca.h"
+#include "../my_orca.h"
+#include "test_common.h"
+
+// +--------------------------------------------------------------+
+// |                        Compile Time                          |
+// +--------------------------------------------------------------+
+static_assert(Min(3, 1, 2) == 1 && Max(3, 1, 2) == 3, "variadic Min/Max");
+static_assert(Clamp(5, 0, 3) == 3 && Clamp(-5, 0, 3) == 0 && Clamp(2, 0, 3) == 2, "Clamp");
+static_assert(Abs(-7) == 7 && SignOf(-7) == -1 && SignOf(0) == 0 && SignOf(9) == 1, "Abs/SignOf");
+static_assert(AbsDiff((u8)3, (u8)250) == 247 && AbsDiff((u32)250, (u32)3) == 247, "AbsDiff doesn't wrap for unsigned");
+static_assert(Lerp(2.0f, 4.0f, 0.5f) == 3.0f, "Lerp");
+static_assert(ClampR32(1.5f, 0.0f, 1.0f) == 1.0f && ClampI32(-9, -5, 5) == -5 && ClampU8(200, 10, 100) == 100, "typed Clamp wrappers");
+static_assert(MinU32(4, 2, 8, 6) == 2 && MaxI32(-4, -2, -8) == -2, "typed Min/Max wrappers");
+static_assert(Min(3, 7) == 3 && Max(3, 7) == 7 && Min(5, 2, 9, 4) == 2 && Max(5, 2, 9, 4) == 9, "Min/Max");
+static_assert(Abs(-4) == 4 && SignOf(-2.5f) == -1.0f && AbsDiff(3u, 10u) == 7u, "Abs/SignOf/AbsDiff on other types");
+static_assert(LerpClampR32(0.0f, 1.0f, 2.0f) == 1.0f && LerpClampR32(1.0f, 0.0f, 2.0f) == 0.0f, "LerpClamp works in both directions");
+static_assert(MinR32(1.0f, 2.0f, -1.0f) == -1.0f && MaxU32(1, 8, 3, 4, 5) == 8 && ClampI32(300, 0, 255) == 255 && AbsI8(-128 + 1) == 127, "more typed wrappers");
+static_assert(Clamp(-5, 10, 0) == 10 && Clamp(5, 10, 0) == 10 && Clamp(15, 10, 0) == 0, "min > max: below min gives min, everything else max");
+
+// +--------------------------------------------------------------+
+// |                      Codegen Functions                       |
+// +--------------------------------------------------------------+
+extern "C"
+{
+	r32 ScalarClampR32(r32 value, r32 min, r32 max) { return ClampR32(value, min, max); }
+	i32 ScalarClampI32(i32 value, i32 min, i32 max) { return ClampI32(value, min, max); }
+	i32 ScalarSignOfI32(i32 value) { return SignOfI32(value); }
+	u8 ScalarAbsDiffU8(u8 value1, u8 value2) { return AbsDiffU8(value1, value2); }
+
+	void KernelClampR32(u32 count, const r32* values, r32* resultsOut) { for (u32 i = 0; i < count; i++) { resultsOut[i] = ClampR32(values[i], -1.0f, 1.0f); } }
+	void KernelClampI32(u32 count, const i32* values, i32* resultsOut) { for (u32 i = 0; i < count; i++) { resultsOut[i] = ClampI32(values[i], -100, 100); } }
+	void KernelMinI32(u32 count, const i32* left, const i32* right, i32* resultsOut) { for (u32 i = 0; i < count; i++) { resultsOut[i] = MinI32(left[i], right[i]); } }
+	void KernelMaxR32(u32 count, const r32* left, const r32* right, r32* resultsOut) { for (u32 i = 0; i < count; i++) { resultsOut[i] = MaxR32(left[i], right[i]); } }
+	void KernelAbsI32(u32 count, const i32* values, i32* resultsOut) { for (u32 i = 0; i < count; i++) { resultsOut[i] = AbsI32(values[i]); } }
+	void KernelSignOfR32(u32 count, const r32* values, r32* resultsOut) { for (u32 i = 0; i < count; i++) { resultsOut[i] = SignOfR32(values[i]); } }
+	void KernelAbsDiffU8(u32 count, const u8* left, const u8* right, u8* resultsOut) { for (u32 i = 0; i < count; i++) { resultsOut[i] = AbsDiffU8(left[i], right[i]); } }
+	void KernelLerpClampR32(u32 count, const r32* starts, const r32* ends, r32* resultsOut) { for (u32 i = 0; i < count; i++) { resultsOut[i] = LerpClampR32(starts[i], ends[i], 0.3f); } }
+}
+
+// +--------------------------------------------------------------+
+// |                          Run Time                            |
+// +--------------------------------------------------------------+
+void TestEdgeCases()
+{
+	TestSection("Edge cases");
+	volatile r32 nan = NAN;
+	TestCheck(isnan(ScalarClampR32(nan, 0.0f, 1.0f))); //NaN passes through, same as the old compare-and-branch version
+	TestCheck(ScalarClampR32(-3.0f, 0.0f, 1.0f) == 0.0f);
+	TestCheck(ScalarClampR32(0.5f, 0.0f, 1.0f) == 0.5f);
+	TestCheck(ScalarClampI32(INT32_MIN, -5, 5) == -5);
+	TestCheck(ScalarClampR32(-3.0f, 1.0f, 0.0f) == 1.0f && ScalarClampI32(-30, 10, 0) == 10 && ScalarClampI32(5, 10, 0) == 10); //min > max: below min still gives min
+	TestCheck(ScalarClampR32(3.0f, 1.0f, 0.0f) == 0.0f && ScalarClampI32(30, 10, 0) == 0); //and everything else gives max
+	//The float ClampCasts can't pass NaN through (casting it is undefined) so they turn it into the minimum
+	TestCheck(ClampCastR32ToI16(nan) == INT16_MIN && ClampCastR32ToI32(nan) == INT32_MIN && ClampCastR64ToI32((r64)nan) == INT32_MIN);
+	TestCheck(ClampCastR32ToI16(1e9f) == INT16_MAX && ClampCastR32ToI32(-1e12f) == INT32_MIN && ClampCastR32ToI16(2.5f) == 2);
+	TestCheck(ScalarClampI32(INT32_MAX, -5, 5) == 5);
+	TestCheck(ScalarSignOfI32(INT32_MIN) == -1 && ScalarSignOfI32(0) == 0 && ScalarSignOfI32(1) == 1);
+	TestCheck(ScalarAbsDiffU8(0, 255) == 255 && ScalarAbsDiffU8(255, 0) == 255);
+	TestCheck(SignOfR32(-0.0f) == 0.0f && SignOfR32(-1e-30f) == -1.0f);
+	TestCheck(!signbit(AbsR32(-0.0f)));
+	TestCheck(LerpClampR32(2.0f, 4.0f, 1.5f) == 4.0f && LerpClampR32(2.0f, 4.0f, -1.0f) == 2.0f);
+	TestCheck(MinR64(1.0, -2.0, 3.0) == -2.0 && MaxU32(1, 5, 3) == 5);
+}
+
+void TestKernels()
+{
+	TestSection("Kernel loops");
+	const u32 count = 1021; //odd so the vectorized loops run their tails
+	static r32 floats[count], floats2[count], floatResults[count];
+	static i32 ints[count], ints2[count], intResults[count];
+	static u8 bytes[count], bytes2[count], byteResults[count];
+	for (u32 i = 0; i < count; i++)
+	{
+		floats[i] = TestRandR32(-3.0f, 3.0f); floats2[i] = TestRandR32(-3.0f, 3.0f);
+		ints[i] = (i32)TestRandU32(0, 400) - 200; ints2[i] = (i32)TestRandU32(0, 400) - 200;
+		bytes[i] = (u8)TestRandU32(); bytes2[i] = (u8)TestRandU32();
+	}
+	bool allMatch = true;
+	KernelClampR32(count, floats, floatResults);
+	for (u32 i = 0; i < count; i++) { if (floatResults[i] != ((floats[i] < -1.0f) ? -1.0f : ((floats[i] > 1.0f) ? 1.0f : floats[i]))) { allMatch = false; } }
+	TestCheck(allMatch);
+	allMatch = true;
+	KernelClampI32(count, ints, intResults);
+	for (u32 i = 0; i < count; i++) { if (intResults[i] != ((ints[i] < -100) ? -100 : ((ints[i] > 100) ? 100 : ints[i]))) { allMatch = false; } }
+	TestCheck(allMatch);
+	allMatch = true;
+	KernelMinI32(count, ints, ints2, intResults);
+	for (u32 i = 0; i < count; i++) { if (intResults[i] != ((ints[i] < ints2[i]) ? ints[i] : ints2[i])) { allMatch = false; } }
+	TestCheck(allMatch);
+	allMatch = true;
+	KernelMaxR32(count, floats, floats2, floatResults);
+	for (u32 i = 0; i < count; i++) { if (floatResults[i] != ((floats[i] > floats2[i]) ? floats[i] : floats2[i])) { allMatch = false; } }
+	TestCheck(allMatch);
+	allMatch = true;
+	KernelAbsI32(count, ints, intResults);
+	for (u32 i = 0; i < count; i++) { if (intResults[i] != ((ints[i] < 0) ? -ints[i] : ints[i])) { allMatch = false; } }
+	TestCheck(allMatch);
+	allMatch = true;
+	KernelSignOfR32(count, floats, floatResults);
+	for (u32 i = 0; i < count; i++) { if (floatResults[i] != ((floats[i] > 0) ? 1.0f : ((floats[i] < 0) ? -1.0f : 0.0f))) { allMatch = false; } }
+	TestCheck(allMatch);
+	allMatch = true;
+	KernelAbsDiffU8(count, bytes, bytes2, byteResults);
+	for (u32 i = 0; i < count; i++) { if (byteResults[i] != (u8)((bytes[i] > bytes2[i]) ? (bytes[i] - bytes2[i]) : (bytes2[i] - bytes[i]))) { allMatch = false; } }
+	TestCheck(allMatch);
+	allMatch = true;
+	KernelLerpClampR32(count, floats, floats2, floatResults);
+	for (u32 i = 0; i < count; i++) { if (AbsR32(floatResults[i] - (floats[i] + (floats2[i] - floats[i]) * 0.3f)) > 1e-6f) { allMatch = false; } }
+	TestCheck(allMatch);
+}
+
+//The clamp ClampR32 used before it went through the templates
+__attribute__((noinline)) void BranchingClampLoop(u32 count, const r32* values, r32* resultsOut)
+{
+	for (u32 i = 0; i < count; i++)
+	{
+		r32 value = values[i];
+		if (value < -1.0f) { resultsOut[i] = -1.0f; }
+		else if (value > 1.0f) { resultsOut[i] = 1.0f; }
+		else { resultsOut[i] = value; }
+	}
+}
+
+void BenchClamp()
+{
+	TestSection("Benchmarks (64k random values in [-2, 2], per pass)");
+	const u32 count = 64*1024;
+	r32* values = (r32*)malloc(count * sizeof(r32));
+	r32* results = (r32*)malloc(count * sizeof(r32));
+	for (u32 i = 0; i < count; i++) { values[i] = TestRandR32(-2.0f, 2.0f); }
+	TestBench("clamp r32", "compare and branch", 100, count, [&]() { BranchingClampLoop(count, values, results); });
+	TestBench("clamp r32", "ClampR32 loop", 100, count, [&]() { KernelClampR32(count, values, results); });
+	TestDoNotOptimize(results[count/2]);
+	free(values);
+	free(results);
+}
+
+int main(int argc, char** argv)
+{
+	TestBegin("Min/Max/Clamp templates", argc, argv);
+	TestEdgeCases();
+	TestKernels();
+	if (testBenchEnabled) { BenchClamp(); }
+	return TestEnd();
+}
@@ -0,0 +1,258 @@
+/*
+File:   test_parse.cpp
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Checks the TryParse functions in orca_parse.h against strtoull/strtoll and
+	** strtod/strtof: integer edge cases and overflow, float syntax errors, random
+	** long digit strings with big exponents, strings right next to the halfway point
+	** between two doubles (and floats) where the big decimal fallback has to decide,
+	** and FormatR64/FormatR32/FormatU64/FormatI64 output reading back bit-exact.
+	** With --bench it times each against the C library on 1M strings
+*/
+
+#include "orca.h"
+#include "../my_orca.h"
+#include "test_common.h"
+
+#include <vector>
+#include <string>
+#include <cmath>
+#include <cerrno>
+
+INLINE u64 TestRandU64() { return ((u64)TestRandU32() << 32) | TestRandU32(); }
+
+MyStr_t ToMyStr(const std::string& str) { return NewStr((u64)str.size(), (char*)str.c_str()); }
+std::string ToStdStr(MyStr_t str) { return std::string(str.chars, str.length); }
+
+std::string RandomDigits(u32 numDigits)
+{
+	std::string result;
+	for (u32 dIndex = 0; dIndex < numDigits; dIndex++) { result += (char)('0' + TestRandU32(0, 10)); }
+	return result;
+}
+
+//Checks TryParseR64 and TryParseR32 give the same bits as strtod/strtof (or fail with Overflow when those return inf)
+bool CheckFloat(const std::string& str)
+{
+	bool result = true;
+	errno = 0;
+	r64 reference = strtod(str.c_str(), nullptr);
+	bool referenceOverflow = (errno == ERANGE && std::isinf(reference));
+	r64 value = 0;
+	ParseFailure_t failure = ParseFailure_None;
+	bool success = TryParseR64(ToMyStr(str), &value, &failure);
+	if (referenceOverflow ? (success || failure != ParseFailure_Overflow) : (!success || memcmp(&value, &reference, sizeof(r64)) != 0))
+	{
+		printf("  TryParseR64 \"%s\": %.17g (%s), strtod gives %.17g\n", str.c_str(), value, GetParseFailureStr(failure), reference);
+		result = false;
+	}
+	errno = 0;
+	r32 reference32 = strtof(str.c_str(), nullptr);
+	bool referenceOverflow32 = (errno == ERANGE && std::isinf(reference32));
+	r32 value32 = 0;
+	success = TryParseR32(ToMyStr(str), &value32, &failure);
+	if (referenceOverflow32 ? (success || failure != ParseFailure_Overflow) : (!success || memcmp(&value32, &reference32, sizeof(r32)) != 0))
+	{
+		printf("  TryParseR32 \"%s\": %.9g (%s), strtof gives %.9g\n", str.c_str(), value32, GetParseFailureStr(failure), reference32);
+		result = false;
+	}
+	return result;
+}
+
+bool ExpectFloatFailure(const char* str, ParseFailure_t expected)
+{
+	r64 value = 1234.0;
+	ParseFailure_t failure = ParseFailure_None;
+	bool success = TryParseR64(NewStr(str), &value, &failure);
+	return (!success && failure == expected && value == 1234.0);
+}
+
+void TestIntegers()
+{
+	TestSection("Integers vs strtoull/strtoll");
+	const char* cases[] = {
+		"0", "00000000000000000000000000000", "1", "+1", "-0", "18446744073709551615", "18446744073709551616", "99999999999999999999",
+		"000000000000000000000018446744073709551615", "9223372036854775807", "9223372036854775808", "-9223372036854775808", "-9223372036854775809",
+		"12345678", "1234567890123456", "12345678901234567", "", "-", "+", "1a", "a1", " 1", "1 ", "--1", "2147483647", "2147483648",
+		"-2147483648", "-2147483649",
+	};
+	bool allCases = true;
+	for (const char* caseStr : cases)
+	{
+		std::string str = caseStr;
+		//The C functions skip whitespace and take partial strings, so only trust them when the whole string is an optional sign and digits
+		bool isStrict = (!str.empty() && (isdigit((u8)str[0]) || ((str[0] == '+' || str[0] == '-') && str.size() > 1 && isdigit((u8)str[1]))));
+		for (size_t cIndex = 1; cIndex < str.size(); cIndex++) { if (!isdigit((u8)str[cIndex])) { isStrict = false; } }
+		errno = 0;
+		unsigned long long referenceU64 = strtoull(str.c_str(), nullptr, 10);
+		bool referenceOkU64 = (isStrict && str[0] != '-' && errno == 0);
+		errno = 0;
+		long long referenceI64 = strtoll(str.c_str(), nullptr, 10);
+		bool referenceOkI64 = (isStrict && errno == 0);
+		bool referenceOkI32 = (referenceOkI64 && referenceI64 >= INT32_MIN && referenceI64 <= INT32_MAX);
+		u64 valueU64 = 7;
+		i64 valueI64 = 7;
+		i32 valueI32 = 7;
+		bool okU64 = TryParseU64(ToMyStr(str), &valueU64);
+		bool okI64 = TryParseI64(ToMyStr(str), &valueI64);
+		bool okI32 = TryParseI32(ToMyStr(str), &valueI32);
+		if (okU64 != referenceOkU64 || (okU64 ? (valueU64 != referenceU64) : (valueU64 != 7))) { printf("  TryParseU64 \"%s\"\n", caseStr); allCases = false; }
+		if (okI64 != referenceOkI64 || (okI64 ? (valueI64 != referenceI64) : (valueI64 != 7))) { printf("  TryParseI64 \"%s\"\n", caseStr); allCases = false; }
+		if (okI32 != referenceOkI32 || (okI32 ? (valueI32 != referenceI64) : (valueI32 != 7))) { printf("  TryParseI32 \"%s\"\n", caseStr); allCases = false; }
+	}
+	TestCheck(allCases);
+	ParseFailure_t failure = ParseFailure_None;
+	u64 ignored;
+	TestCheck(!TryParseU64(NewStr(""), &ignored, &failure) && failure == ParseFailure_Empty);
+	TestCheck(!TryParseU64(NewStr("12x4"), &ignored, &failure) && failure == ParseFailure_InvalidCharacter);
+	TestCheck(!TryParseU64(NewStr("18446744073709551616"), &ignored, &failure) && failure == ParseFailure_Overflow);
+
+	bool allRoundTrips = true;
+	char buffer[FORMAT_I64_MAX_LENGTH];
+	for (u32 iIndex = 0; iIndex < 500000; iIndex++)
+	{
+		u64 value = TestRandU64() >> TestRandU32(0, 64);
+		i64 signedValue = (i64)TestRandU64() >> TestRandU32(0, 64);
+		u64 valueBack = 0;
+		i64 signedBack = 0;
+		if (!TryParseU64(FormatU64(value, buffer, sizeof(buffer)), &valueBack) || valueBack != value) { allRoundTrips = false; }
+		if (!TryParseI64(FormatI64(signedValue, buffer, sizeof(buffer)), &signedBack) || signedBack != signedValue) { allRoundTrips = false; }
+	}
+	TestCheck(allRoundTrips);
+}
+
+void TestFloatSyntax()
+{
+	TestSection("Float syntax and edge cases vs strtod/strtof");
+	TestCheck(ExpectFloatFailure("", ParseFailure_Empty));
+	bool allInvalid = true;
+	for (const char* str : { "-", ".", "1e", "1e+", "1.5f", " 1", "1 ", "infinite", "1..2", "0x10", "--1", "e5" })
+	{
+		if (!ExpectFloatFailure(str, ParseFailure_InvalidCharacter)) { printf("  \"%s\" should be InvalidCharacter\n", str); allInvalid = false; }
+	}
+	TestCheck(allInvalid);
+	TestCheck(ExpectFloatFailure("1e309", ParseFailure_Overflow) && ExpectFloatFailure("-1.8e308", ParseFailure_Overflow));
+
+	const char* cases[] = {
+		"0", "-0", "1", "1.", ".5", "-.5", "+1.5", "1e5", "1E-5", "1e+5", "0.1", "0.30000000000000004", "123456789012345678901234567890",
+		"1.7976931348623157e308", "1.7976931348623158e308", "1.7976931348623159e308", "2.2250738585072011e-308", "2.2250738585072014e-308",
+		"4.9e-324", "2.4703282292062327e-324", "2.4703282292062328e-324", "1e-400", "0e999999999999", "9007199254740993",
+		"9007199254740993.0000000000000000000001", "9007199254740992.9999999999999999999999", "3.4028235e38", "3.4028236e38", "1.17549435e-38",
+		"1.4e-45", "7.006492321624085354618e-46", "7.006492321624085354619e-46", "16777217", "16777217.000000000000000000001",
+		"0.000000000000000000000000000000000000000000001", "1e22", "1e23", "8.98846567431158e307", "0.1e-320",
+		"000000000000000000000000000000.100000000000000000000000000000e1",
+	};
+	bool allCases = true;
+	for (const char* str : cases) { if (!CheckFloat(str)) { allCases = false; } }
+	TestCheck(allCases);
+	r64 value = 0;
+	TestCheck(TryParseR64(NewStr("inf"), &value) && value == INFINITY);
+	TestCheck(TryParseR64(NewStr("-Infinity"), &value) && value == -INFINITY);
+	TestCheck(TryParseR64(NewStr("NaN"), &value) && std::isnan(value));
+}
+
+void TestFloatRandom()
+{
+	TestSection("Random floats vs strtod/strtof");
+	bool allRoundTrips = true;
+	char buffer[FORMAT_R64_MAX_LENGTH];
+	for (u32 iIndex = 0; iIndex < 1000000; iIndex++)
+	{
+		u64 bits = TestRandU64();
+		r64 value;
+		memcpy(&value, &bits, sizeof(value));
+		r64 valueBack = 0;
+		if (!std::isnan(value) && (!TryParseR64(FormatR64(value, buffer, sizeof(buffer)), &valueBack) || memcmp(&valueBack, &value, sizeof(r64)) != 0)) { allRoundTrips = false; }
+		u32 bits32 = TestRandU32();
+		r32 value32;
+		memcpy(&value32, &bits32, sizeof(value32));
+		r32 valueBack32 = 0;
+		if (!std::isnan(value32) && (!TryParseR32(FormatR32(value32, buffer, sizeof(buffer)), &valueBack32) || memcmp(&valueBack32, &value32, sizeof(r32)) != 0)) { allRoundTrips = false; }
+	}
+	TestCheck(allRoundTrips);
+
+	//Up to 60 digits with the point anywhere, leading zeros and exponents well past both ends
+	bool allStrings = true;
+	for (u32 iIndex = 0; iIndex < 300000; iIndex++)
+	{
+		std::string str = (TestRandU32(0, 2) == 0) ? "-" : "";
+		std::string digits = RandomDigits(1 + TestRandU32(0, (TestRandU32(0, 4) == 0) ? 60 : 20));
+		if (TestRandU32(0, 4) == 0) { digits = std::string(TestRandU32(0, 30), '0') + digits; }
+		u32 pointIndex = TestRandU32(0, (u32)digits.size() + 1);
+		str += digits.substr(0, pointIndex) + "." + digits.substr(pointIndex);
+		u32 exponentType = TestRandU32(0, 4);
+		if (exponentType == 0) { str += "e" + std::to_string((i32)TestRandU32(0, 700) - 360); }
+		else if (exponentType == 1) { str += "e" + std::to_string((i32)TestRandU32(0, 100) - 60); }
+		if (!CheckFloat(str)) { allStrings = false; }
+	}
+	TestCheck(allStrings);
+
+	//Halfway between two neighbours (or a last digit off from it), where Eisel-Lemire gives up and the big decimal path decides
+	bool allHalfway = true;
+	char text[128];
+	for (u32 iIndex = 0; iIndex < 200000; iIndex++)
+	{
+		u64 bits = TestRandU64() & 0x7FEFFFFFFFFFFFFFULL;
+		r64 value;
+		memcpy(&value, &bits, sizeof(value));
+		long double halfway = ((long double)value + (long double)nextafter(value, INFINITY)) / 2;
+		snprintf(text, sizeof(text), "%.*Le", (int)TestRandU32(17, 42), halfway);
+		std::string str = text;
+		if (TestRandU32(0, 2) == 0)
+		{
+			char& lastDigit = str[str.find('e') - 1];
+			lastDigit = (char)('0' + ((lastDigit - '0') + ((TestRandU32(0, 2) == 0) ? 1 : 9)) % 10);
+		}
+		if (!CheckFloat(str)) { allHalfway = false; }
+		u32 bits32 = TestRandU32() & 0x7F7FFFFF;
+		r32 value32;
+		memcpy(&value32, &bits32, sizeof(value32));
+		snprintf(text, sizeof(text), "%.*e", (int)TestRandU32(8, 38), ((r64)value32 + (r64)nextafterf(value32, INFINITY)) / 2);
+		if (!CheckFloat(text)) { allHalfway = false; }
+	}
+	TestCheck(allHalfway);
+}
+
+void BenchParse()
+{
+	TestSection("Benchmarks (1M strings, per string)");
+	const u32 numStrings = 1000000;
+	char buffer[64];
+	std::vector<std::string> configStrs(numStrings), shortestStrs(numStrings), longStrs(numStrings), intStrs(numStrings);
+	for (u32 sIndex = 0; sIndex < numStrings; sIndex++)
+	{
+		snprintf(buffer, sizeof(buffer), "%.2f", ((r64)TestRandU32(0, 2000000) - 1000000.0) / 100.0);
+		configStrs[sIndex] = buffer;
+		u64 bits = TestRandU64() & 0x7FEFFFFFFFFFFFFFULL;
+		r64 value;
+		memcpy(&value, &bits, sizeof(value));
+		shortestStrs[sIndex] = ToStdStr(FormatR64(value, buffer, sizeof(buffer)));
+		snprintf(buffer, sizeof(buffer), "%.17g", value);
+		longStrs[sIndex] = buffer;
+		snprintf(buffer, sizeof(buffer), "%lld", (long long)((i64)TestRandU64() >> TestRandU32(0, 64)));
+		intStrs[sIndex] = buffer;
+	}
+	r64 sum = 0;
+	i64 intSum = 0;
+	for (auto group : { std::make_pair("config \"%.2f\"", &configStrs), std::make_pair("shortest r64", &shortestStrs), std::make_pair("%.17g", &longStrs) })
+	{
+		const std::vector<std::string>& strs = *group.second;
+		TestBench(group.first, "strtod", 5, numStrings, [&]() { for (const std::string& str : strs) { sum += strtod(str.c_str(), nullptr); } });
+		TestBench(group.first, "TryParseR64", 5, numStrings, [&]() { for (const std::string& str : strs) { r64 value = 0; TryParseR64(ToMyStr(str), &value); sum += value; } });
+	}
+	TestBench("i64", "strtoll", 5, numStrings, [&]() { for (const std::string& str : intStrs) { intSum += strtoll(str.c_str(), nullptr, 10); } });
+	TestBench("i64", "TryParseI64", 5, numStrings, [&]() { for (const std::string& str : intStrs) { i64 value = 0; TryParseI64(ToMyStr(str), &value); intSum += value; } });
+	TestDoNotOptimize(sum);
+	TestDoNotOptimize(intSum);
+}
+
+int main(int argc, char** argv)
+{
+	TestBegin("Number parsing", argc, argv);
+	TestIntegers();
+	TestFloatSyntax();
+	TestFloatRandom();
+	if (testBenchEnabled) { BenchParse(); }
+	return TestEnd();
+}
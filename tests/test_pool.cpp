@@ -0,0 +1,125 @@
+/*
+File:   test_pool.cpp
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Checks Pool_t from orca_pool.h: slab growth and the numLive/peakLive/capacity
+	** stats, that freed slots get reused before a new slab is added, that live slots
+	** are never touched by frees around them, IsPointerInPool, PoolFreeAll and
+	** cache line alignment.
+	** With --bench it times random free+alloc churn against malloc/free
+*/
+
+#include "orca.h"
+#include "../my_orca.h"
+#include "test_common.h"
+
+#include <vector>
+
+struct Particle_t
+{
+	v2 position;
+	v2 velocity;
+	r32 life;
+	u32 id;
+	u8 padding[40];
+};
+
+void TestPool()
+{
+	TestSection("Slabs, reuse and stats");
+	OC_Arena_t arena;
+	OC_ArenaInit(&arena);
+	Pool_t pool;
+	CreatePoolType(&pool, &arena, Particle_t, 256);
+	std::vector<Particle_t*> particles;
+	for (u32 pIndex = 0; pIndex < 1000; pIndex++)
+	{
+		Particle_t* particle = PoolAllocType(&pool, Particle_t);
+		particle->id = pIndex;
+		particles.push_back(particle);
+	}
+	TestCheck(pool.numLive == 1000 && pool.capacity == 1024 && pool.numSlabs == 4);
+	bool allAligned = true;
+	for (Particle_t* particle : particles) { if (((uintptr_t)particle % alignof(Particle_t)) != 0) { allAligned = false; } }
+	TestCheck(allAligned);
+
+	for (u32 pIndex = 0; pIndex < 1000; pIndex += 2) { PoolFree(&pool, particles[pIndex]); }
+	bool allIntact = true;
+	for (u32 pIndex = 1; pIndex < 1000; pIndex += 2) { if (particles[pIndex]->id != pIndex) { allIntact = false; } }
+	TestCheck(allIntact);
+	TestCheck(pool.numLive == 500 && pool.peakLive == 1000);
+
+	for (u32 pIndex = 0; pIndex < 500; pIndex++) { PoolAllocType(&pool, Particle_t); }
+	TestCheck(pool.numSlabs == 4 && pool.numLive == 1000 && pool.peakLive == 1000);
+	TestCheck(IsPointerInPool(&pool, particles[5]));
+	TestCheck(!IsPointerInPool(&pool, (u8*)particles[5] + 1));
+	Particle_t outside;
+	TestCheck(!IsPointerInPool(&pool, &outside));
+
+	PoolFreeAll(&pool);
+	TestCheck(pool.numLive == 0 && pool.numSlabs == 4 && pool.capacity == 1024);
+	for (u32 pIndex = 0; pIndex < 1024; pIndex++) { PoolAlloc(&pool); }
+	TestCheck(pool.numSlabs == 4); //every slot came back, no new slab needed
+
+	TestSection("Cache line alignment");
+	Pool_t alignedPool;
+	CreatePool(&alignedPool, &arena, 20, 100, POOL_CACHE_LINE_SIZE);
+	bool allCacheAligned = true;
+	for (u32 pIndex = 0; pIndex < 300; pIndex++) { if (((uintptr_t)PoolAlloc(&alignedPool) % POOL_CACHE_LINE_SIZE) != 0) { allCacheAligned = false; } }
+	TestCheck(allCacheAligned);
+	TestCheck(alignedPool.stride == POOL_CACHE_LINE_SIZE);
+
+	FreePool(&pool);
+	FreePool(&alignedPool);
+	OC_ArenaCleanup(&arena);
+}
+
+void BenchPool()
+{
+	TestSection("Benchmarks (10k live 64-byte objects, random free+alloc pairs)");
+	const u32 numLive = 10000;
+	const u32 numPairs = 2000000;
+	std::vector<void*> slots(numLive);
+	std::vector<u32> slotOrder(numPairs);
+	for (u32 oIndex = 0; oIndex < numPairs; oIndex++) { slotOrder[oIndex] = TestRandU32(0, numLive); }
+
+	for (u32 sIndex = 0; sIndex < numLive; sIndex++) { slots[sIndex] = malloc(sizeof(Particle_t)); }
+	TestBench("churn", "free + malloc", 5, numPairs, [&]()
+	{
+		for (u32 oIndex = 0; oIndex < numPairs; oIndex++)
+		{
+			u32 slot = slotOrder[oIndex];
+			free(slots[slot]);
+			slots[slot] = malloc(sizeof(Particle_t));
+			((Particle_t*)slots[slot])->id = oIndex;
+		}
+	});
+	for (u32 sIndex = 0; sIndex < numLive; sIndex++) { free(slots[sIndex]); }
+
+	OC_Arena_t arena;
+	OC_ArenaInit(&arena);
+	Pool_t pool;
+	CreatePoolType(&pool, &arena, Particle_t, 1024);
+	for (u32 sIndex = 0; sIndex < numLive; sIndex++) { slots[sIndex] = PoolAlloc(&pool); }
+	TestBench("churn", "PoolFree + PoolAlloc", 5, numPairs, [&]()
+	{
+		for (u32 oIndex = 0; oIndex < numPairs; oIndex++)
+		{
+			u32 slot = slotOrder[oIndex];
+			PoolFree(&pool, slots[slot]);
+			slots[slot] = PoolAlloc(&pool);
+			((Particle_t*)slots[slot])->id = oIndex;
+		}
+	});
+	FreePool(&pool);
+	OC_ArenaCleanup(&arena);
+}
+
+int main(int argc, char** argv)
+{
+	TestBegin("Object pool", argc, argv);
+	TestPool();
+	if (testBenchEnabled) { BenchPool(); }
+	return TestEnd();
+}
@@ -0,0 +1,209 @@
+/*
+File:   test_radix_sort.cpp
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Checks the radix sorts in orca_radix_sort.h against std::stable_sort for every
+	** key type, with and without payloads, at sizes on both sides of the insertion
+	** sort cutoff. Keys are random, mostly constant (so passes get skipped), heavy on
+	** duplicates (the payload order checks stability) and, for r32, full of -0/+0,
+	** infinities and NaNs.
+	** With --bench it times u32, r32 and u64 keys with a payload against std::sort
+	** (and qsort for u32) on pairs, from 256 to 1M keys
+*/
+
+#include "orca.h"
+#include "../my_orca.h"
+#include "test_common.h"
+
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+
+INLINE u64 TestRandU64() { return ((u64)TestRandU32() << 32) | TestRandU32(); }
+
+//r32 keys are compared by their flipped bits, that's the order RadixSortR32 documents (NaNs included)
+template<typename KeyType>
+INLINE bool KeyLess(KeyType left, KeyType right)
+{
+	if constexpr (std::is_same<KeyType, r32>::value)
+	{
+		u32 leftBits, rightBits;
+		memcpy(&leftBits, &left, sizeof(u32));
+		memcpy(&rightBits, &right, sizeof(u32));
+		return (RadixSortFlipR32(leftBits) < RadixSortFlipR32(rightBits));
+	}
+	else { return (left < right); }
+}
+
+template<typename KeyType>
+bool CheckSort(std::vector<KeyType> keys, bool usePayloads, void (*sortFunc)(KeyType*, u32*, u64))
+{
+	u64 count = keys.size();
+	std::vector<u32> payloads(count);
+	std::vector<std::pair<KeyType, u32>> reference(count);
+	for (u64 kIndex = 0; kIndex < count; kIndex++) { payloads[kIndex] = (u32)kIndex; reference[kIndex] = { keys[kIndex], (u32)kIndex }; }
+	std::stable_sort(reference.begin(), reference.end(), [](const std::pair<KeyType, u32>& left, const std::pair<KeyType, u32>& right) { return KeyLess(left.first, right.first); });
+	sortFunc(keys.data(), usePayloads ? payloads.data() : nullptr, count);
+	for (u64 kIndex = 0; kIndex < count; kIndex++)
+	{
+		if (memcmp(&keys[kIndex], &reference[kIndex].first, sizeof(KeyType)) != 0) { return false; }
+		if (usePayloads && payloads[kIndex] != reference[kIndex].second) { return false; }
+	}
+	return true;
+}
+
+void TestSorts()
+{
+	TestSection("All key types vs std::stable_sort");
+	bool allU32 = true, allI32 = true, allR32 = true, allU64 = true;
+	const r32 specialFloats[] = { -0.0f, 0.0f, -1.5f, INFINITY, -INFINITY, NAN, -NAN };
+	for (u64 count : { 0, 1, 2, 3, 17, 63, 64, 65, 200, 1000, 4097, 100000 })
+	{
+		for (u32 mode = 0; mode < 4; mode++)
+		{
+			std::vector<u32> keysU32(count);
+			std::vector<i32> keysI32(count);
+			std::vector<r32> keysR32(count);
+			std::vector<u64> keysU64(count);
+			for (u64 kIndex = 0; kIndex < count; kIndex++)
+			{
+				u64 random = TestRandU64();
+				if (mode == 1) { random &= 0xFF00; } //most bytes the same, those passes get skipped
+				if (mode == 2) { random %= 7; } //lots of equal keys, the payloads check stability
+				if (mode == 3) { random = ((random & 0xFFFF) << 40) | (random >> 60); } //u64 with constant bytes in the middle
+				keysU32[kIndex] = (u32)random;
+				keysI32[kIndex] = (i32)(u32)(random >> 7);
+				keysU64[kIndex] = random;
+				u32 floatBits = (u32)(random >> 3);
+				memcpy(&keysR32[kIndex], &floatBits, sizeof(r32));
+				if (mode == 1) { keysR32[kIndex] = (r32)((i32)(random % 2001) - 1000) * 0.25f; }
+				if (mode == 2) { keysR32[kIndex] = specialFloats[random]; }
+			}
+			for (bool usePayloads : { false, true })
+			{
+				if (!CheckSort<u32>(keysU32, usePayloads, RadixSortU32)) { printf("  RadixSortU32 count %llu mode %u\n", (unsigned long long)count, mode); allU32 = false; }
+				if (!CheckSort<i32>(keysI32, usePayloads, RadixSortI32)) { printf("  RadixSortI32 count %llu mode %u\n", (unsigned long long)count, mode); allI32 = false; }
+				if (!CheckSort<r32>(keysR32, usePayloads, RadixSortR32)) { printf("  RadixSortR32 count %llu mode %u\n", (unsigned long long)count, mode); allR32 = false; }
+				if (!CheckSort<u64>(keysU64, usePayloads, RadixSortU64)) { printf("  RadixSortU64 count %llu mode %u\n", (unsigned long long)count, mode); allU64 = false; }
+			}
+		}
+	}
+	TestCheck(allU32);
+	TestCheck(allI32);
+	TestCheck(allR32);
+	TestCheck(allU64);
+	TestCheck(RadixSortUnflipR32(RadixSortFlipR32(0x80000000)) == 0x80000000 && RadixSortUnflipR32(RadixSortFlipR32(0x3F800000)) == 0x3F800000);
+}
+
+struct SortPair_t
+{
+	u32 key;
+	u32 payload;
+};
+
+//Every repeat copies in a different slice of unsorted keys first (so the branch predictor can't learn one array), the copy is part of each number
+void BenchRadixSort()
+{
+	TestSection("Benchmarks (with a u32 payload, per key)");
+	char groupName[32];
+	for (u64 count : { 256, 1000, 10000, 100000, 1000000 })
+	{
+		u64 numRepeats = Max<u64>(2000000 / count, 1);
+		u64 numOps = numRepeats * count;
+		std::vector<u32> sourceU32(numOps), keysU32(count), payloads(count);
+		std::vector<r32> sourceR32(numOps), keysR32(count);
+		std::vector<u64> sourceU64(numOps), keysU64(count);
+		for (u64 kIndex = 0; kIndex < numOps; kIndex++)
+		{
+			sourceU32[kIndex] = TestRandU32();
+			sourceR32[kIndex] = (r32)TestRandU32(0, 1000000) * 0.001f - 500.0f;
+			sourceU64[kIndex] = TestRandU64();
+		}
+		std::vector<SortPair_t> pairs(count);
+		std::vector<std::pair<r32, u32>> pairsR32(count);
+		std::vector<std::pair<u64, u32>> pairsU64(count);
+		snprintf(groupName, sizeof(groupName), "%llu keys", (unsigned long long)count);
+
+		TestBench(groupName, "RadixSortU32", 5, numOps, [&]()
+		{
+			for (u64 rIndex = 0; rIndex < numRepeats; rIndex++)
+			{
+				for (u64 kIndex = 0; kIndex < count; kIndex++) { keysU32[kIndex] = sourceU32[rIndex * count + kIndex]; payloads[kIndex] = (u32)kIndex; }
+				RadixSortU32(keysU32.data(), payloads.data(), count);
+			}
+		});
+		if (count <= 256)
+		{
+			TestBench(groupName, "InsertionSortU32", 5, numOps, [&]()
+			{
+				for (u64 rIndex = 0; rIndex < numRepeats; rIndex++)
+				{
+					for (u64 kIndex = 0; kIndex < count; kIndex++) { keysU32[kIndex] = sourceU32[rIndex * count + kIndex]; payloads[kIndex] = (u32)kIndex; }
+					InsertionSortU32(keysU32.data(), payloads.data(), count);
+				}
+			});
+		}
+		TestBench(groupName, "std::sort u32 pairs", 5, numOps, [&]()
+		{
+			for (u64 rIndex = 0; rIndex < numRepeats; rIndex++)
+			{
+				for (u64 kIndex = 0; kIndex < count; kIndex++) { pairs[kIndex] = { sourceU32[rIndex * count + kIndex], (u32)kIndex }; }
+				std::sort(pairs.begin(), pairs.end(), [](const SortPair_t& left, const SortPair_t& right) { return left.key < right.key; });
+			}
+		});
+		TestBench(groupName, "qsort u32 pairs", 5, numOps, [&]()
+		{
+			for (u64 rIndex = 0; rIndex < numRepeats; rIndex++)
+			{
+				for (u64 kIndex = 0; kIndex < count; kIndex++) { pairs[kIndex] = { sourceU32[rIndex * count + kIndex], (u32)kIndex }; }
+				qsort(pairs.data(), count, sizeof(SortPair_t), [](const void* left, const void* right)
+				{
+					u32 leftKey = ((const SortPair_t*)left)->key, rightKey = ((const SortPair_t*)right)->key;
+					return (leftKey > rightKey) - (leftKey < rightKey);
+				});
+			}
+		});
+		TestBench(groupName, "RadixSortR32", 5, numOps, [&]()
+		{
+			for (u64 rIndex = 0; rIndex < numRepeats; rIndex++)
+			{
+				for (u64 kIndex = 0; kIndex < count; kIndex++) { keysR32[kIndex] = sourceR32[rIndex * count + kIndex]; payloads[kIndex] = (u32)kIndex; }
+				RadixSortR32(keysR32.data(), payloads.data(), count);
+			}
+		});
+		TestBench(groupName, "std::sort r32 pairs", 5, numOps, [&]()
+		{
+			for (u64 rIndex = 0; rIndex < numRepeats; rIndex++)
+			{
+				for (u64 kIndex = 0; kIndex < count; kIndex++) { pairsR32[kIndex] = { sourceR32[rIndex * count + kIndex], (u32)kIndex }; }
+				std::sort(pairsR32.begin(), pairsR32.end(), [](const std::pair<r32, u32>& left, const std::pair<r32, u32>& right) { return left.first < right.first; });
+			}
+		});
+		TestBench(groupName, "RadixSortU64", 5, numOps, [&]()
+		{
+			for (u64 rIndex = 0; rIndex < numRepeats; rIndex++)
+			{
+				for (u64 kIndex = 0; kIndex < count; kIndex++) { keysU64[kIndex] = sourceU64[rIndex * count + kIndex]; payloads[kIndex] = (u32)kIndex; }
+				RadixSortU64(keysU64.data(), payloads.data(), count);
+			}
+		});
+		TestBench(groupName, "std::sort u64 pairs", 5, numOps, [&]()
+		{
+			for (u64 rIndex = 0; rIndex < numRepeats; rIndex++)
+			{
+				for (u64 kIndex = 0; kIndex < count; kIndex++) { pairsU64[kIndex] = { sourceU64[rIndex * count + kIndex], (u32)kIndex }; }
+				std::sort(pairsU64.begin(), pairsU64.end(), [](const std::pair<u64, u32>& left, const std::pair<u64, u32>& right) { return left.first < right.first; });
+			}
+		});
+		TestDoNotOptimize(keysU32[count / 2] + pairs[count / 2].key + payloads[0]);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	TestBegin("Radix sort", argc, argv);
+	TestSorts();
+	if (testBenchEnabled) { BenchRadixSort(); }
+	return TestEnd();
+}
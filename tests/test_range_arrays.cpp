@@ -0,0 +1,160 @@
+/*
+File:   test_range_arrays.cpp
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Checks the Range Array Functions in orca_intrinsics.h (ClampArrayR32,
+	** LerpArrayR32, InverseLerpArrayR32, RemapArrayR32, SmoothStepArrayR32 and
+	** ScaleRampArrayR32) against their scalar versions, for every count up to 40
+	** (so every tail length is covered) on misaligned pointers and in-place, and on
+	** ranges far from zero where folding the start into the multiply-add used to
+	** cancel badly. With --bench it times each one against a scalar loop
+*/
+
+#include "orca.h"
+#include "../my_orca.h"
+#include "test_common.h"
+
+#define TEST_MAX_COUNT 40
+
+//How many r32 values lie between two finite values of the same sign (0 means identical)
+u32 UlpDistance(r32 value1, r32 value2)
+{
+	if (value1 == value2) { return 0; }
+	if ((value1 < 0) != (value2 < 0)) { return UINT32_MAX; }
+	u32 bits1 = R32ToBits(value1);
+	u32 bits2 = R32ToBits(value2);
+	return (bits1 > bits2) ? (bits1 - bits2) : (bits2 - bits1);
+}
+
+struct TestRange_t
+{
+	r32 start;
+	r32 end;
+};
+static const TestRange_t testRanges[] = {
+	{ -2.0f, 3.0f },
+	{ 0.0f, 1.0f },
+	{ 1000.0f, 1003.0f },
+	{ 100000.0f, 100007.0f },
+	{ -50000.0f, -49990.0f },
+	{ 5.0f, -5.0f },
+};
+
+void TestAgainstScalar()
+{
+	TestSection("Array vs scalar, counts 0-40, misaligned and in-place");
+	static r32 storage[TEST_MAX_COUNT + 1];
+	static r32 ends[TEST_MAX_COUNT];
+	static r32 results[TEST_MAX_COUNT + 1];
+	u32 maxInverseLerpUlp = 0, maxRemapUlp = 0;
+	r32 maxSmoothStepError = 0.0f;
+	bool allClamp = true, allLerp = true, allRamp = true, allInPlace = true, allGuard = true;
+	for (u32 rIndex = 0; rIndex < ArrayCount(testRanges); rIndex++)
+	{
+		TestRange_t range = testRanges[rIndex];
+		r32 rangeSize = range.end - range.start;
+		for (u32 count = 0; count <= TEST_MAX_COUNT; count++)
+		{
+			r32* values = &storage[1]; //one float in, so the SIMD loads are never 16-byte aligned
+			for (u32 i = 0; i < count; i++)
+			{
+				values[i] = range.start + rangeSize * TestRandR32(-0.25f, 1.25f);
+				ends[i] = range.start + rangeSize * TestRandR32();
+			}
+			results[count] = 12345.0f;
+
+			ClampArrayR32(count, values, range.start, range.end, results);
+			for (u32 i = 0; i < count; i++) { if (results[i] != ClampR32(values[i], range.start, range.end)) { allClamp = false; } }
+			LerpArrayR32(count, values, ends, 0.3f, results);
+			for (u32 i = 0; i < count; i++) { if (UlpDistance(results[i], LerpR32(values[i], ends[i], 0.3f)) > 1) { allLerp = false; } }
+			for (u32 clamp = 0; clamp < 2; clamp++)
+			{
+				InverseLerpArrayR32(count, values, range.start, range.end, (clamp != 0), results);
+				for (u32 i = 0; i < count; i++) { maxInverseLerpUlp = MaxU32(maxInverseLerpUlp, UlpDistance(results[i], InverseLerpR32(range.start, range.end, values[i], (clamp != 0)))); }
+			}
+			RemapArrayR32(count, values, range.start, range.end, -1.0f, 1.0f, results);
+			for (u32 i = 0; i < count; i++) { maxRemapUlp = MaxU32(maxRemapUlp, UlpDistance(results[i], RemapR32(values[i], range.start, range.end, -1.0f, 1.0f))); }
+			SmoothStepArrayR32(count, values, range.start, range.end, results);
+			for (u32 i = 0; i < count; i++) { maxSmoothStepError = MaxR32(maxSmoothStepError, AbsR32(results[i] - SmoothStepR32(range.start, range.end, values[i]))); }
+			ScaleRampArrayR32(count, values, 1.0f, 0.0f, results);
+			for (u32 i = 0; i < count; i++) { if (AbsR32(results[i] - values[i] * LerpR32(1.0f, 0.0f, (r32)i / (r32)count)) > 1e-6f * AbsR32(values[i])) { allRamp = false; } }
+			if (results[count] != 12345.0f) { allGuard = false; }
+
+			//In-place over the misaligned values
+			for (u32 i = 0; i < count; i++) { results[i] = RemapR32(values[i], range.start, range.end, 0.0f, 255.0f); }
+			RemapArrayR32(count, values, range.start, range.end, 0.0f, 255.0f, values);
+			for (u32 i = 0; i < count; i++) { if (UlpDistance(values[i], results[i]) > 1) { allInPlace = false; } }
+		}
+	}
+	printf("  max difference from scalar: InverseLerp %u ULP, Remap %u ULP, SmoothStep %.3g\n", maxInverseLerpUlp, maxRemapUlp, maxSmoothStepError);
+	TestCheck(allClamp);
+	TestCheck(allLerp);
+	TestCheck(maxInverseLerpUlp <= 1);
+	TestCheck(maxRemapUlp <= 1);
+	TestCheck(maxSmoothStepError <= 4e-7f);
+	TestCheck(allRamp);
+	TestCheck(allInPlace);
+	TestCheck(allGuard);
+}
+
+//Ranges far from zero used to lose most of their precision when the start was folded into the offset (v*scale + -start*scale)
+void TestFarFromZero()
+{
+	TestSection("Ranges far from zero");
+	r32 values[8] = { 1000.0625f, 1000.0625f, 1000.0625f, 1000.0625f, 1000.0625f, 1000.0625f, 1000.0625f, 1000.0625f };
+	r32 results[8];
+	InverseLerpArrayR32(8, values, 1000.0f, 1003.0f, false, results);
+	r32 expected = InverseLerpR32(1000.0f, 1003.0f, 1000.0625f);
+	printf("  InverseLerp(1000, 1003, 1000.0625): scalar %.9g, array %.9g %.9g\n", expected, results[0], results[7]);
+	TestCheck(UlpDistance(results[0], expected) <= 1 && UlpDistance(results[7], expected) <= 1);
+
+	RemapArrayR32(8, values, 1000.0f, 1003.0f, 0.0f, 300.0f, results);
+	expected = RemapR32(1000.0625f, 1000.0f, 1003.0f, 0.0f, 300.0f);
+	TestCheck(UlpDistance(results[0], expected) <= 1 && UlpDistance(results[7], expected) <= 1);
+
+	//Against the r64 result: the subtraction is exact for values near the start, so only the scale can round
+	const u32 count = 4096;
+	static r32 sweep[count], sweepResults[count];
+	r64 maxRelError = 0.0;
+	for (u32 i = 0; i < count; i++) { sweep[i] = 100000.0f + 7.0f * TestRandR32(); }
+	InverseLerpArrayR32(count, sweep, 100000.0f, 100007.0f, false, sweepResults);
+	for (u32 i = 0; i < count; i++)
+	{
+		r64 reference = ((r64)sweep[i] - 100000.0) / 7.0;
+		if (reference > 0.01) { maxRelError = MaxR64(maxRelError, AbsR64((r64)sweepResults[i] - reference) / reference); }
+	}
+	printf("  InverseLerp over [100000, 100007] max relative error vs r64 %.3g\n", maxRelError);
+	TestCheck(maxRelError < 2.5e-7);
+}
+
+__attribute__((noinline)) void ScalarInverseLerpLoop(u32 count, const r32* values, r32* resultsOut) { for (u32 i = 0; i < count; i++) { resultsOut[i] = InverseLerpR32(-2.0f, 3.0f, values[i], true); } }
+__attribute__((noinline)) void ScalarRemapLoop(u32 count, const r32* values, r32* resultsOut) { for (u32 i = 0; i < count; i++) { resultsOut[i] = RemapR32(values[i], -1.0f, 1.0f, 0.0f, 255.0f); } }
+__attribute__((noinline)) void ScalarSmoothStepLoop(u32 count, const r32* values, r32* resultsOut) { for (u32 i = 0; i < count; i++) { resultsOut[i] = SmoothStepR32(-0.5f, 0.5f, values[i]); } }
+__attribute__((noinline)) void ScalarClampLoop(u32 count, const r32* values, r32* resultsOut) { for (u32 i = 0; i < count; i++) { resultsOut[i] = ClampR32(values[i], -0.5f, 0.5f); } }
+
+void BenchRangeArrays()
+{
+	TestSection("Benchmarks (4096 values, per pass)");
+	const u32 count = 4096;
+	static r32 values[count], results[count];
+	for (u32 i = 0; i < count; i++) { values[i] = TestRandR32(-2.5f, 2.5f); }
+	TestBench("clamp", "ClampR32 loop", 200, count, [&]() { ScalarClampLoop(count, values, results); });
+	TestBench("clamp", "ClampArrayR32", 200, count, [&]() { ClampArrayR32(count, values, -0.5f, 0.5f, results); });
+	TestBench("inverse lerp", "InverseLerpR32 loop", 200, count, [&]() { ScalarInverseLerpLoop(count, values, results); });
+	TestBench("inverse lerp", "InverseLerpArrayR32", 200, count, [&]() { InverseLerpArrayR32(count, values, -2.0f, 3.0f, true, results); });
+	TestBench("remap", "RemapR32 loop", 200, count, [&]() { ScalarRemapLoop(count, values, results); });
+	TestBench("remap", "RemapArrayR32", 200, count, [&]() { RemapArrayR32(count, values, -1.0f, 1.0f, 0.0f, 255.0f, results); });
+	TestBench("smoothstep", "SmoothStepR32 loop", 200, count, [&]() { ScalarSmoothStepLoop(count, values, results); });
+	TestBench("smoothstep", "SmoothStepArrayR32", 200, count, [&]() { SmoothStepArrayR32(count, values, -0.5f, 0.5f, results); });
+	TestDoNotOptimize(results[count/2]);
+}
+
+int main(int argc, char** argv)
+{
+	TestBegin("Range array functions", argc, argv);
+	TestAgainstScalar();
+	TestFarFromZero();
+	if (testBenchEnabled) { BenchRangeArrays(); }
+	return TestEnd();
+}
@@ -0,0 +1,184 @@
+/*
+File:   test_rectangles.cpp
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Checks the rectangle functions in orca_addons.h. RecCullArray is compared
+	** against a plain RecIntersects loop for every count 0-7 (every mix of the
+	** 4-wide SIMD body and the scalar tail) with every visible/hidden pattern,
+	** on random sets, on rectangles that only touch the clip, and on degenerate
+	** (zero or negative size, NaN) rectangles and clips. Also spot checks
+	** RecOverlap, RecContains, RecUnion and RecExpand.
+	** With --bench it times RecCullArray against the RecIntersects loop
+*/
+
+#include "orca.h"
+#include "../my_orca.h"
+#include "test_common.h"
+
+#include <vector>
+
+//The reference RecCullArray is checked against
+u32 NaiveCull(u32 count, const rec* items, rec clip, u32* visibleIndicesOut)
+{
+	u32 numVisible = 0;
+	for (u32 iIndex = 0; iIndex < count; iIndex++)
+	{
+		if (RecIntersects(items[iIndex], clip)) { visibleIndicesOut[numVisible++] = iIndex; }
+	}
+	return numVisible;
+}
+
+//Runs both on an exact-size copy of the items (and an exact-size output) so ASan catches any access past the end
+bool CullMatches(u32 count, const rec* items, rec clip)
+{
+	std::vector<rec> itemsCopy(items, items + count);
+	std::vector<u32> expected(count), actual(count);
+	u32 numExpected = NaiveCull(count, itemsCopy.data(), clip, expected.data());
+	u32 numActual = RecCullArray(count, itemsCopy.data(), clip, actual.data());
+	if (numActual != numExpected) { return false; }
+	for (u32 vIndex = 0; vIndex < numActual; vIndex++) { if (actual[vIndex] != expected[vIndex]) { return false; } }
+	return true;
+}
+
+rec RandomRec(r32 range, r32 maxSize)
+{
+	return NewRec(TestRandR32(-range, range), TestRandR32(-range, range), TestRandR32(0.0f, maxSize), TestRandR32(0.0f, maxSize));
+}
+
+void TestCullArray()
+{
+	TestSection("RecCullArray vs RecIntersects loop");
+	const rec clip = NewRec(100, 50, 800, 600);
+	const rec insideRec = NewRec(200, 200, 10, 10);
+	const rec outsideRec = NewRec(2000, 200, 10, 10);
+
+	//Every count through the SIMD tail, with every pattern of visible and hidden items
+	bool allPatterns = true;
+	for (u32 count = 0; count <= 7; count++)
+	{
+		for (u32 pattern = 0; pattern < (1u << count); pattern++)
+		{
+			rec items[8];
+			for (u32 iIndex = 0; iIndex < count; iIndex++) { items[iIndex] = IsFlagSet(pattern, (1u << iIndex)) ? insideRec : outsideRec; }
+			if (!CullMatches(count, items, clip)) { allPatterns = false; printf("  mismatch for count %u pattern 0x%02X\n", count, pattern); }
+		}
+	}
+	TestCheck(allPatterns);
+
+	bool allRandom = true;
+	TestSeedRand(5);
+	for (u32 tIndex = 0; tIndex < 2000; tIndex++)
+	{
+		u32 count = TestRandU32(0, 70);
+		rec items[70];
+		for (u32 iIndex = 0; iIndex < count; iIndex++) { items[iIndex] = RandomRec(1200.0f, 300.0f); }
+		if (!CullMatches(count, items, clip)) { allRandom = false; }
+	}
+	TestCheck(allRandom);
+
+	//Rectangles that share an edge with the clip don't intersect it (half-open), ones that overlap by a hair do
+	const rec touching[] = {
+		NewRec(clip.x - 10, 300, 10, 10),                 //left edge
+		NewRec(clip.x + clip.width, 300, 10, 10),         //right edge
+		NewRec(300, clip.y - 10, 10, 10),                 //top edge
+		NewRec(300, clip.y + clip.height, 10, 10),        //bottom edge
+		NewRec(clip.x - 10, clip.y - 10, 10, 10),         //top-left corner
+		NewRec(clip.x + clip.width, clip.y + clip.height, 10, 10), //bottom-right corner
+		NewRec(clip.x - 10, 300, 10.001f, 10),            //overlaps by a hair
+		NewRec(clip.x + clip.width - 0.001f, 300, 10, 10),
+	};
+	u32 touchingIndices[ArrayCount(touching)];
+	u32 numTouching = RecCullArray(ArrayCount(touching), touching, clip, touchingIndices);
+	TestCheck(numTouching == 2 && touchingIndices[0] == 6 && touchingIndices[1] == 7);
+	TestCheck(CullMatches(ArrayCount(touching), touching, clip));
+	for (u32 count = 0; count <= ArrayCount(touching); count++) { TestCheck(CullMatches(count, touching, clip)); }
+
+	//Zero and negative sizes and NaN on either side of the test, SIMD must agree with the scalar compare in every case
+	const rec degenerate[] = {
+		NewRec(300, 300, 0, 0),
+		NewRec(300, 300, 0, 10),
+		NewRec(300, 300, 10, 0),
+		NewRec(300, 300, -10, 10),
+		NewRec(clip.x, clip.y, 0, 0),
+		NewRec(clip.x + clip.width, clip.y, 0, 10),
+		NewRec(NAN, 300, 10, 10),
+		NewRec(300, 300, NAN, 10),
+		NewRec(-INFINITY, -INFINITY, INFINITY, INFINITY),
+		NewRec(300, 300, 10, 10),
+		NewRec(-1e30f, -1e30f, 2e30f, 2e30f),
+	};
+	const rec degenerateClips[] = { clip, NewRec(300, 300, 0, 0), NewRec(300, 300, -5, 5), NewRec(NAN, 0, 10, 10), NewRec(-1e30f, -1e30f, 2e30f, 2e30f) };
+	bool allDegenerate = true;
+	for (u32 cIndex = 0; cIndex < ArrayCount(degenerateClips); cIndex++)
+	{
+		for (u32 count = 0; count <= ArrayCount(degenerate); count++)
+		{
+			if (!CullMatches(count, degenerate, degenerateClips[cIndex])) { allDegenerate = false; printf("  mismatch for clip %u count %u\n", cIndex, count); }
+			//Start part way in too so every item lands in every lane
+			if (count > 0 && !CullMatches(count - 1, &degenerate[1], degenerateClips[cIndex])) { allDegenerate = false; }
+		}
+	}
+	TestCheck(allDegenerate);
+
+	//Null pointers are fine when there is nothing to do
+	TestCheck(RecCullArray(0, nullptr, clip, nullptr) == 0);
+}
+
+void TestRecFunctions()
+{
+	TestSection("RecOverlap, RecContains, RecUnion and RecExpand");
+	rec left = NewRec(0, 0, 10, 10);
+	rec right = NewRec(5, -5, 10, 10);
+	TestCheck(RecIntersects(left, right) && RecIntersects(right, left));
+	TestCheck(!RecIntersects(left, NewRec(10, 0, 5, 5)));
+	rec overlap = RecOverlap(left, right);
+	TestCheck(overlap.x == 5 && overlap.y == 0 && overlap.width == 5 && overlap.height == 5);
+	rec noOverlap = RecOverlap(left, NewRec(20, 20, 5, 5));
+	TestCheck(noOverlap.width == 0 && noOverlap.height == 0);
+	rec both = RecUnion(left, right);
+	TestCheck(both.x == 0 && both.y == -5 && both.width == 15 && both.height == 15);
+	TestCheck(RecContains(left, NewVec2(0, 0)) && !RecContains(left, NewVec2(10, 5)) && !RecContains(left, NewVec2(5, 10)));
+	TestCheck(RecContains(left, NewRec(0, 0, 10, 10)) && RecContains(left, NewRec(2, 2, 3, 3)) && !RecContains(left, right));
+	rec expanded = RecExpand(left, 2.0f);
+	TestCheck(expanded.x == -2 && expanded.y == -2 && expanded.width == 14 && expanded.height == 14);
+	rec shrunk = RecExpand(left, NewVec2(-1.0f, -2.0f));
+	TestCheck(shrunk.x == 1 && shrunk.y == 2 && shrunk.width == 8 && shrunk.height == 6);
+
+	//RecOverlap is non-empty exactly when RecIntersects is true (for positive sizes)
+	bool allConsistent = true;
+	TestSeedRand(6);
+	for (u32 tIndex = 0; tIndex < 10000; tIndex++)
+	{
+		rec a = RandomRec(100.0f, 50.0f);
+		rec b = RandomRec(100.0f, 50.0f);
+		rec ab = RecOverlap(a, b);
+		bool overlapNonEmpty = (ab.width > 0 && ab.height > 0);
+		if (overlapNonEmpty != RecIntersects(a, b)) { allConsistent = false; }
+	}
+	TestCheck(allConsistent);
+}
+
+void BenchCullArray()
+{
+	TestSection("Benchmarks (100k random 0-60 sized rectangles in [-2000, 2000], 800x600 clip)");
+	const u32 numItems = 100000;
+	std::vector<rec> items(numItems);
+	std::vector<u32> visible(numItems);
+	for (u32 iIndex = 0; iIndex < numItems; iIndex++) { items[iIndex] = RandomRec(2000.0f, 60.0f); }
+	rec clip = NewRec(0, 0, 800, 600);
+	u32 numVisible = 0;
+	TestBench("cull", "RecIntersects loop", 20, numItems, [&]() { numVisible = NaiveCull(numItems, items.data(), clip, visible.data()); });
+	TestBench("cull", "RecCullArray", 20, numItems, [&]() { numVisible = RecCullArray(numItems, items.data(), clip, visible.data()); });
+	printf("  %u of %u visible\n", numVisible, numItems);
+	TestDoNotOptimize(numVisible);
+}
+
+int main(int argc, char** argv)
+{
+	TestBegin("Rectangles", argc, argv);
+	TestCullArray();
+	TestRecFunctions();
+	if (testBenchEnabled) { BenchCullArray(); }
+	return TestEnd();
+}
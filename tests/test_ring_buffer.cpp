@@ -0,0 +1,219 @@
+/*
+File:   test_ring_buffer.cpp
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Drives RingBuffer_t from orca_ring_buffer.h on one thread next to a std::deque
+	** (random batch push/pop, peek and skip, wrapping at every capacity, full and empty),
+	** then passes sequence-numbered events between a producer and a consumer thread at
+	** small and odd capacities with random batch sizes and checks every event arrives
+	** once, in order and intact.
+	** With --bench it times 20M 24-byte events between two threads at batch 1, 16 and
+	** 256, lock-free and with the same ring behind a std::mutex
+*/
+
+#include "orca.h"
+#include "../my_orca.h"
+#include "test_common.h"
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+
+struct Event_t
+{
+	u64 sequence;
+	u32 type;
+	r32 x, y;
+	u32 padding;
+};
+
+//TestRandU32 shares one state, each thread gets its own xorshift instead
+INLINE u32 ThreadRandU32(u64* statePntr)
+{
+	*statePntr ^= *statePntr << 13;
+	*statePntr ^= *statePntr >> 7;
+	*statePntr ^= *statePntr << 17;
+	return (u32)(*statePntr >> 32);
+}
+
+INLINE Event_t MakeEvent(u64 sequence) { return { sequence, (u32)sequence * 7, (r32)(sequence & 0xFF), -(r32)(sequence & 0xFF), 0 }; }
+INLINE bool IsEventValid(const Event_t* event, u64 sequence) { return (event->sequence == sequence && event->type == (u32)sequence * 7 && event->x == (r32)(sequence & 0xFF) && event->y == -(r32)(sequence & 0xFF)); }
+
+void TestSingleThread()
+{
+	TestSection("Single thread vs std::deque");
+	OC_Arena_t arena;
+	OC_ArenaInit(&arena);
+	bool allPushes = true, allPops = true, allPeeks = true, allCounts = true;
+	for (u32 capacity : { 1u, 2u, 3u, 7u, 64u, 1000u })
+	{
+		RingBuffer_t buffer;
+		CreateRingBufferType(&buffer, &arena, Event_t, capacity);
+		if (buffer.capacity != NextPowerOfTwoU32(capacity)) { allCounts = false; }
+		std::deque<u64> reference;
+		std::vector<Event_t> events(2 * buffer.capacity + 1);
+		u64 nextSequence = 0, nextExpected = 0;
+		for (u32 sIndex = 0; sIndex < 20000; sIndex++)
+		{
+			u32 operation = TestRandU32(0, 10);
+			u32 count = TestRandU32(0, (u32)events.size() + 1);
+			if (operation < 4)
+			{
+				for (u32 eIndex = 0; eIndex < count; eIndex++) { events[eIndex] = MakeEvent(nextSequence + eIndex); }
+				u32 numPushed = RingBufferPushBatch(&buffer, events.data(), count);
+				if (numPushed != MinU32(count, buffer.capacity - (u32)reference.size())) { allPushes = false; }
+				for (u32 eIndex = 0; eIndex < numPushed; eIndex++) { reference.push_back(nextSequence++); }
+			}
+			else if (operation < 5)
+			{
+				Event_t event = MakeEvent(nextSequence);
+				bool wasFull = (reference.size() == buffer.capacity);
+				if (RingBufferPush(&buffer, &event) == wasFull) { allPushes = false; }
+				if (!wasFull) { reference.push_back(nextSequence++); }
+			}
+			else if (operation < 8)
+			{
+				u32 numPopped = RingBufferPopBatch(&buffer, events.data(), count);
+				if (numPopped != MinU32(count, (u32)reference.size())) { allPops = false; }
+				for (u32 eIndex = 0; eIndex < numPopped; eIndex++)
+				{
+					if (!IsEventValid(&events[eIndex], nextExpected) || reference.front() != nextExpected) { allPops = false; }
+					reference.pop_front();
+					nextExpected++;
+				}
+			}
+			else if (operation < 9)
+			{
+				Event_t* peeked = (Event_t*)RingBufferPeek(&buffer);
+				if ((peeked == nullptr) != reference.empty()) { allPeeks = false; }
+				if (peeked != nullptr && !IsEventValid(peeked, nextExpected)) { allPeeks = false; }
+			}
+			else
+			{
+				u32 numSkipped = RingBufferSkip(&buffer, count);
+				if (numSkipped != MinU32(count, (u32)reference.size())) { allPops = false; }
+				for (u32 eIndex = 0; eIndex < numSkipped; eIndex++) { reference.pop_front(); nextExpected++; }
+			}
+			if (RingBufferCount(&buffer) != reference.size() || RingBufferIsEmpty(&buffer) != reference.empty()) { allCounts = false; }
+		}
+		FreeRingBuffer(&buffer);
+	}
+	TestCheck(allPushes);
+	TestCheck(allPops);
+	TestCheck(allPeeks);
+	TestCheck(allCounts);
+	OC_ArenaCleanup(&arena);
+}
+
+//Returns the elapsed milliseconds, clears *isValidPntr if any event arrived out of order or damaged.
+//With batchSize 0 the consumer uses RingBufferPeek/Skip one event at a time, with randomBatches both sides pick 1-batchSize each call
+r64 RunProducerConsumer(u32 capacity, u32 batchSize, u64 numEvents, bool randomBatches, std::mutex* mutex, bool* isValidPntr)
+{
+	OC_Arena_t arena;
+	OC_ArenaInit(&arena);
+	RingBuffer_t buffer;
+	CreateRingBufferType(&buffer, &arena, Event_t, capacity);
+	u32 maxBatch = MaxU32(batchSize, 1);
+	r64 startTime = TestGetTimeMs();
+	std::thread producer([&]()
+	{
+		std::vector<Event_t> events(maxBatch);
+		u64 randState = 0x123456789ULL;
+		u64 sequence = 0;
+		while (sequence < numEvents)
+		{
+			u32 count = randomBatches ? 1 + (ThreadRandU32(&randState) % maxBatch) : maxBatch;
+			if (count > numEvents - sequence) { count = (u32)(numEvents - sequence); }
+			for (u32 eIndex = 0; eIndex < count; eIndex++) { events[eIndex] = MakeEvent(sequence + eIndex); }
+			u32 numPushed = 0;
+			while (numPushed < count)
+			{
+				u32 numNew;
+				if (mutex != nullptr) { std::lock_guard<std::mutex> lock(*mutex); numNew = RingBufferPushBatch(&buffer, events.data() + numPushed, count - numPushed); }
+				else { numNew = RingBufferPushBatch(&buffer, events.data() + numPushed, count - numPushed); }
+				if (numNew == 0) { std::this_thread::yield(); }
+				numPushed += numNew;
+			}
+			sequence += count;
+		}
+	});
+	std::vector<Event_t> events(maxBatch);
+	u64 randState = 0x987654321ULL;
+	u64 nextExpected = 0;
+	bool isValid = true;
+	while (nextExpected < numEvents)
+	{
+		if (batchSize == 0)
+		{
+			Event_t* peeked = (Event_t*)RingBufferPeek(&buffer);
+			if (peeked == nullptr) { std::this_thread::yield(); continue; }
+			if (!IsEventValid(peeked, nextExpected)) { isValid = false; }
+			RingBufferSkip(&buffer, 1);
+			nextExpected++;
+			continue;
+		}
+		u32 count = randomBatches ? 1 + (ThreadRandU32(&randState) % maxBatch) : maxBatch;
+		u32 numPopped;
+		if (mutex != nullptr) { std::lock_guard<std::mutex> lock(*mutex); numPopped = RingBufferPopBatch(&buffer, events.data(), count); }
+		else { numPopped = RingBufferPopBatch(&buffer, events.data(), count); }
+		if (numPopped == 0) { std::this_thread::yield(); continue; }
+		for (u32 eIndex = 0; eIndex < numPopped; eIndex++) { if (!IsEventValid(&events[eIndex], nextExpected + eIndex)) { isValid = false; } }
+		nextExpected += numPopped;
+	}
+	producer.join();
+	r64 elapsedMs = TestGetTimeMs() - startTime;
+	if (!isValid || !RingBufferIsEmpty(&buffer)) { *isValidPntr = false; }
+	FreeRingBuffer(&buffer);
+	OC_ArenaCleanup(&arena);
+	return elapsedMs;
+}
+
+void TestTwoThreads()
+{
+	TestSection("Producer and consumer threads");
+	bool allInOrder = true;
+	for (u32 capacity : { 1u, 2u, 3u, 7u, 64u, 1000u })
+	{
+		for (u32 batchSize : { 1u, 3u, 17u, 200u }) { RunProducerConsumer(capacity, batchSize, 200000, true, nullptr, &allInOrder); }
+	}
+	TestCheck(allInOrder);
+	bool allPeeked = true;
+	RunProducerConsumer(16, 0, 200000, false, nullptr, &allPeeked);
+	TestCheck(allPeeked);
+}
+
+//TestBench times a function on this thread, the threads are timed inside RunProducerConsumer instead and the best run is reported the same way
+void BenchRingBuffer()
+{
+	TestSection("Benchmarks (24-byte events, capacity 4096, 2 threads)");
+	const u64 numEvents = 20000000;
+	std::mutex mutex;
+	char name[32];
+	bool allInOrder = true;
+	for (bool useMutex : { false, true })
+	{
+		for (u32 batchSize : { 1u, 16u, 256u })
+		{
+			r64 bestMs = 0;
+			for (u32 rIndex = 0; rIndex < 3; rIndex++)
+			{
+				r64 elapsedMs = RunProducerConsumer(4096, batchSize, numEvents, false, useMutex ? &mutex : nullptr, &allInOrder);
+				if (rIndex == 0 || elapsedMs < bestMs) { bestMs = elapsedMs; }
+			}
+			snprintf(name, sizeof(name), "batch %u", batchSize);
+			TestReportBench(useMutex ? "mutex" : "lock-free", name, bestMs, numEvents);
+		}
+	}
+	TestCheck(allInOrder);
+}
+
+int main(int argc, char** argv)
+{
+	TestBegin("Ring buffer", argc, argv);
+	TestSingleThread();
+	TestTwoThreads();
+	if (testBenchEnabled) { BenchRingBuffer(); }
+	return TestEnd();
+}
@@ -0,0 +1,246 @@
+/*
+File:   test_simd_vectors.cpp
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Checks the r32 array kernels in orca_simd.h and the packed (AoS) and SoA
+	** vector array functions in orca_addons.h against plain per-element loops,
+	** for every count from 0 to 40 so each tail length is covered, both in-place
+	** and out-of-place. With --bench it times the batch functions against the
+	** per-element operator loops they replace. Also pins down what Simd4fMin and
+	** Simd4fMax give for NaN lanes
+*/
+
+#include "orca.h"
+#include "../my_orca.h"
+#include "test_common.h"
+
+#define TEST_MAX_COUNT 40
+
+static r32 srcA[TEST_MAX_COUNT*4];
+static r32 srcB[TEST_MAX_COUNT*4];
+static r32 srcC[TEST_MAX_COUNT*4];
+static r32 expected[TEST_MAX_COUNT*4];
+static r32 actual[TEST_MAX_COUNT*4 + 1]; //one extra so we can check nothing is written past count
+
+void FillSources()
+{
+	for (u32 vIndex = 0; vIndex < TEST_MAX_COUNT*4; vIndex++)
+	{
+		srcA[vIndex] = TestRandR32(-100.0f, 100.0f);
+		srcB[vIndex] = TestRandR32(-100.0f, 100.0f);
+		srcC[vIndex] = TestRandR32(-100.0f, 100.0f);
+	}
+}
+
+//Sets the guard value after numValues, call CheckResults afterwards
+void PrepareActual(u32 numValues)
+{
+	for (u32 vIndex = 0; vIndex <= numValues; vIndex++) { actual[vIndex] = 12345.0f; }
+}
+bool CheckResults(u32 numValues, r32 tolerance)
+{
+	for (u32 vIndex = 0; vIndex < numValues; vIndex++)
+	{
+		if (!(AbsR32(actual[vIndex] - expected[vIndex]) <= tolerance)) { return false; }
+	}
+	return (actual[numValues] == 12345.0f);
+}
+
+void TestR32Kernels()
+{
+	TestSection("R32 array kernels");
+	const r32 pattern[4] = { 1.0f, -2.0f, 3.0f, -4.0f };
+	for (u32 count = 0; count <= TEST_MAX_COUNT; count++)
+	{
+		for (u32 i = 0; i < count; i++) { expected[i] = srcA[i] + srcB[i]; }
+		PrepareActual(count); AddArrayR32(count, srcA, srcB, actual);
+		TestCheckMsg(CheckResults(count, 0.0f), "AddArrayR32 count=%u", count);
+
+		for (u32 i = 0; i < count; i++) { expected[i] = srcA[i] - srcB[i]; }
+		PrepareActual(count); SubtractArrayR32(count, srcA, srcB, actual);
+		TestCheckMsg(CheckResults(count, 0.0f), "SubtractArrayR32 count=%u", count);
+
+		for (u32 i = 0; i < count; i++) { expected[i] = srcA[i] * srcB[i]; }
+		PrepareActual(count); MultiplyArrayR32(count, srcA, srcB, actual);
+		TestCheckMsg(CheckResults(count, 0.0f), "MultiplyArrayR32 count=%u", count);
+
+		for (u32 i = 0; i < count; i++) { expected[i] = srcA[i] * 0.25f; }
+		PrepareActual(count); ScaleArrayR32(count, srcA, 0.25f, actual);
+		TestCheckMsg(CheckResults(count, 0.0f), "ScaleArrayR32 count=%u", count);
+
+		//MulAdd may be fused on some targets, so allow for the one rounding step it skips
+		for (u32 i = 0; i < count; i++) { expected[i] = srcA[i] + (srcB[i] * 0.016f); }
+		PrepareActual(count); AddScaledArrayR32(count, srcA, srcB, 0.016f, actual);
+		TestCheckMsg(CheckResults(count, 1e-4f), "AddScaledArrayR32 count=%u", count);
+
+		for (u32 i = 0; i < count; i++) { expected[i] = (srcA[i] * srcB[i]) + srcC[i]; }
+		PrepareActual(count); MulAddArrayR32(count, srcA, srcB, srcC, actual);
+		TestCheckMsg(CheckResults(count, 2e-3f), "MulAddArrayR32 count=%u", count);
+
+		for (u32 i = 0; i < count; i++) { expected[i] = srcA[i] + pattern[i%4]; }
+		PrepareActual(count); AddPatternArrayR32(count, srcA, pattern, actual);
+		TestCheckMsg(CheckResults(count, 0.0f), "AddPatternArrayR32 count=%u", count);
+
+		//In-place
+		for (u32 i = 0; i < count; i++) { expected[i] = srcA[i] + srcB[i]; actual[i] = srcA[i]; }
+		actual[count] = 12345.0f;
+		AddArrayR32(count, actual, srcB, actual);
+		TestCheckMsg(CheckResults(count, 0.0f), "AddArrayR32 in-place count=%u", count);
+	}
+}
+
+void TestAosArrays()
+{
+	TestSection("Packed v2/v3/v4 arrays");
+	const v2* a2 = (const v2*)srcA; const v2* b2 = (const v2*)srcB;
+	const v3* a3 = (const v3*)srcA; const v3* b3 = (const v3*)srcB;
+	const v4* a4 = (const v4*)srcA; const v4* b4 = (const v4*)srcB;
+	for (u32 count = 0; count <= TEST_MAX_COUNT; count++)
+	{
+		v2 shift2 = NewVec2(3.0f, -5.0f);
+		for (u32 i = 0; i < count; i++) { ((v2*)expected)[i] = a2[i] + b2[i]*0.5f; }
+		PrepareActual(count*2); Vec2AddScaledArray(count, a2, b2, 0.5f, (v2*)actual);
+		TestCheckMsg(CheckResults(count*2, 1e-4f), "Vec2AddScaledArray count=%u", count);
+		for (u32 i = 0; i < count; i++) { ((v2*)expected)[i] = a2[i] + shift2; }
+		PrepareActual(count*2); Vec2ShiftArray(count, a2, shift2, (v2*)actual);
+		TestCheckMsg(CheckResults(count*2, 0.0f), "Vec2ShiftArray count=%u", count);
+		for (u32 i = 0; i < count; i++) { ((v2*)expected)[i] = a2[i] - b2[i]; }
+		PrepareActual(count*2); Vec2SubtractArray(count, a2, b2, (v2*)actual);
+		TestCheckMsg(CheckResults(count*2, 0.0f), "Vec2SubtractArray count=%u", count);
+
+		v3 shift3 = NewVec3(1.0f, 2.0f, -3.0f);
+		for (u32 i = 0; i < count; i++) { ((v3*)expected)[i] = a3[i] + shift3; }
+		PrepareActual(count*3); Vec3ShiftArray(count, a3, shift3, (v3*)actual);
+		TestCheckMsg(CheckResults(count*3, 0.0f), "Vec3ShiftArray count=%u", count);
+		for (u32 i = 0; i < count; i++) { ((v3*)expected)[i] = a3[i] + b3[i]*2.0f; }
+		PrepareActual(count*3); Vec3AddScaledArray(count, a3, b3, 2.0f, (v3*)actual);
+		TestCheckMsg(CheckResults(count*3, 1e-4f), "Vec3AddScaledArray count=%u", count);
+		for (u32 i = 0; i < count; i++) { ((v3*)expected)[i] = a3[i] * 3.0f; }
+		PrepareActual(count*3); Vec3ScaleArray(count, a3, 3.0f, (v3*)actual);
+		TestCheckMsg(CheckResults(count*3, 0.0f), "Vec3ScaleArray count=%u", count);
+
+		v4 shift4 = NewVec4(1.0f, 2.0f, 3.0f, 4.0f);
+		for (u32 i = 0; i < count; i++) { ((v4*)expected)[i] = a4[i] + shift4; }
+		PrepareActual(count*4); Vec4ShiftArray(count, a4, shift4, (v4*)actual);
+		TestCheckMsg(CheckResults(count*4, 0.0f), "Vec4ShiftArray count=%u", count);
+		for (u32 i = 0; i < count; i++) { ((v4*)expected)[i] = a4[i] + b4[i]; }
+		PrepareActual(count*4); Vec4AddArray(count, a4, b4, (v4*)actual);
+		TestCheckMsg(CheckResults(count*4, 0.0f), "Vec4AddArray count=%u", count);
+	}
+}
+
+void TestSoaArrays()
+{
+	TestSection("SoA v2/v3 arrays");
+	static r32 x[TEST_MAX_COUNT], y[TEST_MAX_COUNT], z[TEST_MAX_COUNT];
+	static r32 rx[TEST_MAX_COUNT], ry[TEST_MAX_COUNT], rz[TEST_MAX_COUNT];
+	static v2 backTo2[TEST_MAX_COUNT];
+	static v3 backTo3[TEST_MAX_COUNT];
+	const v2* a2 = (const v2*)srcA;
+	const v3* a3 = (const v3*)srcA;
+	const v3* b3 = (const v3*)srcB;
+	for (u32 count = 0; count <= TEST_MAX_COUNT; count++)
+	{
+		Vec2ArrayToSoa(count, a2, NewVec2Soa(x, y));
+		bool allMatch = true;
+		for (u32 i = 0; i < count; i++) { if (x[i] != a2[i].x || y[i] != a2[i].y) { allMatch = false; } }
+		TestCheckMsg(allMatch, "Vec2ArrayToSoa count=%u", count);
+		Vec2SoaToArray(count, NewVec2Soa(x, y), backTo2);
+		TestCheckMsg(count == 0 || memcmp(backTo2, a2, count * sizeof(v2)) == 0, "Vec2SoaToArray count=%u", count);
+
+		PrepareActual(count); Vec2SoaLength(count, NewVec2Soa(x, y), actual);
+		for (u32 i = 0; i < count; i++) { expected[i] = Vec2Length(a2[i]); }
+		TestCheckMsg(CheckResults(count, 1e-3f), "Vec2SoaLength count=%u", count);
+
+		Vec3ArrayToSoa(count, a3, NewVec3Soa(x, y, z));
+		Vec3SoaToArray(count, NewVec3Soa(x, y, z), backTo3);
+		TestCheckMsg(count == 0 || memcmp(backTo3, a3, count * sizeof(v3)) == 0, "Vec3 SoA round trip count=%u", count);
+
+		Vec3ArrayToSoa(count, b3, NewVec3Soa(rx, ry, rz));
+		PrepareActual(count); Vec3SoaDot(count, NewVec3Soa(x, y, z), NewVec3Soa(rx, ry, rz), actual);
+		for (u32 i = 0; i < count; i++) { expected[i] = Vec3Dot(a3[i], b3[i]); }
+		TestCheckMsg(CheckResults(count, 1e-2f), "Vec3SoaDot count=%u", count);
+
+		Vec3SoaAddScaled(count, NewVec3Soa(x, y, z), NewVec3Soa(rx, ry, rz), 0.5f, NewVec3Soa(x, y, z));
+		allMatch = true;
+		for (u32 i = 0; i < count; i++)
+		{
+			v3 expectedVec = a3[i] + b3[i]*0.5f;
+			if (AbsR32(x[i] - expectedVec.x) > 1e-4f || AbsR32(y[i] - expectedVec.y) > 1e-4f || AbsR32(z[i] - expectedVec.z) > 1e-4f) { allMatch = false; }
+		}
+		TestCheckMsg(allMatch, "Vec3SoaAddScaled in-place count=%u", count);
+	}
+}
+
+void BenchVectorArrays()
+{
+	TestSection("Benchmarks (64k vectors, per pass)");
+	const u32 numVectors = 64*1024;
+	v2* positions2 = (v2*)malloc(numVectors * sizeof(v2));
+	v2* velocities2 = (v2*)malloc(numVectors * sizeof(v2));
+	v3* positions3 = (v3*)malloc(numVectors * sizeof(v3));
+	v3* velocities3 = (v3*)malloc(numVectors * sizeof(v3));
+	r32* soaX = (r32*)malloc(numVectors * sizeof(r32));
+	r32* soaY = (r32*)malloc(numVectors * sizeof(r32));
+	r32* lengths = (r32*)malloc(numVectors * sizeof(r32));
+	for (u32 i = 0; i < numVectors; i++)
+	{
+		positions2[i] = NewVec2(TestRandR32(-100, 100), TestRandR32(-100, 100));
+		velocities2[i] = NewVec2(TestRandR32(-1, 1), TestRandR32(-1, 1));
+		positions3[i] = NewVec3(positions2[i].x, positions2[i].y, 1.0f);
+		velocities3[i] = NewVec3(velocities2[i].x, velocities2[i].y, 0.5f);
+	}
+	Vec2ArrayToSoa(numVectors, positions2, NewVec2Soa(soaX, soaY));
+
+	TestBench("v2 pos+=vel*dt", "operator loop", 50, numVectors, [&]()
+	{
+		for (u32 i = 0; i < numVectors; i++) { positions2[i] = positions2[i] + velocities2[i] * 0.016f; }
+	});
+	TestBench("v2 pos+=vel*dt", "Vec2AddScaledArray", 50, numVectors, [&]() { Vec2AddScaledArray(numVectors, positions2, velocities2, 0.016f, positions2); });
+	TestBench("v3 pos+=vel*dt", "operator loop", 50, numVectors, [&]()
+	{
+		for (u32 i = 0; i < numVectors; i++) { positions3[i] = positions3[i] + velocities3[i] * 0.016f; }
+	});
+	TestBench("v3 pos+=vel*dt", "Vec3AddScaledArray", 50, numVectors, [&]() { Vec3AddScaledArray(numVectors, positions3, velocities3, 0.016f, positions3); });
+	TestBench("v2 length", "Vec2Length loop", 50, numVectors, [&]()
+	{
+		for (u32 i = 0; i < numVectors; i++) { lengths[i] = Vec2Length(positions2[i]); }
+	});
+	TestBench("v2 length", "Vec2SoaLength", 50, numVectors, [&]() { Vec2SoaLength(numVectors, NewVec2Soa(soaX, soaY), lengths); });
+	TestDoNotOptimize(lengths[numVectors/2]);
+
+	free(positions2); free(velocities2); free(positions3); free(velocities3);
+	free(soaX); free(soaY); free(lengths);
+}
+
+//Every backend has to give right in lanes where either side is NaN, like minps/maxps
+void TestMinMaxNaN()
+{
+	TestSection("Simd4fMin/Simd4fMax with NaN");
+	const r32 left[4] = { NAN, 1.0f, NAN, -3.0f };
+	const r32 right[4] = { 2.0f, NAN, NAN, 5.0f };
+	r32 minResults[4], maxResults[4];
+	Simd4fStore(minResults, Simd4fMin(Simd4fLoad(left), Simd4fLoad(right)));
+	Simd4fStore(maxResults, Simd4fMax(Simd4fLoad(left), Simd4fLoad(right)));
+	TestCheck(minResults[0] == 2.0f && isnan(minResults[1]) && isnan(minResults[2]) && minResults[3] == -3.0f);
+	TestCheck(maxResults[0] == 2.0f && isnan(maxResults[1]) && isnan(maxResults[2]) && maxResults[3] == 5.0f);
+
+	//ClampArrayR32 has to match ClampR32 (NaN passes through) in the SIMD body and the tail
+	r32 values[6] = { NAN, -2.0f, 0.5f, 7.0f, 3.0f, NAN };
+	r32 results[6];
+	ClampArrayR32(6, values, 0.0f, 1.0f, results);
+	TestCheck(isnan(results[0]) && results[1] == 0.0f && results[2] == 0.5f && results[3] == 1.0f && results[4] == 1.0f && isnan(results[5]));
+}
+
+int main(int argc, char** argv)
+{
+	TestBegin("SIMD vector arrays", argc, argv);
+	FillSources();
+	TestR32Kernels();
+	TestAosArrays();
+	TestSoaArrays();
+	TestMinMaxNaN();
+	if (testBenchEnabled) { BenchVectorArrays(); }
+	return TestEnd();
+}
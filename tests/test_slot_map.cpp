@@ -0,0 +1,235 @@
+/*
+File:   test_slot_map.cpp
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Runs a long random add/remove/clear sequence on SlotMap_t from orca_slot_map.h
+	** next to a std::unordered_map and checks every live handle resolves to its value,
+	** removed handles never resolve again (even after their slot is reused or runs
+	** out of generations), and SlotMapLoop sees exactly the live items.
+	** With --bench it compares per-frame iteration and remove+add churn against an
+	** intrusive OC_List_t of pool allocated entities, scrambled the way a long
+	** running game would leave it
+*/
+
+#include "orca.h"
+#include "../my_orca.h"
+#include "test_common.h"
+
+#include <vector>
+#include <unordered_map>
+
+struct Entity_t
+{
+	v2 position;
+	v2 velocity;
+	r32 health;
+	u32 flags;
+	u64 id;
+	u8 padding[24];
+};
+
+struct ListEntity_t
+{
+	OC_ListElement_t link;
+	Entity_t entity;
+};
+
+void TestAgainstMap()
+{
+	TestSection("Random operations vs std::unordered_map");
+	OC_Arena_t arena;
+	OC_ArenaInit(&arena);
+	SlotMap_t map;
+	CreateSlotMapType(&map, &arena, u64, 0);
+	std::unordered_map<u32, u64> reference;
+	std::vector<u32> liveHandles, deadHandles;
+	bool allNewHandles = true, allRemoves = true, allGets = true, allStale = true, allCounts = true, allLooped = true;
+	for (u32 oIndex = 0; oIndex < 500000; oIndex++)
+	{
+		u32 operation = TestRandU32(0, 10);
+		if (operation < 5 || liveHandles.empty())
+		{
+			u32 handle = SLOT_MAP_INVALID_HANDLE;
+			u64* value = SlotMapAddType(&map, u64, &handle);
+			*value = ((u64)TestRandU32() << 32) | oIndex;
+			if (handle == SLOT_MAP_INVALID_HANDLE || reference.count(handle) > 0) { allNewHandles = false; }
+			reference[handle] = *value;
+			liveHandles.push_back(handle);
+		}
+		else if (operation < 9)
+		{
+			u32 liveIndex = TestRandU32(0, (u32)liveHandles.size());
+			u32 handle = liveHandles[liveIndex];
+			if (!SlotMapRemove(&map, handle) || SlotMapRemove(&map, handle)) { allRemoves = false; }
+			reference.erase(handle);
+			liveHandles[liveIndex] = liveHandles.back();
+			liveHandles.pop_back();
+			deadHandles.push_back(handle);
+		}
+		else if (TestRandU32(0, 500) == 0)
+		{
+			SlotMapClear(&map);
+			deadHandles.insert(deadHandles.end(), liveHandles.begin(), liveHandles.end());
+			liveHandles.clear();
+			reference.clear();
+		}
+
+		if ((oIndex % 500) == 0)
+		{
+			for (u32 handle : liveHandles)
+			{
+				u64* value = SlotMapGetType(&map, handle, u64);
+				if (value == nullptr || *value != reference[handle]) { allGets = false; }
+			}
+			for (u32 dIndex = 0; dIndex < 200 && !deadHandles.empty(); dIndex++)
+			{
+				if (SlotMapContains(&map, deadHandles[TestRandU32(0, (u32)deadHandles.size())])) { allStale = false; }
+			}
+			if (SlotMapCount(&map) != liveHandles.size()) { allCounts = false; }
+			u32 numLooped = 0;
+			SlotMapLoop(&map, iIndex)
+			{
+				numLooped++;
+				auto found = reference.find(SlotMapGetHandleAt(&map, iIndex));
+				if (found == reference.end() || *SlotMapGetItemType(&map, iIndex, u64) != found->second) { allLooped = false; }
+			}
+			if (numLooped != reference.size()) { allLooped = false; }
+		}
+	}
+	TestCheck(allNewHandles);
+	TestCheck(allRemoves);
+	TestCheck(allGets);
+	TestCheck(allStale);
+	TestCheck(allCounts);
+	TestCheck(allLooped);
+	TestCheck(!SlotMapContains(&map, SLOT_MAP_INVALID_HANDLE));
+	printf("  %llu slots, %u live items\n", (unsigned long long)map.slots.length, SlotMapCount(&map));
+	FreeSlotMap(&map);
+	OC_ArenaCleanup(&arena);
+}
+
+void TestGenerations()
+{
+	TestSection("Generation wrap and retired slots");
+	OC_Arena_t arena;
+	OC_ArenaInit(&arena);
+	SlotMap_t map;
+	CreateSlotMapType(&map, &arena, u32, 0);
+	//A single slot gets reused over and over until it runs out of generations, then a new one takes over
+	std::vector<u32> oldHandles;
+	for (u32 aIndex = 0; aIndex < 3 * SLOT_MAP_MAX_GENERATION; aIndex++)
+	{
+		u32 handle = SLOT_MAP_INVALID_HANDLE;
+		*SlotMapAddType(&map, u32, &handle) = aIndex;
+		oldHandles.push_back(handle);
+		SlotMapRemove(&map, handle);
+	}
+	bool allStale = true;
+	for (u32 handle : oldHandles) { if (SlotMapContains(&map, handle)) { allStale = false; } }
+	TestCheck(allStale);
+	TestCheck(map.numRetiredSlots == 3 && map.slots.length == 3); //each slot gives exactly SLOT_MAP_MAX_GENERATION handles and is never reused after that
+	TestCheck(SlotMapCount(&map) == 0 && !SlotMapContains(&map, SLOT_MAP_INVALID_HANDLE));
+
+	u32 handle1 = SLOT_MAP_INVALID_HANDLE, handle2 = SLOT_MAP_INVALID_HANDLE;
+	*SlotMapAddType(&map, u32, &handle1) = 111;
+	*SlotMapAddType(&map, u32, &handle2) = 222;
+	SlotMapRemove(&map, handle1); //222 moves into the hole, its handle has to follow it
+	TestCheck(SlotMapCount(&map) == 1 && *SlotMapGetType(&map, handle2, u32) == 222 && SlotMapGetHandleAt(&map, 0) == handle2);
+	FreeSlotMap(&map);
+	OC_ArenaCleanup(&arena);
+}
+
+void BenchSlotMap()
+{
+	TestSection("Benchmarks (64-byte entities)");
+	char groupName[32];
+	for (u32 numEntities : { 10000u, 100000u })
+	{
+		OC_Arena_t arena;
+		OC_ArenaInit(&arena);
+		Pool_t pool;
+		CreatePoolType(&pool, &arena, ListEntity_t, 1024);
+		OC_List_t list;
+		OC_ListInit(&list);
+		std::vector<ListEntity_t*> listEntities;
+		SlotMap_t map;
+		CreateSlotMapType(&map, &arena, Entity_t, numEntities);
+		std::vector<u32> handles;
+		for (u32 eIndex = 0; eIndex < numEntities; eIndex++)
+		{
+			ListEntity_t* listEntity = PoolAllocType(&pool, ListEntity_t);
+			memset(listEntity, 0, sizeof(ListEntity_t));
+			listEntity->entity.velocity = NewVec2(1, 0);
+			OC_ListPushBack(&list, &listEntity->link);
+			listEntities.push_back(listEntity);
+			u32 handle;
+			Entity_t* entity = SlotMapAddType(&map, Entity_t, &handle);
+			memset(entity, 0, sizeof(Entity_t));
+			entity->velocity = NewVec2(1, 0);
+			handles.push_back(handle);
+		}
+		const u32 numChurn = 1000000;
+		std::vector<u32> churnIndices(numChurn);
+		for (u32 cIndex = 0; cIndex < numChurn; cIndex++) { churnIndices[cIndex] = TestRandU32(0, numEntities); }
+		snprintf(groupName, sizeof(groupName), "%uk entities", numEntities / 1000);
+
+		//Each churn is one remove plus one add, the first run also scrambles the list order
+		TestBench(groupName, "churn, list + pool", 3, numChurn, [&]()
+		{
+			for (u32 eIndex : churnIndices)
+			{
+				OC_ListRemove(&list, &listEntities[eIndex]->link);
+				PoolFree(&pool, listEntities[eIndex]);
+				ListEntity_t* listEntity = PoolAllocType(&pool, ListEntity_t);
+				memset(listEntity, 0, sizeof(ListEntity_t));
+				listEntity->entity.velocity = NewVec2(1, 0);
+				OC_ListPushBack(&list, &listEntity->link);
+				listEntities[eIndex] = listEntity;
+			}
+		});
+		TestBench(groupName, "churn, slot map", 3, numChurn, [&]()
+		{
+			for (u32 eIndex : churnIndices)
+			{
+				SlotMapRemove(&map, handles[eIndex]);
+				Entity_t* entity = SlotMapAddType(&map, Entity_t, &handles[eIndex]);
+				memset(entity, 0, sizeof(Entity_t));
+				entity->velocity = NewVec2(1, 0);
+			}
+		});
+		const u32 numFrames = (numEntities >= 100000) ? 20 : 200;
+		TestBench(groupName, "iterate, list", 3, (u64)numFrames * numEntities, [&]()
+		{
+			for (u32 fIndex = 0; fIndex < numFrames; fIndex++)
+			{
+				OC_ListFor(list, listEntity, ListEntity_t, link) { listEntity->entity.position.x += listEntity->entity.velocity.x * 0.016f; listEntity->entity.position.y += listEntity->entity.velocity.y * 0.016f; }
+			}
+		});
+		TestBench(groupName, "iterate, slot map", 3, (u64)numFrames * numEntities, [&]()
+		{
+			for (u32 fIndex = 0; fIndex < numFrames; fIndex++)
+			{
+				SlotMapLoop(&map, iIndex) { Entity_t* entity = SlotMapGetItemType(&map, iIndex, Entity_t); entity->position.x += entity->velocity.x * 0.016f; entity->position.y += entity->velocity.y * 0.016f; }
+			}
+		});
+		std::vector<u32> lookupIndices(numChurn);
+		for (u32 lIndex = 0; lIndex < numChurn; lIndex++) { lookupIndices[lIndex] = TestRandU32(0, numEntities); }
+		r32 sum = 0;
+		TestBench(groupName, "random SlotMapGet", 3, numChurn, [&]() { for (u32 eIndex : lookupIndices) { sum += SlotMapGetType(&map, handles[eIndex], Entity_t)->position.x; } });
+		TestBench(groupName, "random pointer", 3, numChurn, [&]() { for (u32 eIndex : lookupIndices) { sum += listEntities[eIndex]->entity.position.x; } });
+		TestDoNotOptimize(sum);
+		FreeSlotMap(&map);
+		FreePool(&pool);
+		OC_ArenaCleanup(&arena);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	TestBegin("Slot map", argc, argv);
+	TestAgainstMap();
+	TestGenerations();
+	if (testBenchEnabled) { BenchSlotMap(); }
+	return TestEnd();
+}
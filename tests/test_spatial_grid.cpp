@@ -0,0 +1,287 @@
+/*
+File:   test_spatial_grid.cpp
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Runs random insert/remove/move/clear sequences on SpatialGrid_t from
+	** orca_spatial_grid.h and checks every rec query, point query and k-nearest query
+	** against a brute force loop over a plain std::vector of the same items. Items mix
+	** points, small rects, rects over many cells and rects exactly on cell edges, at
+	** three cell sizes. Also checks k-nearest queries from far outside the used cells
+	** finish right away.
+	** With --bench it moves 100k particles around a 4096x4096 world with 16 unit cells
+	** and times the per-frame update and rebuild, and each kind of query against brute force
+*/
+
+#include "orca.h"
+#include "../my_orca.h"
+#include "test_common.h"
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+struct ReferenceItem_t
+{
+	u32 handle;
+	rec bounds;
+	u32 value;
+};
+
+r32 DistSquaredToRec(rec bounds, v2 point)
+{
+	r32 closestX = ClampR32(point.x, bounds.x, bounds.x + bounds.width);
+	r32 closestY = ClampR32(point.y, bounds.y, bounds.y + bounds.height);
+	return (closestX - point.x) * (closestX - point.x) + (closestY - point.y) * (closestY - point.y);
+}
+
+rec RandomBounds()
+{
+	v2 position = NewVec2(TestRandR32(-300, 300), TestRandR32(-300, 300));
+	switch (TestRandU32(0, 4))
+	{
+		case 0: return NewRec(position, 0, 0);
+		case 1: return NewRec(position, TestRandR32(0, 5), TestRandR32(0, 5));
+		case 2: return NewRec(position, TestRandR32(0, 60), TestRandR32(0, 60));
+		default: return NewRec(NewVec2(FloorR32(position.x / 10) * 10, FloorR32(position.y / 10) * 10), 10, 20); //exactly on the edges of 10 unit cells
+	}
+}
+
+void TestAgainstBruteForce(r32 cellSize)
+{
+	char sectionName[64];
+	snprintf(sectionName, sizeof(sectionName), "Random operations vs brute force, cell size %g", cellSize);
+	TestSection(sectionName);
+	OC_Arena_t arena;
+	OC_ArenaInit(&arena);
+	SpatialGrid_t grid;
+	CreateSpatialGrid(&grid, &arena, cellSize);
+	std::vector<ReferenceItem_t> reference;
+	std::vector<u32> values(10000), found, expected;
+	std::vector<r32> distances(64), expectedDistSquareds;
+	u32 nextValue = 1;
+	bool allRemoves = true, allMoves = true, allRecQueries = true, allTruncated = true, allPointQueries = true, allNearest = true;
+	for (u32 sIndex = 0; sIndex < 4000; sIndex++)
+	{
+		u32 operation = TestRandU32(0, 10);
+		if (operation < 4 || reference.empty())
+		{
+			rec bounds = RandomBounds();
+			u32 value = nextValue++;
+			reference.push_back({ SpatialGridInsert(&grid, bounds, value), bounds, value });
+		}
+		else if (operation < 5)
+		{
+			u32 rIndex = TestRandU32(0, (u32)reference.size());
+			if (!SpatialGridRemove(&grid, reference[rIndex].handle) || SpatialGridRemove(&grid, reference[rIndex].handle)) { allRemoves = false; }
+			reference[rIndex] = reference.back();
+			reference.pop_back();
+		}
+		else if (operation < 7)
+		{
+			u32 rIndex = TestRandU32(0, (u32)reference.size());
+			rec bounds = RandomBounds();
+			if (!SpatialGridMove(&grid, reference[rIndex].handle, bounds)) { allMoves = false; }
+			reference[rIndex].bounds = bounds;
+		}
+		else if (operation == 7 && (sIndex % 500) == 0)
+		{
+			SpatialGridClear(&grid);
+			reference.clear();
+		}
+
+		rec query = NewRec(NewVec2(TestRandR32(-350, 350), TestRandR32(-350, 350)), TestRandR32(0, 120), TestRandR32(0, 120));
+		if (TestRandU32(0, 8) == 0) { query = NewRec(FloorR32(query.x / 10) * 10, FloorR32(query.y / 10) * 10, 30, 10); }
+		u32 numFound = SpatialGridQueryRec(&grid, query, values.data(), (u32)values.size());
+		found.assign(values.begin(), values.begin() + numFound);
+		expected.clear();
+		for (const ReferenceItem_t& item : reference) { if (SpatialGridOverlaps(item.bounds, query)) { expected.push_back(item.value); } }
+		std::sort(found.begin(), found.end());
+		std::sort(expected.begin(), expected.end());
+		if (found != expected) { allRecQueries = false; }
+		if (SpatialGridQueryRec(&grid, query, values.data(), 1) != numFound) { allTruncated = false; } //the count is the full count even when the output is too small
+
+		v2 point = NewVec2(TestRandR32(-350, 350), TestRandR32(-350, 350));
+		if (TestRandU32(0, 8) == 0) { point = NewVec2(FloorR32(point.x / 10) * 10, FloorR32(point.y / 10) * 10); }
+		numFound = SpatialGridQueryPoint(&grid, point, values.data(), (u32)values.size());
+		found.assign(values.begin(), values.begin() + numFound);
+		expected.clear();
+		for (const ReferenceItem_t& item : reference) { if (RecContains(item.bounds, point)) { expected.push_back(item.value); } }
+		std::sort(found.begin(), found.end());
+		std::sort(expected.begin(), expected.end());
+		if (found != expected) { allPointQueries = false; }
+
+		//Ties at the k-th distance can pick either item, so compare the distances and check each value really is at its distance
+		point = NewVec2(TestRandR32(-500, 500), TestRandR32(-500, 500));
+		u32 k = TestRandU32(1, 21);
+		r32 maxDistance = (TestRandU32(0, 3) == 0) ? TestRandR32(0, 100) : -1.0f;
+		numFound = SpatialGridFindNearest(&grid, point, k, values.data(), distances.data(), maxDistance);
+		expectedDistSquareds.clear();
+		for (const ReferenceItem_t& item : reference)
+		{
+			r32 distSquared = DistSquaredToRec(item.bounds, point);
+			if (maxDistance < 0 || distSquared <= maxDistance * maxDistance) { expectedDistSquareds.push_back(distSquared); }
+		}
+		std::sort(expectedDistSquareds.begin(), expectedDistSquareds.end());
+		if (expectedDistSquareds.size() > k) { expectedDistSquareds.resize(k); }
+		if (numFound != expectedDistSquareds.size()) { allNearest = false; continue; }
+		found.assign(values.begin(), values.begin() + numFound);
+		std::sort(found.begin(), found.end());
+		if (std::adjacent_find(found.begin(), found.end()) != found.end()) { allNearest = false; }
+		for (u32 nIndex = 0; nIndex < numFound; nIndex++)
+		{
+			if (fabsf(distances[nIndex] - sqrtf(expectedDistSquareds[nIndex])) > 1e-4f) { allNearest = false; }
+			auto item = std::find_if(reference.begin(), reference.end(), [&](const ReferenceItem_t& other) { return other.value == values[nIndex]; });
+			if (item == reference.end() || fabsf(sqrtf(DistSquaredToRec(item->bounds, point)) - distances[nIndex]) > 1e-4f) { allNearest = false; }
+		}
+	}
+	TestCheck(allRemoves);
+	TestCheck(allMoves);
+	TestCheck(allRecQueries);
+	TestCheck(allTruncated);
+	TestCheck(allPointQueries);
+	TestCheck(allNearest);
+	FreeSpatialGrid(&grid);
+	OC_ArenaCleanup(&arena);
+}
+
+//Queries far outside the used cells have to skip straight to the rings that reach them instead of walking out one ring at a time
+void TestFarQueries()
+{
+	TestSection("k-nearest from far outside the grid");
+	OC_Arena_t arena;
+	OC_ArenaInit(&arena);
+	SpatialGrid_t grid;
+	CreateSpatialGrid(&grid, &arena, 1.0f);
+	SpatialGridInsertPoint(&grid, NewVec2(0, 0), 1);
+	u32 values[2];
+	r32 distances[2];
+	u32 numFound = 0;
+	r64 elapsedMs = TestTimeBestMs(1, [&]() { numFound = SpatialGridFindNearest(&grid, NewVec2(5e7f, 0), 1, values, distances); });
+	TestCheck(numFound == 1 && values[0] == 1 && distances[0] == 5e7f);
+	TestCheckMsg(elapsedMs < 10.0, "%.3f ms", elapsedMs); //walking every ring out to the query took ~400 ms
+	numFound = SpatialGridFindNearest(&grid, NewVec2(-3e7f, -5e7f), 1, values, distances);
+	TestCheck(numFound == 1 && values[0] == 1 && fabsf(distances[0] - sqrtf(3e7f*3e7f + 5e7f*5e7f)) < 16.0f);
+	numFound = SpatialGridFindNearest(&grid, NewVec2(0, 5e7f), 1, values, distances, 100.0f);
+	TestCheck(numFound == 0);
+
+	//Two items, the query is past both of them on one side
+	SpatialGridInsert(&grid, NewRec(10, 10, 2, 2), 2);
+	elapsedMs = TestTimeBestMs(1, [&]() { numFound = SpatialGridFindNearest(&grid, NewVec2(1e6f, 5), 2, values, distances); });
+	TestCheck(numFound == 2 && values[0] == 2 && values[1] == 1);
+	TestCheck(distances[0] == 1e6f - 12.0f && fabsf(distances[1] - sqrtf(1e6f*1e6f + 25.0f)) < 0.5f);
+	TestCheckMsg(elapsedMs < 10.0, "%.3f ms", elapsedMs);
+	//And from inside the used cells nothing changed
+	numFound = SpatialGridFindNearest(&grid, NewVec2(8, 8), 2, values, distances);
+	TestCheck(numFound == 2 && values[0] == 2 && values[1] == 1);
+	FreeSpatialGrid(&grid);
+	OC_ArenaCleanup(&arena);
+}
+
+struct Particle_t
+{
+	v2 position;
+	v2 velocity;
+	u32 handle;
+};
+
+void BenchSpatialGrid()
+{
+	TestSection("Benchmarks (100k moving points, 4096x4096 world, 16 unit cells)");
+	const u32 numParticles = 100000;
+	const u32 numQueries = 1000;
+	const r32 worldSize = 4096;
+	OC_Arena_t arena;
+	OC_ArenaInit(&arena);
+	SpatialGrid_t grid;
+	CreateSpatialGrid(&grid, &arena, 16.0f, numParticles);
+	std::vector<Particle_t> particles(numParticles);
+	for (u32 pIndex = 0; pIndex < numParticles; pIndex++)
+	{
+		particles[pIndex].position = NewVec2(TestRandR32(0, worldSize), TestRandR32(0, worldSize));
+		particles[pIndex].velocity = NewVec2(TestRandR32(-2, 2), TestRandR32(-2, 2));
+		particles[pIndex].handle = SpatialGridInsertPoint(&grid, particles[pIndex].position, pIndex);
+	}
+	std::vector<v2> queryPoints(numQueries);
+	for (v2& queryPoint : queryPoints) { queryPoint = NewVec2(TestRandR32(0, worldSize), TestRandR32(0, worldSize)); }
+	std::vector<u32> values(numParticles);
+	u32 nearest[8];
+	u64 sum = 0;
+
+	auto stepParticles = [&]()
+	{
+		for (Particle_t& particle : particles)
+		{
+			particle.position.x += particle.velocity.x;
+			particle.position.y += particle.velocity.y;
+			if (particle.position.x < 0 || particle.position.x > worldSize) { particle.velocity.x = -particle.velocity.x; }
+			if (particle.position.y < 0 || particle.position.y > worldSize) { particle.velocity.y = -particle.velocity.y; }
+		}
+	};
+	//Per particle, the whole frame's work divided by 100k
+	TestBench("frame", "SpatialGridMovePoint all", 10, numParticles, [&]()
+	{
+		stepParticles();
+		for (Particle_t& particle : particles) { SpatialGridMovePoint(&grid, particle.handle, particle.position); }
+	});
+	TestBench("frame", "move all + rebuild", 10, numParticles, [&]()
+	{
+		stepParticles();
+		for (Particle_t& particle : particles) { SpatialGridMovePoint(&grid, particle.handle, particle.position); }
+		SpatialGridRebuild(&grid);
+	});
+	TestBench("frame", "clear + insert all + rebuild", 10, numParticles, [&]()
+	{
+		stepParticles();
+		SpatialGridClear(&grid);
+		for (u32 pIndex = 0; pIndex < numParticles; pIndex++) { particles[pIndex].handle = SpatialGridInsertPoint(&grid, particles[pIndex].position, pIndex); }
+		SpatialGridRebuild(&grid);
+	});
+
+	TestBench("query", "32x32 rec", 10, numQueries, [&]() { for (v2 queryPoint : queryPoints) { sum += SpatialGridQueryRec(&grid, NewRec(queryPoint.x - 16, queryPoint.y - 16, 32, 32), values.data(), numParticles); } });
+	TestBench("query", "32x32 rec, brute force", 3, numQueries / 10, [&]()
+	{
+		for (u32 qIndex = 0; qIndex < numQueries / 10; qIndex++)
+		{
+			rec query = NewRec(queryPoints[qIndex].x - 16, queryPoints[qIndex].y - 16, 32, 32);
+			for (const Particle_t& particle : particles) { if (RecContains(query, particle.position)) { sum++; } }
+		}
+	});
+	TestBench("query", "point", 10, numQueries, [&]() { for (v2 queryPoint : queryPoints) { sum += SpatialGridQueryPoint(&grid, queryPoint, values.data(), numParticles); } });
+	TestBench("query", "8 nearest", 10, numQueries, [&]() { for (v2 queryPoint : queryPoints) { sum += SpatialGridFindNearest(&grid, queryPoint, 8, nearest); } });
+	TestBench("query", "8 nearest, brute force", 3, numQueries / 10, [&]()
+	{
+		for (u32 qIndex = 0; qIndex < numQueries / 10; qIndex++)
+		{
+			v2 queryPoint = queryPoints[qIndex];
+			r32 best[8];
+			u32 numBest = 0;
+			for (const Particle_t& particle : particles)
+			{
+				v2 offset = particle.position - queryPoint;
+				r32 distSquared = Vec2Dot(offset, offset);
+				if (numBest < 8 || distSquared < best[7])
+				{
+					u32 insertIndex = (numBest < 8) ? numBest++ : 7;
+					while (insertIndex > 0 && best[insertIndex - 1] > distSquared) { best[insertIndex] = best[insertIndex - 1]; insertIndex--; }
+					best[insertIndex] = distSquared;
+				}
+			}
+			sum += (u64)best[0];
+		}
+	});
+	TestDoNotOptimize(sum);
+	FreeSpatialGrid(&grid);
+	OC_ArenaCleanup(&arena);
+}
+
+int main(int argc, char** argv)
+{
+	TestBegin("Spatial grid", argc, argv);
+	TestAgainstBruteForce(10.0f);
+	TestAgainstBruteForce(37.5f);
+	TestAgainstBruteForce(3.0f);
+	TestFarQueries();
+	if (testBenchEnabled) { BenchSpatialGrid(); }
+	return TestEnd();
+}
@@ -0,0 +1,168 @@
+/*
+File:   test_str_intern.cpp
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Interns a long random stream of strings into a StrInternPool_t from
+	** orca_str_intern.h next to a std::unordered_map<std::string, u32> that hands
+	** out ids the same way, starting from an empty pool so the lookup has to grow
+	** and rehash many times. Checks that identical strings always get identical
+	** ids, that ids are dense, that StrInternFind never adds and misses cleanly,
+	** that StrInternGet keeps returning the same bytes at the same address, and
+	** that the empty string is STR_INTERN_INVALID_ID both ways.
+	** With --bench it times interning already seen strings against std::unordered_map
+*/
+
+#include "orca.h"
+#include "../my_orca.h"
+#include "test_common.h"
+
+#include <vector>
+#include <string>
+#include <unordered_map>
+
+//Most keys share a long prefix so the hash and compare both get some work
+int RandomKey(char* buffer, size_t bufferSize, u32 numDistinct)
+{
+	return snprintf(buffer, bufferSize, "%s/%u", (TestRandU32(0, 2) == 0) ? "assets/sprites/characters" : "ev", TestRandU32(0, numDistinct));
+}
+
+void TestEmptyString()
+{
+	TestSection("Empty string and STR_INTERN_INVALID_ID");
+	OC_Arena_t arena;
+	OC_ArenaInit(&arena);
+	StrInternPool_t pool;
+	CreateStrInternPool(&pool, &arena);
+	TestCheck(StrInternCount(&pool) == 0);
+	TestCheck(StrInternGet(&pool, STR_INTERN_INVALID_ID).length == 0);
+	TestCheck(StrIntern(&pool, NewStr("")) == STR_INTERN_INVALID_ID);
+	TestCheck(StrIntern(&pool, NewStr(0, nullptr)) == STR_INTERN_INVALID_ID);
+	TestCheck(StrInternFind(&pool, NewStr("")) == STR_INTERN_INVALID_ID);
+	TestCheck(StrInternCount(&pool) == 0 && pool.lookup.count == 0);
+
+	//The first real string still gets id 1
+	u32 firstId = StrIntern(&pool, NewStr("first"));
+	TestCheck(firstId == 1 && StrInternCount(&pool) == 1);
+	TestCheck(StrIntern(&pool, NewStr("")) == STR_INTERN_INVALID_ID && StrInternCount(&pool) == 1);
+	FreeStrInternPool(&pool);
+	OC_ArenaCleanup(&arena);
+}
+
+void TestAgainstUnorderedMap()
+{
+	TestSection("Random interning vs std::unordered_map");
+	OC_Arena_t arena;
+	OC_ArenaInit(&arena);
+	StrInternPool_t pool;
+	CreateStrInternPool(&pool, &arena);
+	std::unordered_map<std::string, u32> reference;
+	std::vector<const char*> firstPointers = { nullptr };
+	u64 expectedBytes = 0;
+	u32 initialCapacity = pool.lookup.capacity;
+	u32 numGrows = 0;
+	char keyBuffer[64];
+	bool allIds = true, allDense = true, allCopied = true, allFinds = true, allMisses = true, allCounts = true;
+	TestSeedRand(16);
+	for (u32 oIndex = 0; oIndex < 300000; oIndex++)
+	{
+		int keyLength = RandomKey(keyBuffer, sizeof(keyBuffer), 20000);
+		std::string key(keyBuffer, keyLength);
+		MyStr_t keyStr = NewStr((u32)keyLength, keyBuffer);
+		auto found = reference.find(key);
+		if (TestRandU32(0, 4) == 0)
+		{
+			//Find must agree and must never add
+			u32 numBefore = StrInternCount(&pool);
+			u32 foundId = StrInternFind(&pool, keyStr);
+			u32 expectedId = (found != reference.end()) ? found->second : STR_INTERN_INVALID_ID;
+			if (foundId != expectedId) { allFinds = false; }
+			if (found == reference.end() && StrInternCount(&pool) != numBefore) { allMisses = false; }
+		}
+		else
+		{
+			u32 capacityBefore = pool.lookup.capacity;
+			u32 id = StrIntern(&pool, keyStr);
+			if (pool.lookup.capacity != capacityBefore) { numGrows++; }
+			if (found != reference.end())
+			{
+				if (id != found->second) { allIds = false; }
+			}
+			else
+			{
+				//New strings get the next id, like the reference hands out
+				u32 expectedId = (u32)reference.size() + 1;
+				if (id != expectedId) { allDense = false; }
+				reference[key] = expectedId;
+				firstPointers.push_back(StrInternGet(&pool, id).chars);
+				expectedBytes += (u64)keyLength;
+			}
+			keyBuffer[0] = 'X'; //the pool has to have copied the string
+			MyStr_t stored = StrInternGet(&pool, id);
+			if (stored.length != (u32)keyLength || memcmp(stored.chars, key.data(), keyLength) != 0) { allCopied = false; }
+		}
+		if (StrInternCount(&pool) != reference.size()) { allCounts = false; }
+	}
+	TestCheck(allIds);
+	TestCheck(allDense);
+	TestCheck(allCopied);
+	TestCheck(allFinds);
+	TestCheck(allMisses);
+	TestCheck(allCounts);
+	TestCheckMsg(numGrows >= 5 && pool.lookup.capacity > initialCapacity, "%u grows, capacity %u -> %u", numGrows, initialCapacity, pool.lookup.capacity);
+	TestCheck(pool.numBytes == expectedBytes);
+
+	//After all the rehashing every id still gives back the same bytes from the same place
+	bool allStable = true, allRoundTrip = true;
+	for (const auto& pair : reference)
+	{
+		MyStr_t stored = StrInternGet(&pool, pair.second);
+		if (stored.chars != firstPointers[pair.second]) { allStable = false; }
+		if (stored.length != pair.first.size() || memcmp(stored.chars, pair.first.data(), stored.length) != 0) { allRoundTrip = false; }
+		if (StrInternFind(&pool, stored) != pair.second || StrIntern(&pool, stored) != pair.second) { allRoundTrip = false; }
+	}
+	TestCheck(allStable);
+	TestCheck(allRoundTrip);
+
+	//Strings that were never interned
+	TestCheck(StrInternFind(&pool, NewStr("ev/999999")) == STR_INTERN_INVALID_ID);
+	TestCheck(StrInternFind(&pool, NewStr("assets/sprites/character")) == STR_INTERN_INVALID_ID);
+	TestCheck(StrInternCount(&pool) == reference.size());
+	printf("  %u strings, %llu bytes, lookup capacity %u after %u grows\n", StrInternCount(&pool), (unsigned long long)pool.numBytes, pool.lookup.capacity, numGrows);
+	FreeStrInternPool(&pool);
+	OC_ArenaCleanup(&arena);
+}
+
+void BenchStrIntern()
+{
+	TestSection("Benchmarks (100k interns of 10k distinct strings, already seen)");
+	OC_Arena_t arena;
+	OC_ArenaInit(&arena);
+	StrInternPool_t pool;
+	CreateStrInternPool(&pool, &arena);
+	std::unordered_map<std::string, u32> reference;
+	const u32 numOps = 100000;
+	std::vector<std::string> keys(numOps);
+	char keyBuffer[64];
+	for (u32 kIndex = 0; kIndex < numOps; kIndex++)
+	{
+		keys[kIndex].assign(keyBuffer, RandomKey(keyBuffer, sizeof(keyBuffer), 10000));
+		StrIntern(&pool, NewStr((u32)keys[kIndex].size(), keys[kIndex].data()));
+		reference.emplace(keys[kIndex], (u32)reference.size() + 1);
+	}
+	u64 idSum = 0;
+	TestBench("intern", "std::unordered_map", 20, numOps, [&]() { for (const std::string& key : keys) { idSum += reference.find(key)->second; } });
+	TestBench("intern", "StrIntern", 20, numOps, [&]() { for (const std::string& key : keys) { idSum += StrIntern(&pool, NewStr((u32)key.size(), key.data())); } });
+	TestDoNotOptimize(idSum);
+	FreeStrInternPool(&pool);
+	OC_ArenaCleanup(&arena);
+}
+
+int main(int argc, char** argv)
+{
+	TestBegin("String Interning", argc, argv);
+	TestEmptyString();
+	TestAgainstUnorderedMap();
+	if (testBenchEnabled) { BenchStrIntern(); }
+	return TestEnd();
+}
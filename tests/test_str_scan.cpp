@@ -0,0 +1,206 @@
+/*
+File:   test_str_scan.cpp
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Checks the 16-byte-at-a-time string functions in orca_addons.h (BufferEquals,
+	** BufferIsNullTerminated, StrFindChar, StrCountChar, StrFindStr) against naive
+	** byte loops at every start alignment and every length 0-63 (so every tail size),
+	** plus longer buffers. Each test buffer is its own exact-size allocation, so an
+	** ASan build catches any read past the end.
+	** With --bench it times each function on a 16 MB buffer against the byte loop
+	** (and memchr/memcmp where there is one). The numbers are per byte, so Mop/s is MB/s
+*/
+
+#include "orca.h"
+#include "../my_orca.h"
+#include "test_common.h"
+
+#include <vector>
+#include <memory>
+
+bool NaiveBufferEquals(u32 bufferSize, const char* left, const char* right)
+{
+	for (u32 bIndex = 0; bIndex < bufferSize; bIndex++) { if (left[bIndex] != right[bIndex]) { return false; } }
+	return true;
+}
+bool NaiveIsNullTerminated(u32 bufferSize, const char* buffer)
+{
+	for (u32 bIndex = 0; bIndex < bufferSize; bIndex++) { if (buffer[bIndex] == '\0') { return true; } }
+	return false;
+}
+bool NaiveFindChar(u32 length, const char* chars, char target, u32* indexOut, u32 startIndex)
+{
+	for (u32 cIndex = startIndex; cIndex < length; cIndex++) { if (chars[cIndex] == target) { *indexOut = cIndex; return true; } }
+	return false;
+}
+u32 NaiveCountChar(u32 length, const char* chars, char target)
+{
+	u32 result = 0;
+	for (u32 cIndex = 0; cIndex < length; cIndex++) { if (chars[cIndex] == target) { result++; } }
+	return result;
+}
+bool NaiveFindStr(u32 length, const char* chars, u32 targetLength, const char* target, u32* indexOut, u32 startIndex)
+{
+	for (u32 cIndex = startIndex; cIndex + targetLength <= length; cIndex++)
+	{
+		if (NaiveBufferEquals(targetLength, &chars[cIndex], target)) { *indexOut = cIndex; return true; }
+	}
+	return false;
+}
+
+//A few byte values, so matches (and near matches for StrFindStr) are common. 0xE9 checks nothing treats chars as signed
+const char scanAlphabet[] = { 'a', 'b', 'c', '\0', (char)0xE9 };
+INLINE char RandomScanChar() { return scanAlphabet[TestRandU32(0, ArrayCount(scanAlphabet))]; }
+
+void TestAgainstNaive()
+{
+	TestSection("All alignments and lengths vs byte loops");
+	bool allEquals = true, allNullTerm = true, allFindChar = true, allCountChar = true, allFindStr = true, allStrHelpers = true;
+	std::vector<u32> lengths;
+	for (u32 length = 0; length < 64; length++) { lengths.push_back(length); }
+	for (u32 length : { 100u, 255u, 256u, 257u, 1000u, 4111u }) { lengths.push_back(length); }
+	for (u32 length : lengths)
+	{
+		for (u32 offset = 0; offset < 16; offset++)
+		{
+			//Exact size allocations, the offset moves the start off of the allocator's 16-byte alignment
+			std::unique_ptr<char[]> leftAlloc(new char[offset + length]);
+			std::unique_ptr<char[]> rightAlloc(new char[length + 1]);
+			char* left = leftAlloc.get() + offset;
+			char* right = rightAlloc.get() + 1;
+			for (u32 cIndex = 0; cIndex < length; cIndex++) { left[cIndex] = RandomScanChar(); }
+			memcpy(right, left, length);
+			MyStr_t leftStr = NewStr(length, left);
+
+			//BufferEquals: equal, then a difference in every position for the short ones (first, middle and last for the long ones)
+			if (!BufferEquals(length, left, right)) { allEquals = false; }
+			for (u32 dIndex = 0; dIndex < length; dIndex++)
+			{
+				if (length >= 64 && dIndex != 0 && dIndex != length / 2 && dIndex != length - 1) { continue; }
+				right[dIndex] ^= 0x40;
+				if (BufferEquals(length, left, right) != NaiveBufferEquals(length, left, right) || BufferEquals(length, left, right)) { allEquals = false; }
+				right[dIndex] ^= 0x40;
+			}
+			if (length > 0)
+			{
+				if (!StrStartsWith(leftStr, NewStr(length - 1, right)) || !StrEndsWith(leftStr, NewStr(length - 1, right + 1)) || !StrEquals(leftStr, NewStr(length, right))) { allStrHelpers = false; }
+				if (StrStartsWith(NewStr(length - 1, left), leftStr) || StrEquals(NewStr(length - 1, left), NewStr(length - 1, right + 1)) != NaiveBufferEquals(length - 1, left, right + 1)) { allStrHelpers = false; }
+			}
+
+			//BufferIsNullTerminated: as generated, with no zero at all, and with the only zero in the last byte
+			if (BufferIsNullTerminated(length, left) != NaiveIsNullTerminated(length, left)) { allNullTerm = false; }
+			for (u32 cIndex = 0; cIndex < length; cIndex++) { if (right[cIndex] == '\0') { right[cIndex] = 'z'; } }
+			if (BufferIsNullTerminated(length, right)) { allNullTerm = false; }
+			if (length > 0)
+			{
+				right[length - 1] = '\0';
+				if (!BufferIsNullTerminated(length, right)) { allNullTerm = false; }
+			}
+
+			//StrFindChar and StrCountChar for every alphabet char plus one that is never there, from every start index (including past the end)
+			for (char target : { 'a', 'b', '\0', (char)0xE9, 'q' })
+			{
+				if (StrCountChar(leftStr, target) != NaiveCountChar(length, left, target)) { allCountChar = false; }
+				for (u32 startIndex = 0; startIndex <= length + 1; startIndex++)
+				{
+					if (length >= 64 && startIndex > 40 && startIndex + 40 < length) { startIndex = length - 40; }
+					u32 index = UINT32_MAX, expectedIndex = UINT32_MAX;
+					bool found = StrFindChar(leftStr, target, &index, startIndex);
+					bool expectedFound = NaiveFindChar(length, left, target, &expectedIndex, startIndex);
+					if (found != expectedFound || (found && index != expectedIndex)) { allFindChar = false; }
+				}
+			}
+			//Only match in the last byte
+			if (length > 0)
+			{
+				right[length - 1] = 'q';
+				u32 index = UINT32_MAX;
+				if (!StrFindChar(NewStr(length, right), 'q', &index) || index != length - 1 || StrCountChar(NewStr(length, right), 'q') != 1) { allFindChar = false; }
+				memcpy(right, left, length);
+			}
+
+			//StrFindStr with pieces of the buffer (always found), random targets (near misses), the empty target and targets longer than the buffer
+			for (u32 tIndex = 0; tIndex < 12; tIndex++)
+			{
+				u32 targetLength = TestRandU32(0, 20);
+				std::vector<char> target(targetLength + 1);
+				if (tIndex < 4 && targetLength <= length)
+				{
+					u32 sourceIndex = TestRandU32(0, length - targetLength + 1);
+					memcpy(target.data(), &left[sourceIndex], targetLength);
+				}
+				else if (tIndex < 6) { targetLength = length + 1 + tIndex; target.resize(targetLength); memcpy(target.data(), left, length); }
+				else { for (u32 cIndex = 0; cIndex < targetLength; cIndex++) { target[cIndex] = RandomScanChar(); } }
+				for (u32 startIndex = 0; startIndex <= length + 1; startIndex++)
+				{
+					if (length >= 64 && startIndex > 20 && startIndex + 24 < length) { startIndex = length - 24; }
+					u32 index = UINT32_MAX, expectedIndex = UINT32_MAX;
+					bool found = StrFindStr(leftStr, NewStr(targetLength, target.data()), &index, startIndex);
+					bool expectedFound = (targetLength == 0) ? (startIndex <= length) : NaiveFindStr(length, left, targetLength, target.data(), &expectedIndex, startIndex);
+					if (targetLength == 0) { expectedIndex = startIndex; }
+					if (found != expectedFound || (found && index != expectedIndex)) { allFindStr = false; }
+				}
+			}
+			//A target that only matches at the very end
+			if (length >= 2)
+			{
+				right[length - 1] = 'q';
+				MyStr_t target = NewStr(2, &right[length - 2]);
+				u32 index = UINT32_MAX;
+				if (!StrFindStr(NewStr(length, right), target, &index, length - 2) || index != length - 2) { allFindStr = false; }
+				if (!StrFindStr(NewStr(length, right), target, &index) || index != length - 2) { allFindStr = false; }
+				if (StrFindStr(NewStr(length, right), target, &index, length - 1)) { allFindStr = false; }
+				memcpy(right, left, length);
+			}
+		}
+	}
+	TestCheck(allEquals);
+	TestCheck(allStrHelpers);
+	TestCheck(allNullTerm);
+	TestCheck(allFindChar);
+	TestCheck(allCountChar);
+	TestCheck(allFindStr);
+	TestCheck(BufferEquals(0, nullptr, nullptr) && !BufferIsNullTerminated(0, nullptr) && !StrFindChar(NewStr(0, nullptr), 'a') && StrCountChar(NewStr(0, nullptr), 'a') == 0);
+}
+
+void BenchStrScan()
+{
+	TestSection("Benchmarks (16 MB of printable text, per byte)");
+	const u32 bufferSize = 16 * 1024 * 1024;
+	std::vector<char> buffer(bufferSize), copy(bufferSize);
+	for (u32 cIndex = 0; cIndex < bufferSize; cIndex++) { buffer[cIndex] = (char)TestRandU32(' ', '~'); } //never '~', so searches for it scan everything
+	memcpy(copy.data(), buffer.data(), bufferSize);
+	MyStr_t str = NewStr(bufferSize, buffer.data());
+	//8 chars that never show up together, the first and last chars are common so StrFindStr has candidates to reject
+	const char* needle = "e!~~~~~e";
+	u64 sum = 0;
+
+	TestBench("find char", "StrFindChar", 5, bufferSize, [&]() { u32 index = 0; sum += StrFindChar(str, '~', &index); });
+	TestBench("find char", "byte loop", 3, bufferSize, [&]() { u32 index = 0; sum += NaiveFindChar(bufferSize, buffer.data(), '~', &index, 0); });
+	TestBench("find char", "memchr", 5, bufferSize, [&]() { sum += (memchr(buffer.data(), '~', bufferSize) != nullptr); });
+
+	TestBench("count char", "StrCountChar", 5, bufferSize, [&]() { sum += StrCountChar(str, 'e'); });
+	TestBench("count char", "byte loop", 3, bufferSize, [&]() { sum += NaiveCountChar(bufferSize, buffer.data(), 'e'); });
+
+	TestBench("find str", "StrFindStr, 8 chars", 5, bufferSize, [&]() { u32 index = 0; sum += StrFindStr(str, NewStr(needle), &index); });
+	TestBench("find str", "byte loop", 3, bufferSize, [&]() { u32 index = 0; sum += NaiveFindStr(bufferSize, buffer.data(), 8, needle, &index, 0); });
+	TestBench("find str", "memmem", 5, bufferSize, [&]() { sum += (memmem(buffer.data(), bufferSize, needle, 8) != nullptr); });
+
+	TestBench("equals", "BufferEquals", 5, bufferSize, [&]() { sum += BufferEquals(bufferSize, buffer.data(), copy.data()); });
+	TestBench("equals", "byte loop", 3, bufferSize, [&]() { sum += NaiveBufferEquals(bufferSize, buffer.data(), copy.data()); });
+	TestBench("equals", "memcmp", 5, bufferSize, [&]() { sum += (memcmp(buffer.data(), copy.data(), bufferSize) == 0); });
+
+	TestBench("null term", "BufferIsNullTerm", 5, bufferSize, [&]() { sum += BufferIsNullTerminated(bufferSize, buffer.data()); });
+	TestBench("null term", "byte loop", 3, bufferSize, [&]() { sum += NaiveIsNullTerminated(bufferSize, buffer.data()); });
+	TestBench("null term", "memchr", 5, bufferSize, [&]() { sum += (memchr(buffer.data(), '\0', bufferSize) != nullptr); });
+	TestDoNotOptimize(sum);
+}
+
+int main(int argc, char** argv)
+{
+	TestBegin("String scanning", argc, argv);
+	TestAgainstNaive();
+	if (testBenchEnabled) { BenchStrScan(); }
+	return TestEnd();
+}
@@ -0,0 +1,294 @@
+/*
+File:   test_unicode.cpp
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Checks the UTF-8 <=> UTF-32 converters in orca_unicode.h against a separate
+	** reference decoder written from the well-formed byte sequence table in the
+	** Unicode standard (table 3-7), on hand picked invalid sequences and on random
+	** byte soup mixed with ASCII runs so the 16-wide fast path starts and stops
+	** everywhere. Outputs are exact-size heap buffers, so make test SANITIZE=1
+	** catches any write past maxNumCodepoints/maxNumBytes when the output is too small.
+	** With --bench it times both directions against a per-codepoint loop
+*/
+
+#include "orca.h"
+#include "../my_orca.h"
+#include "test_common.h"
+
+#include <vector>
+#include <string>
+
+//Returns the number of codepoints decoded, stops at the first ill-formed sequence and stores its byte index in errorIndexOut (or UINT32_MAX)
+u32 ReferenceDecode(const std::vector<u8>& bytes, std::vector<u32>* codepointsOut, u32* errorIndexOut)
+{
+	codepointsOut->clear();
+	*errorIndexOut = UINT32_MAX;
+	u32 bIndex = 0;
+	while (bIndex < bytes.size())
+	{
+		u32 numLeft = (u32)bytes.size() - bIndex;
+		u8 b0 = bytes[bIndex];
+		u8 b1 = (numLeft > 1) ? bytes[bIndex+1] : 0;
+		u8 b2 = (numLeft > 2) ? bytes[bIndex+2] : 0;
+		u8 b3 = (numLeft > 3) ? bytes[bIndex+3] : 0;
+		u32 size = 0;
+		u8 secondMin = 0x80, secondMax = 0xBF;
+		if (b0 <= 0x7F) { size = 1; }
+		else if (b0 >= 0xC2 && b0 <= 0xDF) { size = 2; }
+		else if (b0 >= 0xE0 && b0 <= 0xEF) { size = 3; if (b0 == 0xE0) { secondMin = 0xA0; } if (b0 == 0xED) { secondMax = 0x9F; } }
+		else if (b0 >= 0xF0 && b0 <= 0xF4) { size = 4; if (b0 == 0xF0) { secondMin = 0x90; } if (b0 == 0xF4) { secondMax = 0x8F; } }
+		bool valid = (size > 0 && numLeft >= size);
+		if (valid && size >= 2 && (b1 < secondMin || b1 > secondMax)) { valid = false; }
+		if (valid && size >= 3 && (b2 < 0x80 || b2 > 0xBF)) { valid = false; }
+		if (valid && size >= 4 && (b3 < 0x80 || b3 > 0xBF)) { valid = false; }
+		if (!valid) { *errorIndexOut = bIndex; break; }
+		u32 codepoint = 0;
+		if (size == 1) { codepoint = b0; }
+		if (size == 2) { codepoint = ((b0 & 0x1F) << 6) | (b1 & 0x3F); }
+		if (size == 3) { codepoint = ((b0 & 0x0F) << 12) | ((b1 & 0x3F) << 6) | (b2 & 0x3F); }
+		if (size == 4) { codepoint = ((b0 & 0x07) << 18) | ((b1 & 0x3F) << 12) | ((b2 & 0x3F) << 6) | (b3 & 0x3F); }
+		codepointsOut->push_back(codepoint);
+		bIndex += size;
+	}
+	return (u32)codepointsOut->size();
+}
+
+std::vector<u8> BytesFromStr(const char* str) { return std::vector<u8>(str, str + strlen(str)); }
+
+//Decodes into an exact-size heap buffer and checks everything against ReferenceDecode
+bool CheckDecode(const std::vector<u8>& bytes)
+{
+	std::vector<u32> expected;
+	u32 expectedError = 0;
+	ReferenceDecode(bytes, &expected, &expectedError);
+	u8* heapBytes = (u8*)malloc(bytes.size() + 1);
+	if (!bytes.empty()) { memcpy(heapBytes, bytes.data(), bytes.size()); }
+	u32* codepoints = (u32*)malloc((bytes.size() + 1) * sizeof(u32));
+	MyStr_t str = NewStr((u32)bytes.size(), (char*)heapBytes);
+	u32 numCodepoints = 0, errorIndex = 12345, numCounted = 0;
+	bool success = ConvertUtf8ToUtf32(str, codepoints, (u32)bytes.size(), &numCodepoints, &errorIndex);
+	bool countSuccess = ConvertUtf8ToUtf32(str, nullptr, 0, &numCounted);
+	bool result = (success == (expectedError == UINT32_MAX) && countSuccess == success && numCounted == numCodepoints);
+	if (numCodepoints != expected.size() || (!success && errorIndex != expectedError)) { result = false; }
+	if (result && !expected.empty() && memcmp(codepoints, expected.data(), expected.size() * sizeof(u32)) != 0) { result = false; }
+	free(heapBytes);
+	free(codepoints);
+	return result;
+}
+
+void TestDecode()
+{
+	TestSection("UTF-8 to UTF-32 vs reference decoder");
+	const char* validStrs[] = {
+		"", "a", "hello world", "caf\xC3\xA9", "\xE4\xB8\xAD\xE6\x96\x87", "\xF0\x9F\x98\x80", "\xF4\x8F\xBF\xBF", "\xEF\xBF\xBF", "\xED\x9F\xBF",
+		"The quick brown fox jumps over\xC2\x80 the lazy dog, then \xE2\x82\xAC again and again and again.",
+	};
+	bool allValid = true;
+	for (const char* validStr : validStrs) { if (!CheckDecode(BytesFromStr(validStr))) { allValid = false; printf("  mismatch on \"%s\"\n", validStr); } }
+	TestCheck(allValid);
+	//Overlong, surrogates, past U+10FFFF, stray continuations, truncated sequences, each after a full ASCII block so the fast path is involved
+	const char* invalidStrs[] = {
+		"\xC0\x80", "\xC1\xBF", "\xE0\x9F\xBF", "\xF0\x8F\xBF\xBF", "\xED\xA0\x80", "\xED\xBF\xBF", "\xF4\x90\x80\x80", "\xF5\x80\x80\x80", "\xFF",
+		"\x80", "\xBF", "\xC3", "\xE4\xB8", "\xF0\x9F\x98", "\xC3\x28", "\xE4\x28\xAD",
+	};
+	bool allInvalid = true;
+	for (const char* invalidStr : invalidStrs)
+	{
+		std::vector<u8> bytes = BytesFromStr("0123456789abcdefXYZ");
+		std::vector<u8> tail = BytesFromStr(invalidStr);
+		bytes.insert(bytes.end(), tail.begin(), tail.end());
+		std::vector<u32> expected;
+		u32 expectedError = 0;
+		ReferenceDecode(bytes, &expected, &expectedError);
+		if (expectedError != 19 || !CheckDecode(bytes)) { allInvalid = false; }
+	}
+	TestCheck(allInvalid);
+
+	//Random mixes of ASCII runs, valid multi-byte characters and the odd random byte
+	const u32 multiByteChars[] = { 0xE9, 0x7FF, 0x800, 0x4E2D, 0xFFFD, 0xFFFF, 0x10000, 0x1F600, 0x10FFFF };
+	bool allRandom = true;
+	u32 numInvalid = 0;
+	for (u32 tIndex = 0; tIndex < 20000; tIndex++)
+	{
+		std::vector<u8> bytes;
+		u32 numPieces = TestRandU32(1, 12);
+		for (u32 pIndex = 0; pIndex < numPieces; pIndex++)
+		{
+			u32 pieceType = TestRandU32(0, 10);
+			if (pieceType < 5) { u32 runLength = TestRandU32(0, 40); for (u32 i = 0; i < runLength; i++) { bytes.push_back((u8)TestRandU32(0x20, 0x7F)); } }
+			else if (pieceType < 9)
+			{
+				u8 encoded[UTF8_MAX_CHAR_SIZE];
+				u8 size = GetUtf8BytesForCodepoint(multiByteChars[TestRandU32(0, ArrayCount(multiByteChars))], encoded);
+				bytes.insert(bytes.end(), encoded, encoded + size);
+			}
+			else if (TestRandU32(0, 4) == 0) { bytes.push_back((u8)TestRandU32(0x80, 0x100)); }
+		}
+		std::vector<u32> expected;
+		u32 expectedError = 0;
+		ReferenceDecode(bytes, &expected, &expectedError);
+		if (expectedError != UINT32_MAX) { numInvalid++; }
+		if (!CheckDecode(bytes)) { allRandom = false; }
+	}
+	printf("  20000 random strings, %u of them invalid\n", numInvalid);
+	TestCheck(allRandom);
+}
+
+void TestEncode()
+{
+	TestSection("UTF-32 to UTF-8");
+	OC_Arena_t arena;
+	OC_ArenaInit(&arena);
+	bool allRoundTrips = true;
+	for (u32 tIndex = 0; tIndex < 2000; tIndex++)
+	{
+		std::vector<u32> codepoints;
+		u32 numCodepoints = TestRandU32(0, 80);
+		for (u32 cIndex = 0; cIndex < numCodepoints; cIndex++)
+		{
+			u32 codepoint = (TestRandU32(0, 3) != 0) ? TestRandU32(0x20, 0x80) : TestRandU32(0x80, UNICODE_MAX_CODEPOINT + 1);
+			if (codepoint >= 0xD800 && codepoint <= 0xDFFF) { codepoint = 0xFFFD; }
+			codepoints.push_back(codepoint);
+		}
+		oc_str32 codepointsStr = { codepoints.data(), codepoints.size() };
+		MyStr_t encoded = PushUtf32ToUtf8(&arena, codepointsStr);
+		oc_str32 decoded = PushUtf8ToUtf32(&arena, encoded);
+		if (decoded.len != codepoints.size() || (decoded.len > 0 && memcmp(decoded.ptr, codepoints.data(), decoded.len * sizeof(u32)) != 0)) { allRoundTrips = false; }
+		if (encoded.chars != nullptr && encoded.chars[encoded.length] != '\0') { allRoundTrips = false; }
+	}
+	TestCheck(allRoundTrips);
+
+	u32 badCodepoints[20];
+	for (u32 cIndex = 0; cIndex < ArrayCount(badCodepoints); cIndex++) { badCodepoints[cIndex] = 'a'; }
+	u32 numBytes = 0, errorIndex = 0;
+	badCodepoints[17] = 0xD800;
+	TestCheck(!ConvertUtf32ToUtf8(badCodepoints, 20, nullptr, 0, &numBytes, &errorIndex) && errorIndex == 17 && numBytes == 17);
+	badCodepoints[17] = 0x110000;
+	TestCheck(!ConvertUtf32ToUtf8(badCodepoints, 20, nullptr, 0, &numBytes, &errorIndex) && errorIndex == 17);
+	badCodepoints[17] = 0x80000000;
+	TestCheck(!ConvertUtf32ToUtf8(badCodepoints, 20, nullptr, 0, &numBytes, &errorIndex) && errorIndex == 17);
+	badCodepoints[3] = 0xFFFFFFFF;
+	TestCheck(!ConvertUtf32ToUtf8(badCodepoints, 20, nullptr, 0, &numBytes, &errorIndex) && errorIndex == 3);
+	oc_str32 badStr = { badCodepoints, 20 };
+	TestCheck(PushUtf32ToUtf8(&arena, badStr).length == 0);
+
+	//Invalid UTF-8 must not leave anything pushed, valid text pushes exactly one u32 per codepoint
+	u64 offsetBefore = arena.currentChunk->offset;
+	u32 pushErrorIndex = 0;
+	oc_str32 badDecoded = PushUtf8ToUtf32(&arena, NewStr("0123456789abcdefXYZ\xE4\x28\xAD"), &pushErrorIndex);
+	TestCheck(badDecoded.ptr == nullptr && badDecoded.len == 0 && pushErrorIndex == 19);
+	TestCheck(arena.currentChunk->offset == offsetBefore);
+	oc_str32 goodDecoded = PushUtf8ToUtf32(&arena, NewStr("ab\xC3\xA9\xE4\xB8\xAD"));
+	TestCheck(goodDecoded.len == 4 && goodDecoded.ptr[2] == 0xE9 && (u64)((u8*)(goodDecoded.ptr + 4) - (u8*)arena.currentChunk->ptr) == arena.currentChunk->offset);
+	OC_ArenaCleanup(&arena);
+}
+
+//Every output size from 0 up to what's needed, into exact-size heap buffers so ASan sees any write past the end
+void TestOutputCapacity()
+{
+	TestSection("Output too small");
+	//ASCII runs long enough for the 16-wide path on both sides of the multi-byte characters
+	const char* text = "0123456789abcdefghij\xC3\xA9\xE4\xB8\xAD\xF0\x9F\x98\x80klmnopqrstuvwxyz0123456789ABCDEF!";
+	std::vector<u8> bytes = BytesFromStr(text);
+	std::vector<u32> expected;
+	u32 expectedError = 0;
+	u32 numExpected = ReferenceDecode(bytes, &expected, &expectedError);
+	MyStr_t str = NewStr((u32)bytes.size(), (char*)bytes.data());
+
+	bool allDecodeTruncated = true;
+	for (u32 maxNumCodepoints = 0; maxNumCodepoints <= numExpected; maxNumCodepoints++)
+	{
+		u32* codepoints = (u32*)malloc(MaxU32(maxNumCodepoints, 1) * sizeof(u32));
+		u32 numCodepoints = 0, errorIndex = 0;
+		bool ranOutOfRoom = false;
+		bool success = ConvertUtf8ToUtf32(str, codepoints, maxNumCodepoints, &numCodepoints, &errorIndex, &ranOutOfRoom);
+		bool fits = (maxNumCodepoints >= numExpected);
+		if (success != fits || ranOutOfRoom == fits) { allDecodeTruncated = false; }
+		if (numCodepoints != (fits ? numExpected : maxNumCodepoints)) { allDecodeTruncated = false; }
+		if (numCodepoints > 0 && memcmp(codepoints, expected.data(), numCodepoints * sizeof(u32)) != 0) { allDecodeTruncated = false; }
+		//errorIndex is where the first codepoint that didn't fit starts, so converting the rest from there finishes the job
+		if (!fits)
+		{
+			u32 numRest = 0;
+			MyStr_t rest = NewStr(str.length - errorIndex, str.chars + errorIndex);
+			if (!ConvertUtf8ToUtf32(rest, nullptr, 0, &numRest) || numCodepoints + numRest != numExpected) { allDecodeTruncated = false; }
+		}
+		free(codepoints);
+	}
+	TestCheck(allDecodeTruncated);
+
+	bool allEncodeTruncated = true;
+	for (u32 maxNumBytes = 0; maxNumBytes <= bytes.size(); maxNumBytes++)
+	{
+		char* encoded = (char*)malloc(MaxU32(maxNumBytes, 1));
+		u32 numBytes = 0, errorIndex = 0;
+		bool ranOutOfRoom = false;
+		bool success = ConvertUtf32ToUtf8(expected.data(), numExpected, encoded, maxNumBytes, &numBytes, &errorIndex, &ranOutOfRoom);
+		bool fits = (maxNumBytes >= bytes.size());
+		if (success != fits || ranOutOfRoom == fits) { allEncodeTruncated = false; }
+		if (numBytes > maxNumBytes || (fits && numBytes != bytes.size())) { allEncodeTruncated = false; }
+		if (numBytes > 0 && memcmp(encoded, bytes.data(), numBytes) != 0) { allEncodeTruncated = false; }
+		//Only whole characters get written, so what's there is always valid UTF-8 ending where the next codepoint starts
+		u32 numWhole = 0;
+		if (!ConvertUtf8ToUtf32(NewStr(numBytes, encoded), nullptr, 0, &numWhole) || (!fits && numWhole != errorIndex)) { allEncodeTruncated = false; }
+		free(encoded);
+	}
+	TestCheck(allEncodeTruncated);
+}
+
+//What converting text looked like before these functions: decode or encode every codepoint on its own
+u32 PerCodepointUtf8ToUtf32(MyStr_t str, u32* codepointsOut)
+{
+	u32 numCodepoints = 0;
+	for (u32 bIndex = 0; bIndex < str.length; )
+	{
+		u32 codepoint = 0;
+		u8 charSize = GetCodepointForUtf8(str.length - bIndex, &str.bytes[bIndex], &codepoint);
+		if (charSize == 0) { break; }
+		codepointsOut[numCodepoints++] = codepoint;
+		bIndex += charSize;
+	}
+	return numCodepoints;
+}
+u32 PerCodepointUtf32ToUtf8(const u32* codepoints, u32 numCodepoints, char* bytesOut)
+{
+	u32 numBytes = 0;
+	for (u32 cIndex = 0; cIndex < numCodepoints; cIndex++) { numBytes += GetUtf8BytesForCodepoint(codepoints[cIndex], (u8*)&bytesOut[numBytes]); }
+	return numBytes;
+}
+
+void BenchUnicode()
+{
+	TestSection("Benchmarks (1MB of text, per byte of UTF-8)");
+	const char* units[] = {
+		"The quick brown fox jumps over the lazy dog. Score: 12345, FPS: 60.0\n",
+		"Le c\xC5\x93ur d\xC3\xA9\xC3\xA7u mais l'\xC3\xA2me plut\xC3\xB4t na\xC3\xAFve, Lou\xC3\xBFs r\xC3\xAAva de crapa\xC3\xBCter en cano\xC3\xAB au del\xC3\xA0 des \xC3\xAEles. ",
+		"\xE5\xA4\xA9\xE5\x9C\xB0\xE7\x8E\x84\xE9\xBB\x84\xEF\xBC\x8C\xE5\xAE\x87\xE5\xAE\x99\xE6\xB4\xAA\xE8\x8D\x92\xE3\x80\x82",
+	};
+	const char* groupNames[] = { "ascii", "latin", "cjk" };
+	std::vector<u32> codepoints(1 << 21);
+	for (u32 uIndex = 0; uIndex < ArrayCount(units); uIndex++)
+	{
+		std::string text;
+		while (text.size() < (1 << 20)) { text += units[uIndex]; }
+		MyStr_t str = NewStr((u32)text.size(), text.data());
+		std::vector<char> back(text.size());
+		u32 numCodepoints = 0, numBytes = 0;
+		TestBench(groupNames[uIndex], "ConvertUtf8ToUtf32", 20, str.length, [&]() { ConvertUtf8ToUtf32(str, codepoints.data(), (u32)codepoints.size(), &numCodepoints); });
+		TestBench(groupNames[uIndex], "per-codepoint 8 to 32", 20, str.length, [&]() { numCodepoints = PerCodepointUtf8ToUtf32(str, codepoints.data()); });
+		TestBench(groupNames[uIndex], "ConvertUtf32ToUtf8", 20, str.length, [&]() { ConvertUtf32ToUtf8(codepoints.data(), numCodepoints, back.data(), (u32)back.size(), &numBytes); });
+		TestBench(groupNames[uIndex], "per-codepoint 32 to 8", 20, str.length, [&]() { numBytes = PerCodepointUtf32ToUtf8(codepoints.data(), numCodepoints, back.data()); });
+		TestCheck(numBytes == str.length && memcmp(back.data(), str.chars, str.length) == 0);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	TestBegin("UTF-8 and UTF-32 conversion", argc, argv);
+	TestDecode();
+	TestEncode();
+	TestOutputCapacity();
+	if (testBenchEnabled) { BenchUnicode(); }
+	return TestEnd();
+}
@@ -0,0 +1,171 @@
+/*
+File:   test_var_array.cpp
+Author: Taylor Robbins
+Date:   10\17\2026
+Description:
+	** Runs a long random sequence of push/insert/remove/swap-remove/pop/append on
+	** a VarArray_t from orca_var_array.h next to a std::vector and checks they always
+	** agree. Also checks that growing in place only happens when the array is the
+	** last thing pushed to its arena, and that the items survive a grow that moves.
+	** With --bench it times pushing 1M items with and without in-place growth
+*/
+
+#include "orca.h"
+#include "../my_orca.h"
+#include "test_common.h"
+
+#include <vector>
+
+struct Item_t
+{
+	u32 index;
+	u32 value;
+	r32 weight;
+};
+
+void TestAgainstVector()
+{
+	TestSection("Random operations vs std::vector");
+	OC_Arena_t arena;
+	OC_ArenaInit(&arena);
+	VarArray_t array;
+	CreateVarArrayType(&array, &arena, u32, 0);
+	std::vector<u32> reference;
+	bool allPops = true;
+	for (u32 oIndex = 0; oIndex < 20000; oIndex++)
+	{
+		u32 value = TestRandU32();
+		u32 operation = TestRandU32(0, 10);
+		if (operation < 5 || reference.empty()) { *VarArrayPush(&array, u32) = value; reference.push_back(value); }
+		else if (operation == 5)
+		{
+			u64 index = TestRandU32(0, (u32)reference.size() + 1);
+			*VarArrayInsert(&array, index, u32) = value;
+			reference.insert(reference.begin() + index, value);
+		}
+		else if (operation == 6)
+		{
+			u64 index = TestRandU32(0, (u32)reference.size());
+			VarArraySwapRemove(&array, index);
+			reference[index] = reference.back();
+			reference.pop_back();
+		}
+		else if (operation == 7)
+		{
+			u64 index = TestRandU32(0, (u32)reference.size());
+			VarArrayRemove(&array, index);
+			reference.erase(reference.begin() + index);
+		}
+		else if (operation == 8)
+		{
+			u32 popped = 0;
+			if (!VarArrayPop(&array, &popped) || popped != reference.back()) { allPops = false; }
+			reference.pop_back();
+		}
+		else
+		{
+			u32 bulk[7] = { 1, 2, 3, 4, 5, 6, value };
+			VarArrayAppend(&array, bulk, ArrayCount(bulk));
+			reference.insert(reference.end(), bulk, bulk + ArrayCount(bulk));
+		}
+	}
+	TestCheck(allPops);
+	TestCheck(array.length == reference.size());
+	bool allMatch = (array.length == reference.size());
+	VarArrayLoop(&array, iIndex) { if (*VarArrayGet(&array, iIndex, u32) != reference[iIndex]) { allMatch = false; break; } }
+	TestCheck(allMatch);
+	TestCheck(array.numGrowsMoved == 0 && array.numGrowsInPlace > 0); //nothing else pushes to this arena
+	printf("  length %llu, capacity %llu, %u grows in place, %u moved\n", (unsigned long long)array.length, (unsigned long long)array.capacity, array.numGrowsInPlace, array.numGrowsMoved);
+
+	VarArrayClear(&array);
+	u32 ignored;
+	TestCheck(array.length == 0 && !VarArrayPop(&array, &ignored));
+	FreeVarArray(&array);
+	OC_ArenaCleanup(&arena);
+}
+
+void TestGrowth()
+{
+	TestSection("In place and moving growth");
+	OC_Arena_t arena;
+	OC_ArenaInit(&arena);
+	VarArray_t array;
+	CreateVarArrayType(&array, &arena, Item_t, 4);
+	for (u32 iIndex = 0; iIndex < 4; iIndex++) { *VarArrayPush(&array, Item_t) = { iIndex, iIndex * 3, 0.5f }; }
+	Item_t* before = VarArrayGet(&array, 0, Item_t);
+	*VarArrayPush(&array, Item_t) = { 4, 12, 0.5f };
+	TestCheck(VarArrayGet(&array, 0, Item_t) == before && array.numGrowsInPlace == 1);
+
+	OC_ArenaPush(&arena, 1); //something else now sits after the items, so the next grow has to move them
+	VarArrayExpand(&array, array.capacity + 1);
+	TestCheck(VarArrayGet(&array, 0, Item_t) != before && array.numGrowsMoved == 1);
+	bool allKept = true;
+	VarArrayLoop(&array, iIndex) { Item_t* item = VarArrayGet(&array, iIndex, Item_t); if (item->index != iIndex || item->value != iIndex * 3) { allKept = false; } }
+	TestCheck(allKept && array.length == 5);
+	TestCheck(VarArrayLast(&array, Item_t)->index == 4);
+	TestCheck(((uintptr_t)VarArrayGet(&array, 0, Item_t) % alignof(Item_t)) == 0);
+	FreeVarArray(&array);
+	OC_ArenaCleanup(&arena);
+}
+
+void BenchVarArray()
+{
+	TestSection("Benchmarks (pushing 1M 12-byte items, per push)");
+	const u32 numItems = 1000000;
+	TestBench("push 1M", "malloc, +4096 items and copy", 3, numItems, [&]()
+	{
+		u64 capacity = 0, length = 0;
+		Item_t* items = nullptr;
+		for (u32 iIndex = 0; iIndex < numItems; iIndex++)
+		{
+			if (length == capacity)
+			{
+				Item_t* newItems = (Item_t*)malloc((capacity + 4096) * sizeof(Item_t));
+				if (length > 0) { memcpy(newItems, items, length * sizeof(Item_t)); }
+				free(items);
+				items = newItems;
+				capacity += 4096;
+			}
+			items[length++] = { iIndex, iIndex, 0.0f };
+		}
+		TestDoNotOptimize(items[numItems/2].value);
+		free(items);
+	});
+	OC_Arena_t arena;
+	OC_ArenaInit(&arena);
+	//Another push lands right after the array before every grow, so each one has to move
+	TestBench("push 1M", "VarArray_t, always moved", 3, numItems, [&]()
+	{
+		OC_ArenaClear(&arena);
+		VarArray_t array;
+		CreateVarArrayType(&array, &arena, Item_t, 0);
+		for (u32 iIndex = 0; iIndex < numItems; iIndex++)
+		{
+			if (array.length == array.capacity) { VarArrayExpand(&array, array.length + 1); OC_ArenaPush(&arena, 1); }
+			*VarArrayPush(&array, Item_t) = { iIndex, iIndex, 0.0f };
+		}
+	});
+	TestBench("push 1M", "VarArray_t, grows in place", 3, numItems, [&]()
+	{
+		OC_ArenaClear(&arena);
+		VarArray_t array;
+		CreateVarArrayType(&array, &arena, Item_t, 0);
+		for (u32 iIndex = 0; iIndex < numItems; iIndex++) { *VarArrayPush(&array, Item_t) = { iIndex, iIndex, 0.0f }; }
+	});
+	TestBench("push 1M", "std::vector", 3, numItems, [&]()
+	{
+		std::vector<Item_t> items;
+		for (u32 iIndex = 0; iIndex < numItems; iIndex++) { items.push_back({ iIndex, iIndex, 0.0f }); }
+		TestDoNotOptimize(items[numItems/2].value);
+	});
+	OC_ArenaCleanup(&arena);
+}
+
+int main(int argc, char** argv)
+{
+	TestBegin("Variable length array", argc, argv);
+	TestAgainstVector();
+	TestGrowth();
+	if (testBenchEnabled) { BenchVarArray(); }
+	return TestEnd();
+}